@@ -40,11 +40,18 @@
 #define BPLIB_AS_NUM_NODE_CNTRS      (76u)                    /** \brief Number of node counters (also total number of counters) */
 #define BPLIB_AS_NUM_SOURCE_CNTRS    (56u)                    /** \brief Number of source counters */
 #define BPLIB_AS_NODE_CNTR_INDICATOR (BPLIB_MAX_NUM_MIB_SETS) /** \brief Indicates that only the node counter passed in should be modified, not the source counter */
+#define BPLIB_AS_INVALID_SLOT        (0xFFFFu)                /** \brief Slot for EIDs that have no node or source counters */
 
 /* ======= */
 /* Typdefs */
 /* ======= */
 
+/**
+  * \brief  Counter slot an EID resolves to: an index into the source MIB array,
+  *         BPLIB_AS_NODE_CNTR_INDICATOR for node counters or BPLIB_AS_INVALID_SLOT
+  */
+typedef uint16_t BPLib_AS_Slot_t;
+
 /**
   * \brief  Used to as indices into the counter arrays in the node and source payloads
   * \anchor BPLib_AS_Counter_t
@@ -72,7 +79,7 @@ typedef enum
     BUNDLE_COUNT_DELETED_UNAUTHORIZED      = 17, /** \brief Number of Bundles deleted due to having a unrecognized source EID. Incremented if the bundle is not in the set of authorized source EIDs configured for the node. */
     BUNDLE_COUNT_DELETED_UNINTELLIGIBLE    = 18, /** \brief Number of Bundles Deletions due to Block Unintelligible Condition */
     BUNDLE_COUNT_DELETED_UNSUPPORTED_BLOCK = 19, /** \brief Number of Bundles Deletions due to Unsupported Block Condition */
-    BUNDLE_COUNT_DELIVERED                 = 20, /** \brief Total number of Bundles Delivered to this node, including fragments */
+    BUNDLE_COUNT_DELIVERED                 = 20, /** \brief Total number of Bundles Delivered to this node, a reassembled bundle counts once */
     BUNDLE_COUNT_DEPLETED                  = 21, /** \brief Number of bundles for which rejected Custody Signals generated indicating rejection due to depleted storage */
     BUNDLE_COUNT_DISCARDED                 = 22, /** \brief Number of Bundles Discarded */
     BUNDLE_COUNT_FORWARDED                 = 23, /** \brief Number of Bundles Forwarded to another DTN Node */
@@ -132,6 +139,42 @@ typedef enum
     BUNDLE_COUNT_RECEIVED_CRS              = 75, /** \brief Number of Compressed Reporting Signals (CRSs) received since last counter reset. */
 } BPLib_AS_Counter_t;
 
+/**
+  * \brief  Traffic directions tracked by the throughput rate estimator
+  * \anchor BPLib_AS_TrafficDir_t
+  */
+typedef enum
+{
+    BPLIB_AS_TRAFFIC_INGRESS          = 0, /** \brief Bundles received from a contact (CLA), identified by contact ID */
+    BPLIB_AS_TRAFFIC_INGRESS_REJECTED = 1, /** \brief Bundles received from a contact and then rejected */
+    BPLIB_AS_TRAFFIC_EGRESS           = 2, /** \brief Bundles forwarded to a contact */
+    BPLIB_AS_TRAFFIC_INGESTED         = 3, /** \brief ADUs ingested locally, identified by channel ID */
+    BPLIB_AS_TRAFFIC_DELIVERED        = 4, /** \brief ADUs delivered locally to a channel */
+    BPLIB_AS_NUM_TRAFFIC_DIRS         = 5  /** \brief Number of traffic directions */
+} BPLib_AS_TrafficDir_t;
+
+/**
+  * \brief  Smoothed throughput rate
+  * \anchor BPLib_AS_Rate_t
+  */
+typedef struct
+{
+    uint32_t BytesPerSec;   /** \brief Bytes per second */
+    uint32_t BundlesPerSec; /** \brief Bundles per second */
+} BPLib_AS_Rate_t;
+
+/**
+  * \brief  Source EID hash table statistics
+  * \anchor BPLib_AS_SourceCacheStats_t
+  */
+typedef struct
+{
+    uint32_t Misses;    /** \brief Lookups that had to scan the MIB array keys */
+    uint32_t Inserts;   /** \brief Source EIDs added to the table */
+    uint32_t Evictions; /** \brief Entries evicted to make room for another source EID */
+    uint32_t Flushes;   /** \brief Times the table was invalidated by a MIB array key change */
+} BPLib_AS_SourceCacheStats_t;
+
 /**
  * \brief  Node MIB counters housekeeping payload
  * \anchor BPLib_NodeMibCountersHkTlm_Payload_t
@@ -241,7 +284,8 @@ BPLib_Status_t BPLib_AS_Init(void);
 
 /**
  * \brief     Returns counter value for the provided EID
- * \note      Source counters are unimplemented and return 0 by default
+ * \note      Pending per-task deltas for the counter are folded in first. EIDs outside
+ *            every MIB set return 0
  * \param[in] EID Endpoint identifier
  * \param[in] Counter Enumeration of counter to return
  * \return    Counter value
@@ -252,7 +296,8 @@ uint32_t BPLib_AS_GetCounter(BPLib_EID_t *EID, BPLib_AS_Counter_t Counter);
 
 /**
  * \brief     Add an amount to the counter specified by the given EID and counter
- * \details   Incrementing function for counters used by Admin Statistics
+ * \details   Incrementing function for counters used by Admin Statistics. Lock-free: the
+ *            amount is added to the calling task's counter shard
  * \note      Amount must be positive
  * \param[in] EID (BPLib_EID_t) EID whose associated counter should be incremented
  * \param[in] Counter (BPLib_AS_Counter_t) Counter to increment
@@ -260,16 +305,99 @@ uint32_t BPLib_AS_GetCounter(BPLib_EID_t *EID, BPLib_AS_Counter_t Counter);
  * \return    void
  * \ref       BPLib_SourceMibCountersHkTlm_Payload_t
  * \ref       BPLib_AS_Counter_t
- * \ref       BPLib_AS_SetCounter [BPLib_AS_SetCounter()]
  * \ref       BPLib_EID_t
- * \ref       BPLib_AS_LockCounters [BPLib_AS_LockCounters]
- * \ref       BPLib_AS_UnlockCounters [BPLib_AS_UnlockCounters()]
+ * \ref       BPLib_AS_ResolveSlot [BPLib_AS_ResolveSlot()]
  */
 void BPLib_AS_Increment(BPLib_EID_t EID, BPLib_AS_Counter_t Counter, uint32_t Amount);
 
+/**
+ * \brief     Resolve the counter slot associated with an EID
+ * \details   The instance EID resolves to the node counters; any other valid EID resolves
+ *            to the first MIB set with a matching source pattern. Results, including sources
+ *            outside every MIB set, are remembered in a fixed-size hash table so repeat sources
+ *            cost one lookup. Callers that update several counters for one bundle should
+ *            resolve once and use BPLib_AS_IncrementSlot().
+ * \param[in] EID (BPLib_EID_t*) EID to resolve
+ * \return    Counter slot
+ * \retval    BPLIB_AS_NODE_CNTR_INDICATOR: EID is the instance EID
+ * \retval    BPLIB_AS_INVALID_SLOT: EID is NULL, invalid or not covered by any MIB set
+ * \retval    Otherwise the index of the matching MIB set
+ */
+BPLib_AS_Slot_t BPLib_AS_ResolveSlot(const BPLib_EID_t *EID);
+
+/**
+ * \brief     Resolve the source counter slot of a bundle's source EID
+ * \details   Same as BPLib_AS_ResolveSlot() except that the instance EID is matched against the
+ *            MIB set patterns like any other source, so it never resolves to the node counters.
+ *            Bundle paths resolve a bundle's source once and pass the slot to
+ *            BPLib_AS_IncrementSlot() next to their node counter updates.
+ * \param[in] EID (BPLib_EID_t*) Source EID to resolve
+ * \return    Counter slot
+ * \retval    BPLIB_AS_INVALID_SLOT: EID is NULL, invalid or not covered by any MIB set
+ * \retval    Otherwise the index of the matching MIB set
+ */
+BPLib_AS_Slot_t BPLib_AS_ResolveSourceSlot(const BPLib_EID_t *EID);
+
+/**
+ * \brief     Add an amount to a counter in an already resolved slot
+ * \details   Lock-free: the amount is added with a relaxed atomic to the calling task's
+ *            counter shard and aggregated when telemetry is collected or counters are reset
+ * \note      Updates to BPLIB_AS_INVALID_SLOT are silently ignored
+ * \param[in] Slot    (BPLib_AS_Slot_t) Slot returned by BPLib_AS_ResolveSlot(), or
+ *                    BPLIB_AS_NODE_CNTR_INDICATOR for the node counters
+ * \param[in] Counter (BPLib_AS_Counter_t) Counter to increment
+ * \param[in] Amount  (uint32_t) Positive integer to increment Counter by
+ * \return    void
+ */
+void BPLib_AS_IncrementSlot(BPLib_AS_Slot_t Slot, BPLib_AS_Counter_t Counter, uint32_t Amount);
+
+/**
+ * \brief      Get the statistics of the source EID hash table used by BPLib_AS_ResolveSlot()
+ * \param[out] Stats (BPLib_AS_SourceCacheStats_t*) Statistics since initialization
+ * \return     Execution status
+ * \retval     BPLIB_NULL_PTR_ERROR: Stats is NULL
+ * \retval     BPLIB_SUCCESS: Successful execution
+ */
+BPLib_Status_t BPLib_AS_GetSourceCacheStats(BPLib_AS_SourceCacheStats_t *Stats);
+
+/**
+ * \brief     Account for one bundle or ADU of traffic in the throughput rate estimator
+ * \details   Lock-free: adds to cumulative byte and bundle totals with relaxed atomics. The
+ *            totals are turned into rates by BPLib_AS_UpdateRates()
+ * \param[in] Dir   (BPLib_AS_TrafficDir_t) Traffic direction
+ * \param[in] Id    (uint32_t) Contact ID for CLA directions, channel ID for local directions
+ * \param[in] Bytes (size_t) Size of the bundle or ADU
+ * \return    void
+ */
+void BPLib_AS_RecordTraffic(BPLib_AS_TrafficDir_t Dir, uint32_t Id, size_t Bytes);
+
+/**
+ * \brief     Sample the traffic totals and update the smoothed throughput rates
+ * \details   Rates are an exponentially weighted moving average with a time constant of
+ *            BPLIB_AS_RATE_WINDOW_MS, sampled from monotonic time. The first call only takes
+ *            a baseline, and calls less than BPLIB_AS_RATE_MIN_SAMPLE_MS apart are skipped.
+ * \return    void
+ */
+void BPLib_AS_UpdateRates(void);
+
+/**
+ * \brief      Get the smoothed throughput rate of one contact or channel
+ * \param[in]  Dir  (BPLib_AS_TrafficDir_t) Traffic direction
+ * \param[in]  Id   (uint32_t) Contact ID for CLA directions, channel ID for local directions
+ * \param[out] Rate (BPLib_AS_Rate_t*) Rate as of the last BPLib_AS_UpdateRates()
+ * \return     Execution status
+ * \retval     BPLIB_NULL_PTR_ERROR: Rate is NULL
+ * \retval     BPLIB_INVALID_CONT_ID_ERR: Contact ID is out of range for a CLA direction
+ * \retval     BPLIB_INVALID_CHAN_ID_ERR: Channel ID is out of range for a local direction
+ * \retval     BPLIB_ERROR: Unknown traffic direction
+ * \retval     BPLIB_SUCCESS: Successful execution
+ */
+BPLib_Status_t BPLib_AS_GetRate(BPLib_AS_TrafficDir_t Dir, uint32_t Id, BPLib_AS_Rate_t *Rate);
+
 /**
  * \brief     Subtract an amount to the counter specified by the given EID and counter
- * \details   Decrementing function for counters used by Admin Statistics
+ * \details   Decrementing function for counters used by Admin Statistics. Lock-free: the
+ *            amount is subtracted in the calling task's counter shard
  * \note      Amount must be positive
  * \param[in] EID (BPLib_EID_t) EID whose associated counter should be decremented
  * \param[in] Counter (BPLib_AS_Counter_t) Counter to decrement
@@ -277,10 +405,8 @@ void BPLib_AS_Increment(BPLib_EID_t EID, BPLib_AS_Counter_t Counter, uint32_t Am
  * \return    void
  * \ref       BPLib_SourceMibCountersHkTlm_Payload_t
  * \ref       BPLib_AS_Counter_t
- * \ref       BPLib_AS_SetCounter [BPLib_AS_SetCounter()]
  * \ref       BPLib_EID_t
- * \ref       BPLib_AS_LockCounters [BPLib_AS_LockCounters]
- * \ref       BPLib_AS_UnlockCounters [BPLib_AS_UnlockCounters()]
+ * \ref       BPLib_AS_ResolveSlot [BPLib_AS_ResolveSlot()]
  */
 void BPLib_AS_Decrement(BPLib_EID_t EID, BPLib_AS_Counter_t Counter, uint32_t Amount);
 
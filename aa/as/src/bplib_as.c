@@ -40,6 +40,8 @@ BPLib_Status_t BPLib_AS_Init(void)
     /* Instantiate all payloads under the stewardship of AS */
     BPLib_AS_ResetAllCounters();
     BPLib_AS_InitializeReportsHkTlm();
+    memset(&BPLib_AS_Rates, 0, sizeof(BPLib_AS_Rates));
+    memset(&BPLib_AS_SourceCache, 0, sizeof(BPLib_AS_SourceCache));
 
     return Status;
 }
@@ -54,72 +56,136 @@ uint32_t BPLib_AS_GetCounter(BPLib_EID_t *EID, BPLib_AS_Counter_t Counter)
     return 0;
 }
 
-void BPLib_AS_Increment(BPLib_EID_t EID, BPLib_AS_Counter_t Counter, uint32_t Amount)
+BPLib_AS_Slot_t BPLib_AS_ResolveSlot(const BPLib_EID_t *EID)
 {
-    BPLib_Status_t Status;
+    if (EID == NULL)
+    {
+        return BPLIB_AS_INVALID_SLOT;
+    }
 
-    if (BPLib_EID_IsMatch(&EID, &BPLIB_EID_INSTANCE))
-    { /* Increment a node counter */
-        /* Prevent modification of counters from other tasks while modifying them */
-        BPLib_AS_LockCounters();
+    if (BPLib_EID_IsMatch(EID, &BPLIB_EID_INSTANCE))
+    {
+        return BPLIB_AS_NODE_CNTR_INDICATOR;
+    }
 
-        /* Use BPLib_AS_SetCounter to evaluate source MIB array index and counter ranges */
-        Status = BPLib_AS_SetCounter(EID, Counter, BPLib_AS_NodeCountersPayload.NodeCounters[Counter] + Amount);
-        if (Status != BPLIB_SUCCESS)
+    return BPLib_AS_ResolveSourceSlot(EID);
+}
+
+BPLib_AS_Slot_t BPLib_AS_ResolveSourceSlot(const BPLib_EID_t *EID)
+{
+    BPLib_AS_Slot_t MibIndex;
+    BPLib_AS_Slot_t Slot;
+    uint8_t         PatternIndex;
+    uint32_t        Generation;
+    BPLib_SourceMibCounters_t *MibSet;
+
+    if (EID == NULL)
+    {
+        return BPLIB_AS_INVALID_SLOT;
+    }
+
+    /* Repeat sources, counted or not, are answered by the hash table */
+    Generation = BPLib_AS_SourceCacheGeneration();
+    if (BPLib_AS_SourceCacheLookup(EID, Generation, &Slot))
+    {
+        return Slot;
+    }
+
+    if (!BPLib_EID_IsValid((BPLib_EID_t *) EID))
+    {
+        return BPLIB_AS_INVALID_SLOT;
+    }
+
+    Slot = BPLIB_AS_INVALID_SLOT;
+    for (MibIndex = 0; MibIndex < BPLIB_MAX_NUM_MIB_SETS && Slot == BPLIB_AS_INVALID_SLOT; MibIndex++)
+    {
+        MibSet = &BPLib_AS_SourceCountersPayload.MibArray[MibIndex];
+
+        for (PatternIndex = 0; PatternIndex < MibSet->ActiveKeys; PatternIndex++)
         {
-            BPLib_EM_SendEvent(BPLIB_AS_SET_CTR_ERR_EID,
-                                BPLib_EM_EventType_ERROR,
-                                "Could not increment node counter %d to %d, RC = %d",
-                                Counter,
-                                BPLib_AS_NodeCountersPayload.NodeCounters[Counter] + Amount,
-                                Status);
+            if (BPLib_EID_PatternIsMatch((BPLib_EID_t *) EID, &MibSet->EidPatterns[PatternIndex]))
+            {
+                Slot = MibIndex;
+                break;
+            }
         }
-
-        /* Allow counters to be modified by other tasks after operation has finished */
-        BPLib_AS_UnlockCounters();
     }
-    // else
-    // { /* Increment a source counter */
-    //     /* Prevent modification of counters from other tasks while modifying them */
-    //     BPLib_AS_LockCounters();
 
-    //     /* Allow counters to be modified by other tasks after operation has finished */
-    //     BPLib_AS_UnlockCounters();
-    // }
+    BPLib_AS_SourceCacheInsert(EID, Generation, Slot);
+
+    return Slot;
 }
 
-void BPLib_AS_Decrement(BPLib_EID_t EID, BPLib_AS_Counter_t Counter, uint32_t Amount)
+void BPLib_AS_IncrementSlot(BPLib_AS_Slot_t Slot, BPLib_AS_Counter_t Counter, uint32_t Amount)
 {
     BPLib_Status_t Status;
 
-    if (BPLib_EID_IsMatch(&EID, &BPLIB_EID_INSTANCE))
-    { /* Increment a node counter */
-        /* Prevent modification of counters from other tasks while modifying them */
-        BPLib_AS_LockCounters();
+    if (Slot == BPLIB_AS_INVALID_SLOT)
+    { /* Sources outside every MIB set aren't tracked */
+        return;
+    }
 
-        /* Use BPLib_AS_SetCounter to evaluate EID and counter ranges */
-        Status = BPLib_AS_SetCounter(EID, Counter, BPLib_AS_NodeCountersPayload.NodeCounters[Counter] - Amount);
-        if (Status != BPLIB_SUCCESS)
-        {
-            BPLib_EM_SendEvent(BPLIB_AS_SET_CTR_ERR_EID,
-                                BPLib_EM_EventType_ERROR,
-                                "Could not decrement node counter %d to %d, RC = %d",
-                                Counter,
-                                BPLib_AS_NodeCountersPayload.NodeCounters[Counter] - Amount,
-                                Status);
-        }
+    Status = BPLib_AS_AddToShard(Slot, Counter, Amount);
+    if (Status != BPLIB_SUCCESS)
+    {
+        BPLib_EM_SendEvent(BPLIB_AS_SET_CTR_ERR_EID,
+                            BPLib_EM_EventType_ERROR,
+                            "Could not increment counter %d in slot %d by %d, RC = %d",
+                            Counter,
+                            Slot,
+                            Amount,
+                            Status);
+    }
+}
 
-        /* Allow counters to be modified by other tasks after operation has finished */
-        BPLib_AS_UnlockCounters();
+void BPLib_AS_Increment(BPLib_EID_t EID, BPLib_AS_Counter_t Counter, uint32_t Amount)
+{
+    BPLib_AS_Slot_t Slot;
+    BPLib_Status_t  Status;
+
+    Slot = BPLib_AS_ResolveSlot(&EID);
+    if (Slot == BPLIB_AS_INVALID_SLOT)
+    {
+        return;
+    }
+
+    /* No lock: the amount lands in this task's shard and is folded in on read/reset/send */
+    Status = BPLib_AS_AddToShard(Slot, Counter, Amount);
+    if (Status != BPLIB_SUCCESS)
+    {
+        BPLib_EM_SendEvent(BPLIB_AS_SET_CTR_ERR_EID,
+                            BPLib_EM_EventType_ERROR,
+                            "Could not increment %s counter %d by %d, RC = %d",
+                            (Slot == BPLIB_AS_NODE_CNTR_INDICATOR) ? "node" : "source",
+                            Counter,
+                            Amount,
+                            Status);
+    }
+}
+
+void BPLib_AS_Decrement(BPLib_EID_t EID, BPLib_AS_Counter_t Counter, uint32_t Amount)
+{
+    BPLib_AS_Slot_t Slot;
+    BPLib_Status_t  Status;
+
+    Slot = BPLib_AS_ResolveSlot(&EID);
+    if (Slot == BPLIB_AS_INVALID_SLOT)
+    {
+        return;
     }
-    // else
-    // { /* Increment a source counter */
-    //     /* Prevent modification of counters from other tasks while modifying them */
-    //     BPLib_AS_LockCounters();
 
-    //     /* Allow counters to be modified by other tasks after operation has finished */
-    //     BPLib_AS_UnlockCounters();
-    // }
+    /* Shard deltas wrap, so adding the two's complement subtracts once folded */
+    Status = BPLib_AS_AddToShard(Slot, Counter, 0u - Amount);
+    if (Status != BPLIB_SUCCESS)
+    {
+        BPLib_EM_SendEvent(BPLIB_AS_SET_CTR_ERR_EID,
+                            BPLib_EM_EventType_ERROR,
+                            "Could not decrement %s counter %d by %d, RC = %d",
+                            (Slot == BPLIB_AS_NODE_CNTR_INDICATOR) ? "node" : "source",
+                            Counter,
+                            Amount,
+                            Status);
+    }
 }
 
 BPLib_Status_t BPLib_AS_ResetCounter(uint16_t MibArrayIndex, BPLib_AS_Counter_t Counter)
@@ -135,6 +201,7 @@ BPLib_Status_t BPLib_AS_ResetCounter(uint16_t MibArrayIndex, BPLib_AS_Counter_t
             /* Prevent modification of counters while outputting */
             BPLib_AS_LockCounters();
 
+            (void) BPLib_AS_TakeShardDeltas(MibArrayIndex, Counter);
             BPLib_AS_NodeCountersPayload.NodeCounters[Counter] = 0;
 
             /* Allow counters to be modified again */
@@ -152,6 +219,7 @@ BPLib_Status_t BPLib_AS_ResetCounter(uint16_t MibArrayIndex, BPLib_AS_Counter_t
             /* Prevent modification of counters while outputting */
             BPLib_AS_LockCounters();
 
+            (void) BPLib_AS_TakeShardDeltas(MibArrayIndex, Counter);
             BPLib_AS_SourceCountersPayload.MibArray[MibArrayIndex].SourceCounters[Counter] = 0;
 
             /* Allow counters to be modified again */
@@ -182,6 +250,9 @@ BPLib_Status_t BPLib_AS_ResetSourceCounters(uint16_t MibArrayIndex)
         /* Prevent modification of counters from other tasks while modifying them */
         BPLib_AS_LockCounters();
 
+        /* Pending shard deltas are part of the counts being reset */
+        BPLib_AS_FoldShards();
+
         memset((void*) &BPLib_AS_SourceCountersPayload.MibArray[MibArrayIndex].SourceCounters,
                 0, sizeof(BPLib_AS_SourceCountersPayload.MibArray[MibArrayIndex].SourceCounters));
 
@@ -201,6 +272,8 @@ void BPLib_AS_ResetBundleCounters()
     /* Prevent modification of counters from other tasks while modifying them */
     BPLib_AS_LockCounters();
 
+    BPLib_AS_FoldShards();
+
     /* Only reset bundle-related node counters */
     BPLib_AS_NodeCountersPayload.NodeCounters[ADU_COUNT_DELIVERED]                    = 0;
     BPLib_AS_NodeCountersPayload.NodeCounters[ADU_COUNT_RECEIVED]                     = 0;
@@ -293,6 +366,9 @@ BPLib_Status_t BPLib_AS_ResetErrorCounters(uint16_t MibArrayIndex)
         /* Prevent modification of counters from other tasks while modifying them */
         BPLib_AS_LockCounters();
 
+        /* Pending shard deltas are part of the counts being reset */
+        BPLib_AS_FoldShards();
+
         /* Reset the error counters associated with nodes and sources */
         BPLib_AS_NodeCountersPayload.NodeCounters[BUNDLE_COUNT_ABANDONED]                                             = 0;
         BPLib_AS_SourceCountersPayload.MibArray[MibArrayIndex].SourceCounters[BUNDLE_COUNT_ABANDONED]                 = 0;
@@ -355,6 +431,8 @@ void BPLib_AS_ResetAllCounters(void)
     /* Prevent modification of counters from other tasks while modifying them */
     BPLib_AS_LockCounters();
 
+    BPLib_AS_FoldShards();
+
     memset((void*) BPLib_AS_NodeCountersPayload.NodeCounters, 0,
             sizeof(uint32_t) * BPLIB_AS_NUM_NODE_CNTRS);
 
@@ -375,6 +453,8 @@ BPLib_Status_t BPLib_AS_SendNodeMibCountersHk()
     /* Prevent modification of counters from other tasks while modifying them */
     BPLib_AS_LockCounters();
 
+    BPLib_AS_FoldShards();
+
     Status = BPLib_FWP_ProxyCallbacks.BPA_TLMP_SendNodeMibCounterPkt(&BPLib_AS_NodeCountersPayload);
 
     /* Allow counters to be modified by other tasks after operation has finished */
@@ -390,6 +470,8 @@ BPLib_Status_t BPLib_AS_SendSourceMibCountersHk()
     /* Prevent modification of counters from other tasks while modifying them */
     BPLib_AS_LockCounters();
 
+    BPLib_AS_FoldShards();
+
     Status = BPLib_FWP_ProxyCallbacks.BPA_TLMP_SendPerSourceMibCounterPkt(&BPLib_AS_SourceCountersPayload);
 
     /* Allow counters to be modified by other tasks after operation has finished */
@@ -398,6 +480,152 @@ BPLib_Status_t BPLib_AS_SendSourceMibCountersHk()
     return Status;
 }
 
+void BPLib_AS_RecordTraffic(BPLib_AS_TrafficDir_t Dir, uint32_t Id, size_t Bytes)
+{
+    BPLib_AS_RateEstimator_t *Estimator;
+
+    Estimator = BPLib_AS_GetRateEstimator(Dir, Id);
+    if (Estimator == NULL)
+    {
+        return;
+    }
+
+    __atomic_fetch_add(&Estimator->Bytes, (uint64_t) Bytes, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&Estimator->Bundles, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&BPLib_AS_Rates.Node[Dir].Bytes, (uint64_t) Bytes, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&BPLib_AS_Rates.Node[Dir].Bundles, 1, __ATOMIC_RELAXED);
+}
+
+/* Fold the traffic since the last sample into one estimator's moving average */
+static uint32_t BPLib_AS_SmoothRate(uint32_t Rate, uint64_t Delta, int64_t Elapsed)
+{
+    int64_t Sample;
+
+    Sample = (int64_t) ((Delta * 1000) / (uint64_t) Elapsed);
+    if (Sample > UINT32_MAX)
+    {
+        Sample = UINT32_MAX;
+    }
+
+    if (Elapsed >= BPLIB_AS_RATE_WINDOW_MS)
+    {
+        return (uint32_t) Sample;
+    }
+
+    return (uint32_t) ((int64_t) Rate + ((Sample - (int64_t) Rate) * Elapsed) / BPLIB_AS_RATE_WINDOW_MS);
+}
+
+/* Sample one estimator's totals; an Elapsed of 0 only takes a baseline */
+static void BPLib_AS_SampleEstimator(BPLib_AS_RateEstimator_t *Estimator, int64_t Elapsed)
+{
+    uint64_t Bytes;
+    uint32_t Bundles;
+
+    Bytes   = __atomic_load_n(&Estimator->Bytes, __ATOMIC_RELAXED);
+    Bundles = __atomic_load_n(&Estimator->Bundles, __ATOMIC_RELAXED);
+
+    if (Elapsed > 0)
+    {
+        Estimator->Rate.BytesPerSec   = BPLib_AS_SmoothRate(Estimator->Rate.BytesPerSec, Bytes - Estimator->LastBytes, Elapsed);
+        Estimator->Rate.BundlesPerSec = BPLib_AS_SmoothRate(Estimator->Rate.BundlesPerSec, Bundles - Estimator->LastBundles, Elapsed);
+    }
+
+    Estimator->LastBytes          = Bytes;
+    Estimator->LastBundles        = Bundles;
+}
+
+void BPLib_AS_UpdateRates(void)
+{
+    BPLib_AS_RateEstimator_t *Estimator;
+    int64_t  Now;
+    int64_t  Elapsed;
+    uint32_t Dir;
+    uint32_t Id;
+
+    BPLib_AS_LockCounters();
+
+    Now     = BPLib_TIME_GetMonotonicTime();
+    Elapsed = Now - BPLib_AS_Rates.LastSampleTime;
+
+    /* The first sample only establishes a baseline */
+    if (BPLib_AS_Rates.LastSampleTime == 0)
+    {
+        Elapsed = 0;
+    }
+
+    /* Samples closer together than the minimum interval are deferred to the next update */
+    if (BPLib_AS_Rates.LastSampleTime == 0 || Elapsed >= BPLIB_AS_RATE_MIN_SAMPLE_MS)
+    {
+        for (Dir = 0; Dir < BPLIB_AS_NUM_TRAFFIC_DIRS; Dir++)
+        {
+            BPLib_AS_SampleEstimator(&BPLib_AS_Rates.Node[Dir], Elapsed);
+
+            for (Id = 0; (Estimator = BPLib_AS_GetRateEstimator(Dir, Id)) != NULL; Id++)
+            {
+                BPLib_AS_SampleEstimator(Estimator, Elapsed);
+            }
+        }
+
+        BPLib_AS_Rates.LastSampleTime = Now;
+    }
+
+    BPLib_AS_UnlockCounters();
+}
+
+BPLib_Status_t BPLib_AS_GetSourceCacheStats(BPLib_AS_SourceCacheStats_t *Stats)
+{
+    if (Stats == NULL)
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    BPLib_AS_LockCounters();
+
+    Stats->Misses    = __atomic_load_n(&BPLib_AS_SourceCache.Stats.Misses, __ATOMIC_RELAXED);
+    Stats->Inserts   = BPLib_AS_SourceCache.Stats.Inserts;
+    Stats->Evictions = BPLib_AS_SourceCache.Stats.Evictions;
+    Stats->Flushes   = __atomic_load_n(&BPLib_AS_SourceCache.Stats.Flushes, __ATOMIC_RELAXED);
+
+    BPLib_AS_UnlockCounters();
+
+    return BPLIB_SUCCESS;
+}
+
+BPLib_Status_t BPLib_AS_GetRate(BPLib_AS_TrafficDir_t Dir, uint32_t Id, BPLib_AS_Rate_t *Rate)
+{
+    BPLib_AS_RateEstimator_t *Estimator;
+
+    if (Rate == NULL)
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    Estimator = BPLib_AS_GetRateEstimator(Dir, Id);
+    if (Estimator == NULL)
+    {
+        switch (Dir)
+        {
+            case BPLIB_AS_TRAFFIC_INGRESS:
+            case BPLIB_AS_TRAFFIC_INGRESS_REJECTED:
+            case BPLIB_AS_TRAFFIC_EGRESS:
+                return BPLIB_INVALID_CONT_ID_ERR;
+
+            case BPLIB_AS_TRAFFIC_INGESTED:
+            case BPLIB_AS_TRAFFIC_DELIVERED:
+                return BPLIB_INVALID_CHAN_ID_ERR;
+
+            default:
+                return BPLIB_ERROR;
+        }
+    }
+
+    BPLib_AS_LockCounters();
+    *Rate = Estimator->Rate;
+    BPLib_AS_UnlockCounters();
+
+    return BPLIB_SUCCESS;
+}
+
 /* Send Node MIB Reports housekeeping telemetry */
 BPLib_Status_t BPLib_AS_SendNodeMibReportsHk(BPLib_Instance_t *Inst)
 {
@@ -521,6 +749,9 @@ BPLib_Status_t BPLib_AS_AddMibArrayKey(const BPLib_EID_Pattern_t* EID_Patterns)
                     /* Update the number of active keys for the MIB array entry */
                     BPLib_AS_SourceCountersPayload.MibArray[MibIndex].ActiveKeys += NumKeysGiven;
 
+                    /* Sources already resolved may now belong to this MIB set */
+                    BPLib_AS_SourceCacheFlush();
+
                     /* Indicate that a key was added */
                     Status = BPLIB_SUCCESS;
                     break;
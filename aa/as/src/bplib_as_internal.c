@@ -34,6 +34,27 @@ BPLib_NodeMibCountersHkTlm_Payload_t   BPLib_AS_NodeCountersPayload;   /** \brie
 BPLib_SourceMibCountersHkTlm_Payload_t BPLib_AS_SourceCountersPayload; /** \brief Global source MIB counter payload */
 BPLib_NodeMibReportsHkTlm_Payload_t    BPLib_AS_NodeReportsPayload;    /** \brief Global node MIB reports payload */
 
+/* ============== */
+/* Counter Shards */
+/* ============== */
+
+BPLib_AS_CounterShard_t BPLib_AS_CounterShards[BPLIB_AS_NUM_CNTR_SHARDS]; /** \brief Pending counter deltas */
+
+static uint32_t          BPLib_AS_ShardsAssigned; /** \brief Number of shard assignments handed out so far */
+static __thread uint32_t BPLib_AS_TaskShard;      /** \brief Calling task's shard index plus one, 0 if unassigned */
+
+/* ================ */
+/* Throughput Rates */
+/* ================ */
+
+BPLib_AS_RateState_t BPLib_AS_Rates; /** \brief Throughput rate estimator state */
+
+/* ================= */
+/* Source Hash Table */
+/* ================= */
+
+BPLib_AS_SourceCache_t BPLib_AS_SourceCache; /** \brief Source EID hash table */
+
 /* =============== */
 /* Mutex Variables */
 /* =============== */
@@ -44,19 +65,140 @@ BPLib_TIME_MonotonicTime_t InitTime;    /** \brief Time the node was initialized
 /* Function Definitions */
 /* ==================== */
 
+/* Return the calling task's shard, assigning one round-robin on first use */
+static inline BPLib_AS_CounterShard_t *BPLib_AS_GetTaskShard(void)
+{
+    if (BPLib_AS_TaskShard == 0)
+    {
+        BPLib_AS_TaskShard = (__atomic_fetch_add(&BPLib_AS_ShardsAssigned, 1, __ATOMIC_RELAXED)
+                              % BPLIB_AS_NUM_CNTR_SHARDS) + 1;
+    }
+
+    return &BPLib_AS_CounterShards[BPLib_AS_TaskShard - 1];
+}
+
+/* Number of shards that may hold deltas, so folding can skip the ones never handed out */
+static inline uint32_t BPLib_AS_ShardsInUse(void)
+{
+    uint32_t Assigned;
+
+    Assigned = __atomic_load_n(&BPLib_AS_ShardsAssigned, __ATOMIC_RELAXED);
+
+    return (Assigned < BPLIB_AS_NUM_CNTR_SHARDS) ? Assigned : BPLIB_AS_NUM_CNTR_SHARDS;
+}
+
+/* Address of a counter within a shard, NULL if the slot or counter is out of range */
+static inline uint32_t *BPLib_AS_ShardCounter(BPLib_AS_CounterShard_t *Shard, BPLib_AS_Slot_t Slot,
+                                              BPLib_AS_Counter_t Counter)
+{
+    if (Slot == BPLIB_AS_NODE_CNTR_INDICATOR)
+    {
+        return (Counter < BPLIB_AS_NUM_NODE_CNTRS) ? &Shard->NodeCounters[Counter] : NULL;
+    }
+
+    return (Counter < BPLIB_AS_NUM_SOURCE_CNTRS) ? &Shard->SourceCounters[Slot][Counter] : NULL;
+}
+
 uint32_t BPLib_AS_GetCounterImpl(BPLib_EID_t *EID, BPLib_AS_Counter_t Counter)
 {
-    if (BPLib_EID_IsMatch(EID, &BPLIB_EID_INSTANCE))
+    BPLib_AS_Slot_t Slot;
+    uint32_t        Value;
+
+    Slot = BPLib_AS_ResolveSlot(EID);
+    if (Slot == BPLIB_AS_NODE_CNTR_INDICATOR)
+    {
+        BPLib_AS_LockCounters();
+        Value = BPLib_AS_NodeCountersPayload.NodeCounters[Counter] + BPLib_AS_TakeShardDeltas(Slot, Counter);
+        BPLib_AS_NodeCountersPayload.NodeCounters[Counter] = Value;
+        BPLib_AS_UnlockCounters();
+
+        return Value;
+    }
+    else if (Slot < BPLIB_MAX_NUM_MIB_SETS && Counter < BPLIB_AS_NUM_SOURCE_CNTRS)
     {
-        return BPLib_AS_NodeCountersPayload.NodeCounters[Counter];
+        BPLib_AS_LockCounters();
+        Value = BPLib_AS_SourceCountersPayload.MibArray[Slot].SourceCounters[Counter] +
+                BPLib_AS_TakeShardDeltas(Slot, Counter);
+        BPLib_AS_SourceCountersPayload.MibArray[Slot].SourceCounters[Counter] = Value;
+        BPLib_AS_UnlockCounters();
+
+        return Value;
     }
     else
     {
-        /* Source counters are unimplemented */
         return 0;
     }
 }
 
+BPLib_Status_t BPLib_AS_AddToShard(BPLib_AS_Slot_t Slot, BPLib_AS_Counter_t Counter, uint32_t Delta)
+{
+    uint32_t *ShardCounter;
+
+    if (Slot != BPLIB_AS_NODE_CNTR_INDICATOR && Slot >= BPLIB_MAX_NUM_MIB_SETS)
+    {
+        return BPLIB_AS_INVALID_MIB_INDEX;
+    }
+
+    ShardCounter = BPLib_AS_ShardCounter(BPLib_AS_GetTaskShard(), Slot, Counter);
+    if (ShardCounter == NULL)
+    {
+        return (Slot == BPLIB_AS_NODE_CNTR_INDICATOR) ? BPLIB_AS_UNKNOWN_NODE_CNTR : BPLIB_AS_UNKNOWN_SRC_CNTR;
+    }
+
+    __atomic_fetch_add(ShardCounter, Delta, __ATOMIC_RELAXED);
+
+    return BPLIB_SUCCESS;
+}
+
+uint32_t BPLib_AS_TakeShardDeltas(BPLib_AS_Slot_t Slot, BPLib_AS_Counter_t Counter)
+{
+    uint32_t ShardIndex;
+    uint32_t NumShards;
+    uint32_t Delta;
+
+    Delta     = 0;
+    NumShards = BPLib_AS_ShardsInUse();
+
+    for (ShardIndex = 0; ShardIndex < NumShards; ShardIndex++)
+    {
+        Delta += __atomic_exchange_n(BPLib_AS_ShardCounter(&BPLib_AS_CounterShards[ShardIndex], Slot, Counter),
+                                     0, __ATOMIC_RELAXED);
+    }
+
+    return Delta;
+}
+
+void BPLib_AS_FoldShards(void)
+{
+    uint32_t ShardIndex;
+    uint32_t NumShards;
+    uint16_t MibIndex;
+    uint16_t Counter;
+    BPLib_AS_CounterShard_t *Shard;
+
+    NumShards = BPLib_AS_ShardsInUse();
+
+    for (ShardIndex = 0; ShardIndex < NumShards; ShardIndex++)
+    {
+        Shard = &BPLib_AS_CounterShards[ShardIndex];
+
+        for (Counter = 0; Counter < BPLIB_AS_NUM_NODE_CNTRS; Counter++)
+        {
+            BPLib_AS_NodeCountersPayload.NodeCounters[Counter] +=
+                __atomic_exchange_n(&Shard->NodeCounters[Counter], 0, __ATOMIC_RELAXED);
+        }
+
+        for (MibIndex = 0; MibIndex < BPLIB_MAX_NUM_MIB_SETS; MibIndex++)
+        {
+            for (Counter = 0; Counter < BPLIB_AS_NUM_SOURCE_CNTRS; Counter++)
+            {
+                BPLib_AS_SourceCountersPayload.MibArray[MibIndex].SourceCounters[Counter] +=
+                    __atomic_exchange_n(&Shard->SourceCounters[MibIndex][Counter], 0, __ATOMIC_RELAXED);
+            }
+        }
+    }
+}
+
 BPLib_Status_t BPLib_AS_SetCounter(BPLib_EID_t EID, BPLib_AS_Counter_t Counter, uint32_t Value)
 {
     BPLib_Status_t Status;
@@ -69,7 +211,14 @@ BPLib_Status_t BPLib_AS_SetCounter(BPLib_EID_t EID, BPLib_AS_Counter_t Counter,
         { /* EID denotes a node counter manipulation */
             if (Counter < BPLIB_AS_NUM_NODE_CNTRS)
             { // Counter is within range
+                /* Same lock as the get/reset paths, so the deltas aren't taken twice */
+                BPLib_AS_LockCounters();
+
+                /* Drop pending deltas so they don't land on top of the new value */
+                (void) BPLib_AS_TakeShardDeltas(BPLIB_AS_NODE_CNTR_INDICATOR, Counter);
                 BPLib_AS_NodeCountersPayload.NodeCounters[Counter] = Value;
+
+                BPLib_AS_UnlockCounters();
             }
             else
             { // Counter is out of valid range
@@ -149,6 +298,192 @@ void BPLib_AS_UnlockCounters(void)
     }
 }
 
+/* Whether a source hash table entry holds a result from the given generation */
+static inline bool BPLib_AS_SourceEntryIsLive(const BPLib_AS_SourceCacheEntry_t *Entry, uint32_t Generation)
+{
+    return Entry->Seq != 0 && Entry->Generation == Generation;
+}
+
+/* Home entry of an EID in the source hash table */
+static inline uint32_t BPLib_AS_HashEid(const BPLib_EID_t *EID)
+{
+    uint64_t Hash;
+
+    Hash = EID->Scheme ^ (EID->IpnSspFormat << 8);
+    Hash = (Hash ^ EID->Allocator) * 0x9E3779B97F4A7C15ull;
+    Hash = (Hash ^ EID->Node) * 0x9E3779B97F4A7C15ull;
+    Hash = (Hash ^ EID->Service) * 0x9E3779B97F4A7C15ull;
+
+    return (uint32_t) (Hash >> 32) & (BPLIB_AS_SRC_CACHE_SIZE - 1);
+}
+
+uint32_t BPLib_AS_SourceCacheGeneration(void)
+{
+    return __atomic_load_n(&BPLib_AS_SourceCache.Generation, __ATOMIC_ACQUIRE);
+}
+
+bool BPLib_AS_SourceCacheLookup(const BPLib_EID_t *EID, uint32_t Generation, BPLib_AS_Slot_t *Slot)
+{
+    BPLib_AS_SourceCacheEntry_t *Entry;
+    uint32_t        Probe;
+    uint32_t        Index;
+    uint32_t        Seq;
+    uint32_t        Clock;
+    bool            Match;
+    BPLib_AS_Slot_t CachedSlot;
+
+    Index = BPLib_AS_HashEid(EID);
+
+    for (Probe = 0; Probe < BPLIB_AS_SRC_CACHE_PROBES; Probe++)
+    {
+        Entry = &BPLib_AS_SourceCache.Entries[(Index + Probe) & (BPLIB_AS_SRC_CACHE_SIZE - 1)];
+
+        /* Skip entries that were never written or are being rewritten */
+        Seq = __atomic_load_n(&Entry->Seq, __ATOMIC_ACQUIRE);
+        if (Seq == 0 || (Seq & 1) != 0)
+        {
+            continue;
+        }
+
+        Match = __atomic_load_n(&Entry->Generation, __ATOMIC_RELAXED) == Generation &&
+                __atomic_load_n(&Entry->EID.Service, __ATOMIC_RELAXED) == EID->Service &&
+                __atomic_load_n(&Entry->EID.Node, __ATOMIC_RELAXED) == EID->Node &&
+                __atomic_load_n(&Entry->EID.Allocator, __ATOMIC_RELAXED) == EID->Allocator &&
+                __atomic_load_n(&Entry->EID.IpnSspFormat, __ATOMIC_RELAXED) == EID->IpnSspFormat &&
+                __atomic_load_n(&Entry->EID.Scheme, __ATOMIC_RELAXED) == EID->Scheme;
+        CachedSlot = __atomic_load_n(&Entry->Slot, __ATOMIC_RELAXED);
+
+        /* The entry is only trusted if it did not change while being read */
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (Match && __atomic_load_n(&Entry->Seq, __ATOMIC_RELAXED) == Seq)
+        {
+            /* Only touch the entry's cache line when its age actually changes */
+            Clock = __atomic_load_n(&BPLib_AS_SourceCache.Clock, __ATOMIC_RELAXED);
+            if (__atomic_load_n(&Entry->LastUse, __ATOMIC_RELAXED) != Clock)
+            {
+                __atomic_store_n(&Entry->LastUse, Clock, __ATOMIC_RELAXED);
+            }
+
+            *Slot = CachedSlot;
+            return true;
+        }
+    }
+
+    __atomic_fetch_add(&BPLib_AS_SourceCache.Stats.Misses, 1, __ATOMIC_RELAXED);
+
+    return false;
+}
+
+void BPLib_AS_SourceCacheInsert(const BPLib_EID_t *EID, uint32_t Generation, BPLib_AS_Slot_t Slot)
+{
+    BPLib_AS_SourceCacheEntry_t *Entry;
+    BPLib_AS_SourceCacheEntry_t *Victim;
+    uint32_t Probe;
+    uint32_t Index;
+    uint32_t Seq;
+    uint32_t Clock;
+    bool     Evict;
+
+    BPLib_AS_LockCounters();
+
+    /* The MIB array keys changed while Slot was being resolved */
+    if (Generation != BPLib_AS_SourceCacheGeneration())
+    {
+        BPLib_AS_UnlockCounters();
+        return;
+    }
+
+    Index  = BPLib_AS_HashEid(EID);
+    Clock  = BPLib_AS_SourceCache.Clock;
+    Victim = NULL;
+    Evict  = true;
+
+    /* Prefer the EID's own entry (another task got here first), then the first free or stale one */
+    for (Probe = 0; Probe < BPLIB_AS_SRC_CACHE_PROBES; Probe++)
+    {
+        Entry = &BPLib_AS_SourceCache.Entries[(Index + Probe) & (BPLIB_AS_SRC_CACHE_SIZE - 1)];
+
+        if (!BPLib_AS_SourceEntryIsLive(Entry, Generation))
+        {
+            if (Victim == NULL)
+            {
+                Victim = Entry;
+                Evict  = false;
+            }
+        }
+        else if (memcmp(&Entry->EID, EID, sizeof(*EID)) == 0)
+        {
+            Victim = Entry;
+            Evict  = false;
+            break;
+        }
+    }
+
+    /* Otherwise evict the least recently used entry of the probe window */
+    if (Victim == NULL)
+    {
+        for (Probe = 0; Probe < BPLIB_AS_SRC_CACHE_PROBES; Probe++)
+        {
+            Entry = &BPLib_AS_SourceCache.Entries[(Index + Probe) & (BPLIB_AS_SRC_CACHE_SIZE - 1)];
+
+            if (Victim == NULL || Clock - Entry->LastUse > Clock - Victim->LastUse)
+            {
+                Victim = Entry;
+            }
+        }
+    }
+
+    if (Evict)
+    {
+        BPLib_AS_SourceCache.Stats.Evictions++;
+    }
+
+    /* Rewrite the entry under its sequence number so lock-free readers never see it torn */
+    Seq = Victim->Seq;
+    __atomic_store_n(&Victim->Seq, Seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    __atomic_store_n(&Victim->Generation, Generation, __ATOMIC_RELAXED);
+    __atomic_store_n(&Victim->LastUse, Clock, __ATOMIC_RELAXED);
+    __atomic_store_n(&Victim->Slot, Slot, __ATOMIC_RELAXED);
+    __atomic_store_n(&Victim->EID.Scheme, EID->Scheme, __ATOMIC_RELAXED);
+    __atomic_store_n(&Victim->EID.IpnSspFormat, EID->IpnSspFormat, __ATOMIC_RELAXED);
+    __atomic_store_n(&Victim->EID.Allocator, EID->Allocator, __ATOMIC_RELAXED);
+    __atomic_store_n(&Victim->EID.Node, EID->Node, __ATOMIC_RELAXED);
+    __atomic_store_n(&Victim->EID.Service, EID->Service, __ATOMIC_RELAXED);
+
+    __atomic_store_n(&Victim->Seq, Seq + 2, __ATOMIC_RELEASE);
+
+    __atomic_store_n(&BPLib_AS_SourceCache.Clock, Clock + 1, __ATOMIC_RELAXED);
+    BPLib_AS_SourceCache.Stats.Inserts++;
+
+    BPLib_AS_UnlockCounters();
+}
+
+void BPLib_AS_SourceCacheFlush(void)
+{
+    __atomic_fetch_add(&BPLib_AS_SourceCache.Generation, 1, __ATOMIC_RELEASE);
+    __atomic_fetch_add(&BPLib_AS_SourceCache.Stats.Flushes, 1, __ATOMIC_RELAXED);
+}
+
+BPLib_AS_RateEstimator_t *BPLib_AS_GetRateEstimator(BPLib_AS_TrafficDir_t Dir, uint32_t Id)
+{
+    switch (Dir)
+    {
+        case BPLIB_AS_TRAFFIC_INGRESS:
+        case BPLIB_AS_TRAFFIC_INGRESS_REJECTED:
+        case BPLIB_AS_TRAFFIC_EGRESS:
+            return (Id < BPLIB_MAX_NUM_CONTACTS) ? &BPLib_AS_Rates.Contact[Id][Dir] : NULL;
+
+        case BPLIB_AS_TRAFFIC_INGESTED:
+        case BPLIB_AS_TRAFFIC_DELIVERED:
+            return (Id < BPLIB_MAX_NUM_CHANNELS) ? &BPLib_AS_Rates.Channel[Id][Dir] : NULL;
+
+        default:
+            return NULL;
+    }
+}
+
 /* Initialize the static MIB reports telemetry values */
 void BPLib_AS_InitializeReportsHkTlm(void)
 {
@@ -180,7 +515,26 @@ void BPLib_AS_InitializeReportsHkTlm(void)
 
 void BPLib_AS_UpdateReportsHkTlm(BPLib_Instance_t *Inst)
 {
+    BPLib_AS_RateEstimator_t *Node = BPLib_AS_Rates.Node;
+
+    BPLib_AS_UpdateRates();
+
     BPLib_AS_NodeReportsPayload.SystemNodeUpTime = BPLib_TIME_GetMonotonicTime() - InitTime.Time;
     BPLib_AS_NodeReportsPayload.BundleCountStored = Inst->BundleStorage.BundleCountStored;
     BPLib_AS_NodeReportsPayload.KbytesCountStorageAvailable = (BPLIB_MAX_STORED_BUNDLE_BYTES - Inst->BundleStorage.BytesStorageInUse) / 1000;
+
+    BPLib_AS_LockCounters();
+
+    BPLib_AS_NodeReportsPayload.BundleIngressRateBytesPerSec           = Node[BPLIB_AS_TRAFFIC_INGRESS].Rate.BytesPerSec;
+    BPLib_AS_NodeReportsPayload.BundleIngressRateBundlesPerSec         = Node[BPLIB_AS_TRAFFIC_INGRESS].Rate.BundlesPerSec;
+    BPLib_AS_NodeReportsPayload.BundleEgressRateBytesPerSec            = Node[BPLIB_AS_TRAFFIC_EGRESS].Rate.BytesPerSec;
+    BPLib_AS_NodeReportsPayload.BundleEgressRateBundlesPerSec          = Node[BPLIB_AS_TRAFFIC_EGRESS].Rate.BundlesPerSec;
+    BPLib_AS_NodeReportsPayload.BundleIngestedRateBytesPerSec          = Node[BPLIB_AS_TRAFFIC_INGESTED].Rate.BytesPerSec;
+    BPLib_AS_NodeReportsPayload.BundleIngestedRateBundlesPerSec        = Node[BPLIB_AS_TRAFFIC_INGESTED].Rate.BundlesPerSec;
+    BPLib_AS_NodeReportsPayload.BundleDeliveryRateBytesPerSec          = Node[BPLIB_AS_TRAFFIC_DELIVERED].Rate.BytesPerSec;
+    BPLib_AS_NodeReportsPayload.BundleDeliveryRateBundlesPerSec        = Node[BPLIB_AS_TRAFFIC_DELIVERED].Rate.BundlesPerSec;
+    BPLib_AS_NodeReportsPayload.BundleIngressRejectedRateBytesPerSec   = Node[BPLIB_AS_TRAFFIC_INGRESS_REJECTED].Rate.BytesPerSec;
+    BPLib_AS_NodeReportsPayload.BundleIngressRejectedRateBundlesPerSec = Node[BPLIB_AS_TRAFFIC_INGRESS_REJECTED].Rate.BundlesPerSec;
+
+    BPLib_AS_UnlockCounters();
 }
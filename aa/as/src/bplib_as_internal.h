@@ -43,6 +43,80 @@ extern BPLib_NodeMibReportsHkTlm_Payload_t     BPLib_AS_NodeReportsPayload;
 /* Macros */
 /* ====== */
 #define BPLIB_AS_MAX_MUTEX_NAME_SIZE (20u) /** \brief Max allowed length for AS counter mutex name */
+#define BPLIB_AS_NUM_CNTR_SHARDS     (8u)  /** \brief Number of counter shards that incrementing tasks are spread across */
+#define BPLIB_AS_CNTR_SHARD_ALIGN    (64u) /** \brief Shard alignment, keeps shards on separate cache lines */
+
+/* ======= */
+/* Typdefs */
+/* ======= */
+
+/**
+  * \brief   Per-task counter deltas
+  * \details Each task that increments counters is assigned one shard on first use and adds to it
+  *          with relaxed atomics. The deltas are folded into the telemetry payloads, under the
+  *          counter mutex, only when the counters are read, reset or sent.
+  */
+typedef struct
+{
+    uint32_t NodeCounters[BPLIB_AS_NUM_NODE_CNTRS];                              /** \brief Node counter deltas */
+    uint32_t SourceCounters[BPLIB_MAX_NUM_MIB_SETS][BPLIB_AS_NUM_SOURCE_CNTRS]; /** \brief Source counter deltas */
+} __attribute__((aligned(BPLIB_AS_CNTR_SHARD_ALIGN))) BPLib_AS_CounterShard_t;
+
+extern BPLib_AS_CounterShard_t BPLib_AS_CounterShards[BPLIB_AS_NUM_CNTR_SHARDS]; /** \brief Pending counter deltas */
+
+/**
+  * \brief   Throughput rate estimator for one traffic direction of the node, a contact or a channel
+  * \details Bytes and Bundles are running totals updated lock-free by BPLib_AS_RecordTraffic().
+  *          The remaining fields are only touched by BPLib_AS_UpdateRates() under the counter mutex.
+  */
+typedef struct
+{
+    uint64_t        Bytes;       /** \brief Total bytes seen */
+    uint32_t        Bundles;     /** \brief Total bundles seen */
+    uint32_t        LastBundles; /** \brief Bundles at the previous sample */
+    uint64_t        LastBytes;   /** \brief Bytes at the previous sample */
+    BPLib_AS_Rate_t Rate;        /** \brief Smoothed rate */
+} BPLib_AS_RateEstimator_t;
+
+/**
+  * \brief Throughput rate estimator state
+  */
+typedef struct
+{
+    BPLib_AS_RateEstimator_t Node[BPLIB_AS_NUM_TRAFFIC_DIRS];                            /** \brief Node-wide rates */
+    BPLib_AS_RateEstimator_t Contact[BPLIB_MAX_NUM_CONTACTS][BPLIB_AS_NUM_TRAFFIC_DIRS]; /** \brief Per-contact rates, CLA directions only */
+    BPLib_AS_RateEstimator_t Channel[BPLIB_MAX_NUM_CHANNELS][BPLIB_AS_NUM_TRAFFIC_DIRS]; /** \brief Per-channel rates, local directions only */
+    int64_t                  LastSampleTime;                                             /** \brief Monotonic time of the previous sample, 0 if none */
+} BPLib_AS_RateState_t;
+
+extern BPLib_AS_RateState_t BPLib_AS_Rates; /** \brief Throughput rate estimator state */
+
+/**
+  * \brief   Source EID hash table entry
+  * \details Written only under the counter mutex and read lock-free. Seq is odd while the
+  *          entry is being rewritten and 0 if it was never written.
+  */
+typedef struct
+{
+    uint32_t        Seq;        /** \brief Entry sequence number */
+    uint32_t        Generation; /** \brief Table generation the entry was written in */
+    uint32_t        LastUse;    /** \brief Table clock at the last hit, for LRU eviction */
+    BPLib_AS_Slot_t Slot;       /** \brief Resolved counter slot */
+    BPLib_EID_t     EID;        /** \brief Source EID */
+} __attribute__((aligned(BPLIB_AS_CNTR_SHARD_ALIGN))) BPLib_AS_SourceCacheEntry_t;
+
+/**
+  * \brief Open-addressing hash table of resolved source EIDs
+  */
+typedef struct
+{
+    BPLib_AS_SourceCacheEntry_t Entries[BPLIB_AS_SRC_CACHE_SIZE]; /** \brief Table entries */
+    uint32_t                    Generation;                       /** \brief Current generation, bumped to invalidate every entry */
+    uint32_t                    Clock;                            /** \brief Incremented on every insert */
+    BPLib_AS_SourceCacheStats_t Stats;                            /** \brief Table statistics */
+} BPLib_AS_SourceCache_t;
+
+extern BPLib_AS_SourceCache_t BPLib_AS_SourceCache; /** \brief Source EID hash table */
 
 /* =============== */
 /* Mutex Variables */
@@ -84,6 +158,37 @@ uint32_t BPLib_AS_GetCounterImpl(BPLib_EID_t *EID, BPLib_AS_Counter_t Counter);
  */
 BPLib_Status_t BPLib_AS_SetCounter(BPLib_EID_t EID, BPLib_AS_Counter_t Counter, uint32_t Value);
 
+/**
+ * \brief     Add a (possibly wrapped negative) delta to a counter in the calling task's shard
+ * \details   Lock-free: a single relaxed atomic add on a shard owned by the calling task
+ * \param[in] Slot    (BPLib_AS_Slot_t) Counter slot, see BPLib_AS_ResolveSlot()
+ * \param[in] Counter (BPLib_AS_Counter_t) Counter to modify
+ * \param[in] Delta   (uint32_t) Amount to add, modulo 2^32
+ * \return    Execution status
+ * \retval    BPLIB_AS_UNKNOWN_NODE_CNTR: Counter is outside node counters' range
+ * \retval    BPLIB_AS_UNKNOWN_SRC_CNTR: Counter is outside source counters' range
+ * \retval    BPLIB_AS_INVALID_MIB_INDEX: Slot does not refer to the node or a MIB set
+ * \retval    BPLIB_SUCCESS: Successful execution
+ */
+BPLib_Status_t BPLib_AS_AddToShard(BPLib_AS_Slot_t Slot, BPLib_AS_Counter_t Counter, uint32_t Delta);
+
+/**
+ * \brief     Remove and return the pending shard deltas of one counter
+ * \note      Slot and Counter must already be range checked
+ * \param[in] Slot    (BPLib_AS_Slot_t) Counter slot, see BPLib_AS_ResolveSlot()
+ * \param[in] Counter (BPLib_AS_Counter_t) Counter whose deltas are taken
+ * \return    Sum of the pending deltas, modulo 2^32
+ */
+uint32_t BPLib_AS_TakeShardDeltas(BPLib_AS_Slot_t Slot, BPLib_AS_Counter_t Counter);
+
+/**
+ * \brief     Fold all pending shard deltas into the node and source counter payloads
+ * \note      Caller must hold the counter mutex
+ * \return    void
+ * \ref       BPLib_AS_LockCounters [BPLib_AS_LockCounters()]
+ */
+void BPLib_AS_FoldShards(void);
+
 /**
  * \brief     Initialize the mutex that guards the node and source MIB counters
  * \details   Uses OS_MutSemCreate() with the internal MutexId and MutexName
@@ -113,6 +218,49 @@ void BPLib_AS_LockCounters(void);
  */
 void BPLib_AS_UnlockCounters(void);
 
+/**
+ * \brief     Get the current source hash table generation
+ * \details   Read before resolving an EID the slow way and passed to BPLib_AS_SourceCacheInsert()
+ *            so that results computed against stale MIB array keys are never cached
+ * \return    Generation
+ */
+uint32_t BPLib_AS_SourceCacheGeneration(void);
+
+/**
+ * \brief      Look up a source EID in the hash table without locking
+ * \param[in]  EID        (BPLib_EID_t*) Source EID
+ * \param[in]  Generation (uint32_t) Generation from BPLib_AS_SourceCacheGeneration()
+ * \param[out] Slot       (BPLib_AS_Slot_t*) Cached counter slot on a hit
+ * \return     true on a hit
+ */
+bool BPLib_AS_SourceCacheLookup(const BPLib_EID_t *EID, uint32_t Generation, BPLib_AS_Slot_t *Slot);
+
+/**
+ * \brief     Remember the counter slot of a source EID
+ * \details   Takes the counter mutex. Reuses a free or stale entry in the EID's probe window, or
+ *            evicts the least recently used one. Nothing is cached if the table was flushed
+ *            after Generation was read.
+ * \param[in] EID        (BPLib_EID_t*) Source EID
+ * \param[in] Generation (uint32_t) Generation read before Slot was resolved
+ * \param[in] Slot       (BPLib_AS_Slot_t) Counter slot to remember
+ * \return    void
+ */
+void BPLib_AS_SourceCacheInsert(const BPLib_EID_t *EID, uint32_t Generation, BPLib_AS_Slot_t Slot);
+
+/**
+ * \brief     Invalidate every entry of the source hash table
+ * \return    void
+ */
+void BPLib_AS_SourceCacheFlush(void);
+
+/**
+ * \brief     Get the estimator for one traffic direction of a contact or channel
+ * \param[in] Dir (BPLib_AS_TrafficDir_t) Traffic direction
+ * \param[in] Id  (uint32_t) Contact ID for CLA directions, channel ID for local directions
+ * \return    Estimator, or NULL if the direction or ID is out of range
+ */
+BPLib_AS_RateEstimator_t *BPLib_AS_GetRateEstimator(BPLib_AS_TrafficDir_t Dir, uint32_t Id);
+
 /**
  * \brief     Set the initial node MIB reports telemetry
  * \return    void
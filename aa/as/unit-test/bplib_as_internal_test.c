@@ -45,6 +45,10 @@ void Test_BPLib_AS_SetCounter_NodeCounter_Nominal(void)
 
     /* Verify that counter is the expected value */
     UtAssert_EQ(uint32_t, TestValue, BPLib_AS_NodeCountersPayload.NodeCounters[BUNDLE_COUNT_CUSTODY_TRANSFERRED]);
+
+    /* Verify the counter was set under the counter lock */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
 }
 
 void Test_BPLib_AS_SetCounter_SourceCounter_Nominal(void)
@@ -198,6 +202,65 @@ void Test_BPLib_AS_UnlockCounters_Error(void)
     BPLib_AS_Test_Verify_Event(0, BPLIB_AS_GIVE_MUTEX_ERR_EID, "Failed to give to the counter mutex, RC = %d");
 }
 
+void Test_BPLib_AS_SourceCacheInsert_StaleGeneration(void)
+{
+    BPLib_EID_t     Eid;
+    BPLib_AS_Slot_t Slot;
+    uint32_t        Generation;
+
+    memset(&Eid, 0, sizeof(Eid));
+    Generation = BPLib_AS_SourceCacheGeneration();
+
+    /* A result resolved before a flush is not cached */
+    BPLib_AS_SourceCacheFlush();
+    BPLib_AS_SourceCacheInsert(&Eid, Generation, 2);
+
+    UtAssert_BOOL_FALSE(BPLib_AS_SourceCacheLookup(&Eid, BPLib_AS_SourceCacheGeneration(), &Slot));
+    UtAssert_UINT32_EQ(BPLib_AS_SourceCache.Stats.Inserts, 0);
+}
+
+void Test_BPLib_AS_SourceCacheInsert_Evict(void)
+{
+    BPLib_EID_t     Eid;
+    BPLib_AS_Slot_t Slot;
+    uint32_t        Index;
+
+    /* Fill the whole table with live entries for other sources */
+    for (Index = 0; Index < BPLIB_AS_SRC_CACHE_SIZE; Index++)
+    {
+        BPLib_AS_SourceCache.Entries[Index].Seq      = 2;
+        BPLib_AS_SourceCache.Entries[Index].EID.Node = Index + 1000;
+    }
+
+    memset(&Eid, 0, sizeof(Eid));
+    BPLib_AS_SourceCacheInsert(&Eid, BPLib_AS_SourceCacheGeneration(), 5);
+
+    UtAssert_UINT32_EQ(BPLib_AS_SourceCache.Stats.Evictions, 1);
+    UtAssert_BOOL_TRUE(BPLib_AS_SourceCacheLookup(&Eid, BPLib_AS_SourceCacheGeneration(), &Slot));
+    UtAssert_UINT16_EQ(Slot, 5);
+}
+
+void Test_BPLib_AS_SourceCacheLookup_Busy(void)
+{
+    BPLib_EID_t     Eid;
+    BPLib_AS_Slot_t Slot;
+    uint32_t        Index;
+
+    memset(&Eid, 0, sizeof(Eid));
+    BPLib_AS_SourceCacheInsert(&Eid, BPLib_AS_SourceCacheGeneration(), 5);
+
+    /* An entry being rewritten is treated as a miss */
+    for (Index = 0; Index < BPLIB_AS_SRC_CACHE_SIZE; Index++)
+    {
+        if (BPLib_AS_SourceCache.Entries[Index].Seq != 0)
+        {
+            BPLib_AS_SourceCache.Entries[Index].Seq++;
+        }
+    }
+
+    UtAssert_BOOL_FALSE(BPLib_AS_SourceCacheLookup(&Eid, BPLib_AS_SourceCacheGeneration(), &Slot));
+}
+
 void TestBplibAsInternal_Register(void)
 {
     ADD_TEST(Test_BPLib_AS_SetCounter_NodeCounter_Nominal);
@@ -210,4 +273,7 @@ void TestBplibAsInternal_Register(void)
     ADD_TEST(Test_BPLib_AS_LockUnlockCounters_Nominal);
     ADD_TEST(Test_BPLib_AS_LockCounters_Error);
     ADD_TEST(Test_BPLib_AS_UnlockCounters_Error);
+    ADD_TEST(Test_BPLib_AS_SourceCacheInsert_StaleGeneration);
+    ADD_TEST(Test_BPLib_AS_SourceCacheInsert_Evict);
+    ADD_TEST(Test_BPLib_AS_SourceCacheLookup_Busy);
 }
\ No newline at end of file
@@ -54,6 +54,10 @@ void Test_BPLib_AS_Increment_NodeCounter_Nominal(void)
     BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DISCARDED, 5);
     TestValue += 5;
 
+    /* The increment is only pending in the task's shard until folded */
+    UtAssert_EQ(uint32_t, TestValue - 5, BPLib_AS_NodeCountersPayload.NodeCounters[BUNDLE_COUNT_DISCARDED]);
+    BPLib_AS_FoldShards();
+
     /* Verify that counter is the expected value */
     UtAssert_EQ(uint32_t, TestValue, BPLib_AS_NodeCountersPayload.NodeCounters[BUNDLE_COUNT_DISCARDED]);
 }
@@ -66,18 +70,21 @@ void Test_BPLib_AS_Increment_SourceCounter_Nominal(void)
     /* Force BPLib_AS_Increment to see the given EID as valid and for a source counter */
     UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsValid), true);
     UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), false);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_PatternIsMatch), true);
 
     /* Set values to test against */
     MibIndex = 3;
     TestValue = 17;
+    BPLib_AS_SourceCountersPayload.MibArray[MibIndex].ActiveKeys = 1;
     BPLib_AS_SourceCountersPayload.MibArray[MibIndex].SourceCounters[BUNDLE_COUNT_FORWARDED] = TestValue;
 
     /* Run function under test */
     BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_FORWARDED, 7);
     TestValue += 7;
+    BPLib_AS_FoldShards();
 
-    // /* Verify that counter is the expected value */
-    // UtAssert_EQ(uint32_t, TestValue, BPLib_AS_SourceCountersPayload.MibArray[MibIndex].SourceCounters[BUNDLE_COUNT_FORWARDED]);
+    /* Verify that counter is the expected value */
+    UtAssert_EQ(uint32_t, TestValue, BPLib_AS_SourceCountersPayload.MibArray[MibIndex].SourceCounters[BUNDLE_COUNT_FORWARDED]);
 }
 
 void Test_BPLib_AS_Increment_InvalidEID_Error(void)
@@ -113,13 +120,14 @@ void Test_BPLib_AS_Increment_UnkNodeCtr_Error(void)
 
     /* Run the function under test */
     BPLib_AS_Increment(BPLIB_EID_INSTANCE, BPLIB_AS_NUM_NODE_CNTRS, 8);
+    BPLib_AS_FoldShards();
 
     /* Verify that counter was set to the expected value */
     UtAssert_EQ(uint32_t, TestValue, BPLib_AS_NodeCountersPayload.NodeCounters[BUNDLE_COUNT_FRAGMENTED]);
 
     /* Demonstrate that the correct error event was issued */
     BPLib_AS_Test_Verify_Event(0, BPLIB_AS_SET_CTR_ERR_EID,
-                                "Could not increment node counter %d to %d, RC = %d");
+                                "Could not increment %s counter %d by %d, RC = %d");
 }
 
 void Test_BPLib_AS_Increment_UnkSrcCtr_Error(void)
@@ -130,23 +138,25 @@ void Test_BPLib_AS_Increment_UnkSrcCtr_Error(void)
     /* Force BPLib_AS_Increment to see the given EID as valid and for a source counter */
     UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsValid), true);
     UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), false);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_PatternIsMatch), true);
 
     /* Set values to test against */
     TestValue = 66;
-    MibEntry  = 10;
+    MibEntry  = 9;
 
+    BPLib_AS_SourceCountersPayload.MibArray[MibEntry].ActiveKeys = 1;
     BPLib_AS_SourceCountersPayload.MibArray[MibEntry].SourceCounters[BUNDLE_COUNT_FRAGMENT_ERROR] = TestValue;
 
     /* Run the function under test */
     BPLib_AS_Increment(BPLIB_EID_INSTANCE, BPLIB_AS_NUM_SOURCE_CNTRS, 6);
+    BPLib_AS_FoldShards();
 
     /* Verify that counter was set to the expected value */
-    // UtAssert_STUB_COUNT(BPLib_AS_SetCounter, 1);
-    // UtAssert_EQ(uint32_t, TestValue, BPLib_AS_SourceCountersPayload.MibArray[MibEntry].SourceCounters[BUNDLE_COUNT_FRAGMENT_ERROR]);
+    UtAssert_EQ(uint32_t, TestValue, BPLib_AS_SourceCountersPayload.MibArray[MibEntry].SourceCounters[BUNDLE_COUNT_FRAGMENT_ERROR]);
 
     /* Demonstrate that the correct error event was issued */
-    // BPLib_AS_Test_Verify_Event(0, BPLIB_AS_SET_CTR_ERR_EID,
-    //                             "Could not increment source counter %d to %d, RC = %d");
+    BPLib_AS_Test_Verify_Event(0, BPLIB_AS_SET_CTR_ERR_EID,
+                                "Could not increment %s counter %d by %d, RC = %d");
 }
 
 void Test_BPLib_AS_Decrement_NodeCounter_Nominal(void)
@@ -164,6 +174,7 @@ void Test_BPLib_AS_Decrement_NodeCounter_Nominal(void)
     /* Run function under test */
     BPLib_AS_Decrement(BPLIB_EID_INSTANCE, BUNDLE_COUNT_CUSTODY_TRANSFERRED, 4);
     TestValue -= 4;
+    BPLib_AS_FoldShards();
 
     /* Verify that counter is the expected value */
     UtAssert_EQ(uint32_t, TestValue, BPLib_AS_NodeCountersPayload.NodeCounters[BUNDLE_COUNT_CUSTODY_TRANSFERRED]);
@@ -177,18 +188,21 @@ void Test_BPLib_AS_Decrement_SourceCounter_Nominal(void)
     /* Force BPLib_AS_Decrement to see the given EID as valid and for a source counter */
     UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsValid), true);
     UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), false);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_PatternIsMatch), true);
 
     /* Set values to test against */
     MibIndex = 2;
     TestValue = 6;
+    BPLib_AS_SourceCountersPayload.MibArray[MibIndex].ActiveKeys = 1;
     BPLib_AS_SourceCountersPayload.MibArray[MibIndex].SourceCounters[BUNDLE_COUNT_CUSTODY_TRANSFERRED] = TestValue;
 
     /* Run function under test */
     BPLib_AS_Decrement(BPLIB_EID_INSTANCE, BUNDLE_COUNT_CUSTODY_TRANSFERRED, 4);
     TestValue -= 4;
+    BPLib_AS_FoldShards();
 
-    // /* Verify that counter is the expected value */
-    // UtAssert_EQ(uint32_t, TestValue, BPLib_AS_SourceCountersPayload.MibArray[MibIndex].SourceCounters[BUNDLE_COUNT_CUSTODY_TRANSFERRED]);
+    /* Verify that counter is the expected value */
+    UtAssert_EQ(uint32_t, TestValue, BPLib_AS_SourceCountersPayload.MibArray[MibIndex].SourceCounters[BUNDLE_COUNT_CUSTODY_TRANSFERRED]);
 }
 
 void Test_BPLib_AS_Decrement_InvalidEID_Error(void)
@@ -224,13 +238,14 @@ void Test_BPLib_AS_Decrement_UnkNodeCtr_Error(void)
 
     /* Run the function under test */
     BPLib_AS_Decrement(BPLIB_EID_INSTANCE, BPLIB_AS_NUM_NODE_CNTRS, 5);
+    BPLib_AS_FoldShards();
 
     /* Verify that counter was set to the expected value */
     UtAssert_EQ(uint32_t, TestValue, BPLib_AS_NodeCountersPayload.NodeCounters[BUNDLE_COUNT_DELETED]);
 
     /* Demonstrate that the correct error event was issued */
     BPLib_AS_Test_Verify_Event(0, BPLIB_AS_SET_CTR_ERR_EID,
-                                "Could not decrement node counter %d to %d, RC = %d");
+                                "Could not decrement %s counter %d by %d, RC = %d");
 }
 
 void Test_BPLib_AS_Decrement_UnkSrcCtr_Error(void)
@@ -239,24 +254,27 @@ void Test_BPLib_AS_Decrement_UnkSrcCtr_Error(void)
     uint32_t MibEntry;
 
     /* Force BPLib_AS_Decrement to see the given EID as valid and for a source counter */
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsValid), true);
     UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), false);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_PatternIsMatch), true);
 
     /* Set values to test against */
     TestValue = 5;
     MibEntry  = 1;
 
+    BPLib_AS_SourceCountersPayload.MibArray[MibEntry].ActiveKeys = 1;
     BPLib_AS_SourceCountersPayload.MibArray[MibEntry].SourceCounters[BUNDLE_COUNT_DELIVERED] = TestValue;
 
     /* Run the function under test */
     BPLib_AS_Decrement(BPLIB_EID_INSTANCE, BPLIB_AS_NUM_SOURCE_CNTRS, 5);
+    BPLib_AS_FoldShards();
 
     /* Verify that counter was set to the expected value */
-    // UtAssert_STUB_COUNT(BPLib_AS_SetCounter, 1);
-    // UtAssert_EQ(uint32_t, TestValue, BPLib_AS_SourceCountersPayload.MibArray[MibEntry].SourceCounters[BUNDLE_COUNT_DELIVERED]);
+    UtAssert_EQ(uint32_t, TestValue, BPLib_AS_SourceCountersPayload.MibArray[MibEntry].SourceCounters[BUNDLE_COUNT_DELIVERED]);
 
     /* Demonstrate that the correct error event was issued */
-    // BPLib_AS_Test_Verify_Event(0, BPLIB_AS_SET_CTR_ERR_EID,
-    //                             "Could not decrement source counter %d to %d, RC = %d");
+    BPLib_AS_Test_Verify_Event(0, BPLIB_AS_SET_CTR_ERR_EID,
+                                "Could not decrement %s counter %d by %d, RC = %d");
 }
 
 void Test_BPLib_AS_ResetCounter_NodeCtr_Nominal(void)
@@ -1148,6 +1166,350 @@ void Test_BPLib_AS_GetCounter_SrcCounter(void)
     UtAssert_EQ(uint32_t, BPLib_AS_GetCounter(&Eid, BUNDLE_COUNT_DELIVERED), 0);
 }
 
+void Test_BPLib_AS_ResolveSlot_Node(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), true);
+
+    UtAssert_UINT16_EQ(BPLib_AS_ResolveSlot(&BPLIB_EID_INSTANCE), BPLIB_AS_NODE_CNTR_INDICATOR);
+}
+
+void Test_BPLib_AS_ResolveSlot_Source(void)
+{
+    BPLib_EID_t Eid;
+
+    memset(&Eid, 0, sizeof(Eid));
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), false);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsValid), true);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_PatternIsMatch), true);
+
+    /* Only MIB set 4 has an active key */
+    BPLib_AS_SourceCountersPayload.MibArray[4].ActiveKeys = 1;
+
+    UtAssert_UINT16_EQ(BPLib_AS_ResolveSlot(&Eid), 4);
+    UtAssert_STUB_COUNT(BPLib_EID_PatternIsMatch, 1);
+}
+
+void Test_BPLib_AS_ResolveSlot_NoMatch(void)
+{
+    BPLib_EID_t Eid;
+
+    memset(&Eid, 0, sizeof(Eid));
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), false);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsValid), true);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_PatternIsMatch), false);
+
+    BPLib_AS_SourceCountersPayload.MibArray[0].ActiveKeys = 2;
+
+    UtAssert_UINT16_EQ(BPLib_AS_ResolveSlot(&Eid), BPLIB_AS_INVALID_SLOT);
+    UtAssert_STUB_COUNT(BPLib_EID_PatternIsMatch, 2);
+}
+
+void Test_BPLib_AS_ResolveSlot_InvalidEid(void)
+{
+    BPLib_EID_t Eid;
+
+    memset(&Eid, 0, sizeof(Eid));
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), false);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsValid), false);
+
+    UtAssert_UINT16_EQ(BPLib_AS_ResolveSlot(&Eid), BPLIB_AS_INVALID_SLOT);
+    UtAssert_UINT16_EQ(BPLib_AS_ResolveSlot(NULL), BPLIB_AS_INVALID_SLOT);
+    UtAssert_STUB_COUNT(BPLib_EID_PatternIsMatch, 0);
+}
+
+void Test_BPLib_AS_ResolveSourceSlot_Instance(void)
+{
+    BPLib_EID_t Eid;
+
+    memset(&Eid, 0, sizeof(Eid));
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), true);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsValid), true);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_PatternIsMatch), true);
+
+    /* A bundle sourced by this node is counted against the MIB set covering it, not the node */
+    BPLib_AS_SourceCountersPayload.MibArray[2].ActiveKeys = 1;
+
+    UtAssert_UINT16_EQ(BPLib_AS_ResolveSourceSlot(&Eid), 2);
+    UtAssert_UINT16_EQ(BPLib_AS_ResolveSourceSlot(NULL), BPLIB_AS_INVALID_SLOT);
+}
+
+/* A bundle's source is resolved once, then its source counters are counted alongside the node's */
+void Test_BPLib_AS_ResolveSourceSlot_Counted(void)
+{
+    BPLib_EID_t     Eid;
+    BPLib_AS_Slot_t Slot;
+
+    memset(&Eid, 0, sizeof(Eid));
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), false);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsValid), true);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_PatternIsMatch), true);
+
+    BPLib_AS_SourceCountersPayload.MibArray[1].ActiveKeys = 1;
+
+    Slot = BPLib_AS_ResolveSourceSlot(&Eid);
+    BPLib_AS_IncrementSlot(Slot, BUNDLE_COUNT_RECEIVED, 1);
+    BPLib_AS_IncrementSlot(Slot, BUNDLE_COUNT_RECEIVED, 1);
+
+    UtAssert_UINT32_EQ(BPLib_AS_GetCounter(&Eid, BUNDLE_COUNT_RECEIVED), 2);
+}
+
+void Test_BPLib_AS_IncrementSlot_Nominal(void)
+{
+    BPLib_AS_NodeCountersPayload.NodeCounters[BUNDLE_COUNT_RECEIVED]            = 10;
+    BPLib_AS_SourceCountersPayload.MibArray[1].SourceCounters[BUNDLE_COUNT_RECEIVED] = 20;
+
+    /* Several updates against a slot resolved once, with no EID comparisons */
+    BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_RECEIVED, 1);
+    BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_RECEIVED, 2);
+    BPLib_AS_IncrementSlot(1, BUNDLE_COUNT_RECEIVED, 3);
+    UtAssert_STUB_COUNT(BPLib_EID_IsMatch, 0);
+
+    BPLib_AS_FoldShards();
+
+    UtAssert_UINT32_EQ(BPLib_AS_NodeCountersPayload.NodeCounters[BUNDLE_COUNT_RECEIVED], 13);
+    UtAssert_UINT32_EQ(BPLib_AS_SourceCountersPayload.MibArray[1].SourceCounters[BUNDLE_COUNT_RECEIVED], 23);
+}
+
+void Test_BPLib_AS_IncrementSlot_InvalidSlot(void)
+{
+    /* Untracked sources are silently ignored */
+    BPLib_AS_IncrementSlot(BPLIB_AS_INVALID_SLOT, BUNDLE_COUNT_RECEIVED, 1);
+    UtAssert_STUB_COUNT(BPLib_EM_SendEvent, 0);
+
+    /* Out of range slots and counters are reported */
+    BPLib_AS_IncrementSlot(BPLIB_MAX_NUM_MIB_SETS + 1, BUNDLE_COUNT_RECEIVED, 1);
+    BPLib_AS_Test_Verify_Event(0, BPLIB_AS_SET_CTR_ERR_EID,
+                                "Could not increment counter %d in slot %d by %d, RC = %d");
+
+    BPLib_AS_IncrementSlot(0, BPLIB_AS_NUM_SOURCE_CNTRS, 1);
+    UtAssert_STUB_COUNT(BPLib_EM_SendEvent, 2);
+
+    BPLib_AS_FoldShards();
+    Test_BPLib_AS_NodeCountersValueTest(0);
+}
+
+void Test_BPLib_AS_Shards_FoldedOnSend(void)
+{
+    BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_FORWARDED, 4);
+
+    UtAssert_INT32_EQ(BPLib_AS_SendNodeMibCountersHk(), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(BPLib_AS_NodeCountersPayload.NodeCounters[BUNDLE_COUNT_FORWARDED], 4);
+
+    /* Nothing left pending after folding */
+    UtAssert_UINT32_EQ(BPLib_AS_TakeShardDeltas(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_FORWARDED), 0);
+}
+
+void Test_BPLib_AS_Shards_DiscardedOnReset(void)
+{
+    BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_FORWARDED, 4);
+    BPLib_AS_IncrementSlot(2, BUNDLE_COUNT_FORWARDED, 5);
+
+    BPLib_AS_ResetAllCounters();
+
+    BPLib_AS_FoldShards();
+    UtAssert_UINT32_EQ(BPLib_AS_NodeCountersPayload.NodeCounters[BUNDLE_COUNT_FORWARDED], 0);
+    UtAssert_UINT32_EQ(BPLib_AS_SourceCountersPayload.MibArray[2].SourceCounters[BUNDLE_COUNT_FORWARDED], 0);
+}
+
+void Test_BPLib_AS_GetCounter_Pending(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsValid), true);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), true);
+
+    BPLib_AS_NodeCountersPayload.NodeCounters[BUNDLE_COUNT_DELIVERED] = 10;
+    BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DELIVERED, 5);
+
+    UtAssert_UINT32_EQ(BPLib_AS_GetCounter(&BPLIB_EID_INSTANCE, BUNDLE_COUNT_DELIVERED), 15);
+}
+
+void Test_BPLib_AS_RecordTraffic_Nominal(void)
+{
+    BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_INGRESS, 0, 100);
+    BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_INGRESS, 0, 50);
+    BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_DELIVERED, 1, 10);
+
+    UtAssert_EQ(uint64_t, BPLib_AS_Rates.Contact[0][BPLIB_AS_TRAFFIC_INGRESS].Bytes, 150);
+    UtAssert_UINT32_EQ(BPLib_AS_Rates.Contact[0][BPLIB_AS_TRAFFIC_INGRESS].Bundles, 2);
+    UtAssert_EQ(uint64_t, BPLib_AS_Rates.Channel[1][BPLIB_AS_TRAFFIC_DELIVERED].Bytes, 10);
+    UtAssert_EQ(uint64_t, BPLib_AS_Rates.Node[BPLIB_AS_TRAFFIC_INGRESS].Bytes, 150);
+    UtAssert_UINT32_EQ(BPLib_AS_Rates.Node[BPLIB_AS_TRAFFIC_DELIVERED].Bundles, 1);
+}
+
+void Test_BPLib_AS_RecordTraffic_InvalidId(void)
+{
+    BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_EGRESS, BPLIB_MAX_NUM_CONTACTS, 100);
+    BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_INGESTED, BPLIB_MAX_NUM_CHANNELS, 100);
+    BPLib_AS_RecordTraffic(BPLIB_AS_NUM_TRAFFIC_DIRS, 0, 100);
+
+    UtAssert_UINT32_EQ(BPLib_AS_Rates.Node[BPLIB_AS_TRAFFIC_EGRESS].Bundles, 0);
+    UtAssert_UINT32_EQ(BPLib_AS_Rates.Node[BPLIB_AS_TRAFFIC_INGESTED].Bundles, 0);
+}
+
+void Test_BPLib_AS_UpdateRates_Ewma(void)
+{
+    BPLib_AS_Rate_t Rate;
+
+    /* Baseline at 1s, then two samples 1s apart */
+    UT_SetDeferredRetcode(UT_KEY(BPLib_TIME_GetMonotonicTime), 1, 1000);
+    UT_SetDeferredRetcode(UT_KEY(BPLib_TIME_GetMonotonicTime), 1, 2000);
+    UT_SetDeferredRetcode(UT_KEY(BPLib_TIME_GetMonotonicTime), 1, 3000);
+
+    BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_EGRESS, 0, 500);
+    BPLib_AS_UpdateRates();
+
+    /* 20 bundles and 2000 bytes in one second: one tenth of the way to the new sample */
+    BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_EGRESS, 0, 1100);
+    BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_EGRESS, 0, 900);
+    BPLib_AS_UpdateRates();
+
+    UtAssert_INT32_EQ(BPLib_AS_GetRate(BPLIB_AS_TRAFFIC_EGRESS, 0, &Rate), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Rate.BytesPerSec, 200);
+    UtAssert_UINT32_EQ(BPLib_AS_Rates.Node[BPLIB_AS_TRAFFIC_EGRESS].Rate.BytesPerSec, 200);
+
+    /* An idle second decays the rate */
+    BPLib_AS_UpdateRates();
+
+    UtAssert_INT32_EQ(BPLib_AS_GetRate(BPLIB_AS_TRAFFIC_EGRESS, 0, &Rate), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Rate.BytesPerSec, 180);
+}
+
+void Test_BPLib_AS_UpdateRates_LongInterval(void)
+{
+    BPLib_AS_Rate_t Rate;
+
+    UT_SetDeferredRetcode(UT_KEY(BPLib_TIME_GetMonotonicTime), 1, 1000);
+    UT_SetDeferredRetcode(UT_KEY(BPLib_TIME_GetMonotonicTime), 1, 1000 + 2 * BPLIB_AS_RATE_WINDOW_MS);
+
+    BPLib_AS_UpdateRates();
+
+    BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_INGESTED, 1, 2 * BPLIB_AS_RATE_WINDOW_MS);
+    BPLib_AS_UpdateRates();
+
+    /* An interval longer than the window replaces the rate outright */
+    UtAssert_INT32_EQ(BPLib_AS_GetRate(BPLIB_AS_TRAFFIC_INGESTED, 1, &Rate), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Rate.BytesPerSec, 1000);
+}
+
+void Test_BPLib_AS_UpdateRates_TooSoon(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(BPLib_TIME_GetMonotonicTime), 1, 1000);
+    UT_SetDeferredRetcode(UT_KEY(BPLib_TIME_GetMonotonicTime), 1, 1000 + BPLIB_AS_RATE_MIN_SAMPLE_MS - 1);
+
+    BPLib_AS_UpdateRates();
+
+    BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_INGRESS, 0, 100);
+    BPLib_AS_UpdateRates();
+
+    /* The traffic stays pending for the next sample */
+    UtAssert_EQ(int64_t, BPLib_AS_Rates.LastSampleTime, 1000);
+    UtAssert_EQ(uint64_t, BPLib_AS_Rates.Contact[0][BPLIB_AS_TRAFFIC_INGRESS].LastBytes, 0);
+    UtAssert_UINT32_EQ(BPLib_AS_Rates.Contact[0][BPLIB_AS_TRAFFIC_INGRESS].Rate.BytesPerSec, 0);
+}
+
+void Test_BPLib_AS_GetRate_Error(void)
+{
+    BPLib_AS_Rate_t Rate;
+
+    UtAssert_INT32_EQ(BPLib_AS_GetRate(BPLIB_AS_TRAFFIC_INGRESS, 0, NULL), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_AS_GetRate(BPLIB_AS_TRAFFIC_INGRESS_REJECTED, BPLIB_MAX_NUM_CONTACTS, &Rate),
+                      BPLIB_INVALID_CONT_ID_ERR);
+    UtAssert_INT32_EQ(BPLib_AS_GetRate(BPLIB_AS_TRAFFIC_DELIVERED, BPLIB_MAX_NUM_CHANNELS, &Rate),
+                      BPLIB_INVALID_CHAN_ID_ERR);
+    UtAssert_INT32_EQ(BPLib_AS_GetRate(BPLIB_AS_NUM_TRAFFIC_DIRS, 0, &Rate), BPLIB_ERROR);
+}
+
+void Test_BPLib_AS_SendNodeMibReportsHk_Rates(void)
+{
+    BPLib_Instance_t Inst;
+
+    memset(&Inst, 0, sizeof(Inst));
+    BPLib_AS_Rates.LastSampleTime = 5000;
+    BPLib_AS_Rates.Node[BPLIB_AS_TRAFFIC_INGRESS].Rate.BytesPerSec            = 11;
+    BPLib_AS_Rates.Node[BPLIB_AS_TRAFFIC_INGRESS_REJECTED].Rate.BundlesPerSec = 12;
+    BPLib_AS_Rates.Node[BPLIB_AS_TRAFFIC_EGRESS].Rate.BytesPerSec             = 13;
+    BPLib_AS_Rates.Node[BPLIB_AS_TRAFFIC_INGESTED].Rate.BundlesPerSec         = 14;
+    BPLib_AS_Rates.Node[BPLIB_AS_TRAFFIC_DELIVERED].Rate.BytesPerSec          = 15;
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetMonotonicTime), 5000);
+
+    UtAssert_INT32_EQ(BPLib_AS_SendNodeMibReportsHk(&Inst), BPLIB_SUCCESS);
+
+    UtAssert_UINT32_EQ(BPLib_AS_NodeReportsPayload.BundleIngressRateBytesPerSec, 11);
+    UtAssert_UINT32_EQ(BPLib_AS_NodeReportsPayload.BundleIngressRejectedRateBundlesPerSec, 12);
+    UtAssert_UINT32_EQ(BPLib_AS_NodeReportsPayload.BundleEgressRateBytesPerSec, 13);
+    UtAssert_UINT32_EQ(BPLib_AS_NodeReportsPayload.BundleIngestedRateBundlesPerSec, 14);
+    UtAssert_UINT32_EQ(BPLib_AS_NodeReportsPayload.BundleDeliveryRateBytesPerSec, 15);
+}
+
+void Test_BPLib_AS_ResolveSlot_Cached(void)
+{
+    BPLib_EID_t Eid;
+    BPLib_AS_SourceCacheStats_t Stats;
+
+    memset(&Eid, 0, sizeof(Eid));
+    Eid.Node = 42;
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), false);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsValid), true);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_PatternIsMatch), true);
+
+    BPLib_AS_SourceCountersPayload.MibArray[3].ActiveKeys = 1;
+
+    /* Only the first resolution scans the MIB array keys */
+    UtAssert_UINT16_EQ(BPLib_AS_ResolveSlot(&Eid), 3);
+    UtAssert_UINT16_EQ(BPLib_AS_ResolveSlot(&Eid), 3);
+    UtAssert_STUB_COUNT(BPLib_EID_PatternIsMatch, 1);
+    UtAssert_STUB_COUNT(BPLib_EID_IsValid, 1);
+
+    UtAssert_INT32_EQ(BPLib_AS_GetSourceCacheStats(&Stats), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Stats.Misses, 1);
+    UtAssert_UINT32_EQ(Stats.Inserts, 1);
+    UtAssert_UINT32_EQ(Stats.Evictions, 0);
+}
+
+void Test_BPLib_AS_ResolveSlot_NoMatchCached(void)
+{
+    BPLib_EID_t Eid;
+
+    memset(&Eid, 0, sizeof(Eid));
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), false);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsValid), true);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_PatternIsMatch), false);
+
+    BPLib_AS_SourceCountersPayload.MibArray[0].ActiveKeys = 1;
+
+    /* Sources outside every MIB set are remembered too */
+    UtAssert_UINT16_EQ(BPLib_AS_ResolveSlot(&Eid), BPLIB_AS_INVALID_SLOT);
+    UtAssert_UINT16_EQ(BPLib_AS_ResolveSlot(&Eid), BPLIB_AS_INVALID_SLOT);
+    UtAssert_STUB_COUNT(BPLib_EID_PatternIsMatch, 1);
+}
+
+void Test_BPLib_AS_ResolveSlot_Flushed(void)
+{
+    BPLib_EID_t Eid;
+    BPLib_AS_SourceCacheStats_t Stats;
+
+    memset(&Eid, 0, sizeof(Eid));
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), false);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsValid), true);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_PatternIsMatch), true);
+
+    BPLib_AS_SourceCountersPayload.MibArray[1].ActiveKeys = 1;
+    UtAssert_UINT16_EQ(BPLib_AS_ResolveSlot(&Eid), 1);
+
+    /* A key change invalidates every resolved source */
+    BPLib_AS_SourceCacheFlush();
+    UtAssert_UINT16_EQ(BPLib_AS_ResolveSlot(&Eid), 1);
+    UtAssert_STUB_COUNT(BPLib_EID_PatternIsMatch, 2);
+
+    UtAssert_INT32_EQ(BPLib_AS_GetSourceCacheStats(&Stats), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Stats.Flushes, 1);
+    UtAssert_UINT32_EQ(Stats.Misses, 2);
+}
+
+void Test_BPLib_AS_GetSourceCacheStats_Null(void)
+{
+    UtAssert_INT32_EQ(BPLib_AS_GetSourceCacheStats(NULL), BPLIB_NULL_PTR_ERROR);
+}
+
 void TestBplibAs_Register(void)
 {
     ADD_TEST(Test_BPLib_AS_Init_Nominal);
@@ -1159,6 +1521,23 @@ void TestBplibAs_Register(void)
     ADD_TEST(Test_BPLib_AS_Increment_UnkNodeCtr_Error);
     ADD_TEST(Test_BPLib_AS_Increment_UnkSrcCtr_Error);
 
+    ADD_TEST(Test_BPLib_AS_ResolveSlot_Node);
+    ADD_TEST(Test_BPLib_AS_ResolveSlot_Source);
+    ADD_TEST(Test_BPLib_AS_ResolveSlot_NoMatch);
+    ADD_TEST(Test_BPLib_AS_ResolveSlot_InvalidEid);
+    ADD_TEST(Test_BPLib_AS_ResolveSlot_Cached);
+    ADD_TEST(Test_BPLib_AS_ResolveSlot_NoMatchCached);
+    ADD_TEST(Test_BPLib_AS_ResolveSlot_Flushed);
+    ADD_TEST(Test_BPLib_AS_ResolveSourceSlot_Instance);
+    ADD_TEST(Test_BPLib_AS_ResolveSourceSlot_Counted);
+    ADD_TEST(Test_BPLib_AS_GetSourceCacheStats_Null);
+
+    ADD_TEST(Test_BPLib_AS_IncrementSlot_Nominal);
+    ADD_TEST(Test_BPLib_AS_IncrementSlot_InvalidSlot);
+
+    ADD_TEST(Test_BPLib_AS_Shards_FoldedOnSend);
+    ADD_TEST(Test_BPLib_AS_Shards_DiscardedOnReset);
+
     ADD_TEST(Test_BPLib_AS_Decrement_NodeCounter_Nominal);
     ADD_TEST(Test_BPLib_AS_Decrement_SourceCounter_Nominal);
     ADD_TEST(Test_BPLib_AS_Decrement_InvalidEID_Error);
@@ -1187,6 +1566,14 @@ void TestBplibAs_Register(void)
 
     ADD_TEST(Test_BPLib_AS_SendNodeMibReportsHk_Nominal);
     ADD_TEST(Test_BPLib_AS_SendNodeMibReportsHk_Null);
+    ADD_TEST(Test_BPLib_AS_SendNodeMibReportsHk_Rates);
+
+    ADD_TEST(Test_BPLib_AS_RecordTraffic_Nominal);
+    ADD_TEST(Test_BPLib_AS_RecordTraffic_InvalidId);
+    ADD_TEST(Test_BPLib_AS_UpdateRates_Ewma);
+    ADD_TEST(Test_BPLib_AS_UpdateRates_LongInterval);
+    ADD_TEST(Test_BPLib_AS_UpdateRates_TooSoon);
+    ADD_TEST(Test_BPLib_AS_GetRate_Error);
     
     ADD_TEST(Test_BPLib_AS_AddMibArrayKey_Nominal);
     ADD_TEST(Test_BPLib_AS_AddMibArrayKey_AllocatorOverlap_Error);
@@ -1198,6 +1585,7 @@ void TestBplibAs_Register(void)
 
     ADD_TEST(Test_BPLib_AS_GetCounter_Nominal);
     ADD_TEST(Test_BPLib_AS_GetCounter_Null);
+    ADD_TEST(Test_BPLib_AS_GetCounter_Pending);
     ADD_TEST(Test_BPLib_AS_GetCounter_InvalidCounter);
     ADD_TEST(Test_BPLib_AS_GetCounter_InvalidEid);
     ADD_TEST(Test_BPLib_AS_GetCounter_SrcCounter);
@@ -36,6 +36,7 @@
 
 BPLib_AS_IncrementDecrementContext_t Context_BPLib_AS_Increment[UT_MAX_INCDEC_DEPTH];
 BPLib_AS_IncrementDecrementContext_t Context_BPLib_AS_Decrement[UT_MAX_INCDEC_DEPTH];
+BPLib_AS_IncrementSlotContext_t      Context_BPLib_AS_IncrementSlot[UT_MAX_INCDEC_DEPTH];
 
 /* ==================== */
 /* Function Definitions */
@@ -85,4 +86,27 @@ void UT_Handler_BPLib_AS_Decrement(void *UserObj, UT_EntryKey_t FuncKey, const U
         Context_BPLib_AS_Decrement[CallNum].Counter = UT_Hook_GetArgValueByName(Context, "Counter", BPLib_AS_Counter_t);
         Context_BPLib_AS_Decrement[CallNum].Amount  = UT_Hook_GetArgValueByName(Context, "Amount",  uint32_t);
     }
-}
\ No newline at end of file
+}
+
+void UT_Handler_BPLib_AS_IncrementSlot(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint16 CallCount;
+    uint16 CallNum;
+
+    CallCount = UT_GetStubCount(UT_KEY(BPLib_AS_IncrementSlot));
+
+    if (CallCount > UT_MAX_INCDEC_DEPTH)
+    {
+        UtAssert_Failed("BPLib_AS_IncrementSlot call history depth exceeded. Called: %u, Max: %u",
+                        CallCount,
+                        UT_MAX_INCDEC_DEPTH);
+    }
+    else
+    {
+        CallNum = CallCount - 1;
+
+        Context_BPLib_AS_IncrementSlot[CallNum].Slot    = UT_Hook_GetArgValueByName(Context, "Slot",    BPLib_AS_Slot_t);
+        Context_BPLib_AS_IncrementSlot[CallNum].Counter = UT_Hook_GetArgValueByName(Context, "Counter", BPLib_AS_Counter_t);
+        Context_BPLib_AS_IncrementSlot[CallNum].Amount  = UT_Hook_GetArgValueByName(Context, "Amount",  uint32_t);
+    }
+}
@@ -49,12 +49,21 @@ typedef struct
     uint32_t           Amount;
 } BPLib_AS_IncrementDecrementContext_t;
 
+/* Unit test slot increment hook information */
+typedef struct
+{
+    BPLib_AS_Slot_t    Slot;
+    BPLib_AS_Counter_t Counter;
+    uint32_t           Amount;
+} BPLib_AS_IncrementSlotContext_t;
+
 /* =========== */
 /* Global Data */
 /* =========== */
 
 extern BPLib_AS_IncrementDecrementContext_t Context_BPLib_AS_Increment[];
 extern BPLib_AS_IncrementDecrementContext_t Context_BPLib_AS_Decrement[];
+extern BPLib_AS_IncrementSlotContext_t      Context_BPLib_AS_IncrementSlot[];
 
 /* ==================== */
 /* Function Definitions */
@@ -64,4 +73,6 @@ void UT_Handler_BPLib_AS_Increment(void *UserObj, UT_EntryKey_t FuncKey, const U
 
 void UT_Handler_BPLib_AS_Decrement(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context);
 
+void UT_Handler_BPLib_AS_IncrementSlot(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context);
+
 #endif /* BPLIB_AS_HANDLERS_H */
@@ -27,6 +27,52 @@
 #include "bplib_as_internal.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_AS_AddToShard()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_AS_AddToShard(BPLib_AS_Slot_t Slot, BPLib_AS_Counter_t Counter, uint32_t Delta)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_AS_AddToShard, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_AS_AddToShard, BPLib_AS_Slot_t, Slot);
+    UT_GenStub_AddParam(BPLib_AS_AddToShard, BPLib_AS_Counter_t, Counter);
+    UT_GenStub_AddParam(BPLib_AS_AddToShard, uint32_t, Delta);
+
+    UT_GenStub_Execute(BPLib_AS_AddToShard, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_AS_AddToShard, BPLib_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_AS_FoldShards()
+ * ----------------------------------------------------
+ */
+void BPLib_AS_FoldShards(void)
+{
+
+    UT_GenStub_Execute(BPLib_AS_FoldShards, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_AS_GetRateEstimator()
+ * ----------------------------------------------------
+ */
+BPLib_AS_RateEstimator_t *BPLib_AS_GetRateEstimator(BPLib_AS_TrafficDir_t Dir, uint32_t Id)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_AS_GetRateEstimator, BPLib_AS_RateEstimator_t *);
+
+    UT_GenStub_AddParam(BPLib_AS_GetRateEstimator, BPLib_AS_TrafficDir_t, Dir);
+    UT_GenStub_AddParam(BPLib_AS_GetRateEstimator, uint32_t, Id);
+
+    UT_GenStub_Execute(BPLib_AS_GetRateEstimator, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_AS_GetRateEstimator, BPLib_AS_RateEstimator_t *);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_AS_InitMutex()
@@ -70,6 +116,79 @@ BPLib_Status_t BPLib_AS_SetCounter(BPLib_EID_t EID, BPLib_AS_Counter_t Counter,
     return UT_GenStub_GetReturnValue(BPLib_AS_SetCounter, BPLib_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_AS_SourceCacheFlush()
+ * ----------------------------------------------------
+ */
+void BPLib_AS_SourceCacheFlush(void)
+{
+    UT_GenStub_Execute(BPLib_AS_SourceCacheFlush, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_AS_SourceCacheGeneration()
+ * ----------------------------------------------------
+ */
+uint32_t BPLib_AS_SourceCacheGeneration(void)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_AS_SourceCacheGeneration, uint32_t);
+
+    UT_GenStub_Execute(BPLib_AS_SourceCacheGeneration, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_AS_SourceCacheGeneration, uint32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_AS_SourceCacheInsert()
+ * ----------------------------------------------------
+ */
+void BPLib_AS_SourceCacheInsert(const BPLib_EID_t *EID, uint32_t Generation, BPLib_AS_Slot_t Slot)
+{
+    UT_GenStub_AddParam(BPLib_AS_SourceCacheInsert, const BPLib_EID_t *, EID);
+    UT_GenStub_AddParam(BPLib_AS_SourceCacheInsert, uint32_t, Generation);
+    UT_GenStub_AddParam(BPLib_AS_SourceCacheInsert, BPLib_AS_Slot_t, Slot);
+
+    UT_GenStub_Execute(BPLib_AS_SourceCacheInsert, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_AS_SourceCacheLookup()
+ * ----------------------------------------------------
+ */
+bool BPLib_AS_SourceCacheLookup(const BPLib_EID_t *EID, uint32_t Generation, BPLib_AS_Slot_t *Slot)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_AS_SourceCacheLookup, bool);
+
+    UT_GenStub_AddParam(BPLib_AS_SourceCacheLookup, const BPLib_EID_t *, EID);
+    UT_GenStub_AddParam(BPLib_AS_SourceCacheLookup, uint32_t, Generation);
+    UT_GenStub_AddParam(BPLib_AS_SourceCacheLookup, BPLib_AS_Slot_t *, Slot);
+
+    UT_GenStub_Execute(BPLib_AS_SourceCacheLookup, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_AS_SourceCacheLookup, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_AS_TakeShardDeltas()
+ * ----------------------------------------------------
+ */
+uint32_t BPLib_AS_TakeShardDeltas(BPLib_AS_Slot_t Slot, BPLib_AS_Counter_t Counter)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_AS_TakeShardDeltas, uint32_t);
+
+    UT_GenStub_AddParam(BPLib_AS_TakeShardDeltas, BPLib_AS_Slot_t, Slot);
+    UT_GenStub_AddParam(BPLib_AS_TakeShardDeltas, BPLib_AS_Counter_t, Counter);
+
+    UT_GenStub_Execute(BPLib_AS_TakeShardDeltas, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_AS_TakeShardDeltas, uint32_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_AS_UnlockCounters()
@@ -74,6 +74,40 @@ uint32_t BPLib_AS_GetCounter(BPLib_EID_t *EID, BPLib_AS_Counter_t Counter)
     return UT_GenStub_GetReturnValue(BPLib_AS_GetCounter, uint32_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_AS_GetRate()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_AS_GetRate(BPLib_AS_TrafficDir_t Dir, uint32_t Id, BPLib_AS_Rate_t *Rate)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_AS_GetRate, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_AS_GetRate, BPLib_AS_TrafficDir_t, Dir);
+    UT_GenStub_AddParam(BPLib_AS_GetRate, uint32_t, Id);
+    UT_GenStub_AddParam(BPLib_AS_GetRate, BPLib_AS_Rate_t *, Rate);
+
+    UT_GenStub_Execute(BPLib_AS_GetRate, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_AS_GetRate, BPLib_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_AS_GetSourceCacheStats()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_AS_GetSourceCacheStats(BPLib_AS_SourceCacheStats_t *Stats)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_AS_GetSourceCacheStats, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_AS_GetSourceCacheStats, BPLib_AS_SourceCacheStats_t *, Stats);
+
+    UT_GenStub_Execute(BPLib_AS_GetSourceCacheStats, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_AS_GetSourceCacheStats, BPLib_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_AS_Increment()
@@ -88,6 +122,20 @@ void BPLib_AS_Increment(BPLib_EID_t EID, BPLib_AS_Counter_t Counter, uint32_t Am
     UT_GenStub_Execute(BPLib_AS_Increment, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_AS_IncrementSlot()
+ * ----------------------------------------------------
+ */
+void BPLib_AS_IncrementSlot(BPLib_AS_Slot_t Slot, BPLib_AS_Counter_t Counter, uint32_t Amount)
+{
+    UT_GenStub_AddParam(BPLib_AS_IncrementSlot, BPLib_AS_Slot_t, Slot);
+    UT_GenStub_AddParam(BPLib_AS_IncrementSlot, BPLib_AS_Counter_t, Counter);
+    UT_GenStub_AddParam(BPLib_AS_IncrementSlot, uint32_t, Amount);
+
+    UT_GenStub_Execute(BPLib_AS_IncrementSlot, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_AS_Init()
@@ -102,6 +150,20 @@ BPLib_Status_t BPLib_AS_Init(void)
     return UT_GenStub_GetReturnValue(BPLib_AS_Init, BPLib_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_AS_RecordTraffic()
+ * ----------------------------------------------------
+ */
+void BPLib_AS_RecordTraffic(BPLib_AS_TrafficDir_t Dir, uint32_t Id, size_t Bytes)
+{
+    UT_GenStub_AddParam(BPLib_AS_RecordTraffic, BPLib_AS_TrafficDir_t, Dir);
+    UT_GenStub_AddParam(BPLib_AS_RecordTraffic, uint32_t, Id);
+    UT_GenStub_AddParam(BPLib_AS_RecordTraffic, size_t, Bytes);
+
+    UT_GenStub_Execute(BPLib_AS_RecordTraffic, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_AS_ResetAllCounters()
@@ -173,6 +235,38 @@ BPLib_Status_t BPLib_AS_ResetSourceCounters(uint16_t MibArrayIndex)
     return UT_GenStub_GetReturnValue(BPLib_AS_ResetSourceCounters, BPLib_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_AS_ResolveSlot()
+ * ----------------------------------------------------
+ */
+BPLib_AS_Slot_t BPLib_AS_ResolveSlot(const BPLib_EID_t *EID)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_AS_ResolveSlot, BPLib_AS_Slot_t);
+
+    UT_GenStub_AddParam(BPLib_AS_ResolveSlot, const BPLib_EID_t *, EID);
+
+    UT_GenStub_Execute(BPLib_AS_ResolveSlot, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_AS_ResolveSlot, BPLib_AS_Slot_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_AS_ResolveSourceSlot()
+ * ----------------------------------------------------
+ */
+BPLib_AS_Slot_t BPLib_AS_ResolveSourceSlot(const BPLib_EID_t *EID)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_AS_ResolveSourceSlot, BPLib_AS_Slot_t);
+
+    UT_GenStub_AddParam(BPLib_AS_ResolveSourceSlot, const BPLib_EID_t *, EID);
+
+    UT_GenStub_Execute(BPLib_AS_ResolveSourceSlot, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_AS_ResolveSourceSlot, BPLib_AS_Slot_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_AS_SendNodeMibCountersHk()
@@ -216,3 +310,13 @@ BPLib_Status_t BPLib_AS_SendSourceMibCountersHk(void)
 
     return UT_GenStub_GetReturnValue(BPLib_AS_SendSourceMibCountersHk, BPLib_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_AS_UpdateRates()
+ * ----------------------------------------------------
+ */
+void BPLib_AS_UpdateRates(void)
+{
+    UT_GenStub_Execute(BPLib_AS_UpdateRates, Basic, NULL);
+}
@@ -337,6 +337,15 @@ void BPLib_AS_Test_Setup(void)
     /* Initialize the source counter payload to 0s */
     memset((void*) &BPLib_AS_SourceCountersPayload, 0, sizeof(BPLib_AS_SourceCountersPayload));
 
+    /* Drop any counter deltas left pending by the previous test */
+    memset((void*) BPLib_AS_CounterShards, 0, sizeof(BPLib_AS_CounterShards));
+
+    /* Start every test without throughput history */
+    memset((void*) &BPLib_AS_Rates, 0, sizeof(BPLib_AS_Rates));
+
+    /* Forget sources resolved by the previous test */
+    memset((void*) &BPLib_AS_SourceCache, 0, sizeof(BPLib_AS_SourceCache));
+
     /* Clear out event handler context */
     memset((void*) &context_BPLib_EM_SendEvent, 0, sizeof(BPLib_EM_SendEvent_context_t));
 
@@ -50,6 +50,7 @@ typedef struct
     BPLib_PDB_SrcAuthTable_t*    AuthConfigPtr;
     BPLib_PDB_SrcLatencyTable_t* LatConfigPtr;
     BPLib_STOR_StorageTable_t*   StorConfigPtr;
+    BPLib_CLA_ContactPlanTable_t* ContactPlanConfigPtr; /* Optional, NULL if there is no contact plan */
 } BPLib_NC_ConfigPtrs_t;
 
 /**
@@ -80,6 +81,7 @@ typedef enum
     BPLIB_SRC_LATENCY_POLICY        =  9, /* Source Latency Policy configuration */
     BPLIB_STORAGE                   = 10, /* Storage configuration */
     BPLIB_ADU_PROXY                 = 11, /* FWP's ADU Proxy configuration; confined to BPNode */
+    BPLIB_CONTACT_PLAN              = 12, /* Contact Plan configuration */
 } BPLib_NC_ConfigType_t;
 
 /**
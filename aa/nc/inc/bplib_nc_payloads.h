@@ -229,12 +229,20 @@ typedef struct
     uint32_t State;             /**< \brief Added, started, stopped, or removed */
     uint32_t RegistrationState; /**< \brief Active, PassiveDefered or PassiveAbandon */
     uint32_t Spare;
+    uint32_t IngestedBytesPerSec;    /**< \brief Smoothed rate of ADUs ingested on this channel in bytes per second */
+    uint32_t IngestedBundlesPerSec;  /**< \brief Smoothed rate of ADUs ingested on this channel in bundles per second */
+    uint32_t DeliveredBytesPerSec;   /**< \brief Smoothed rate of ADUs delivered on this channel in bytes per second */
+    uint32_t DeliveredBundlesPerSec; /**< \brief Smoothed rate of ADUs delivered on this channel in bundles per second */
 } BPLib_ChannelHkTlmPayloadSet_t;
 
 typedef struct
 {
-    uint32_t State;             /**< \brief Set up, started, stopped, or torn down */
+    uint32_t State;                 /**< \brief Set up, started, stopped, or torn down */
     uint32_t Spare;
+    uint32_t IngressBytesPerSec;    /**< \brief Smoothed rate of bundles received on this contact in bytes per second */
+    uint32_t IngressBundlesPerSec;  /**< \brief Smoothed rate of bundles received on this contact in bundles per second */
+    uint32_t EgressBytesPerSec;     /**< \brief Smoothed rate of bundles forwarded on this contact in bytes per second */
+    uint32_t EgressBundlesPerSec;   /**< \brief Smoothed rate of bundles forwarded on this contact in bundles per second */
     BPLib_EID_Pattern_t DestEIDs[BPLIB_MAX_CONTACT_DEST_EIDS];  /**< \brief Destination EIDs */
 } BPLib_ContactHkTlmPayloadSet_t;
 
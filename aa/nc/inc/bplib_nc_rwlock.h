@@ -24,19 +24,26 @@
 
 #include <pthread.h>
 
+/**
+ * \brief Bit of BPLib_NC_RWLock_t.State that is set while a writer holds the lock
+ */
+#define BPLIB_NC_RWLOCK_WRITER (0x80000000u)
+
 /**
  * \brief Definition of the read-write lock structure.
  *
- * \details This structure defines the necessary mutex and condition variables
- * to implement a read-write lock. It includes the mutex, the condition variables
- * for readers and writers, and counters for the number of readers and writers.
+ * \details Readers acquire and release the lock with a single atomic operation on
+ * State and never touch the mutex unless a writer currently holds the lock. A writer
+ * only takes the lock once State shows no readers, so it waits for every reader that
+ * started before it (a grace period), and readers may nest. The mutex and condition
+ * variables are only used to sleep while waiting on the other side.
  */
 typedef struct BPLib_NC_RWLock {
-    pthread_mutex_t Lock;          /**< Mutex to protect shared data */
-    pthread_cond_t ReadCond;       /**< Condition variable for readers */
-    pthread_cond_t WriteCond;      /**< Condition variable for writers */
-    int ReaderCnt;                 /**< Number of active readers */
-    int WriterCnt;               /**< Number of active writers */
+    pthread_mutex_t Lock;          /**< Mutex used only to sleep on the condition variables */
+    pthread_cond_t ReadCond;       /**< Signalled when a writer releases the lock */
+    pthread_cond_t WriteCond;      /**< Signalled when the last reader or a writer releases the lock */
+    uint32_t State;                /**< Number of active readers, plus BPLIB_NC_RWLOCK_WRITER */
+    uint32_t WritersWaiting;       /**< Number of writers waiting for the lock */
 } BPLib_NC_RWLock_t;
 
 /**
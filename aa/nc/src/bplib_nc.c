@@ -100,6 +100,9 @@ BPLib_Status_t BPLib_NC_Init(BPLib_NC_ConfigPtrs_t* ConfigPtrs)
         BPLib_NC_ConfigPtrs.LatConfigPtr       = ConfigPtrs->LatConfigPtr;
         BPLib_NC_ConfigPtrs.StorConfigPtr      = ConfigPtrs->StorConfigPtr;
 
+        /* The contact plan is optional, without one contacts are only driven by directives */
+        BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = ConfigPtrs->ContactPlanConfigPtr;
+
         /* Set the instance EID */
         BPLib_EID_CopyEids(&BPLIB_EID_INSTANCE, BPLib_NC_ConfigPtrs.MibPnConfigPtr->InstanceEID);
 
@@ -111,6 +114,10 @@ BPLib_Status_t BPLib_NC_Init(BPLib_NC_ConfigPtrs_t* ConfigPtrs)
         BPLib_NC_UpdateContactHkTlm();
         BPLib_NC_UpdateChannelHkTlm();
 
+        /* Build the per-channel bundle templates and the compiled contact routes */
+        BPLib_PI_RefreshTemplates();
+        BPLib_CLA_RefreshRoutes();
+
         /* Initialize CRC tables */
         BPLib_CRC_Init();
 
@@ -285,8 +292,9 @@ static BPLib_Status_t BPLib_NC_ConfigUpdateUnlocked(void)
         else
         */
         {
-            /* Update channel telemetry with new table values */
+            /* Update channel telemetry and bundle templates with new table values */
             BPLib_NC_UpdateChannelHkTlm();
+            BPLib_PI_RefreshTemplates();
 
             BPLib_EM_SendEvent(BPLIB_NC_TBL_UPDATE_INF_EID,
                                 BPLib_EM_EventType_INFORMATION,
@@ -318,8 +326,9 @@ static BPLib_Status_t BPLib_NC_ConfigUpdateUnlocked(void)
         else
         */
         {
-            /* Update contact telemetry with new table values */
+            /* Update contact telemetry and routes with new table values */
             BPLib_NC_UpdateContactHkTlm();
+            BPLib_CLA_RefreshRoutes();
             
             BPLib_EM_SendEvent(BPLIB_NC_TBL_UPDATE_INF_EID,
                                 BPLib_EM_EventType_INFORMATION,
@@ -592,5 +601,26 @@ static BPLib_Status_t BPLib_NC_ConfigUpdateUnlocked(void)
         return BPLIB_ERROR;
     }
 
+    /* Update Contact Plan configuration with TABLEP, if contacts are scheduled by one */
+    if (BPLib_NC_ConfigPtrs.ContactPlanConfigPtr != NULL)
+    {
+        FWP_UpdateStatus = BPLib_FWP_ProxyCallbacks.BPA_TABLEP_TableUpdate(BPLIB_CONTACT_PLAN,
+                                                                            (void**) &BPLib_NC_ConfigPtrs.ContactPlanConfigPtr);
+
+        if (FWP_UpdateStatus == BPLIB_TBL_UPDATED)
+        {
+            /* Schedule the new plan's windows from scratch */
+            BPLib_CLA_RefreshContactPlan();
+
+            BPLib_EM_SendEvent(BPLIB_NC_TBL_UPDATE_INF_EID,
+                                BPLib_EM_EventType_INFORMATION,
+                                "Updated Contact Plan configuration");
+        }
+        else if (FWP_UpdateStatus != BPLIB_SUCCESS)
+        {
+            return BPLIB_ERROR;
+        }
+    }
+
     return BPLIB_SUCCESS;
 }
@@ -1155,21 +1155,58 @@ void BPLib_NC_SendStorageHk(BPLib_Instance_t* Instance)
 
 void BPLib_NC_SendChannelContactStatHk(void)
 {
-    BPLib_Status_t              Status;
-    uint32_t                    ContactId;
-    BPLib_CLA_ContactRunState_t RunState;
+    BPLib_Status_t                  Status;
+    uint32_t                        ContactId;
+    uint32_t                        ChanId;
+    BPLib_CLA_ContactRunState_t     RunState;
+    BPLib_AS_Rate_t                 Rate;
+    BPLib_ContactHkTlmPayloadSet_t *ContactStatus;
+    BPLib_ChannelHkTlmPayloadSet_t *ChannelStatus;
+
+    BPLib_AS_UpdateRates();
 
     for (ContactId = 0; ContactId < BPLIB_MAX_NUM_CONTACTS; ContactId++)
     {
+        ContactStatus = &BPLib_NC_ChannelContactStatsPayload.ContactStatus[ContactId];
+
         Status = BPLib_CLA_GetContactRunState(ContactId, &RunState);
         if (Status == BPLIB_SUCCESS)
         {
-            BPLib_NC_ChannelContactStatsPayload.ContactStatus[ContactId].State = RunState;
+            ContactStatus->State = RunState;
         }
         else
         {
             // BPLib_EM_SendEvent()
         }
+
+        if (BPLib_AS_GetRate(BPLIB_AS_TRAFFIC_INGRESS, ContactId, &Rate) == BPLIB_SUCCESS)
+        {
+            ContactStatus->IngressBytesPerSec   = Rate.BytesPerSec;
+            ContactStatus->IngressBundlesPerSec = Rate.BundlesPerSec;
+        }
+
+        if (BPLib_AS_GetRate(BPLIB_AS_TRAFFIC_EGRESS, ContactId, &Rate) == BPLIB_SUCCESS)
+        {
+            ContactStatus->EgressBytesPerSec   = Rate.BytesPerSec;
+            ContactStatus->EgressBundlesPerSec = Rate.BundlesPerSec;
+        }
+    }
+
+    for (ChanId = 0; ChanId < BPLIB_MAX_NUM_CHANNELS; ChanId++)
+    {
+        ChannelStatus = &BPLib_NC_ChannelContactStatsPayload.ChannelStatus[ChanId];
+
+        if (BPLib_AS_GetRate(BPLIB_AS_TRAFFIC_INGESTED, ChanId, &Rate) == BPLIB_SUCCESS)
+        {
+            ChannelStatus->IngestedBytesPerSec   = Rate.BytesPerSec;
+            ChannelStatus->IngestedBundlesPerSec = Rate.BundlesPerSec;
+        }
+
+        if (BPLib_AS_GetRate(BPLIB_AS_TRAFFIC_DELIVERED, ChanId, &Rate) == BPLIB_SUCCESS)
+        {
+            ChannelStatus->DeliveredBytesPerSec   = Rate.BytesPerSec;
+            ChannelStatus->DeliveredBundlesPerSec = Rate.BundlesPerSec;
+        }
     }
 
     Status = BPLib_FWP_ProxyCallbacks.BPA_TLMP_SendChannelContactPkt(&BPLib_NC_ChannelContactStatsPayload);
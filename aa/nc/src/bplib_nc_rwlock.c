@@ -45,8 +45,8 @@ BPLib_Status_t BPLib_NC_RWLock_Init(BPLib_NC_RWLock_t *RWLock)
         return BPLIB_OS_ERROR;
     }
 
-    RWLock->ReaderCnt = 0;
-    RWLock->WriterCnt = 0;
+    RWLock->State = 0;
+    RWLock->WritersWaiting = 0;
 
     return BPLIB_SUCCESS;
 }
@@ -65,44 +65,59 @@ void BPLib_NC_RWLock_Destroy(BPLib_NC_RWLock_t *RWLock)
 
 void BPLib_NC_RWLock_RLock(BPLib_NC_RWLock_t *RWLock)
 {
+    uint32_t PrevState;
+
     if (RWLock == NULL)
     {
         return;
     }
 
-    pthread_mutex_lock(&RWLock->Lock);
-
-    while (RWLock->WriterCnt > 0)
+    while (true)
     {
-        pthread_cond_wait(&RWLock->ReadCond, &RWLock->Lock);
+        /* Fast path: no writer holds the lock */
+        PrevState = __atomic_fetch_add(&RWLock->State, 1, __ATOMIC_SEQ_CST);
+        if ((PrevState & BPLIB_NC_RWLOCK_WRITER) == 0)
+        {
+            return;
+        }
+
+        /* A writer is updating the configuration, back out and sleep until it's done */
+        BPLib_NC_RWLock_RUnlock(RWLock);
+
+        pthread_mutex_lock(&RWLock->Lock);
+        while (__atomic_load_n(&RWLock->State, __ATOMIC_SEQ_CST) & BPLIB_NC_RWLOCK_WRITER)
+        {
+            pthread_cond_wait(&RWLock->ReadCond, &RWLock->Lock);
+        }
+        pthread_mutex_unlock(&RWLock->Lock);
     }
-
-    RWLock->ReaderCnt++;
-
-    pthread_mutex_unlock(&RWLock->Lock);
 }
 
 void BPLib_NC_RWLock_RUnlock(BPLib_NC_RWLock_t *RWLock)
 {
+    uint32_t PrevState;
+
     if (RWLock == NULL)
     {
         return;
     }
 
-    pthread_mutex_lock(&RWLock->Lock);
-
-    RWLock->ReaderCnt--;
+    PrevState = __atomic_fetch_sub(&RWLock->State, 1, __ATOMIC_SEQ_CST);
 
-    if (RWLock->ReaderCnt == 0)
+    /* The last reader out wakes a waiting writer */
+    if ((PrevState & ~BPLIB_NC_RWLOCK_WRITER) == 1 &&
+        __atomic_load_n(&RWLock->WritersWaiting, __ATOMIC_SEQ_CST) > 0)
     {
-        pthread_cond_signal(&RWLock->WriteCond);
+        pthread_mutex_lock(&RWLock->Lock);
+        pthread_cond_broadcast(&RWLock->WriteCond);
+        pthread_mutex_unlock(&RWLock->Lock);
     }
-
-    pthread_mutex_unlock(&RWLock->Lock);
 }
 
 void BPLib_NC_RWLock_WLock(BPLib_NC_RWLock_t *RWLock)
 {
+    uint32_t Expected;
+
     if (RWLock == NULL)
     {
         return;
@@ -110,12 +125,22 @@ void BPLib_NC_RWLock_WLock(BPLib_NC_RWLock_t *RWLock)
 
     pthread_mutex_lock(&RWLock->Lock);
 
-    while (RWLock->ReaderCnt > 0 || RWLock->WriterCnt > 0)
+    __atomic_add_fetch(&RWLock->WritersWaiting, 1, __ATOMIC_SEQ_CST);
+
+    /* Take the lock only once every reader that started before this point has left */
+    while (true)
     {
+        Expected = 0;
+        if (__atomic_compare_exchange_n(&RWLock->State, &Expected, BPLIB_NC_RWLOCK_WRITER,
+                                        false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+        {
+            break;
+        }
+
         pthread_cond_wait(&RWLock->WriteCond, &RWLock->Lock);
     }
 
-    RWLock->WriterCnt++;
+    __atomic_sub_fetch(&RWLock->WritersWaiting, 1, __ATOMIC_SEQ_CST);
 
     pthread_mutex_unlock(&RWLock->Lock);
 }
@@ -127,12 +152,12 @@ void BPLib_NC_RWLock_WUnlock(BPLib_NC_RWLock_t *RWLock)
         return;
     }
 
-    pthread_mutex_lock(&RWLock->Lock);
+    __atomic_and_fetch(&RWLock->State, ~BPLIB_NC_RWLOCK_WRITER, __ATOMIC_SEQ_CST);
 
-    RWLock->WriterCnt--;
+    pthread_mutex_lock(&RWLock->Lock);
 
     pthread_cond_broadcast(&RWLock->ReadCond);
-    pthread_cond_signal(&RWLock->WriteCond);
+    pthread_cond_broadcast(&RWLock->WriteCond);
 
     pthread_mutex_unlock(&RWLock->Lock);
 }
@@ -41,38 +41,61 @@ void Test_BPLib_NC_RWLock_Destroy(void)
 /* Test RLock */
 void Test_BPLib_NC_RWLock_RLock(void)
 {
-    RWLock.WriterCnt = 0;
+    RWLock.State = 0;
 
     BPLib_NC_RWLock_RLock(&RWLock);
-    UtAssert_INT32_EQ(RWLock.ReaderCnt, 1);
+    UtAssert_UINT32_EQ(RWLock.State, 1);
+}
+
+/* Test that readers nest */
+void Test_BPLib_NC_RWLock_RLockNested(void)
+{
+    RWLock.State = 0;
+
+    BPLib_NC_RWLock_RLock(&RWLock);
+    BPLib_NC_RWLock_RLock(&RWLock);
+    UtAssert_UINT32_EQ(RWLock.State, 2);
+
+    BPLib_NC_RWLock_RUnlock(&RWLock);
+    BPLib_NC_RWLock_RUnlock(&RWLock);
+    UtAssert_UINT32_EQ(RWLock.State, 0);
 }
 
 /* Test RUnlock */
 void Test_BPLib_NC_RWLock_RUnlock(void)
 {
-    RWLock.ReaderCnt = 10;
+    RWLock.State = 10;
 
     BPLib_NC_RWLock_RUnlock(&RWLock);
-    UtAssert_INT32_EQ(RWLock.ReaderCnt, 9);
+    UtAssert_UINT32_EQ(RWLock.State, 9);
 }
 
 /* Test WLock */
 void Test_BPLib_NC_RWLock_WLock(void)
 {
-    RWLock.WriterCnt = 0;
-    RWLock.ReaderCnt = 0;
+    RWLock.State = 0;
 
     BPLib_NC_RWLock_WLock(&RWLock);
-    UtAssert_INT32_EQ(RWLock.WriterCnt, 1);
+    UtAssert_UINT32_EQ(RWLock.State, BPLIB_NC_RWLOCK_WRITER);
+    UtAssert_UINT32_EQ(RWLock.WritersWaiting, 0);
 }
 
 /* Test WUnlock */
 void Test_BPLib_NC_RWLock_WUnlock(void)
 {
-    RWLock.WriterCnt = 1;
+    RWLock.State = BPLIB_NC_RWLOCK_WRITER;
 
     BPLib_NC_RWLock_WUnlock(&RWLock);
-    UtAssert_INT32_EQ(RWLock.WriterCnt, 0);
+    UtAssert_UINT32_EQ(RWLock.State, 0);
+}
+
+/* Null locks are ignored */
+void Test_BPLib_NC_RWLock_Null(void)
+{
+    BPLib_NC_RWLock_RLock(NULL);
+    BPLib_NC_RWLock_RUnlock(NULL);
+    BPLib_NC_RWLock_WLock(NULL);
+    BPLib_NC_RWLock_WUnlock(NULL);
 }
 
 
@@ -85,7 +108,9 @@ void TestBplibNcRwlock_Register()
 
     /* Lock/Unlock tests */
     UtTest_Add(Test_BPLib_NC_RWLock_RLock, BPLib_NC_Test_Setup_RWLock, BPLib_NC_Test_Teardown_RWLock, "Test_BPLib_NC_RWLock_RLock");
+    UtTest_Add(Test_BPLib_NC_RWLock_RLockNested, BPLib_NC_Test_Setup_RWLock, BPLib_NC_Test_Teardown_RWLock, "Test_BPLib_NC_RWLock_RLockNested");
     UtTest_Add(Test_BPLib_NC_RWLock_RUnlock, BPLib_NC_Test_Setup_RWLock, BPLib_NC_Test_Teardown_RWLock, "Test_BPLib_NC_RWLock_RUnlock");
     UtTest_Add(Test_BPLib_NC_RWLock_WLock, BPLib_NC_Test_Setup_RWLock, BPLib_NC_Test_Teardown_RWLock, "Test_BPLib_NC_RWLock_WLock");
     UtTest_Add(Test_BPLib_NC_RWLock_WUnlock, BPLib_NC_Test_Setup_RWLock, BPLib_NC_Test_Teardown_RWLock, "Test_BPLib_NC_RWLock_WUnlock");
+    UtTest_Add(Test_BPLib_NC_RWLock_Null, BPLib_NC_Test_Setup_RWLock, BPLib_NC_Test_Teardown_RWLock, "Test_BPLib_NC_RWLock_Null");
 }
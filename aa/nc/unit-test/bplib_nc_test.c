@@ -1831,6 +1831,33 @@ void Test_BPLib_NC_TableUpdate_Update_Nominal(void)
     BPNode_Test_TABLEP_TableUpdate(10, BPLIB_STORAGE);
 }
 
+void Test_BPLib_NC_TableUpdate_ContactPlan_Nominal(void)
+{
+    BPLib_Status_t Status;
+    static BPLib_CLA_ContactPlanTable_t TestContactPlanTbl;
+
+    BPLib_NC_ConfigPtrs.ChanConfigPtr = TestConfigPtrs.ChanConfigPtr;
+    BPLib_NC_ConfigPtrs.ContactsConfigPtr = TestConfigPtrs.ContactsConfigPtr;
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = &TestContactPlanTbl;
+
+    /* Force configuration updates to report only updates */
+    UT_SetDefaultReturnValue(UT_KEY(BPA_TABLEP_TableUpdate), BPLIB_TBL_UPDATED);
+
+    /* Run function under test */
+    Status = BPLib_NC_ConfigUpdate();
+
+    UtAssert_EQ(BPLib_Status_t, Status, BPLIB_SUCCESS);
+
+    /* Show that the optional contact plan was updated last and rescheduled */
+    UtAssert_STUB_COUNT(BPA_TABLEP_TableUpdate, 12);
+    BPNode_Test_TABLEP_TableUpdate(11, BPLIB_CONTACT_PLAN);
+    UtAssert_STUB_COUNT(BPLib_CLA_RefreshContactPlan, 1);
+    UtAssert_STUB_COUNT(BPLib_EM_SendEvent, 12);
+    BPLib_NC_Test_Verify_Event(11, BPLIB_NC_TBL_UPDATE_INF_EID, "Updated Contact Plan configuration");
+
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = NULL;
+}
+
 void Test_BPLib_NC_TableUpdate_Error_Nominal(void)
 {
     BPLib_Status_t Status;
@@ -1984,5 +2011,6 @@ void TestBplibNc_Register(void)
     ADD_TEST(Test_BPLib_NC_GetSetAppState_Nominal);
     ADD_TEST(Test_BPLib_NC_TableUpdate_Success_Nominal);
     ADD_TEST(Test_BPLib_NC_TableUpdate_Update_Nominal);
+    ADD_TEST(Test_BPLib_NC_TableUpdate_ContactPlan_Nominal);
     ADD_TEST(Test_BPLib_NC_TableUpdate_Error_Nominal);
 }
\ No newline at end of file
@@ -25,10 +25,15 @@
 #include "bpcat_fwp.h"
 #include "bpcat_task.h"
 #include "bpcat_cla.h"
+#include "bpcat_stream_cla.h"
+#include "bpcat_shm_cla.h"
 #include "bpcat_nc.h"
+#include "bpcat_trace.h"
 #include "bplib.h"
 
 #include "osapi.h"
+#include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 
 /*******************************************************************************
@@ -37,15 +42,37 @@
 #define BPCAT_NUM_GEN_WORKER            1
 #define BPCAT_GEN_WORKER_TIMEOUT        100u
 #define BPCAT_MEMPOOL_LEN               8000000u
+#define BPCAT_MEMPOOL_BACKING           BPLIB_MEM_BACKING_HUGETLB
+#define BPCAT_MEMPOOL_HIGH_PCT          90u
+#define BPCAT_MEMPOOL_LOW_PCT           75u
 #define BPCAT_QM_MAX_JOBS               1024u
 #define BPCAT_JOBS_PER_CYCLE            100
+#define BPCAT_EVENTS_PER_CYCLE          64
+#define BPCAT_TRACE_FILE_ENV            "BPCAT_TRACE_FILE"
+#define BPCAT_CLA_TYPE_ENV              "BPCAT_CLA_TYPE"       /* udp, tcp, unix or shm */
+#define BPCAT_CLA_UNIX_PATH_ENV         "BPCAT_CLA_UNIX_PATH"  /* Unix-domain socket name prefix */
+#define BPCAT_CLA_SNDBUF_ENV            "BPCAT_CLA_SNDBUF"     /* Stream socket send buffer bytes */
+#define BPCAT_CLA_RCVBUF_ENV            "BPCAT_CLA_RCVBUF"     /* Stream socket receive buffer bytes */
+#define BPCAT_CLA_SHM_NAME_ENV          "BPCAT_CLA_SHM_NAME"   /* Shared memory ring name prefix */
+
+/*******************************************************************************
+** Type Definitions
+*/
+typedef enum
+{
+    BPCAT_CLA_UDP,
+    BPCAT_CLA_STREAM,
+    BPCAT_CLA_SHM
+} BPCat_CLAKind_t;
 
 /*******************************************************************************
 ** Global State
 */
 BPCat_AppData_t AppData;
 static BPCat_Task_t CLAOutTask;
-static BPCat_Task_t CLAInTask;
+static BPCat_Task_t CLAInTasks[BPCAT_CLA_NUM_RX_SOCKETS];
+static uint32_t NumCLAInTasks;
+static BPCat_CLAKind_t CLAKind;
 static BPCat_Task_t GenWorkers[BPCAT_NUM_GEN_WORKER];
 
 /*******************************************************************************
@@ -64,7 +91,7 @@ static BPLib_Status_t BPCat_GenWorkerTaskTeardown()
     return BPCAT_SUCCESS;
 }
 
-static void* BPCat_GenWorkerTaskFunc(BPCat_AppData_t* gAppData)
+static void* BPCat_GenWorkerTaskFunc(BPCat_AppData_t* gAppData, uint32_t TaskId)
 {
     int WorkerID; // DO NOT MERGE THIS: THIS ONLY WORKS IF THERE'S ONE WORKER ID!!!
     if (BPLib_QM_RegisterWorker(&gAppData->BPLibInst, &WorkerID) != BPLIB_SUCCESS)
@@ -79,6 +106,59 @@ static void* BPCat_GenWorkerTaskFunc(BPCat_AppData_t* gAppData)
     return NULL;
 }
 
+/*******************************************************************************
+** CLA Selection
+*/
+static int BPCat_EnvInt(const char* Name, int Default)
+{
+    const char* Value = getenv(Name);
+
+    return (Value != NULL) ? atoi(Value) : Default;
+}
+
+/* Use the contact's CLA type unless it is overridden from the environment */
+static void BPCat_SelectCLA(void)
+{
+    const char* TypeName = getenv(BPCAT_CLA_TYPE_ENV);
+    bool UseUnix = false;
+
+    CLAKind = (AppData.ConfigPtrs.ContactsConfigPtr->ContactSet[0].CLAType == TCPType) ?
+        BPCAT_CLA_STREAM : BPCAT_CLA_UDP;
+    if (TypeName != NULL)
+    {
+        UseUnix = (strcmp(TypeName, "unix") == 0);
+        if (UseUnix || (strcmp(TypeName, "tcp") == 0))
+        {
+            CLAKind = BPCAT_CLA_STREAM;
+        }
+        else if (strcmp(TypeName, "shm") == 0)
+        {
+            CLAKind = BPCAT_CLA_SHM;
+        }
+        else
+        {
+            CLAKind = BPCAT_CLA_UDP;
+        }
+    }
+
+    if (CLAKind == BPCAT_CLA_STREAM)
+    {
+        BPCat_StreamCLAConfigure(UseUnix, getenv(BPCAT_CLA_UNIX_PATH_ENV),
+            BPCat_EnvInt(BPCAT_CLA_SNDBUF_ENV, BPCAT_STREAM_SNDBUF),
+            BPCat_EnvInt(BPCAT_CLA_RCVBUF_ENV, BPCAT_STREAM_RCVBUF));
+        printf("CLA: %s stream\n", UseUnix ? "Unix-domain" : "TCP");
+    }
+    else if (CLAKind == BPCAT_CLA_SHM)
+    {
+        BPCat_ShmCLAConfigure(getenv(BPCAT_CLA_SHM_NAME_ENV));
+        printf("CLA: shared memory\n");
+    }
+    else
+    {
+        printf("CLA: UDP\n");
+    }
+}
+
 /*******************************************************************************
 ** Task Start/Stop
 */
@@ -102,9 +182,25 @@ static BPCat_Status_t BPCat_StartTasks()
     }
 
     /* CLA TaskInit */
-    CLAOutTask.TaskSetup = BPCat_CLAOutSetup;
-    CLAOutTask.TaskTeardown = BPCat_CLAOutTeardown;
-    CLAOutTask.TaskFunc = BPCat_CLAOutTaskFunc;
+    BPCat_SelectCLA();
+    if (CLAKind == BPCAT_CLA_STREAM)
+    {
+        CLAOutTask.TaskSetup = BPCat_StreamCLAOutSetup;
+        CLAOutTask.TaskTeardown = BPCat_StreamCLAOutTeardown;
+        CLAOutTask.TaskFunc = BPCat_StreamCLAOutTaskFunc;
+    }
+    else if (CLAKind == BPCAT_CLA_SHM)
+    {
+        CLAOutTask.TaskSetup = BPCat_ShmCLAOutSetup;
+        CLAOutTask.TaskTeardown = BPCat_ShmCLAOutTeardown;
+        CLAOutTask.TaskFunc = BPCat_ShmCLAOutTaskFunc;
+    }
+    else
+    {
+        CLAOutTask.TaskSetup = BPCat_CLAOutSetup;
+        CLAOutTask.TaskTeardown = BPCat_CLAOutTeardown;
+        CLAOutTask.TaskFunc = BPCat_CLAOutTaskFunc;
+    }
     CLAOutTask.TaskId = 0;
     Status = BPCat_TaskInit(&CLAOutTask);
     if (Status != BPCAT_SUCCESS)
@@ -112,15 +208,35 @@ static BPCat_Status_t BPCat_StartTasks()
         fprintf(stderr, "Failed to initialize CLA-Egress Task\n");
         return Status;
     }
-    CLAInTask.TaskSetup = BPCat_CLAInSetup;
-    CLAInTask.TaskTeardown = BPCat_CLAOutTeardown;
-    CLAInTask.TaskFunc = BPCat_CLAInTaskFunc;
-    CLAInTask.TaskId = 0;
-    Status = BPCat_TaskInit(&CLAInTask);
-    if (Status != BPCAT_SUCCESS)
+    /* Stream connections and shared memory rings have a single reader, so a single CLA In task */
+    NumCLAInTasks = (CLAKind == BPCAT_CLA_UDP) ? BPCAT_CLA_NUM_RX_SOCKETS : 1;
+    for (i = 0; i < NumCLAInTasks; i++)
     {
-        fprintf(stderr, "Failed to initialize CLA-Ingress Task\n");
-        return Status;
+        if (CLAKind == BPCAT_CLA_STREAM)
+        {
+            CLAInTasks[i].TaskSetup = BPCat_StreamCLAInSetup;
+            CLAInTasks[i].TaskTeardown = BPCat_StreamCLAInTeardown;
+            CLAInTasks[i].TaskFunc = BPCat_StreamCLAInTaskFunc;
+        }
+        else if (CLAKind == BPCAT_CLA_SHM)
+        {
+            CLAInTasks[i].TaskSetup = BPCat_ShmCLAInSetup;
+            CLAInTasks[i].TaskTeardown = BPCat_ShmCLAInTeardown;
+            CLAInTasks[i].TaskFunc = BPCat_ShmCLAInTaskFunc;
+        }
+        else
+        {
+            CLAInTasks[i].TaskSetup = BPCat_CLAInSetup;
+            CLAInTasks[i].TaskTeardown = BPCat_CLAInTeardown;
+            CLAInTasks[i].TaskFunc = BPCat_CLAInTaskFunc;
+        }
+        CLAInTasks[i].TaskId = i;
+        Status = BPCat_TaskInit(&CLAInTasks[i]);
+        if (Status != BPCAT_SUCCESS)
+        {
+            fprintf(stderr, "Failed to initialize CLA-Ingress Task %d\n", i);
+            return Status;
+        }
     }
 
     /* Start the generic workers first so BPLib is ready to do work */
@@ -141,11 +257,14 @@ static BPCat_Status_t BPCat_StartTasks()
         fprintf(stderr, "Failed to start CLA-Egress Task\n");
         return Status;
     }
-    Status = BPCat_TaskStart(&CLAInTask, &AppData);
-    if (Status != BPCAT_SUCCESS)
+    for (i = 0; i < NumCLAInTasks; i++)
     {
-        fprintf(stderr, "Failed to start CLA-Ingress Task\n");
-        return Status;
+        Status = BPCat_TaskStart(&CLAInTasks[i], &AppData);
+        if (Status != BPCAT_SUCCESS)
+        {
+            fprintf(stderr, "Failed to start CLA-Ingress Task %d\n", i);
+            return Status;
+        }
     }
 
     return BPCAT_SUCCESS;
@@ -162,10 +281,17 @@ static void BPCat_StopTasks()
     {
         fprintf(stderr, "Failed to stop CLA-Egress Task\n");
     }
-    Status = BPCat_TaskStop(&CLAInTask);
-    if (Status != BPCAT_SUCCESS)
+    for (i = 0; i < NumCLAInTasks; i++)
+    {
+        Status = BPCat_TaskStop(&CLAInTasks[i]);
+        if (Status != BPCAT_SUCCESS)
+        {
+            fprintf(stderr, "Failed to stop CLA-Ingress Task %d\n", i);
+        }
+    }
+    if (CLAKind == BPCAT_CLA_UDP)
     {
-        fprintf(stderr, "Failed to stop CLA-Ingress Task\n");
+        BPCat_CLAInReportStats();
     }
 
     /* Stop Generic Workers */
@@ -207,6 +333,9 @@ void BPCat_Main()
         return;
     }
 
+    /* Keep event formatting off the bundle processing path, the main loop flushes it */
+    BPLib_EM_SetDeferred(true);
+
     /* Time Management */
     /* Without modifying the TIME module, I was unable to get this to work.
     ** We need a follow-on ticket to abstract the TIME module and AS module's
@@ -229,17 +358,21 @@ void BPCat_Main()
     }
 
     /* MEM */
-    AppData.PoolMem = (void *)calloc(BPCAT_MEMPOOL_LEN, 1);
-    if (AppData.PoolMem == NULL)
+    BPLibStatus = BPLib_MEM_PoolMapInit(&AppData.BPLibInst.pool, (size_t)BPCAT_MEMPOOL_LEN,
+        BPCAT_MEMPOOL_BACKING);
+    if (BPLibStatus != BPLIB_SUCCESS)
     {
-        fprintf(stderr, "Failed to calloc() memory for the BPLib Memory Pool\n");
+        fprintf(stderr, "Failed to initialize MEM\n");
         return;
     }
-    BPLibStatus = BPLib_MEM_PoolInit(&AppData.BPLibInst.pool, AppData.PoolMem,
-        (size_t)BPCAT_MEMPOOL_LEN);
+
+    /* Shed ingress before the pool is exhausted */
+    BPLibStatus = BPLib_MEM_PoolSetWatermarks(&AppData.BPLibInst.pool,
+        (AppData.BPLibInst.pool.impl.num_blocks * BPCAT_MEMPOOL_LOW_PCT) / 100u,
+        (AppData.BPLibInst.pool.impl.num_blocks * BPCAT_MEMPOOL_HIGH_PCT) / 100u);
     if (BPLibStatus != BPLIB_SUCCESS)
     {
-        fprintf(stderr, "Failed to initialize MEM\n");
+        fprintf(stderr, "Failed to set MEM watermarks\n");
         return;
     }
 
@@ -271,6 +404,9 @@ void BPCat_Main()
     {
         sleep(BPCAT_CYCLE_TIME_SECS);
 
+        /* Format any events that were deferred off the bundle processing path */
+        (void) BPLib_EM_FlushDeferred(BPCAT_EVENTS_PER_CYCLE);
+
         BPLibStatus = BPLib_STOR_FlushPending(&AppData.BPLibInst);
 
         if (BPLibStatus != BPLIB_SUCCESS)
@@ -284,14 +420,41 @@ void BPCat_Main()
         {
             fprintf(stderr, "Error garbage collecting\n");
         }
+
+        /* Open, preload and close any scheduled contact windows */
+        BPLibStatus = BPLib_CLA_ProcessContactPlan(&AppData.BPLibInst);
+
+        if (BPLibStatus != BPLIB_SUCCESS)
+        {
+            fprintf(stderr, "Error processing contact plan\n");
+        }
+
+        /* Drop fragments that gave up waiting for the rest of their bundle */
+        BPLibStatus = BPLib_PI_ExpireReassembly(&AppData.BPLibInst);
+
+        if (BPLibStatus != BPLIB_SUCCESS)
+        {
+            fprintf(stderr, "Error expiring reassembly\n");
+        }
     }   
 
     /* Exit Signal Received */
 
     /* Cleanup */
     BPCat_StopTasks();
+
+    /* Send whatever events the tasks left behind */
+    BPLib_EM_SetDeferred(false);
+    (void) BPLib_EM_FlushDeferred(BPLIB_EM_DEFERRED_RING_SIZE);
+
+    /* Dump the bundle trace rings once every task has stopped writing to them */
+    if (getenv(BPCAT_TRACE_FILE_ENV) != NULL)
+    {
+        (void) BPCat_TraceDump(getenv(BPCAT_TRACE_FILE_ENV));
+    }
+
     BPLib_QM_QueueTableDestroy(&AppData.BPLibInst);
-    free(AppData.PoolMem);
+    BPLib_MEM_PoolDestroy(&AppData.BPLibInst.pool);
 }
 
 void SigHandler(int signo)
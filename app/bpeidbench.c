@@ -0,0 +1,184 @@
+/*
+ * NASA Docket No. GSC-19,559-1, and identified as "Delay/Disruption Tolerant Networking
+ * (DTN) Bundle Protocol (BP) v7 Core Flight System (cFS) Application Build 7.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+ * ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License. The copyright notice to be
+ * included in the software is as follows:
+ *
+ * Copyright 2025 United States Government as represented by the Administrator of the
+ * National Aeronautics and Space Administration. All Rights Reserved.
+ *
+ */
+
+/*******************************************************************************
+** bpeidbench: compare per-pattern and compiled pattern set EID matching
+**
+**  Usage: bpeidbench [iterations]
+**
+**  For several pattern set sizes, every EID of a fixed pseudo-random workload is matched
+**  against every pattern, once with BPLib_EID_PatternIsMatch in a loop and once with
+**  BPLib_EID_PatternSetMatch. Prints the cost per EID and checks both agree.
+*/
+
+/*******************************************************************************
+** Includes
+*/
+#include "bplib_eid.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*******************************************************************************
+** Definitions
+*/
+#define BPEIDBENCH_NUM_EIDS            1024
+#define BPEIDBENCH_DEFAULT_ITERATIONS  2000
+
+/*******************************************************************************
+** Helpers
+*/
+static uint32_t BPEidBench_Seed = 1;
+
+static uint64_t BPEidBench_Rand(uint64_t Range)
+{
+    BPEidBench_Seed = BPEidBench_Seed * 1103515245u + 12345u;
+    return ((BPEidBench_Seed >> 8) % Range);
+}
+
+static uint64_t BPEidBench_NowNs(void)
+{
+    struct timespec Ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return (uint64_t)Ts.tv_sec * 1000000000ull + (uint64_t)Ts.tv_nsec;
+}
+
+/* Node ranges spread over a small node space so a realistic fraction of EIDs match */
+static void BPEidBench_MakePattern(BPLib_EID_Pattern_t* Pattern)
+{
+    uint64_t Node = BPEidBench_Rand(1000);
+
+    Pattern->Scheme       = BPLIB_EID_SCHEME_IPN;
+    Pattern->IpnSspFormat = BPLIB_EID_IPN_SSP_FORMAT_TWO_DIGIT;
+    Pattern->MinAllocator = 0;
+    Pattern->MaxAllocator = 0;
+    Pattern->MinNode      = Node;
+    Pattern->MaxNode      = Node + BPEidBench_Rand(50);
+    Pattern->MinService   = 0;
+    Pattern->MaxService   = BPLIB_EID_PATTERN_MAX_SERVICE;
+}
+
+/*******************************************************************************
+** Main
+*/
+int main(int argc, char* argv[])
+{
+    static const uint32_t SetSizes[] = { 1, 3, 8, 16, 32, BPLIB_EID_PATTERN_SET_MAX };
+    static BPLib_EID_t EIDs[BPEIDBENCH_NUM_EIDS];
+    BPLib_EID_Pattern_t Patterns[BPLIB_EID_PATTERN_SET_MAX];
+    BPLib_EID_PatternSet_t Set;
+    uint64_t Start;
+    uint64_t ScalarNs;
+    uint64_t SetNs;
+    uint64_t ScalarSum;
+    uint64_t SetSum;
+    uint64_t Mask;
+    long Iterations;
+    uint32_t SizeIdx;
+    uint32_t NumPatterns;
+    uint32_t Iter;
+    uint32_t e;
+    uint32_t p;
+
+    Iterations = (argc > 1) ? strtol(argv[1], NULL, 0) : BPEIDBENCH_DEFAULT_ITERATIONS;
+    if (argc > 2 || Iterations <= 0)
+    {
+        fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    for (e = 0; e < BPEIDBENCH_NUM_EIDS; e++)
+    {
+        EIDs[e].Scheme       = BPLIB_EID_SCHEME_IPN;
+        EIDs[e].IpnSspFormat = BPLIB_EID_IPN_SSP_FORMAT_TWO_DIGIT;
+        EIDs[e].Allocator    = 0;
+        EIDs[e].Node         = BPEidBench_Rand(1100);
+        EIDs[e].Service      = BPEidBench_Rand(64);
+    }
+
+    for (p = 0; p < BPLIB_EID_PATTERN_SET_MAX; p++)
+    {
+        BPEidBench_MakePattern(&Patterns[p]);
+    }
+
+#ifdef __AVX2__
+    printf("Pattern set matcher: AVX2\n");
+#else
+    printf("Pattern set matcher: scalar\n");
+#endif
+    printf("%8s %14s %14s %8s\n", "patterns", "loop ns/EID", "set ns/EID", "speedup");
+
+    for (SizeIdx = 0; SizeIdx < sizeof(SetSizes) / sizeof(SetSizes[0]); SizeIdx++)
+    {
+        NumPatterns = SetSizes[SizeIdx];
+        if (BPLib_EID_PatternSetCompile(&Set, Patterns, NumPatterns) != BPLIB_SUCCESS)
+        {
+            fprintf(stderr, "Failed to compile %u patterns\n", NumPatterns);
+            return EXIT_FAILURE;
+        }
+
+        /* One pattern at a time, the way routing matched before pattern sets */
+        ScalarSum = 0;
+        Start = BPEidBench_NowNs();
+        for (Iter = 0; Iter < (uint32_t)Iterations; Iter++)
+        {
+            for (e = 0; e < BPEIDBENCH_NUM_EIDS; e++)
+            {
+                Mask = 0;
+                for (p = 0; p < NumPatterns; p++)
+                {
+                    if (BPLib_EID_PatternIsMatch(&EIDs[e], &Patterns[p]))
+                    {
+                        Mask |= (uint64_t)1 << p;
+                    }
+                }
+                ScalarSum += Mask;
+            }
+        }
+        ScalarNs = BPEidBench_NowNs() - Start;
+
+        SetSum = 0;
+        Start = BPEidBench_NowNs();
+        for (Iter = 0; Iter < (uint32_t)Iterations; Iter++)
+        {
+            for (e = 0; e < BPEIDBENCH_NUM_EIDS; e++)
+            {
+                SetSum += BPLib_EID_PatternSetMatch(&EIDs[e], &Set);
+            }
+        }
+        SetNs = BPEidBench_NowNs() - Start;
+
+        if (ScalarSum != SetSum)
+        {
+            fprintf(stderr, "Pattern set results differ from per-pattern results for %u patterns\n",
+                NumPatterns);
+            return EXIT_FAILURE;
+        }
+
+        printf("%8u %14.2f %14.2f %7.2fx\n", NumPatterns,
+            (double)ScalarNs / ((double)Iterations * BPEIDBENCH_NUM_EIDS),
+            (double)SetNs / ((double)Iterations * BPEIDBENCH_NUM_EIDS),
+            (SetNs != 0) ? (double)ScalarNs / (double)SetNs : 0.0);
+    }
+
+    return EXIT_SUCCESS;
+}
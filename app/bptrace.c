@@ -0,0 +1,120 @@
+/*
+ * NASA Docket No. GSC-19,559-1, and identified as "Delay/Disruption Tolerant Networking 
+ * (DTN) Bundle Protocol (BP) v7 Core Flight System (cFS) Application Build 7.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this 
+ * file except in compliance with the License. You may obtain a copy of the License at 
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0 
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under 
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF 
+ * ANY KIND, either express or implied. See the License for the specific language 
+ * governing permissions and limitations under the License. The copyright notice to be 
+ * included in the software is as follows: 
+ *
+ * Copyright 2025 United States Government as represented by the Administrator of the 
+ * National Aeronautics and Space Administration. All Rights Reserved.
+ *
+ */
+
+/*******************************************************************************
+** bptrace: decode a bundle trace dump written by bpcat
+**
+**  Usage: bptrace <trace file>
+**
+**  Records from every thread are merged and printed oldest first, one per line.
+*/
+
+/*******************************************************************************
+** Includes
+*/
+#include "bpcat_trace.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*******************************************************************************
+** Helpers
+*/
+static int BPTrace_CompareTime(const void* a, const void* b)
+{
+    const BPLib_PL_TraceRecord_t* RecA = (const BPLib_PL_TraceRecord_t*)a;
+    const BPLib_PL_TraceRecord_t* RecB = (const BPLib_PL_TraceRecord_t*)b;
+
+    if (RecA->TimeNs != RecB->TimeNs)
+    {
+        return (RecA->TimeNs < RecB->TimeNs) ? -1 : 1;
+    }
+    if (RecA->Ring != RecB->Ring)
+    {
+        return (RecA->Ring < RecB->Ring) ? -1 : 1;
+    }
+    return (RecA->Seq < RecB->Seq) ? -1 : (RecA->Seq > RecB->Seq);
+}
+
+/*******************************************************************************
+** Main
+*/
+int main(int argc, char* argv[])
+{
+    BPCat_TraceFileHeader_t Header;
+    BPLib_PL_TraceRecord_t* Records;
+    FILE* File;
+    size_t NumRead;
+    size_t i;
+    char Line[256];
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <trace file>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    File = fopen(argv[1], "rb");
+    if (File == NULL)
+    {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    if ((fread(&Header, sizeof(Header), 1, File) != 1) || (Header.Magic != BPCAT_TRACE_MAGIC))
+    {
+        fprintf(stderr, "%s is not a bundle trace dump\n", argv[1]);
+        fclose(File);
+        return EXIT_FAILURE;
+    }
+    if ((Header.Version != BPCAT_TRACE_VERSION) || (Header.RecordSize != sizeof(BPLib_PL_TraceRecord_t)))
+    {
+        fprintf(stderr, "%s was written by an incompatible build (version %u, record size %u)\n",
+            argv[1], (unsigned int)Header.Version, (unsigned int)Header.RecordSize);
+        fclose(File);
+        return EXIT_FAILURE;
+    }
+
+    Records = calloc(Header.NumRecords ? Header.NumRecords : 1, sizeof(BPLib_PL_TraceRecord_t));
+    if (Records == NULL)
+    {
+        perror("calloc()");
+        fclose(File);
+        return EXIT_FAILURE;
+    }
+
+    NumRead = fread(Records, sizeof(BPLib_PL_TraceRecord_t), Header.NumRecords, File);
+    fclose(File);
+    if (NumRead != Header.NumRecords)
+    {
+        fprintf(stderr, "Warning: expected %u records, read %zu\n", (unsigned int)Header.NumRecords, NumRead);
+    }
+
+    qsort(Records, NumRead, sizeof(BPLib_PL_TraceRecord_t), BPTrace_CompareTime);
+
+    for (i = 0; i < NumRead; i++)
+    {
+        BPLib_PL_TraceDecode(&Records[i], Line, sizeof(Line));
+        printf("%s\n", Line);
+    }
+
+    free(Records);
+    return EXIT_SUCCESS;
+}
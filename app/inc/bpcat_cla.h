@@ -22,16 +22,24 @@
 
 #include "bpcat_types.h"
 
+/* Number of SO_REUSEPORT sockets bound to the contact's ingress address, each with its
+** own CLA In task. The TaskId of a CLA In task is the index of its socket.
+*/
+#define BPCAT_CLA_NUM_RX_SOCKETS    4
+
 BPCat_Status_t BPCat_CLAOutSetup(uint32_t TaskId);
 
 BPCat_Status_t BPCat_CLAOutTeardown(uint32_t TaskId);
 
-void* BPCat_CLAOutTaskFunc();
+void* BPCat_CLAOutTaskFunc(BPCat_AppData_t* AppData, uint32_t TaskId);
 
 BPCat_Status_t BPCat_CLAInSetup(uint32_t TaskId);
 
-BPCat_Status_t BPCat_CLAOutTeardown(uint32_t TaskId);
+BPCat_Status_t BPCat_CLAInTeardown(uint32_t TaskId);
+
+void* BPCat_CLAInTaskFunc(BPCat_AppData_t* AppData, uint32_t TaskId);
 
-void* BPCat_CLAInTaskFunc();
+/* Print how ingress traffic was spread across the receive sockets */
+void BPCat_CLAInReportStats(void);
 
 #endif /* BPLIB_BPCAT_CLA_H */
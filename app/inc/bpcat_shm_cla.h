@@ -0,0 +1,49 @@
+/*
+ * NASA Docket No. GSC-19,559-1, and identified as "Delay/Disruption Tolerant Networking
+ * (DTN) Bundle Protocol (BP) v7 Core Flight System (cFS) Application Build 7.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+ * ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License. The copyright notice to be
+ * included in the software is as follows:
+ *
+ * Copyright 2025 United States Government as represented by the Administrator of the
+ * National Aeronautics and Space Administration. All Rights Reserved.
+ *
+ */
+#ifndef BPLIB_BPCAT_SHM_CLA_H
+#define BPLIB_BPCAT_SHM_CLA_H
+
+#include "bpcat_types.h"
+
+/* Bytes of bundle data each shared memory ring holds, must be a power of two */
+#ifndef BPCAT_SHM_RING_SIZE
+#define BPCAT_SHM_RING_SIZE         (4 * 1024 * 1024)
+#endif
+
+/* Set the shm_open name prefix of the rings. Each ring is named Name.<port> after the
+** contact's port it replaces, so the egress ring of one bpcat is the ingress ring of the
+** bpcat whose ClaInPort matches its ClaOutPort. Must be called before the shared memory
+** CLA tasks are set up.
+*/
+void BPCat_ShmCLAConfigure(const char* Name);
+
+BPCat_Status_t BPCat_ShmCLAOutSetup(uint32_t TaskId);
+
+BPCat_Status_t BPCat_ShmCLAOutTeardown(uint32_t TaskId);
+
+void* BPCat_ShmCLAOutTaskFunc(BPCat_AppData_t* AppData, uint32_t TaskId);
+
+BPCat_Status_t BPCat_ShmCLAInSetup(uint32_t TaskId);
+
+BPCat_Status_t BPCat_ShmCLAInTeardown(uint32_t TaskId);
+
+void* BPCat_ShmCLAInTaskFunc(BPCat_AppData_t* AppData, uint32_t TaskId);
+
+#endif /* BPLIB_BPCAT_SHM_CLA_H */
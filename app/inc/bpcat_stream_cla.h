@@ -0,0 +1,52 @@
+/*
+ * NASA Docket No. GSC-19,559-1, and identified as "Delay/Disruption Tolerant Networking
+ * (DTN) Bundle Protocol (BP) v7 Core Flight System (cFS) Application Build 7.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+ * ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License. The copyright notice to be
+ * included in the software is as follows:
+ *
+ * Copyright 2025 United States Government as represented by the Administrator of the
+ * National Aeronautics and Space Administration. All Rights Reserved.
+ *
+ */
+#ifndef BPLIB_BPCAT_STREAM_CLA_H
+#define BPLIB_BPCAT_STREAM_CLA_H
+
+#include "bpcat_types.h"
+
+/* Default socket buffer sizes, in bytes, for stream CLA connections */
+#ifndef BPCAT_STREAM_SNDBUF
+#define BPCAT_STREAM_SNDBUF         (4 * 1024 * 1024)
+#endif
+
+#ifndef BPCAT_STREAM_RCVBUF
+#define BPCAT_STREAM_RCVBUF         (4 * 1024 * 1024)
+#endif
+
+/* Select TCP (UseUnix false) or Unix-domain sockets and the socket buffer sizes used by the
+** stream CLA. Unix-domain sockets are named UnixPath.<port> after the contact's ports.
+** Must be called before the stream CLA tasks are set up.
+*/
+void BPCat_StreamCLAConfigure(bool UseUnix, const char* UnixPath, int SndBuf, int RcvBuf);
+
+BPCat_Status_t BPCat_StreamCLAOutSetup(uint32_t TaskId);
+
+BPCat_Status_t BPCat_StreamCLAOutTeardown(uint32_t TaskId);
+
+void* BPCat_StreamCLAOutTaskFunc(BPCat_AppData_t* AppData, uint32_t TaskId);
+
+BPCat_Status_t BPCat_StreamCLAInSetup(uint32_t TaskId);
+
+BPCat_Status_t BPCat_StreamCLAInTeardown(uint32_t TaskId);
+
+void* BPCat_StreamCLAInTaskFunc(BPCat_AppData_t* AppData, uint32_t TaskId);
+
+#endif /* BPLIB_BPCAT_STREAM_CLA_H */
@@ -27,11 +27,12 @@
 
 typedef struct BPCat_Task
 {
-    void* (*TaskFunc)(BPCat_AppData_t* AppData);
+    void* (*TaskFunc)(BPCat_AppData_t* AppData, uint32_t TaskId);
     BPCat_Status_t (*TaskSetup)(uint32_t TaskId);
     BPCat_Status_t (*TaskTeardown)(uint32_t TaskId);
     pthread_t Handle;
     uint32_t TaskId;
+    BPCat_AppData_t* AppData;
 } BPCat_Task_t;
 
 
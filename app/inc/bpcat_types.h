@@ -36,13 +36,14 @@
 #define BPCAT_SOCKET_ERR      (-3L)
 #define BPCAT_TASK_INIT_ERR   (-4L)
 #define BPCAT_NC_INIT_ERR     (-5L)
+#define BPCAT_TRACE_ERR       (-6L)
+#define BPCAT_SHM_ERR         (-7L)
 
 typedef int BPCat_Status_t;
 
 typedef struct BPCat_AppData
 {
     volatile sig_atomic_t Running;
-    void* PoolMem;
     BPLib_Instance_t BPLibInst;
     BPLib_NC_ConfigPtrs_t ConfigPtrs;
 } BPCat_AppData_t;
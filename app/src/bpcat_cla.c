@@ -17,9 +17,17 @@
  * National Aeronautics and Space Administration. All Rights Reserved.
  *
  */
+
+/* recvmmsg() and sendmmsg() are GNU extensions */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include "bpcat_cla.h"
 
+#include <errno.h>
 #include <stdio.h>
+#include <string.h>
 #include <arpa/inet.h>
 #include <netinet/in.h>
 #include <poll.h>
@@ -30,6 +38,8 @@
 
 #define BPCAT_CLA_TIMEOUT              100
 #define BPCAT_CLA_BUFLEN               4096
+#define BPCAT_CLA_BATCH_SIZE           32    /* Datagrams moved per recvmmsg()/sendmmsg() call */
+#define BPCAT_CLA_CONTACT_ID           0     /* bpcat runs a single contact */
 
 /* These configurations are going to be greatly improved
 ** once there is a) time to do so and b) an ability to pass
@@ -40,15 +50,29 @@ typedef struct CLAOutConfig
 {
     int SockFd;
     struct sockaddr_in ServerAddr;    
+    uint8_t Buffer[BPCAT_CLA_BATCH_SIZE * BPCAT_CLA_BUFLEN];  /* Bundles are packed back to back */
+    size_t Sizes[BPCAT_CLA_BATCH_SIZE];
+    struct iovec Iov[BPCAT_CLA_BATCH_SIZE];
+    struct mmsghdr Msgs[BPCAT_CLA_BATCH_SIZE];
 } CLAOutConfig_t;
 
+/* Each receive socket is only touched by its own CLA In task, so the counters are
+** plain fields that are read once the tasks have stopped
+*/
 typedef struct CLAInConfig
 {
     int SockFd;
+    uint8_t Buffers[BPCAT_CLA_BATCH_SIZE][BPCAT_CLA_BUFLEN];
+    struct iovec Iov[BPCAT_CLA_BATCH_SIZE];
+    struct mmsghdr Msgs[BPCAT_CLA_BATCH_SIZE];
+    uint64_t Datagrams;
+    uint64_t Bytes;
+    uint64_t Batches;
+    uint64_t Rejected;
 } CLAInConfig_t;
 
 static CLAOutConfig_t TxCLAConfig;
-static CLAInConfig_t RxCLAConfig;
+static CLAInConfig_t RxCLAConfig[BPCAT_CLA_NUM_RX_SOCKETS];
 
 /*******************************************************************************
 * CLA Out Task Implementation 
@@ -56,6 +80,7 @@ static CLAInConfig_t RxCLAConfig;
 BPCat_Status_t BPCat_CLAOutSetup(uint32_t TaskId)
 {
     int SockFd;
+    uint32_t i;
     
     /* Pre-populate the ServerAddr here to prevent doing it in the run loop */
     memset(&(TxCLAConfig.ServerAddr), 0, sizeof(TxCLAConfig.ServerAddr));
@@ -63,6 +88,18 @@ BPCat_Status_t BPCat_CLAOutSetup(uint32_t TaskId)
     TxCLAConfig.ServerAddr.sin_addr.s_addr = inet_addr(AppData.ConfigPtrs.ContactsConfigPtr->ContactSet[TaskId].ClaOutAddr);
     TxCLAConfig.ServerAddr.sin_port = htons(AppData.ConfigPtrs.ContactsConfigPtr->ContactSet[TaskId].ClaOutPort);
 
+    /* Every datagram of a batch goes to the same address, only the lengths change per batch */
+    memset(TxCLAConfig.Msgs, 0, sizeof(TxCLAConfig.Msgs));
+    for (i = 0; i < BPCAT_CLA_BATCH_SIZE; i++)
+    {
+        TxCLAConfig.Iov[i].iov_base = TxCLAConfig.Buffer;
+        TxCLAConfig.Iov[i].iov_len = 0;
+        TxCLAConfig.Msgs[i].msg_hdr.msg_iov = &TxCLAConfig.Iov[i];
+        TxCLAConfig.Msgs[i].msg_hdr.msg_iovlen = 1;
+        TxCLAConfig.Msgs[i].msg_hdr.msg_name = &TxCLAConfig.ServerAddr;
+        TxCLAConfig.Msgs[i].msg_hdr.msg_namelen = sizeof(TxCLAConfig.ServerAddr);
+    }
+
     SockFd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
     if (SockFd < 0)
     {
@@ -83,30 +120,46 @@ BPCat_Status_t BPCat_CLAOutTeardown(uint32_t TaskId)
     return BPCAT_SUCCESS;
 }
 
-void* BPCat_CLAOutTaskFunc(BPCat_AppData_t* AppData)
+void* BPCat_CLAOutTaskFunc(BPCat_AppData_t* AppData, uint32_t TaskId)
 {
     BPLib_Status_t EgressStatus;
     int rc;
-    uint8_t buffer[BPCAT_CLA_BUFLEN] = {0};
-    size_t OutSize;
+    size_t Offset;
+    uint32_t NumTx;
+    uint32_t NumSent;
+    uint32_t i;
 
     while(AppData->Running)
     {
-        EgressStatus = BPLib_CLA_Egress(&AppData->BPLibInst, 0, buffer, &OutSize, BPCAT_CLA_BUFLEN,
-            BPCAT_CLA_TIMEOUT);
-        if (EgressStatus == BPLIB_SUCCESS)
+        /* Wait for the first bundle, then take whatever else is already queued */
+        NumTx = 0;
+        EgressStatus = BPLib_CLA_EgressBatch(&AppData->BPLibInst, BPCAT_CLA_CONTACT_ID, TxCLAConfig.Buffer,
+            sizeof(TxCLAConfig.Buffer), TxCLAConfig.Sizes, BPCAT_CLA_BATCH_SIZE, &NumTx, BPCAT_CLA_TIMEOUT);
+        if ((EgressStatus != BPLIB_SUCCESS) && (EgressStatus != BPLIB_CLA_TIMEOUT))
+        {
+            fprintf(stderr, "Error egressing, RC=%d\n", EgressStatus);
+        }
+
+        /* One datagram per bundle, pointing into the packed buffer */
+        Offset = 0;
+        for (i = 0; i < NumTx; i++)
+        {
+            TxCLAConfig.Iov[i].iov_base = &TxCLAConfig.Buffer[Offset];
+            TxCLAConfig.Iov[i].iov_len = TxCLAConfig.Sizes[i];
+            Offset += TxCLAConfig.Sizes[i];
+        }
+
+        /* sendmmsg() can send less than the full batch, so keep going until it is all out */
+        NumSent = 0;
+        while (NumSent < NumTx)
         {
-            rc = sendto(TxCLAConfig.SockFd, buffer, OutSize, 0, 
-                (struct sockaddr*)&(TxCLAConfig.ServerAddr), sizeof(TxCLAConfig.ServerAddr));
+            rc = sendmmsg(TxCLAConfig.SockFd, &TxCLAConfig.Msgs[NumSent], NumTx - NumSent, 0);
             if (rc < 0)
             {
-                perror("sendto()");
+                perror("sendmmsg()");
                 return NULL;
             }
-        }
-        else if (EgressStatus != BPLIB_CLA_TIMEOUT)
-        {
-            fprintf(stderr, "Error egressing, RC=%d\n", EgressStatus);
+            NumSent += (uint32_t) rc;
         }
     }
     return NULL;
@@ -117,8 +170,17 @@ void* BPCat_CLAOutTaskFunc(BPCat_AppData_t* AppData)
 */
 BPCat_Status_t BPCat_CLAInSetup(uint32_t TaskId)
 {
+    CLAInConfig_t* Rx;
     int SockFd;
+    int ReusePort;
     struct sockaddr_in BindAddr;
+    uint32_t i;
+
+    if (TaskId >= BPCAT_CLA_NUM_RX_SOCKETS)
+    {
+        return BPCAT_SOCKET_ERR;
+    }
+    Rx = &RxCLAConfig[TaskId];
 
     /* Create a UDP socket for the RX link */
     SockFd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
@@ -128,11 +190,20 @@ BPCat_Status_t BPCat_CLAInSetup(uint32_t TaskId)
         return BPCAT_SOCKET_ERR;
     }
 
+    /* Every receive socket binds the same address, the kernel spreads flows across them */
+    ReusePort = 1;
+    if (setsockopt(SockFd, SOL_SOCKET, SO_REUSEPORT, &ReusePort, sizeof(ReusePort)))
+    {
+        perror("setsockopt(SO_REUSEPORT)");
+        close(SockFd);
+        return BPCAT_SOCKET_ERR;
+    }
+
     /* Bind the socket to localhost */
     memset(&BindAddr, 0, sizeof(struct sockaddr_in));
     BindAddr.sin_family = AF_INET;
-    BindAddr.sin_addr.s_addr = inet_addr(AppData.ConfigPtrs.ContactsConfigPtr->ContactSet[TaskId].ClaInAddr);
-    BindAddr.sin_port = htons(AppData.ConfigPtrs.ContactsConfigPtr->ContactSet[TaskId].ClaInPort);
+    BindAddr.sin_addr.s_addr = inet_addr(AppData.ConfigPtrs.ContactsConfigPtr->ContactSet[BPCAT_CLA_CONTACT_ID].ClaInAddr);
+    BindAddr.sin_port = htons(AppData.ConfigPtrs.ContactsConfigPtr->ContactSet[BPCAT_CLA_CONTACT_ID].ClaInPort);
     if (bind(SockFd, (const struct sockaddr*)&BindAddr,
         sizeof(struct sockaddr))) 
     {
@@ -141,45 +212,88 @@ BPCat_Status_t BPCat_CLAInSetup(uint32_t TaskId)
         return BPCAT_SOCKET_ERR;
     }
 
-    printf("Setup CLA Ingress UDP socket on %s:%u\n", AppData.ConfigPtrs.ContactsConfigPtr->ContactSet[TaskId].ClaInAddr,
-                                                      AppData.ConfigPtrs.ContactsConfigPtr->ContactSet[TaskId].ClaInPort);
-    RxCLAConfig.SockFd = SockFd;
+    /* Point each message of a receive batch at its own datagram buffer */
+    memset(Rx->Msgs, 0, sizeof(Rx->Msgs));
+    for (i = 0; i < BPCAT_CLA_BATCH_SIZE; i++)
+    {
+        Rx->Iov[i].iov_base = Rx->Buffers[i];
+        Rx->Iov[i].iov_len = BPCAT_CLA_BUFLEN;
+        Rx->Msgs[i].msg_hdr.msg_iov = &Rx->Iov[i];
+        Rx->Msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    Rx->Datagrams = 0;
+    Rx->Bytes = 0;
+    Rx->Batches = 0;
+    Rx->Rejected = 0;
+
+    printf("Setup CLA Ingress UDP socket %u on %s:%u\n", TaskId,
+        AppData.ConfigPtrs.ContactsConfigPtr->ContactSet[BPCAT_CLA_CONTACT_ID].ClaInAddr,
+        AppData.ConfigPtrs.ContactsConfigPtr->ContactSet[BPCAT_CLA_CONTACT_ID].ClaInPort);
+    Rx->SockFd = SockFd;
     return BPCAT_SUCCESS;
 }
 
 BPCat_Status_t BPCat_CLAInTeardown(uint32_t TaskId)
 {
-    close(RxCLAConfig.SockFd);
-    RxCLAConfig.SockFd = -1;
+    if (TaskId >= BPCAT_CLA_NUM_RX_SOCKETS)
+    {
+        return BPCAT_SOCKET_ERR;
+    }
+
+    close(RxCLAConfig[TaskId].SockFd);
+    RxCLAConfig[TaskId].SockFd = -1;
     return BPCAT_SUCCESS;
 }
 
-void* BPCat_CLAInTaskFunc(BPCat_AppData_t* AppData)
+void* BPCat_CLAInTaskFunc(BPCat_AppData_t* AppData, uint32_t TaskId)
 {
-    uint8_t buffer[BPCAT_CLA_BUFLEN] = {0};
+    CLAInConfig_t* Rx = &RxCLAConfig[TaskId];
+    const void* Bundles[BPCAT_CLA_BATCH_SIZE];
+    size_t Sizes[BPCAT_CLA_BATCH_SIZE];
     struct pollfd pfd;
-    int BytesRx, PollRc;
+    int NumRx, PollRc, i;
+    uint32_t NumAccepted;
     BPLib_Status_t BpStatus;
 
     while(AppData->Running)
     {
-        pfd.fd = RxCLAConfig.SockFd;
+        /* Leave datagrams in the socket buffer while the pool is congested */
+        if (BPLib_MEM_PoolIsCongested(&AppData->BPLibInst.pool))
+        {
+            usleep(BPCAT_CLA_TIMEOUT * 1000);
+            continue;
+        }
+
+        pfd.fd = Rx->SockFd;
         pfd.events = POLLIN;
         PollRc = poll(&pfd, 1, BPCAT_CLA_TIMEOUT);
         if (PollRc > 0)
         {
-            BytesRx = recv(RxCLAConfig.SockFd, buffer, BPCAT_CLA_BUFLEN, 0);
-            if (BytesRx > 0)
+            /* Drain up to a full batch of datagrams without blocking */
+            NumRx = recvmmsg(Rx->SockFd, Rx->Msgs, BPCAT_CLA_BATCH_SIZE, MSG_DONTWAIT, NULL);
+            if (NumRx > 0)
             {
-                BpStatus = BPLib_CLA_Ingress(&AppData->BPLibInst, 0, buffer, BytesRx, 0);
+                for (i = 0; i < NumRx; i++)
+                {
+                    Bundles[i] = Rx->Buffers[i];
+                    Sizes[i] = Rx->Msgs[i].msg_len;
+                    Rx->Bytes += Sizes[i];
+                }
+                Rx->Datagrams += (uint64_t) NumRx;
+                Rx->Batches++;
+
+                BpStatus = BPLib_CLA_IngressBatch(&AppData->BPLibInst, BPCAT_CLA_CONTACT_ID, Bundles, Sizes,
+                    (uint32_t) NumRx, &NumAccepted);
                 if (BpStatus != BPLIB_SUCCESS)
                 {
-                    fprintf(stderr, "BPLib_CLA_Ingress Fail RC=%d\n", BpStatus);
+                    Rx->Rejected += (uint64_t) NumRx - NumAccepted;
+                    fprintf(stderr, "BPLib_CLA_IngressBatch Fail on socket %u RC=%d, accepted %u of %d\n",
+                        TaskId, BpStatus, NumAccepted, NumRx);
                 }
             }
-            else if (BytesRx < 0)
+            else if ((NumRx < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))
             {
-                perror("recv()");
+                perror("recvmmsg()");
                 return NULL;
             }
         }
@@ -192,3 +306,24 @@ void* BPCat_CLAInTaskFunc(BPCat_AppData_t* AppData)
 
     return NULL;
 }
+
+void BPCat_CLAInReportStats(void)
+{
+    uint64_t TotalDatagrams = 0;
+    uint32_t i;
+
+    for (i = 0; i < BPCAT_CLA_NUM_RX_SOCKETS; i++)
+    {
+        TotalDatagrams += RxCLAConfig[i].Datagrams;
+    }
+
+    for (i = 0; i < BPCAT_CLA_NUM_RX_SOCKETS; i++)
+    {
+        printf("CLA Ingress socket %u: %llu datagrams (%.1f%%), %llu bytes, %llu batches, %llu rejected\n", i,
+            (unsigned long long) RxCLAConfig[i].Datagrams,
+            (TotalDatagrams != 0) ? (100.0 * (double) RxCLAConfig[i].Datagrams) / (double) TotalDatagrams : 0.0,
+            (unsigned long long) RxCLAConfig[i].Bytes,
+            (unsigned long long) RxCLAConfig[i].Batches,
+            (unsigned long long) RxCLAConfig[i].Rejected);
+    }
+}
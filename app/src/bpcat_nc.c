@@ -35,7 +35,7 @@ static BPLib_CLA_ContactsTable_t ContactsTbl =
                                         .MinNode      = 200,
                                         .MaxService   = 64,
                                         .MinService   = 64},},
-            .CLAType                = 1, /*CLA Type, uint32 */
+            .CLAType                = UDPType, /* CLA Type, BPCAT_CLA_TYPE overrides it */
             .ClaInAddr              = "0.0.0.0",
             .ClaOutAddr             = "127.0.0.1", /* CL ip address */
             .ClaInPort              = 4501, /* Port Number, int32 */
@@ -94,7 +94,10 @@ BPCat_Status_t BPCat_NC_Init(BPLib_NC_ConfigPtrs_t* ConfigPtrs)
     ConfigPtrs->ReportConfigPtr    = &ReportTbl;
     ConfigPtrs->AuthConfigPtr      = &AuthTbl;
     ConfigPtrs->LatConfigPtr       = &LatencyTbl;
-    ConfigPtrs->StorConfigPtr      = &StorTbl;    
+    ConfigPtrs->StorConfigPtr      = &StorTbl;
+
+    /* bpcat has no contact plan, contacts are started by the application */
+    ConfigPtrs->ContactPlanConfigPtr = NULL;
 
     NCStatus = BPLib_NC_Init(ConfigPtrs);
     if (NCStatus != BPLIB_SUCCESS)
@@ -0,0 +1,485 @@
+/*
+ * NASA Docket No. GSC-19,559-1, and identified as "Delay/Disruption Tolerant Networking
+ * (DTN) Bundle Protocol (BP) v7 Core Flight System (cFS) Application Build 7.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+ * ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License. The copyright notice to be
+ * included in the software is as follows:
+ *
+ * Copyright 2025 United States Government as represented by the Administrator of the
+ * National Aeronautics and Space Administration. All Rights Reserved.
+ *
+ */
+
+/* Shared memory CLA for bpcat instances on the same host. Each direction of a contact is
+** a single-producer/single-consumer ring in a POSIX shared memory object. Bundles are
+** written straight into the ring by BPLib_CLA_Egress and ingressed straight out of it,
+** so in steady state no data is copied through the kernel and no system calls are made.
+** A side only makes a futex call when it runs out of data or space, after publishing that
+** it is waiting; the other side only wakes it when it sees that flag set.
+**
+** The ingress side owns its ring: it creates the object on setup and marks it closed and
+** unlinks it on teardown. The egress side attaches to whatever ring the peer created and
+** reattaches when the peer closes it, so either bpcat can be started first.
+*/
+
+#include "bpcat_shm_cla.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#if (BPCAT_SHM_RING_SIZE & (BPCAT_SHM_RING_SIZE - 1)) != 0
+#error "BPCAT_SHM_RING_SIZE must be a power of two"
+#endif
+
+#define BPCAT_SHM_TIMEOUT           100
+#define BPCAT_SHM_BATCH_SIZE        32                    /* Bundles ingressed together */
+#define BPCAT_SHM_CONTACT_ID        0                     /* bpcat runs a single contact */
+#define BPCAT_SHM_NAME_LEN          64
+#define BPCAT_SHM_MAGIC             0x42505348u           /* "BPSH" */
+#define BPCAT_SHM_VERSION           1u
+#define BPCAT_SHM_CACHE_LINE        64
+
+/* Records are an 8 byte header followed by the bundle, padded to a multiple of 8 bytes.
+** A record never wraps; when the rest of the ring is too short a pad record fills it.
+*/
+#define BPCAT_SHM_REC_HDR_LEN       8u
+#define BPCAT_SHM_REC_FLAG_PAD      0x1u
+#define BPCAT_SHM_ALIGN(Len)        (((size_t) (Len) + 7u) & ~(size_t) 7u)
+#define BPCAT_SHM_MAX_RECORD        (BPCAT_SHM_REC_HDR_LEN + BPCAT_SHM_ALIGN(BPLIB_MAX_BUNDLE_LEN))
+
+/* Layout of the start of the shared memory object, the ring data follows it. Head and
+** Tail count bytes written and read since the ring was created and never wrap. Producer
+** and consumer fields are kept on separate cache lines.
+*/
+typedef struct ShmRingHdr
+{
+    uint32_t Magic;                 /* Stored last by the creator, once the ring is usable */
+    uint32_t Version;
+    uint64_t Size;                  /* Bytes of ring data, a power of two */
+    uint32_t Closed;                /* Set when the ingress side goes away */
+    uint8_t  Pad0[BPCAT_SHM_CACHE_LINE - 20];
+
+    uint64_t Head;                  /* Written by the producer */
+    uint32_t DataSeq;               /* Futex the consumer sleeps on while the ring is empty */
+    uint32_t ReaderWaiting;
+    uint8_t  Pad1[BPCAT_SHM_CACHE_LINE - 16];
+
+    uint64_t Tail;                  /* Written by the consumer */
+    uint32_t SpaceSeq;              /* Futex the producer sleeps on while the ring is full */
+    uint32_t WriterWaiting;
+    uint8_t  Pad2[BPCAT_SHM_CACHE_LINE - 16];
+} ShmRingHdr_t;
+
+typedef struct ShmRecHdr
+{
+    uint32_t Len;
+    uint32_t Flags;
+} ShmRecHdr_t;
+
+typedef struct ShmRing
+{
+    char Name[BPCAT_SHM_NAME_LEN];
+    ShmRingHdr_t* Hdr;
+    uint8_t* Data;
+    size_t MapLen;
+    uint64_t Pos;                   /* Local copy of Head (egress) or Tail (ingress) */
+} ShmRing_t;
+
+static char ShmName[BPCAT_SHM_NAME_LEN - 8] = "/bpcat";
+static ShmRing_t TxRing;
+static ShmRing_t RxRing;
+
+/*******************************************************************************
+* Helpers
+*/
+void BPCat_ShmCLAConfigure(const char* Name)
+{
+    if (Name != NULL)
+    {
+        snprintf(ShmName, sizeof(ShmName), "%s", Name);
+    }
+}
+
+static void BPCat_ShmFutexWait(uint32_t* Word, uint32_t Expected)
+{
+    struct timespec Timeout = { 0, BPCAT_SHM_TIMEOUT * 1000000L };
+
+    /* Not FUTEX_PRIVATE_FLAG, the word is shared with another process */
+    (void) syscall(SYS_futex, Word, FUTEX_WAIT, Expected, &Timeout, NULL, 0);
+}
+
+static void BPCat_ShmFutexWake(uint32_t* Seq)
+{
+    (void) __atomic_add_fetch(Seq, 1, __ATOMIC_SEQ_CST);
+    (void) syscall(SYS_futex, Seq, FUTEX_WAKE, 1, NULL, NULL, 0);
+}
+
+/* Only wake the other side if it said it is waiting */
+static void BPCat_ShmDoorbell(uint32_t* Waiting, uint32_t* Seq)
+{
+    if (__atomic_load_n(Waiting, __ATOMIC_SEQ_CST) != 0)
+    {
+        BPCat_ShmFutexWake(Seq);
+    }
+}
+
+static void BPCat_ShmUnmap(ShmRing_t* Ring)
+{
+    if (Ring->Hdr != NULL)
+    {
+        munmap(Ring->Hdr, Ring->MapLen);
+        Ring->Hdr = NULL;
+        Ring->Data = NULL;
+    }
+}
+
+static bool BPCat_ShmMap(ShmRing_t* Ring, int Fd, size_t MapLen)
+{
+    void* Addr;
+
+    Addr = mmap(NULL, MapLen, PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+    if (Addr == MAP_FAILED)
+    {
+        perror("mmap()");
+        return false;
+    }
+
+    Ring->Hdr = Addr;
+    Ring->Data = (uint8_t*) Addr + sizeof(ShmRingHdr_t);
+    Ring->MapLen = MapLen;
+    return true;
+}
+
+/*******************************************************************************
+* Shared Memory CLA Out Task Implementation
+*/
+BPCat_Status_t BPCat_ShmCLAOutSetup(uint32_t TaskId)
+{
+    const BPLib_CLA_ContactsSet_t* Contact = &AppData.ConfigPtrs.ContactsConfigPtr->ContactSet[TaskId];
+
+    /* The peer may not have created its ring yet, so attaching is left to the task */
+    memset(&TxRing, 0, sizeof(TxRing));
+    snprintf(TxRing.Name, sizeof(TxRing.Name), "%s.%u", ShmName, Contact->ClaOutPort);
+
+    printf("Setup CLA Egress shared memory ring %s\n", TxRing.Name);
+    return BPCAT_SUCCESS;
+}
+
+BPCat_Status_t BPCat_ShmCLAOutTeardown(uint32_t TaskId)
+{
+    BPCat_ShmUnmap(&TxRing);
+    return BPCAT_SUCCESS;
+}
+
+/* Attach to the peer's ring if it exists and has been initialized */
+static void BPCat_ShmAttach(void)
+{
+    struct stat St;
+    int Fd;
+
+    Fd = shm_open(TxRing.Name, O_RDWR, 0);
+    if (Fd < 0)
+    {
+        return;
+    }
+
+    if ((fstat(Fd, &St) == 0) && ((size_t) St.st_size > sizeof(ShmRingHdr_t)) &&
+        BPCat_ShmMap(&TxRing, Fd, (size_t) St.st_size))
+    {
+        if ((__atomic_load_n(&TxRing.Hdr->Magic, __ATOMIC_ACQUIRE) != BPCAT_SHM_MAGIC) ||
+            (TxRing.Hdr->Version != BPCAT_SHM_VERSION) ||
+            (TxRing.Hdr->Size != (size_t) St.st_size - sizeof(ShmRingHdr_t)) ||
+            (TxRing.Hdr->Size < BPCAT_SHM_MAX_RECORD) ||
+            (__atomic_load_n(&TxRing.Hdr->Closed, __ATOMIC_ACQUIRE) != 0))
+        {
+            BPCat_ShmUnmap(&TxRing);
+        }
+        else
+        {
+            TxRing.Pos = __atomic_load_n(&TxRing.Hdr->Head, __ATOMIC_ACQUIRE);
+            printf("CLA Egress shared memory ring attached\n");
+        }
+    }
+
+    /* The mapping stays valid without the descriptor */
+    close(Fd);
+}
+
+/* Wait until the ring has Needed free bytes, giving up if the peer or bpcat stops */
+static bool BPCat_ShmWaitSpace(BPCat_AppData_t* AppData, uint64_t Needed)
+{
+    ShmRingHdr_t* Hdr = TxRing.Hdr;
+    uint32_t Seq;
+
+    while (AppData->Running && (__atomic_load_n(&Hdr->Closed, __ATOMIC_ACQUIRE) == 0))
+    {
+        Seq = __atomic_load_n(&Hdr->SpaceSeq, __ATOMIC_ACQUIRE);
+        if (Hdr->Size - (TxRing.Pos - __atomic_load_n(&Hdr->Tail, __ATOMIC_ACQUIRE)) >= Needed)
+        {
+            return true;
+        }
+
+        /* Say we are waiting, then check again in case the reader made room meanwhile */
+        __atomic_store_n(&Hdr->WriterWaiting, 1, __ATOMIC_SEQ_CST);
+        if (Hdr->Size - (TxRing.Pos - __atomic_load_n(&Hdr->Tail, __ATOMIC_SEQ_CST)) < Needed)
+        {
+            BPCat_ShmFutexWait(&Hdr->SpaceSeq, Seq);
+        }
+        __atomic_store_n(&Hdr->WriterWaiting, 0, __ATOMIC_RELAXED);
+    }
+
+    return false;
+}
+
+/* Find room for the largest possible record, returns where its header goes or NULL */
+static uint8_t* BPCat_ShmReserve(BPCat_AppData_t* AppData)
+{
+    ShmRecHdr_t* Pad;
+    uint64_t Offset = TxRing.Pos & (TxRing.Hdr->Size - 1);
+    uint64_t Contig = TxRing.Hdr->Size - Offset;
+    uint64_t Needed = BPCAT_SHM_MAX_RECORD;
+
+    if (Contig < BPCAT_SHM_MAX_RECORD)
+    {
+        Needed += Contig;
+    }
+    if (!BPCat_ShmWaitSpace(AppData, Needed))
+    {
+        return NULL;
+    }
+
+    /* Skip the end of the ring, the pad is published along with the next record */
+    if (Contig < BPCAT_SHM_MAX_RECORD)
+    {
+        Pad = (ShmRecHdr_t*) &TxRing.Data[Offset];
+        Pad->Len = (uint32_t) (Contig - BPCAT_SHM_REC_HDR_LEN);
+        Pad->Flags = BPCAT_SHM_REC_FLAG_PAD;
+        TxRing.Pos += Contig;
+        Offset = 0;
+    }
+
+    return &TxRing.Data[Offset];
+}
+
+void* BPCat_ShmCLAOutTaskFunc(BPCat_AppData_t* AppData, uint32_t TaskId)
+{
+    BPLib_Status_t EgressStatus;
+    ShmRecHdr_t* Rec;
+    uint8_t* Slot;
+    size_t OutSize;
+
+    while (AppData->Running)
+    {
+        if (TxRing.Hdr == NULL)
+        {
+            BPCat_ShmAttach();
+            if (TxRing.Hdr == NULL)
+            {
+                usleep(BPCAT_SHM_TIMEOUT * 1000);
+                continue;
+            }
+        }
+
+        /* Backpressure: bundles stay queued on the contact until the ring has room */
+        Slot = BPCat_ShmReserve(AppData);
+        if (Slot == NULL)
+        {
+            if (AppData->Running)
+            {
+                fprintf(stderr, "CLA Egress shared memory ring closed by peer\n");
+                BPCat_ShmUnmap(&TxRing);
+            }
+            continue;
+        }
+
+        EgressStatus = BPLib_CLA_Egress(&AppData->BPLibInst, BPCAT_SHM_CONTACT_ID, Slot + BPCAT_SHM_REC_HDR_LEN,
+            &OutSize, BPLIB_MAX_BUNDLE_LEN, BPCAT_SHM_TIMEOUT);
+        if (EgressStatus == BPLIB_SUCCESS)
+        {
+            Rec = (ShmRecHdr_t*) Slot;
+            Rec->Len = (uint32_t) OutSize;
+            Rec->Flags = 0;
+            TxRing.Pos += BPCAT_SHM_REC_HDR_LEN + BPCAT_SHM_ALIGN(OutSize);
+
+            __atomic_store_n(&TxRing.Hdr->Head, TxRing.Pos, __ATOMIC_SEQ_CST);
+            BPCat_ShmDoorbell(&TxRing.Hdr->ReaderWaiting, &TxRing.Hdr->DataSeq);
+        }
+        else if (EgressStatus != BPLIB_CLA_TIMEOUT)
+        {
+            fprintf(stderr, "Error egressing, RC=%d\n", EgressStatus);
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Shared Memory CLA In Task Implementation
+*/
+BPCat_Status_t BPCat_ShmCLAInSetup(uint32_t TaskId)
+{
+    const BPLib_CLA_ContactsSet_t* Contact = &AppData.ConfigPtrs.ContactsConfigPtr->ContactSet[BPCAT_SHM_CONTACT_ID];
+    size_t MapLen = sizeof(ShmRingHdr_t) + BPCAT_SHM_RING_SIZE;
+    int Fd;
+
+    memset(&RxRing, 0, sizeof(RxRing));
+    snprintf(RxRing.Name, sizeof(RxRing.Name), "%s.%u", ShmName, Contact->ClaInPort);
+
+    /* Start from a fresh ring, anything left by a previous run is discarded */
+    (void) shm_unlink(RxRing.Name);
+    Fd = shm_open(RxRing.Name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (Fd < 0)
+    {
+        perror("shm_open()");
+        return BPCAT_SHM_ERR;
+    }
+
+    if ((ftruncate(Fd, (off_t) MapLen) != 0) || !BPCat_ShmMap(&RxRing, Fd, MapLen))
+    {
+        perror("ftruncate()/mmap()");
+        close(Fd);
+        (void) shm_unlink(RxRing.Name);
+        return BPCAT_SHM_ERR;
+    }
+    close(Fd);
+
+    RxRing.Hdr->Version = BPCAT_SHM_VERSION;
+    RxRing.Hdr->Size = BPCAT_SHM_RING_SIZE;
+    __atomic_store_n(&RxRing.Hdr->Magic, BPCAT_SHM_MAGIC, __ATOMIC_RELEASE);
+
+    printf("Setup CLA Ingress shared memory ring %s (%u bytes)\n", RxRing.Name, BPCAT_SHM_RING_SIZE);
+    return BPCAT_SUCCESS;
+}
+
+BPCat_Status_t BPCat_ShmCLAInTeardown(uint32_t TaskId)
+{
+    if (RxRing.Hdr != NULL)
+    {
+        /* Let an attached writer know, it reattaches once a new ring is created */
+        __atomic_store_n(&RxRing.Hdr->Closed, 1, __ATOMIC_SEQ_CST);
+        BPCat_ShmFutexWake(&RxRing.Hdr->SpaceSeq);
+
+        BPCat_ShmUnmap(&RxRing);
+        (void) shm_unlink(RxRing.Name);
+    }
+    return BPCAT_SUCCESS;
+}
+
+/* Wait for the writer to publish data, returns the current Head */
+static uint64_t BPCat_ShmWaitData(void)
+{
+    ShmRingHdr_t* Hdr = RxRing.Hdr;
+    uint32_t Seq = __atomic_load_n(&Hdr->DataSeq, __ATOMIC_ACQUIRE);
+    uint64_t Head = __atomic_load_n(&Hdr->Head, __ATOMIC_ACQUIRE);
+
+    if (Head == RxRing.Pos)
+    {
+        /* Say we are waiting, then check again in case the writer published meanwhile */
+        __atomic_store_n(&Hdr->ReaderWaiting, 1, __ATOMIC_SEQ_CST);
+        Head = __atomic_load_n(&Hdr->Head, __ATOMIC_SEQ_CST);
+        if (Head == RxRing.Pos)
+        {
+            BPCat_ShmFutexWait(&Hdr->DataSeq, Seq);
+            Head = __atomic_load_n(&Hdr->Head, __ATOMIC_ACQUIRE);
+        }
+        __atomic_store_n(&Hdr->ReaderWaiting, 0, __ATOMIC_RELAXED);
+    }
+
+    return Head;
+}
+
+void* BPCat_ShmCLAInTaskFunc(BPCat_AppData_t* AppData, uint32_t TaskId)
+{
+    const void* Bundles[BPCAT_SHM_BATCH_SIZE];
+    size_t Sizes[BPCAT_SHM_BATCH_SIZE];
+    const ShmRecHdr_t* Rec;
+    BPLib_Status_t BpStatus;
+    uint32_t NumBundles;
+    uint32_t NumAccepted;
+    uint64_t Head;
+    uint64_t Offset;
+    uint64_t RecLen;
+    uint32_t DataLen;
+    uint32_t Flags;
+    uint64_t Size = RxRing.Hdr->Size;
+    bool Corrupt;
+
+    while (AppData->Running)
+    {
+        /* Stop reading while the pool is congested, the full ring then stalls the writer */
+        if (BPLib_MEM_PoolIsCongested(&AppData->BPLibInst.pool))
+        {
+            usleep(BPCAT_SHM_TIMEOUT * 1000);
+            continue;
+        }
+
+        Head = BPCat_ShmWaitData();
+
+        /* Bundles are ingressed in place, the ring space is only released afterwards */
+        NumBundles = 0;
+        Corrupt = false;
+        while ((RxRing.Pos != Head) && (NumBundles < BPCAT_SHM_BATCH_SIZE))
+        {
+            Offset = RxRing.Pos & (Size - 1);
+            Rec = (const ShmRecHdr_t*) &RxRing.Data[Offset];
+
+            /* The writer shares the ring, so the header is read once and only the copies are trusted */
+            DataLen = __atomic_load_n(&Rec->Len, __ATOMIC_RELAXED);
+            Flags = __atomic_load_n(&Rec->Flags, __ATOMIC_RELAXED);
+            RecLen = BPCAT_SHM_REC_HDR_LEN + BPCAT_SHM_ALIGN(DataLen);
+            if ((RecLen > Size - Offset) || (RecLen > Head - RxRing.Pos) ||
+                (!(Flags & BPCAT_SHM_REC_FLAG_PAD) && (DataLen > BPLIB_MAX_BUNDLE_LEN)))
+            {
+                Corrupt = true;
+                break;
+            }
+
+            if (!(Flags & BPCAT_SHM_REC_FLAG_PAD))
+            {
+                Bundles[NumBundles] = (const uint8_t*) Rec + BPCAT_SHM_REC_HDR_LEN;
+                Sizes[NumBundles] = DataLen;
+                NumBundles++;
+            }
+            RxRing.Pos += RecLen;
+        }
+
+        if (NumBundles > 0)
+        {
+            BpStatus = BPLib_CLA_IngressBatch(&AppData->BPLibInst, BPCAT_SHM_CONTACT_ID, Bundles, Sizes,
+                NumBundles, &NumAccepted);
+            if (BpStatus != BPLIB_SUCCESS)
+            {
+                fprintf(stderr, "BPLib_CLA_IngressBatch Fail RC=%d, accepted %u of %u\n", BpStatus,
+                    NumAccepted, NumBundles);
+            }
+        }
+
+        if (Corrupt)
+        {
+            fprintf(stderr, "CLA Ingress shared memory ring corrupt, discarding %lu bytes\n",
+                (unsigned long) (Head - RxRing.Pos));
+            RxRing.Pos = Head;
+        }
+
+        __atomic_store_n(&RxRing.Hdr->Tail, RxRing.Pos, __ATOMIC_SEQ_CST);
+        BPCat_ShmDoorbell(&RxRing.Hdr->WriterWaiting, &RxRing.Hdr->SpaceSeq);
+    }
+
+    return NULL;
+}
@@ -0,0 +1,667 @@
+/*
+ * NASA Docket No. GSC-19,559-1, and identified as "Delay/Disruption Tolerant Networking
+ * (DTN) Bundle Protocol (BP) v7 Core Flight System (cFS) Application Build 7.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+ * ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License. The copyright notice to be
+ * included in the software is as follows:
+ *
+ * Copyright 2025 United States Government as represented by the Administrator of the
+ * National Aeronautics and Space Administration. All Rights Reserved.
+ *
+ */
+
+/* Stream CLA over TCP or Unix-domain sockets. Bundles are framed as TCPCLv4 (RFC 9174)
+** XFER_SEGMENT messages: a type byte, a flags byte and a 64-bit transfer ID, then on the
+** segment flagged START a 32-bit transfer extension items length and the items, then a
+** 64-bit data length, all big-endian, followed by the data. A transfer spans the segments
+** from the one flagged START to the one flagged END. bpcat sends no extension items and
+** skips any it receives.
+**
+** This is only the TCPCLv4 segment framing, not a TCPCLv4 session: the contact header,
+** SESS_INIT, XFER_ACKs and SESS_TERM are left out since both ends are bpcat, so the sender
+** pipelines segments without waiting on the receiver. It does not interoperate with other
+** TCPCL implementations.
+*/
+
+#include "bpcat_stream_cla.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#define BPCAT_STREAM_TIMEOUT           100
+#define BPCAT_STREAM_BATCH_SIZE        32                    /* Segments sent or ingressed together */
+#define BPCAT_STREAM_MAX_TRANSFER      BPLIB_MAX_BUNDLE_LEN  /* Largest bundle accepted */
+#define BPCAT_STREAM_RX_BUFLEN         (256 * 1024)
+#define BPCAT_STREAM_CONTACT_ID        0                     /* bpcat runs a single contact */
+
+#define BPCAT_STREAM_MSG_XFER_SEGMENT  0x01
+#define BPCAT_STREAM_FLAG_END          0x01
+#define BPCAT_STREAM_FLAG_START        0x02
+#define BPCAT_STREAM_HDR_LEN           18                    /* Type, flags, transfer ID, data length */
+#define BPCAT_STREAM_START_HDR_LEN     22                    /* Plus the extension items length */
+#define BPCAT_STREAM_MAX_EXT_LEN       1024                  /* Largest extension items skipped */
+
+typedef union StreamAddr
+{
+    struct sockaddr    Sa;
+    struct sockaddr_in In;
+    struct sockaddr_un Un;
+} StreamAddr_t;
+
+typedef struct StreamConfig
+{
+    bool UseUnix;
+    char UnixPath[sizeof(((struct sockaddr_un*)0)->sun_path) - 8];
+    int SndBuf;
+    int RcvBuf;
+} StreamConfig_t;
+
+typedef struct StreamOutState
+{
+    int ConnFd;
+    StreamAddr_t PeerAddr;
+    socklen_t PeerAddrLen;
+    uint64_t NextTransferId;
+    uint8_t Headers[BPCAT_STREAM_BATCH_SIZE][BPCAT_STREAM_START_HDR_LEN];
+    uint8_t Buffers[BPCAT_STREAM_BATCH_SIZE][BPCAT_STREAM_MAX_TRANSFER];
+    struct iovec Iov[2 * BPCAT_STREAM_BATCH_SIZE];
+} StreamOutState_t;
+
+typedef struct StreamInState
+{
+    int ListenFd;
+    int ConnFd;
+    StreamAddr_t LocalAddr;
+    socklen_t LocalAddrLen;
+    size_t RxLen;
+    size_t TransferLen;
+    bool InTransfer;
+    uint8_t RxBuf[BPCAT_STREAM_RX_BUFLEN];
+    uint8_t TransferBuf[BPCAT_STREAM_MAX_TRANSFER];
+} StreamInState_t;
+
+static StreamConfig_t StreamConfig = {
+    .UseUnix = false,
+    .UnixPath = "/tmp/bpcat",
+    .SndBuf = BPCAT_STREAM_SNDBUF,
+    .RcvBuf = BPCAT_STREAM_RCVBUF
+};
+static StreamOutState_t TxStream = { .ConnFd = -1 };
+static StreamInState_t RxStream = { .ListenFd = -1, .ConnFd = -1 };
+
+/*******************************************************************************
+* Helpers
+*/
+void BPCat_StreamCLAConfigure(bool UseUnix, const char* UnixPath, int SndBuf, int RcvBuf)
+{
+    StreamConfig.UseUnix = UseUnix;
+    if (UnixPath != NULL)
+    {
+        snprintf(StreamConfig.UnixPath, sizeof(StreamConfig.UnixPath), "%s", UnixPath);
+    }
+    StreamConfig.SndBuf = SndBuf;
+    StreamConfig.RcvBuf = RcvBuf;
+}
+
+/* Build the TCP or Unix-domain address for one of the contact's ports */
+static socklen_t BPCat_StreamMakeAddr(StreamAddr_t* Addr, const char* IpAddr, uint16_t Port)
+{
+    memset(Addr, 0, sizeof(*Addr));
+    if (StreamConfig.UseUnix)
+    {
+        Addr->Un.sun_family = AF_UNIX;
+        snprintf(Addr->Un.sun_path, sizeof(Addr->Un.sun_path), "%s.%u", StreamConfig.UnixPath, Port);
+        return sizeof(Addr->Un);
+    }
+
+    Addr->In.sin_family = AF_INET;
+    Addr->In.sin_addr.s_addr = inet_addr(IpAddr);
+    Addr->In.sin_port = htons(Port);
+    return sizeof(Addr->In);
+}
+
+/* Apply the configured buffer sizes, and disable Nagle since segments are already batched */
+static void BPCat_StreamTuneSocket(int Fd)
+{
+    int One = 1;
+
+    if (StreamConfig.SndBuf > 0)
+    {
+        (void) setsockopt(Fd, SOL_SOCKET, SO_SNDBUF, &StreamConfig.SndBuf, sizeof(StreamConfig.SndBuf));
+    }
+    if (StreamConfig.RcvBuf > 0)
+    {
+        (void) setsockopt(Fd, SOL_SOCKET, SO_RCVBUF, &StreamConfig.RcvBuf, sizeof(StreamConfig.RcvBuf));
+    }
+    if (!StreamConfig.UseUnix)
+    {
+        (void) setsockopt(Fd, IPPROTO_TCP, TCP_NODELAY, &One, sizeof(One));
+    }
+}
+
+static void BPCat_StreamPutU64(uint8_t* Dst, uint64_t Value)
+{
+    int i;
+
+    for (i = 7; i >= 0; i--)
+    {
+        Dst[i] = (uint8_t) Value;
+        Value >>= 8;
+    }
+}
+
+static uint64_t BPCat_StreamGetU64(const uint8_t* Src)
+{
+    uint64_t Value = 0;
+    int i;
+
+    for (i = 0; i < 8; i++)
+    {
+        Value = (Value << 8) | Src[i];
+    }
+    return Value;
+}
+
+static void BPCat_StreamPutU32(uint8_t* Dst, uint32_t Value)
+{
+    int i;
+
+    for (i = 3; i >= 0; i--)
+    {
+        Dst[i] = (uint8_t) Value;
+        Value >>= 8;
+    }
+}
+
+static uint32_t BPCat_StreamGetU32(const uint8_t* Src)
+{
+    uint32_t Value = 0;
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        Value = (Value << 8) | Src[i];
+    }
+    return Value;
+}
+
+/*******************************************************************************
+* Stream CLA Out Task Implementation
+*/
+BPCat_Status_t BPCat_StreamCLAOutSetup(uint32_t TaskId)
+{
+    const BPLib_CLA_ContactsSet_t* Contact = &AppData.ConfigPtrs.ContactsConfigPtr->ContactSet[TaskId];
+
+    /* The peer may not be listening yet, so connecting is left to the task */
+    TxStream.ConnFd = -1;
+    TxStream.NextTransferId = 0;
+    TxStream.PeerAddrLen = BPCat_StreamMakeAddr(&TxStream.PeerAddr, Contact->ClaOutAddr, Contact->ClaOutPort);
+
+    if (StreamConfig.UseUnix)
+    {
+        printf("Setup CLA Egress stream to %s\n", TxStream.PeerAddr.Un.sun_path);
+    }
+    else
+    {
+        printf("Setup CLA Egress stream to %s:%u\n", Contact->ClaOutAddr, Contact->ClaOutPort);
+    }
+    return BPCAT_SUCCESS;
+}
+
+BPCat_Status_t BPCat_StreamCLAOutTeardown(uint32_t TaskId)
+{
+    if (TxStream.ConnFd >= 0)
+    {
+        close(TxStream.ConnFd);
+        TxStream.ConnFd = -1;
+    }
+    return BPCAT_SUCCESS;
+}
+
+/* Connect to the peer, leaving the connection non-blocking */
+static void BPCat_StreamConnect(void)
+{
+    int Fd;
+
+    Fd = socket(TxStream.PeerAddr.Sa.sa_family, SOCK_STREAM, 0);
+    if (Fd < 0)
+    {
+        perror("socket()");
+        return;
+    }
+
+    BPCat_StreamTuneSocket(Fd);
+    if (connect(Fd, &TxStream.PeerAddr.Sa, TxStream.PeerAddrLen) != 0)
+    {
+        close(Fd);
+        return;
+    }
+
+    (void) fcntl(Fd, F_SETFL, fcntl(Fd, F_GETFL) | O_NONBLOCK);
+    TxStream.ConnFd = Fd;
+    printf("CLA Egress stream connected\n");
+}
+
+/* Wait until the connection can take more data, giving up when bpcat stops */
+static bool BPCat_StreamWaitWritable(BPCat_AppData_t* AppData)
+{
+    struct pollfd pfd;
+    int PollRc;
+
+    pfd.fd = TxStream.ConnFd;
+    pfd.events = POLLOUT;
+    do
+    {
+        PollRc = poll(&pfd, 1, BPCAT_STREAM_TIMEOUT);
+        if ((PollRc > 0) && (pfd.revents & (POLLERR | POLLHUP)))
+        {
+            return false;
+        }
+    } while ((PollRc == 0 || (PollRc < 0 && errno == EINTR)) && AppData->Running);
+
+    return (PollRc > 0);
+}
+
+/* Send every segment of a batch, blocking on the socket as needed */
+static bool BPCat_StreamSendAll(BPCat_AppData_t* AppData, struct iovec* Iov, int IovCnt)
+{
+    struct msghdr Msg;
+    ssize_t Sent;
+
+    while (IovCnt > 0)
+    {
+        memset(&Msg, 0, sizeof(Msg));
+        Msg.msg_iov = Iov;
+        Msg.msg_iovlen = IovCnt;
+
+        Sent = sendmsg(TxStream.ConnFd, &Msg, MSG_NOSIGNAL);
+        if (Sent < 0)
+        {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR))
+            {
+                if (!BPCat_StreamWaitWritable(AppData))
+                {
+                    return false;
+                }
+                continue;
+            }
+            perror("sendmsg()");
+            return false;
+        }
+
+        /* Skip past whatever was fully sent and trim a partially sent entry */
+        while ((IovCnt > 0) && ((size_t) Sent >= Iov->iov_len))
+        {
+            Sent -= (ssize_t) Iov->iov_len;
+            Iov++;
+            IovCnt--;
+        }
+        if (IovCnt > 0)
+        {
+            Iov->iov_base = (uint8_t*) Iov->iov_base + Sent;
+            Iov->iov_len -= (size_t) Sent;
+        }
+    }
+
+    return true;
+}
+
+void* BPCat_StreamCLAOutTaskFunc(BPCat_AppData_t* AppData, uint32_t TaskId)
+{
+    BPLib_Status_t EgressStatus;
+    size_t OutSize;
+    uint32_t Timeout;
+    uint32_t NumTx;
+    uint8_t* Hdr;
+
+    while (AppData->Running)
+    {
+        if (TxStream.ConnFd < 0)
+        {
+            BPCat_StreamConnect();
+            if (TxStream.ConnFd < 0)
+            {
+                usleep(BPCAT_STREAM_TIMEOUT * 1000);
+                continue;
+            }
+        }
+
+        /* Backpressure: bundles stay queued on the contact until the socket has room */
+        if (!BPCat_StreamWaitWritable(AppData))
+        {
+            if (AppData->Running)
+            {
+                fprintf(stderr, "CLA Egress stream lost\n");
+                BPCat_StreamCLAOutTeardown(TaskId);
+            }
+            continue;
+        }
+
+        /* Wait for the first bundle, then take whatever else is already queued */
+        NumTx = 0;
+        Timeout = BPCAT_STREAM_TIMEOUT;
+        do
+        {
+            EgressStatus = BPLib_CLA_Egress(&AppData->BPLibInst, BPCAT_STREAM_CONTACT_ID, TxStream.Buffers[NumTx],
+                &OutSize, BPCAT_STREAM_MAX_TRANSFER, Timeout);
+            if (EgressStatus == BPLIB_SUCCESS)
+            {
+                Hdr = TxStream.Headers[NumTx];
+                Hdr[0] = BPCAT_STREAM_MSG_XFER_SEGMENT;
+                Hdr[1] = BPCAT_STREAM_FLAG_START | BPCAT_STREAM_FLAG_END;
+                BPCat_StreamPutU64(&Hdr[2], TxStream.NextTransferId++);
+                BPCat_StreamPutU32(&Hdr[10], 0);
+                BPCat_StreamPutU64(&Hdr[14], (uint64_t) OutSize);
+
+                TxStream.Iov[2 * NumTx].iov_base = Hdr;
+                TxStream.Iov[2 * NumTx].iov_len = BPCAT_STREAM_START_HDR_LEN;
+                TxStream.Iov[2 * NumTx + 1].iov_base = TxStream.Buffers[NumTx];
+                TxStream.Iov[2 * NumTx + 1].iov_len = OutSize;
+                NumTx++;
+            }
+            Timeout = 0;
+        } while ((EgressStatus == BPLIB_SUCCESS) && (NumTx < BPCAT_STREAM_BATCH_SIZE));
+
+        if ((EgressStatus != BPLIB_SUCCESS) && (EgressStatus != BPLIB_CLA_TIMEOUT))
+        {
+            fprintf(stderr, "Error egressing, RC=%d\n", EgressStatus);
+        }
+
+        /* The whole batch goes out back to back without waiting on the receiver */
+        if ((NumTx > 0) && !BPCat_StreamSendAll(AppData, TxStream.Iov, (int) (2 * NumTx)))
+        {
+            fprintf(stderr, "CLA Egress stream lost, dropped up to %u bundles\n", NumTx);
+            BPCat_StreamCLAOutTeardown(TaskId);
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Stream CLA In Task Implementation
+*/
+BPCat_Status_t BPCat_StreamCLAInSetup(uint32_t TaskId)
+{
+    const BPLib_CLA_ContactsSet_t* Contact = &AppData.ConfigPtrs.ContactsConfigPtr->ContactSet[BPCAT_STREAM_CONTACT_ID];
+    int Fd;
+    int One = 1;
+
+    RxStream.LocalAddrLen = BPCat_StreamMakeAddr(&RxStream.LocalAddr, Contact->ClaInAddr, Contact->ClaInPort);
+
+    Fd = socket(RxStream.LocalAddr.Sa.sa_family, SOCK_STREAM, 0);
+    if (Fd < 0)
+    {
+        perror("socket()");
+        return BPCAT_SOCKET_ERR;
+    }
+
+    if (StreamConfig.UseUnix)
+    {
+        (void) unlink(RxStream.LocalAddr.Un.sun_path);
+    }
+    else
+    {
+        (void) setsockopt(Fd, SOL_SOCKET, SO_REUSEADDR, &One, sizeof(One));
+    }
+
+    if ((bind(Fd, &RxStream.LocalAddr.Sa, RxStream.LocalAddrLen) != 0) || (listen(Fd, 1) != 0))
+    {
+        perror("bind()/listen()");
+        close(Fd);
+        return BPCAT_SOCKET_ERR;
+    }
+
+    if (StreamConfig.UseUnix)
+    {
+        printf("Setup CLA Ingress stream on %s\n", RxStream.LocalAddr.Un.sun_path);
+    }
+    else
+    {
+        printf("Setup CLA Ingress stream on %s:%u\n", Contact->ClaInAddr, Contact->ClaInPort);
+    }
+
+    RxStream.ListenFd = Fd;
+    RxStream.ConnFd = -1;
+    return BPCAT_SUCCESS;
+}
+
+static void BPCat_StreamCloseConn(void)
+{
+    if (RxStream.ConnFd >= 0)
+    {
+        close(RxStream.ConnFd);
+        RxStream.ConnFd = -1;
+    }
+    RxStream.RxLen = 0;
+    RxStream.TransferLen = 0;
+    RxStream.InTransfer = false;
+}
+
+BPCat_Status_t BPCat_StreamCLAInTeardown(uint32_t TaskId)
+{
+    BPCat_StreamCloseConn();
+    if (RxStream.ListenFd >= 0)
+    {
+        close(RxStream.ListenFd);
+        RxStream.ListenFd = -1;
+    }
+    if (StreamConfig.UseUnix)
+    {
+        (void) unlink(RxStream.LocalAddr.Un.sun_path);
+    }
+    return BPCAT_SUCCESS;
+}
+
+static void BPCat_StreamIngress(BPCat_AppData_t* AppData, const void** Bundles, size_t* Sizes, uint32_t NumBundles)
+{
+    BPLib_Status_t BpStatus;
+    uint32_t NumAccepted;
+
+    BpStatus = BPLib_CLA_IngressBatch(&AppData->BPLibInst, BPCAT_STREAM_CONTACT_ID, Bundles, Sizes, NumBundles,
+        &NumAccepted);
+    if (BpStatus != BPLIB_SUCCESS)
+    {
+        fprintf(stderr, "BPLib_CLA_IngressBatch Fail RC=%d, accepted %u of %u\n", BpStatus, NumAccepted,
+            NumBundles);
+    }
+}
+
+/* Ingress every complete transfer in the receive buffer, returns false on a framing error */
+static bool BPCat_StreamProcessRx(BPCat_AppData_t* AppData)
+{
+    const void* Bundles[BPCAT_STREAM_BATCH_SIZE];
+    size_t Sizes[BPCAT_STREAM_BATCH_SIZE];
+    uint32_t NumBundles = 0;
+    size_t Offset = 0;
+    uint64_t SegLen;
+    uint32_t ExtLen;
+    size_t HdrLen;
+    uint8_t Flags;
+    const uint8_t* Data;
+    bool Ok = true;
+
+    while (RxStream.RxLen - Offset >= BPCAT_STREAM_HDR_LEN)
+    {
+        if (RxStream.RxBuf[Offset] != BPCAT_STREAM_MSG_XFER_SEGMENT)
+        {
+            Ok = false;
+            break;
+        }
+
+        /* The START segment carries the transfer extension items ahead of the data length */
+        Flags = RxStream.RxBuf[Offset + 1];
+        HdrLen = BPCAT_STREAM_HDR_LEN;
+        if (Flags & BPCAT_STREAM_FLAG_START)
+        {
+            if (RxStream.RxLen - Offset < BPCAT_STREAM_START_HDR_LEN)
+            {
+                break;
+            }
+            ExtLen = BPCat_StreamGetU32(&RxStream.RxBuf[Offset + 10]);
+            if (ExtLen > BPCAT_STREAM_MAX_EXT_LEN)
+            {
+                Ok = false;
+                break;
+            }
+            HdrLen = BPCAT_STREAM_START_HDR_LEN + ExtLen;
+            if (RxStream.RxLen - Offset < HdrLen)
+            {
+                break;
+            }
+        }
+
+        SegLen = BPCat_StreamGetU64(&RxStream.RxBuf[Offset + HdrLen - 8]);
+        if (SegLen > BPCAT_STREAM_MAX_TRANSFER)
+        {
+            Ok = false;
+            break;
+        }
+        if (RxStream.RxLen - Offset - HdrLen < SegLen)
+        {
+            break;
+        }
+        Data = &RxStream.RxBuf[Offset + HdrLen];
+        Offset += HdrLen + (size_t) SegLen;
+
+        if ((Flags & BPCAT_STREAM_FLAG_START) && (Flags & BPCAT_STREAM_FLAG_END))
+        {
+            /* Single segment transfers are ingressed straight out of the receive buffer */
+            Bundles[NumBundles] = Data;
+            Sizes[NumBundles] = (size_t) SegLen;
+            NumBundles++;
+        }
+        else
+        {
+            if (Flags & BPCAT_STREAM_FLAG_START)
+            {
+                RxStream.InTransfer = true;
+                RxStream.TransferLen = 0;
+            }
+            if (!RxStream.InTransfer || (RxStream.TransferLen + SegLen > BPCAT_STREAM_MAX_TRANSFER))
+            {
+                Ok = false;
+                break;
+            }
+
+            memcpy(&RxStream.TransferBuf[RxStream.TransferLen], Data, (size_t) SegLen);
+            RxStream.TransferLen += (size_t) SegLen;
+            if (Flags & BPCAT_STREAM_FLAG_END)
+            {
+                Bundles[NumBundles] = RxStream.TransferBuf;
+                Sizes[NumBundles] = RxStream.TransferLen;
+                NumBundles++;
+                RxStream.InTransfer = false;
+
+                /* The transfer buffer is reused by the next transfer, so hand it over now */
+                BPCat_StreamIngress(AppData, Bundles, Sizes, NumBundles);
+                NumBundles = 0;
+            }
+        }
+
+        if (NumBundles == BPCAT_STREAM_BATCH_SIZE)
+        {
+            BPCat_StreamIngress(AppData, Bundles, Sizes, NumBundles);
+            NumBundles = 0;
+        }
+    }
+
+    if (NumBundles > 0)
+    {
+        BPCat_StreamIngress(AppData, Bundles, Sizes, NumBundles);
+    }
+
+    /* Keep any partial segment at the front of the buffer */
+    memmove(RxStream.RxBuf, &RxStream.RxBuf[Offset], RxStream.RxLen - Offset);
+    RxStream.RxLen -= Offset;
+
+    return Ok;
+}
+
+void* BPCat_StreamCLAInTaskFunc(BPCat_AppData_t* AppData, uint32_t TaskId)
+{
+    struct pollfd pfd[2];
+    ssize_t BytesRx;
+    int PollRc;
+    int Fd;
+
+    while (AppData->Running)
+    {
+        /* Stop reading while the pool is congested, TCP flow control then slows the sender */
+        if (BPLib_MEM_PoolIsCongested(&AppData->BPLibInst.pool))
+        {
+            usleep(BPCAT_STREAM_TIMEOUT * 1000);
+            continue;
+        }
+
+        pfd[0].fd = RxStream.ListenFd;
+        pfd[0].events = POLLIN;
+        pfd[1].fd = RxStream.ConnFd;
+        pfd[1].events = POLLIN;
+        pfd[1].revents = 0;
+        PollRc = poll(pfd, 2, BPCAT_STREAM_TIMEOUT);
+        if (PollRc < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            perror("poll()");
+            return NULL;
+        }
+
+        /* A new peer connection replaces the current one */
+        if (pfd[0].revents & POLLIN)
+        {
+            Fd = accept(RxStream.ListenFd, NULL, NULL);
+            if (Fd >= 0)
+            {
+                BPCat_StreamCloseConn();
+                BPCat_StreamTuneSocket(Fd);
+                RxStream.ConnFd = Fd;
+                printf("CLA Ingress stream connected\n");
+            }
+        }
+
+        if ((RxStream.ConnFd >= 0) && (pfd[1].revents & (POLLIN | POLLHUP | POLLERR)))
+        {
+            BytesRx = recv(RxStream.ConnFd, &RxStream.RxBuf[RxStream.RxLen], BPCAT_STREAM_RX_BUFLEN - RxStream.RxLen,
+                MSG_DONTWAIT);
+            if (BytesRx > 0)
+            {
+                RxStream.RxLen += (size_t) BytesRx;
+                if (!BPCat_StreamProcessRx(AppData))
+                {
+                    fprintf(stderr, "CLA Ingress stream framing error, closing connection\n");
+                    BPCat_StreamCloseConn();
+                }
+            }
+            else if ((BytesRx == 0) || ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR)))
+            {
+                printf("CLA Ingress stream disconnected\n");
+                BPCat_StreamCloseConn();
+            }
+        }
+    }
+
+    return NULL;
+}
@@ -19,6 +19,14 @@
  */
 #include "bpcat_task.h"
 
+/* Thread entry point, hands the task its app data and ID */
+static void* BPCat_TaskEntry(void* Arg)
+{
+    BPCat_Task_t* task = (BPCat_Task_t*)Arg;
+
+    return task->TaskFunc(task->AppData, task->TaskId);
+}
+
 BPCat_Status_t BPCat_TaskInit(BPCat_Task_t* task)
 {
     BPCat_Status_t Status;
@@ -51,8 +59,8 @@ BPCat_Status_t BPCat_TaskStart(BPCat_Task_t* task, BPCat_AppData_t* AppData)
     }
 
     /* Launch the task in it's own thread */
-    rc = pthread_create(&task->Handle, NULL, (void* (*)(void*))task->TaskFunc,
-        (void*)(AppData));
+    task->AppData = AppData;
+    rc = pthread_create(&task->Handle, NULL, BPCat_TaskEntry, (void*)task);
     if (rc != 0)
     {
         perror("pthread_create()");
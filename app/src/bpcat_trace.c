@@ -0,0 +1,76 @@
+/*
+ * NASA Docket No. GSC-19,559-1, and identified as "Delay/Disruption Tolerant Networking 
+ * (DTN) Bundle Protocol (BP) v7 Core Flight System (cFS) Application Build 7.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this 
+ * file except in compliance with the License. You may obtain a copy of the License at 
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0 
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under 
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF 
+ * ANY KIND, either express or implied. See the License for the specific language 
+ * governing permissions and limitations under the License. The copyright notice to be 
+ * included in the software is as follows: 
+ *
+ * Copyright 2025 United States Government as represented by the Administrator of the 
+ * National Aeronautics and Space Administration. All Rights Reserved.
+ *
+ */
+#include "bpcat_trace.h"
+
+#include <stdio.h>
+
+static BPLib_PL_TraceRecord_t TraceRecords[BPLIB_PL_TRACE_RING_SIZE];
+
+BPCat_Status_t BPCat_TraceDump(const char* Path)
+{
+    BPCat_TraceFileHeader_t Header;
+    FILE* File;
+    uint32_t Ring;
+    uint32_t NumRecords;
+    long HeaderPos;
+
+    if (Path == NULL)
+    {
+        return BPCAT_NULL_PTR_ERR;
+    }
+
+    File = fopen(Path, "wb");
+    if (File == NULL)
+    {
+        perror("fopen()");
+        return BPCAT_TRACE_ERR;
+    }
+
+    Header.Magic = BPCAT_TRACE_MAGIC;
+    Header.Version = BPCAT_TRACE_VERSION;
+    Header.RecordSize = sizeof(BPLib_PL_TraceRecord_t);
+    Header.NumRecords = 0;
+
+    /* Write a placeholder header, the record count is filled in at the end */
+    HeaderPos = ftell(File);
+    fwrite(&Header, sizeof(Header), 1, File);
+
+    for (Ring = 0; Ring < BPLib_PL_TraceNumRings(); Ring++)
+    {
+        if (BPLib_PL_TraceSnapshot(Ring, TraceRecords, BPLIB_PL_TRACE_RING_SIZE, &NumRecords) != BPLIB_SUCCESS)
+        {
+            continue;
+        }
+
+        Header.NumRecords += (uint32_t)fwrite(TraceRecords, sizeof(TraceRecords[0]), NumRecords, File);
+    }
+
+    fseek(File, HeaderPos, SEEK_SET);
+    fwrite(&Header, sizeof(Header), 1, File);
+
+    if (fclose(File) != 0)
+    {
+        perror("fclose()");
+        return BPCAT_TRACE_ERR;
+    }
+
+    printf("Wrote %u trace records to %s\n", (unsigned int)Header.NumRecords, Path);
+    return BPCAT_SUCCESS;
+}
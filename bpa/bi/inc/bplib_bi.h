@@ -40,7 +40,8 @@
  *       Receive candidate bundle from CLA, CBOR decode it, then place the deserialized bundle to EBP In Queue
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       When BPLIB_BI_DUP_FILTER is enabled, bundles that the duplicate filter has seen before
+ *       and that storage still holds a copy of are dropped with BPLIB_BI_DUPLICATE_BUNDLE_ERR.
  *
  *  \param[in] Inst Pointer to a valid BPLib_Instance_t
  *  \param[in] BundleInPtr Pointer to the bundle
@@ -53,6 +54,34 @@
 BPLib_Status_t BPLib_BI_RecvFullBundleIn(BPLib_Instance_t* Inst, const void *BundleIn, 
                                                             size_t Size, uint32_t ContId);
 
+/**
+ * \brief Function for Receiving a Batch of Bundles from CLA
+ *
+ *  \par Description
+ *       Receive several candidate bundles from CLA, CBOR decode each of them, then place the
+ *       deserialized bundles that are valid on the EBP In Queue together
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Bundles that fail to decode or validate are dropped and counted the same way
+ *       BPLib_BI_RecvFullBundleIn drops them, without affecting the rest of the batch.
+ *       Accepted bundles are queued in their original order.
+ *
+ *  \param[in] Inst Pointer to a valid BPLib_Instance_t
+ *  \param[in] BundlesIn Array of pointers to the bundles
+ *  \param[in] Sizes Array of bundle sizes
+ *  \param[in] NumBundles Number of bundles in the batch
+ *  \param[in] ContId Contact ID
+ *  \param[out] Statuses Array of NumBundles entries set to the status of each bundle,
+ *              BPLIB_SUCCESS for the bundles placed on the EBP In Queue
+ *
+ *  \return Execution status
+ *  \retval BPLIB_SUCCESS Every bundle was accepted
+ *  \retval Other The status of the last bundle that was dropped
+ */
+BPLib_Status_t BPLib_BI_RecvBundlesIn(BPLib_Instance_t* Inst, const void *const BundlesIn[],
+                                      const size_t Sizes[], uint32_t NumBundles, uint32_t ContId,
+                                      BPLib_Status_t Statuses[]);
+
 /**
  * \brief Function for receiving control message from CLA
  *
@@ -80,6 +109,8 @@ BPLib_Status_t BPLib_BI_RecvCtrlMsg(BPLib_CLA_CtrlMsg_t* CtrlMsg);
  *
  *  \return Execution status
  *  \retval BPLIB_SUCCESS Initialization was successful
+ *  \retval BPLIB_BI_FRAGMENT_ERR The bundle is a fragment whose payload is empty or lies
+ *          outside its total ADU length
  */
 BPLib_Status_t BPLib_BI_ValidateBundle(BPLib_Bundle_t *CandidateBundle);
 
@@ -101,4 +132,51 @@ BPLib_Status_t BPLib_BI_BlobCopyOut(BPLib_Bundle_t* StoredBundle,
                                     size_t OutputBufferSize,
                                     size_t* NumBytesCopied);
 
+/**
+ * \brief Encodes the fragment of a bundle starting at a payload offset
+ *
+ * The fragment is a slice of the bundle: its payload is read straight from the bundle's
+ * blob, so the bundle itself is left untouched and can be sliced again from where this
+ * fragment ends. As much payload as fits in OutputBufferSize is taken. The fragment at
+ * offset 0 carries every extension block, later fragments only those flagged
+ * BPLIB_BLOCK_PROC_REPLCT_FRAG_FLAG. Fragmenting a fragment keeps offsets relative to the
+ * original ADU.
+ *
+ * \param[in] StoredBundle (BPLib_Bundle_t*) Bundle to take the fragment from.
+ * \param[in] PayloadOffset (size_t) Offset into the bundle's payload the fragment starts at.
+ * \param[out] OutputBuffer (void*) A buffer to store the encoded fragment.
+ * \param[in] OutputBufferSize (size_t) The maximum number of bytes to encode.
+ * \param[out] NumBytesCopied The actual number of bytes encoded.
+ * \param[out] PayloadBytes The number of payload bytes the fragment carries.
+ *
+ * \return Status of the operation.
+ * \retval BPLIB_SUCCESS The fragment was encoded
+ * \retval BPLIB_BI_INVALID_BUNDLE_ERR PayloadOffset is not within the payload
+ * \retval BPLIB_BI_FRAG_NO_ROOM_ERR The fragment would carry less than BPLIB_BI_FRAG_MIN_PAYLOAD
+ *         bytes and is not the last
+ */
+BPLib_Status_t BPLib_BI_FragmentCopyOut(BPLib_Bundle_t* StoredBundle,
+                                        size_t PayloadOffset,
+                                        void* OutputBuffer,
+                                        size_t OutputBufferSize,
+                                        size_t* NumBytesCopied,
+                                        size_t* PayloadBytes);
+
+/**
+ * \brief Trims the payload before an offset off a bundle, leaving the fragment that holds the rest
+ *
+ * The bundle becomes the same fragment BPLib_BI_FragmentCopyOut would encode at PayloadOffset,
+ * so a bundle part way through being sent as fragments can be stored without the part
+ * already sent. The blob is left untouched, the fragment is encoded from it on egress.
+ *
+ * \param[in,out] Bundle (BPLib_Bundle_t*) Bundle to trim.
+ * \param[in] PayloadOffset (size_t) Offset into the bundle's payload the fragment starts at.
+ *
+ * \return Status of the operation.
+ * \retval BPLIB_SUCCESS The bundle was trimmed
+ * \retval BPLIB_NULL_PTR_ERROR Bundle is NULL
+ * \retval BPLIB_BI_INVALID_BUNDLE_ERR PayloadOffset is not within the payload
+ */
+BPLib_Status_t BPLib_BI_FragmentTrim(BPLib_Bundle_t* Bundle, size_t PayloadOffset);
+
 #endif /* BPLIB_BI_H */
@@ -23,11 +23,14 @@
 */
 
 #include "bplib_bi.h"
+#include "bplib_bi_internal.h"
 #include "bplib_cbor.h"
 #include "bplib_qm.h"
 #include "bplib_as.h"
 #include "bplib_eid.h"
 #include "bplib_bblocks.h"
+#include "bplib_pl.h"
+#include "bplib_stor.h"
 
 #include <stdio.h>
 
@@ -35,72 +38,194 @@
 ** Function Definitions
 */
 
-/* Receive candidate bundle from CLA, CBOR decode it, then place it to EBP In Queue */
-BPLib_Status_t BPLib_BI_RecvFullBundleIn(BPLib_Instance_t* Inst, const void *BundleIn, 
-                                            size_t Size, uint32_t ContId)
+/* Set up Slice as the fragment of Bundle starting PayloadOffset bytes into its payload. The
+** slice shares the bundle's blob, so the payload is read from the bundle's own chunks.
+*/
+static void BPLib_BI_MakeFragmentSlice(const BPLib_Bundle_t* Bundle, size_t PayloadOffset, BPLib_Bundle_t* Slice)
 {
-    BPLib_Status_t Status;
-    BPLib_Bundle_t* CandidateBundle;
+    BPLib_PrimaryBlock_t* Primary;
+    uint32_t ExtIdx;
+    uint32_t NumKept;
 
-    if ((Inst == NULL) || (BundleIn == NULL))
+    *Slice = *Bundle;
+    Primary = &Slice->blocks.PrimaryBlock;
+
+    /* Offsets of a fragment's fragments stay relative to the original ADU */
+    if (!(Primary->BundleProcFlags & BPLIB_BUNDLE_PROC_FRAG_FLAG))
     {
-        return BPLIB_NULL_PTR_ERROR;
+        Primary->FragmentOffset  = 0;
+        Primary->TotalAduLength  = Bundle->blocks.PayloadHeader.DataSize;
+        Primary->BundleProcFlags |= BPLIB_BUNDLE_PROC_FRAG_FLAG;
     }
+    Primary->FragmentOffset += PayloadOffset;
+    Primary->RequiresEncode  = true;
 
-    if (ContId >= BPLIB_MAX_NUM_CONTACTS)
+    Slice->blocks.PayloadHeader.DataOffsetStart += PayloadOffset;
+    Slice->blocks.PayloadHeader.DataSize        -= PayloadOffset;
+    Slice->blocks.PayloadHeader.RequiresEncode   = true;
+
+    /* Only the first fragment carries the extension blocks that are not replicated */
+    if (PayloadOffset > 0)
     {
-        return BPLIB_INVALID_CONT_ID_ERR;
+        NumKept = 0;
+        for (ExtIdx = 0; ExtIdx < BPLIB_MAX_NUM_EXTENSION_BLOCKS; ExtIdx++)
+        {
+            if (Slice->blocks.ExtBlocks[ExtIdx].Header.BlockType == BPLib_BlockType_Reserved)
+            {
+                break;
+            }
+
+            if (Slice->blocks.ExtBlocks[ExtIdx].Header.BlockProcFlags & BPLIB_BLOCK_PROC_REPLCT_FRAG_FLAG)
+            {
+                Slice->blocks.ExtBlocks[NumKept++] = Slice->blocks.ExtBlocks[ExtIdx];
+            }
+        }
+
+        if (NumKept < BPLIB_MAX_NUM_EXTENSION_BLOCKS)
+        {
+            Slice->blocks.ExtBlocks[NumKept].Header.BlockType = BPLib_BlockType_Reserved;
+        }
     }
+}
+
+/* Bytes a CBOR byte string head needs, beyond its first, for a string of Len bytes */
+static size_t BPLib_BI_ByteStringHeadGrowth(size_t Len)
+{
+    if (Len < 24)
+    {
+        return 0;
+    }
+    else if (Len < 0x100)
+    {
+        return 1;
+    }
+    else if (Len < 0x10000)
+    {
+        return 2;
+    }
+    else if ((uint64_t) Len < 0x100000000ull)
+    {
+        return 4;
+    }
+
+    return 8;
+}
+
+/* Check a decoded bundle against the duplicate filter, confirming possible duplicates with storage.
+** DtnTime is set to the DTN time the bundle was added to the filter at.
+*/
+static BPLib_Status_t BPLib_BI_CheckDuplicate(BPLib_Instance_t* Inst, BPLib_Bundle_t* Bundle, uint64_t* DtnTime)
+{
+#if (BPLIB_BI_DUP_FILTER == 1)
+    bool Found;
+
+    *DtnTime = BPLib_TIME_GetCurrentDtnTime();
+    if (BPLib_BI_DupFilterAdd(&Bundle->blocks.PrimaryBlock, *DtnTime) == BPLIB_BI_DUP_SEEN)
+    {
+        /* Bundles are only dropped once storage has a copy, a failed lookup keeps the bundle */
+        Found = false;
+        (void) BPLib_STOR_FindDuplicate(Inst, Bundle, &Found);
+        if (Found)
+        {
+            BPLib_BI_DupFilterRemove(&Bundle->blocks.PrimaryBlock, *DtnTime);
+            return BPLIB_BI_DUPLICATE_BUNDLE_ERR;
+        }
+    }
+#endif
+
+    return BPLIB_SUCCESS;
+}
+
+/* Take a bundle that passed the duplicate check back out of the filter when it can't be ingressed,
+** DtnTime must be the time the check added it at so the same partition is found
+*/
+static void BPLib_BI_ForgetDuplicate(BPLib_Bundle_t* Bundle, uint64_t DtnTime)
+{
+#if (BPLIB_BI_DUP_FILTER == 1)
+    BPLib_BI_DupFilterRemove(&Bundle->blocks.PrimaryBlock, DtnTime);
+#endif
+}
+
+/* Create a candidate bundle from a blob, then CBOR decode and validate it */
+static BPLib_Status_t BPLib_BI_DecodeCandidate(BPLib_Instance_t* Inst, const void *BundleIn,
+                                               size_t Size, BPLib_Bundle_t** CandidateBundle,
+                                               uint64_t* DupTime)
+{
+    BPLib_Status_t Status;
+    BPLib_Bundle_t* Bundle;
+    uint64_t DecodeStart;
 
     /* Create the bundle from the incoming blob */
-    CandidateBundle = BPLib_MEM_BundleAlloc(&Inst->pool, BundleIn, Size);
-    if (CandidateBundle == NULL)
+    Bundle = BPLib_MEM_BundleAlloc(&Inst->pool, BundleIn, Size);
+    *CandidateBundle = Bundle;
+    *DupTime = 0;
+    if (Bundle == NULL)
     {
         return BPLIB_NULL_PTR_ERROR;
     }
 
     /* Get reception time of bundle */
-    CandidateBundle->blocks.PrimaryBlock.MonoTime.Time = BPLib_TIME_GetMonotonicTime();
-    CandidateBundle->blocks.PrimaryBlock.MonoTime.BootEra = BPLib_TIME_GetBootEra();
+    Bundle->blocks.PrimaryBlock.MonoTime.Time = BPLib_TIME_GetMonotonicTime();
+    Bundle->blocks.PrimaryBlock.MonoTime.BootEra = BPLib_TIME_GetBootEra();
 
     /* Decode the bundle */
-    Status = BPLib_CBOR_DecodeBundle(BundleIn, Size, CandidateBundle);
+    DecodeStart = BPLib_PL_LatencyStart();
+    Status = BPLib_CBOR_DecodeBundle(BundleIn, Size, Bundle);
+    BPLib_PL_LatencyStop(BPLIB_PL_LATENCY_DECODE, DecodeStart);
 
     /* If decode was successful, try validating the bundle */
     if (Status == BPLIB_SUCCESS)
     {
-        Status = BPLib_BI_ValidateBundle(CandidateBundle);
+        Status = BPLib_BI_ValidateBundle(Bundle);
+    }
+
+    /* Drop valid bundles that have already been received */
+    if (Status == BPLIB_SUCCESS)
+    {
+        Status = BPLib_BI_CheckDuplicate(Inst, Bundle, DupTime);
     }
 
     /* Increment the case-specific counter for the failure of either decode or validation */
     if (Status == BPLIB_CBOR_DEC_BUNDLE_TOO_LONG_DEC_ERR)
     {
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DELETED_TOO_LONG, 1);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DELETED_TOO_LONG, 1);
     }
     else if (Status == BPLIB_CBOR_DEC_HOP_BLOCK_EXCEEDED_ERR)
     {
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DELETED_HOP_EXCEEDED, 1);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DELETED_HOP_EXCEEDED, 1);
     }
     else if (Status == BPLIB_CBOR_DEC_UNKNOWN_BLOCK_DEC_ERR)
     {
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DELETED_UNSUPPORTED_BLOCK, 1);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DELETED_UNSUPPORTED_BLOCK, 1);
     }
     else if (Status == BPLIB_BI_EXPIRED_BUNDLE_ERR)
     {
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DELETED_EXPIRED, 1);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DELETED_EXPIRED, 1);
     }
-    else if (Status != BPLIB_SUCCESS)
+    else if (Status == BPLIB_BI_DUPLICATE_BUNDLE_ERR)
     {
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DELETED_UNINTELLIGIBLE, 1);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_REDUNDANT, 1);
     }
-
-    /* If decode and validation were successful, create the job to ingress bundle */
-    if (Status == BPLIB_SUCCESS)
+    else if (Status == BPLIB_BI_FRAGMENT_ERR)
     {
-        Status = BPLib_QM_CreateJob(Inst, CandidateBundle, CONTACT_IN_BI_TO_EBP, QM_PRI_NORMAL, QM_WAIT_FOREVER);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_FRAGMENT_ERROR, 1);
     }
-    
-    /* If something failed, cease bundle processing and free memory */
+    else if (Status != BPLIB_SUCCESS)
+    {
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DELETED_UNINTELLIGIBLE, 1);
+    }
+
+    BPLIB_PL_TRACE_BUNDLE(BPLIB_PL_TRACE_BI_RECV, Bundle, 0, Status);
+
+    return Status;
+}
+
+/* Count a candidate bundle as received, or free it if it could not be ingressed */
+static void BPLib_BI_FinishCandidate(BPLib_Instance_t* Inst, BPLib_Bundle_t* CandidateBundle,
+                                     BPLib_Status_t Status, uint32_t ContId)
+{
+    BPLib_AS_Slot_t SrcSlot;
+
     if (Status != BPLIB_SUCCESS)
     {
         BPLib_MEM_BundleFree(&Inst->pool, CandidateBundle);
@@ -108,12 +233,147 @@ BPLib_Status_t BPLib_BI_RecvFullBundleIn(BPLib_Instance_t* Inst, const void *Bun
         BPLib_EM_SendEvent(BPLIB_BI_INGRESS_CBOR_DECODE_INF_EID, BPLib_EM_EventType_INFORMATION,
                             "[CLA In #%d]: Error ingressing bundle, RC = %d", ContId, Status);
 
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DISCARDED, 1);
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DELETED, 1);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DISCARDED, 1);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DELETED, 1);
     }
     else
     {
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_RECEIVED, 1);
+        SrcSlot = BPLib_AS_ResolveSourceSlot(&CandidateBundle->blocks.PrimaryBlock.SrcEID);
+
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_RECEIVED, 1);
+        BPLib_AS_IncrementSlot(SrcSlot, BUNDLE_COUNT_RECEIVED, 1);
+
+        if (CandidateBundle->blocks.PrimaryBlock.BundleProcFlags & BPLIB_BUNDLE_PROC_FRAG_FLAG)
+        {
+            BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_RECEIVED_FRAGMENT, 1);
+            BPLib_AS_IncrementSlot(SrcSlot, BUNDLE_COUNT_RECEIVED_FRAGMENT, 1);
+        }
+    }
+}
+
+/* Receive candidate bundle from CLA, CBOR decode it, then place it to EBP In Queue */
+BPLib_Status_t BPLib_BI_RecvFullBundleIn(BPLib_Instance_t* Inst, const void *BundleIn, 
+                                            size_t Size, uint32_t ContId)
+{
+    BPLib_Status_t Status;
+    BPLib_Bundle_t* CandidateBundle;
+    uint64_t DupTime;
+
+    if ((Inst == NULL) || (BundleIn == NULL))
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    if (ContId >= BPLIB_MAX_NUM_CONTACTS)
+    {
+        return BPLIB_INVALID_CONT_ID_ERR;
+    }
+
+    Status = BPLib_BI_DecodeCandidate(Inst, BundleIn, Size, &CandidateBundle, &DupTime);
+    if (CandidateBundle == NULL)
+    {
+        return Status;
+    }
+
+    /* If decode and validation were successful, create the job to ingress bundle */
+    if (Status == BPLIB_SUCCESS)
+    {
+        Status = BPLib_QM_CreateJob(Inst, CandidateBundle, CONTACT_IN_BI_TO_EBP, QM_PRI_NORMAL, QM_WAIT_FOREVER);
+        if (Status != BPLIB_SUCCESS)
+        {
+            BPLib_BI_ForgetDuplicate(CandidateBundle, DupTime);
+        }
+    }
+
+    BPLib_BI_FinishCandidate(Inst, CandidateBundle, Status, ContId);
+
+    return Status;
+}
+
+/* Receive a batch of candidate bundles from CLA, queueing the valid ones together */
+BPLib_Status_t BPLib_BI_RecvBundlesIn(BPLib_Instance_t* Inst, const void *const BundlesIn[],
+                                      const size_t Sizes[], uint32_t NumBundles, uint32_t ContId,
+                                      BPLib_Status_t Statuses[])
+{
+    BPLib_Status_t Status;
+    BPLib_Bundle_t* Decoded[QM_MAX_JOB_BATCH];
+    uint32_t DecodedIdx[QM_MAX_JOB_BATCH];
+    uint64_t DupTimes[QM_MAX_JOB_BATCH];
+    BPLib_Bundle_t* CandidateBundle;
+    uint64_t DupTime;
+    size_t NumDecoded;
+    size_t NumCreated;
+    size_t i;
+    uint32_t Next;
+
+    if ((Inst == NULL) || (BundlesIn == NULL) || (Sizes == NULL) || (Statuses == NULL))
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    if (ContId >= BPLIB_MAX_NUM_CONTACTS)
+    {
+        return BPLIB_INVALID_CONT_ID_ERR;
+    }
+
+    Status = BPLIB_SUCCESS;
+    Next = 0;
+    while (Next < NumBundles)
+    {
+        /* Decode up to a job batch worth of bundles, dropping the ones that fail */
+        NumDecoded = 0;
+        while ((Next < NumBundles) && (NumDecoded < QM_MAX_JOB_BATCH))
+        {
+            if (BundlesIn[Next] == NULL)
+            {
+                Statuses[Next] = BPLIB_NULL_PTR_ERROR;
+                CandidateBundle = NULL;
+            }
+            else
+            {
+                Statuses[Next] = BPLib_BI_DecodeCandidate(Inst, BundlesIn[Next], Sizes[Next], &CandidateBundle,
+                                                          &DupTime);
+            }
+
+            if (Statuses[Next] == BPLIB_SUCCESS)
+            {
+                Decoded[NumDecoded] = CandidateBundle;
+                DecodedIdx[NumDecoded] = Next;
+                DupTimes[NumDecoded] = DupTime;
+                NumDecoded++;
+            }
+            else
+            {
+                Status = Statuses[Next];
+                if (CandidateBundle != NULL)
+                {
+                    BPLib_BI_FinishCandidate(Inst, CandidateBundle, Statuses[Next], ContId);
+                }
+            }
+            Next++;
+        }
+
+        if (NumDecoded == 0)
+        {
+            continue;
+        }
+
+        /* Queue the ingress jobs for the whole batch under one queue lock */
+        NumCreated = 0;
+        (void) BPLib_QM_CreateJobs(Inst, Decoded, NumDecoded, CONTACT_IN_BI_TO_EBP,
+                                   QM_PRI_NORMAL, QM_WAIT_FOREVER, &NumCreated);
+
+        for (i = 0; i < NumDecoded; i++)
+        {
+            if (i >= NumCreated)
+            {
+                Statuses[DecodedIdx[i]] = BPLIB_QM_PUSH_ERROR;
+                Status = BPLIB_QM_PUSH_ERROR;
+                BPLib_BI_ForgetDuplicate(Decoded[i], DupTimes[i]);
+            }
+
+            BPLib_BI_FinishCandidate(Inst, Decoded[i], Statuses[DecodedIdx[i]], ContId);
+        }
     }
 
     return Status;
@@ -158,6 +418,16 @@ BPLib_Status_t BPLib_BI_ValidateBundle(BPLib_Bundle_t *CandidateBundle)
         return BPLIB_BI_INVALID_BUNDLE_ERR;
     }
 
+    /* Verify a fragment's payload lies within the ADU it is part of */
+    if ((CandidateBundle->blocks.PrimaryBlock.BundleProcFlags & BPLIB_BUNDLE_PROC_FRAG_FLAG) &&
+        ((CandidateBundle->blocks.PayloadHeader.DataSize == 0) ||
+         (CandidateBundle->blocks.PrimaryBlock.FragmentOffset >= CandidateBundle->blocks.PrimaryBlock.TotalAduLength) ||
+         (CandidateBundle->blocks.PayloadHeader.DataSize >
+          CandidateBundle->blocks.PrimaryBlock.TotalAduLength - CandidateBundle->blocks.PrimaryBlock.FragmentOffset)))
+    {
+        return BPLIB_BI_FRAGMENT_ERR;
+    }
+
     /* Verify no extension block is duplicated */
     for (ExtBlkIdx = 0; ExtBlkIdx < BPLIB_MAX_NUM_EXTENSION_BLOCKS; ExtBlkIdx++)
     {
@@ -256,6 +526,7 @@ BPLib_Status_t BPLib_BI_BlobCopyOut(BPLib_Bundle_t* StoredBundle,
                                     size_t* NumBytesCopied)
 {
     BPLib_Status_t ReturnStatus;
+    uint64_t EncodeStart;
 
     if ((StoredBundle == NULL) || (StoredBundle->blob == NULL) || (OutputBuffer == NULL) || (NumBytesCopied == NULL))
     {
@@ -263,8 +534,100 @@ BPLib_Status_t BPLib_BI_BlobCopyOut(BPLib_Bundle_t* StoredBundle,
     }
     else
     {
+        EncodeStart = BPLib_PL_LatencyStart();
         ReturnStatus = BPLib_CBOR_EncodeBundle(StoredBundle, OutputBuffer, OutputBufferSize, NumBytesCopied);
+        BPLib_PL_LatencyStop(BPLIB_PL_LATENCY_ENCODE, EncodeStart);
+    }
+
+    return ReturnStatus;
+}
+
+BPLib_Status_t BPLib_BI_FragmentCopyOut(BPLib_Bundle_t* StoredBundle,
+                                        size_t PayloadOffset,
+                                        void* OutputBuffer,
+                                        size_t OutputBufferSize,
+                                        size_t* NumBytesCopied,
+                                        size_t* PayloadBytes)
+{
+    BPLib_Status_t ReturnStatus;
+    BPLib_Bundle_t Slice;
+    uint64_t EncodeStart;
+    size_t Remaining;
+    size_t Overhead;
+    size_t Room;
+    size_t Growth;
+    size_t Len;
+
+    if ((StoredBundle == NULL) || (StoredBundle->blob == NULL) || (OutputBuffer == NULL) ||
+        (NumBytesCopied == NULL) || (PayloadBytes == NULL))
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    *NumBytesCopied = 0;
+    *PayloadBytes   = 0;
+
+    if (PayloadOffset >= StoredBundle->blocks.PayloadHeader.DataSize)
+    {
+        return BPLIB_BI_INVALID_BUNDLE_ERR;
+    }
+
+    BPLib_BI_MakeFragmentSlice(StoredBundle, PayloadOffset, &Slice);
+    Remaining = Slice.blocks.PayloadHeader.DataSize;
+
+    EncodeStart = BPLib_PL_LatencyStart();
+
+    /* Size everything but the payload data by encoding the fragment with none */
+    Overhead = 0;
+    Slice.blocks.PayloadHeader.DataSize = 0;
+    ReturnStatus = BPLib_CBOR_EncodeBundle(&Slice, OutputBuffer, OutputBufferSize, &Overhead);
+    if (ReturnStatus == BPLIB_SUCCESS)
+    {
+        /* Take what fits, leaving room for the payload's byte string head to grow */
+        Room = (OutputBufferSize > Overhead) ? OutputBufferSize - Overhead : 0;
+        Len  = (Remaining < Room) ? Remaining : Room;
+        Growth = BPLib_BI_ByteStringHeadGrowth(Len);
+        if ((Len + Growth) > Room)
+        {
+            Len = (Room > Growth) ? Room - Growth : 0;
+        }
+
+        if ((Len == 0) || ((Len < Remaining) && (Len < BPLIB_BI_FRAG_MIN_PAYLOAD)))
+        {
+            ReturnStatus = BPLIB_BI_FRAG_NO_ROOM_ERR;
+        }
+        else
+        {
+            Slice.blocks.PayloadHeader.DataSize = Len;
+            ReturnStatus = BPLib_CBOR_EncodeBundle(&Slice, OutputBuffer, OutputBufferSize, NumBytesCopied);
+            if (ReturnStatus == BPLIB_SUCCESS)
+            {
+                *PayloadBytes = Len;
+            }
+        }
     }
 
+    BPLib_PL_LatencyStop(BPLIB_PL_LATENCY_ENCODE, EncodeStart);
+
     return ReturnStatus;
 }
+
+BPLib_Status_t BPLib_BI_FragmentTrim(BPLib_Bundle_t* Bundle, size_t PayloadOffset)
+{
+    BPLib_Bundle_t Slice;
+
+    if (Bundle == NULL)
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    if (PayloadOffset >= Bundle->blocks.PayloadHeader.DataSize)
+    {
+        return BPLIB_BI_INVALID_BUNDLE_ERR;
+    }
+
+    BPLib_BI_MakeFragmentSlice(Bundle, PayloadOffset, &Slice);
+    *Bundle = Slice;
+
+    return BPLIB_SUCCESS;
+}
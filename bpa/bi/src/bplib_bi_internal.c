@@ -0,0 +1,190 @@
+/*
+ * NASA Docket No. GSC-19,559-1, and identified as "Delay/Disruption Tolerant Networking 
+ * (DTN) Bundle Protocol (BP) v7 Core Flight System (cFS) Application Build 7.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this 
+ * file except in compliance with the License. You may obtain a copy of the License at 
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0 
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under 
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF 
+ * ANY KIND, either express or implied. See the License for the specific language 
+ * governing permissions and limitations under the License. The copyright notice to be 
+ * included in the software is as follows: 
+ *
+ * Copyright 2025 United States Government as represented by the Administrator of the 
+ * National Aeronautics and Space Administration. All Rights Reserved.
+ *
+ */
+
+/* ======== */
+/* Includes */
+/* ======== */
+
+#include "bplib_bi_internal.h"
+
+#include <string.h>
+
+/* ================ */
+/* Duplicate Filter */
+/* ================ */
+
+BPLib_BI_DupFilter_t BPLib_BI_DupFilter = { .Lock = PTHREAD_MUTEX_INITIALIZER }; /** \brief Duplicate bundle filter */
+
+/* ==================== */
+/* Function Definitions */
+/* ==================== */
+
+/* Counter indexes for a bundle, by double hashing one mix of its identity */
+static void BPLib_BI_DupFilterIndexes(const BPLib_PrimaryBlock_t* PrimaryBlock, uint32_t Indexes[])
+{
+    uint64_t Hash;
+    uint32_t H1;
+    uint32_t H2;
+    uint32_t i;
+
+    Hash = PrimaryBlock->SrcEID.Scheme ^ (PrimaryBlock->SrcEID.IpnSspFormat << 8);
+    Hash = (Hash ^ PrimaryBlock->SrcEID.Allocator) * 0x9E3779B97F4A7C15ull;
+    Hash = (Hash ^ PrimaryBlock->SrcEID.Node) * 0x9E3779B97F4A7C15ull;
+    Hash = (Hash ^ PrimaryBlock->SrcEID.Service) * 0x9E3779B97F4A7C15ull;
+    Hash = (Hash ^ PrimaryBlock->Timestamp.CreateTime) * 0x9E3779B97F4A7C15ull;
+    Hash = (Hash ^ PrimaryBlock->Timestamp.SequenceNumber) * 0x9E3779B97F4A7C15ull;
+    Hash = (Hash ^ PrimaryBlock->FragmentOffset) * 0x9E3779B97F4A7C15ull;
+    Hash ^= Hash >> 29;
+
+    /* An odd step visits distinct counters for up to BPLIB_BI_DUP_COUNTERS hashes */
+    H1 = (uint32_t) (Hash >> 32);
+    H2 = (uint32_t) Hash | 1;
+
+    for (i = 0; i < BPLIB_BI_DUP_HASHES; i++)
+    {
+        Indexes[i] = (H1 + i * H2) & (BPLIB_BI_DUP_COUNTERS - 1);
+    }
+}
+
+/* Partition for the period a bundle expires in, reusing it if its old period is over when Claim is set */
+static BPLib_BI_DupPartition_t* BPLib_BI_DupFilterPartition(const BPLib_PrimaryBlock_t* PrimaryBlock,
+                                                            uint64_t DtnTime, bool Claim)
+{
+    BPLib_BI_DupPartition_t* Partition;
+    uint64_t NowEpoch;
+    uint64_t Epoch;
+
+    /* Bundles without a creation time have no DTN expiry to file them under */
+    if ((DtnTime == 0) || (PrimaryBlock->Timestamp.CreateTime == 0))
+    {
+        return NULL;
+    }
+
+    NowEpoch = DtnTime / BPLIB_BI_DUP_PARTITION_MS;
+    Epoch = (PrimaryBlock->Timestamp.CreateTime + PrimaryBlock->Lifetime) / BPLIB_BI_DUP_PARTITION_MS;
+    if (Epoch < NowEpoch)
+    {
+        return NULL;
+    }
+    /* The filter only spans BPLIB_BI_DUP_PARTITIONS periods, later expiries share the last one */
+    if (Epoch >= NowEpoch + BPLIB_BI_DUP_PARTITIONS)
+    {
+        Epoch = NowEpoch + BPLIB_BI_DUP_PARTITIONS - 1;
+    }
+
+    Partition = &BPLib_BI_DupFilter.Partitions[Epoch % BPLIB_BI_DUP_PARTITIONS];
+    if (Partition->Epoch != Epoch)
+    {
+        if (Claim == false)
+        {
+            return NULL;
+        }
+
+        /* The partition's previous period is over. Bundles clamped into it by a longer
+        ** lifetime may still be live, they roll off the filter early.
+        */
+        memset(Partition->Counters, 0, sizeof(Partition->Counters));
+        Partition->Epoch = Epoch;
+    }
+
+    return Partition;
+}
+
+BPLib_BI_DupResult_t BPLib_BI_DupFilterAdd(const BPLib_PrimaryBlock_t* PrimaryBlock, uint64_t DtnTime)
+{
+    BPLib_BI_DupPartition_t* Partition;
+    BPLib_BI_DupResult_t Result;
+    uint32_t Indexes[BPLIB_BI_DUP_HASHES];
+    uint32_t i;
+
+    BPLib_BI_DupFilterIndexes(PrimaryBlock, Indexes);
+
+    pthread_mutex_lock(&BPLib_BI_DupFilter.Lock);
+
+    Partition = BPLib_BI_DupFilterPartition(PrimaryBlock, DtnTime, true);
+    if (Partition == NULL)
+    {
+        Result = BPLIB_BI_DUP_UNTRACKED;
+    }
+    else
+    {
+        Result = BPLIB_BI_DUP_SEEN;
+        for (i = 0; i < BPLIB_BI_DUP_HASHES; i++)
+        {
+            if (Partition->Counters[Indexes[i]] == 0)
+            {
+                Result = BPLIB_BI_DUP_NEW;
+            }
+        }
+
+        for (i = 0; i < BPLIB_BI_DUP_HASHES; i++)
+        {
+            if (Partition->Counters[Indexes[i]] < UINT8_MAX)
+            {
+                Partition->Counters[Indexes[i]]++;
+            }
+        }
+    }
+
+    pthread_mutex_unlock(&BPLib_BI_DupFilter.Lock);
+
+    return Result;
+}
+
+void BPLib_BI_DupFilterRemove(const BPLib_PrimaryBlock_t* PrimaryBlock, uint64_t DtnTime)
+{
+    BPLib_BI_DupPartition_t* Partition;
+    uint32_t Indexes[BPLIB_BI_DUP_HASHES];
+    uint32_t i;
+
+    BPLib_BI_DupFilterIndexes(PrimaryBlock, Indexes);
+
+    pthread_mutex_lock(&BPLib_BI_DupFilter.Lock);
+
+    Partition = BPLib_BI_DupFilterPartition(PrimaryBlock, DtnTime, false);
+    if (Partition != NULL)
+    {
+        /* Saturated counters no longer know how many bundles set them, so they stay set */
+        for (i = 0; i < BPLIB_BI_DUP_HASHES; i++)
+        {
+            if ((Partition->Counters[Indexes[i]] > 0) && (Partition->Counters[Indexes[i]] < UINT8_MAX))
+            {
+                Partition->Counters[Indexes[i]]--;
+            }
+        }
+    }
+
+    pthread_mutex_unlock(&BPLib_BI_DupFilter.Lock);
+}
+
+void BPLib_BI_DupFilterReset(void)
+{
+    uint32_t i;
+
+    pthread_mutex_lock(&BPLib_BI_DupFilter.Lock);
+
+    for (i = 0; i < BPLIB_BI_DUP_PARTITIONS; i++)
+    {
+        BPLib_BI_DupFilter.Partitions[i].Epoch = 0;
+        memset(BPLib_BI_DupFilter.Partitions[i].Counters, 0, sizeof(BPLib_BI_DupFilter.Partitions[i].Counters));
+    }
+
+    pthread_mutex_unlock(&BPLib_BI_DupFilter.Lock);
+}
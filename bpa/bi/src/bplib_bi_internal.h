@@ -0,0 +1,107 @@
+/*
+ * NASA Docket No. GSC-19,559-1, and identified as "Delay/Disruption Tolerant Networking 
+ * (DTN) Bundle Protocol (BP) v7 Core Flight System (cFS) Application Build 7.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this 
+ * file except in compliance with the License. You may obtain a copy of the License at 
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0 
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under 
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF 
+ * ANY KIND, either express or implied. See the License for the specific language 
+ * governing permissions and limitations under the License. The copyright notice to be 
+ * included in the software is as follows: 
+ *
+ * Copyright 2025 United States Government as represented by the Administrator of the 
+ * National Aeronautics and Space Administration. All Rights Reserved.
+ *
+ */
+
+/**
+ * @file
+ *
+ * Private header file for internal Bundle Interface functions
+ */
+
+#ifndef BPLIB_BI_INTERNAL_H
+#define BPLIB_BI_INTERNAL_H
+
+/* ======== */
+/* Includes */
+/* ======== */
+
+#include "bplib_api_types.h"
+#include "bplib_bblocks.h"
+
+#include <pthread.h>
+
+/* ======= */
+/* Typdefs */
+/* ======= */
+
+/**
+  * \brief Result of adding a bundle to the duplicate filter
+  */
+typedef enum
+{
+    BPLIB_BI_DUP_UNTRACKED = 0, /** \brief Bundle was not added, DTN time is unknown or it expires in a past period */
+    BPLIB_BI_DUP_NEW       = 1, /** \brief Bundle was added and has not been seen before */
+    BPLIB_BI_DUP_SEEN      = 2  /** \brief Bundle was added and may have been seen before */
+} BPLib_BI_DupResult_t;
+
+/**
+  * \brief   One period of the duplicate filter
+  * \details A counting Bloom filter of the bundles expiring in the period starting at
+  *          Epoch * BPLIB_BI_DUP_PARTITION_MS. The counters saturate at UINT8_MAX.
+  */
+typedef struct
+{
+    uint64_t Epoch;                            /** \brief Period the counters are for */
+    uint8_t  Counters[BPLIB_BI_DUP_COUNTERS];  /** \brief Filter counters */
+} BPLib_BI_DupPartition_t;
+
+/**
+  * \brief   Duplicate bundle filter
+  * \details Partitions are indexed by period modulo BPLIB_BI_DUP_PARTITIONS. A partition whose
+  *          period is over is cleared the next time a bundle needs it, so bundles roll off the
+  *          filter with their lifetime. A bundle expiring more than BPLIB_BI_DUP_PARTITIONS
+  *          periods out is filed in the last partition and rolls off when that period ends,
+  *          before its lifetime does. A copy received after that is not caught.
+  */
+typedef struct
+{
+    pthread_mutex_t         Lock;                                   /** \brief Guards the partitions */
+    BPLib_BI_DupPartition_t Partitions[BPLIB_BI_DUP_PARTITIONS];    /** \brief Filter partitions */
+} BPLib_BI_DupFilter_t;
+
+extern BPLib_BI_DupFilter_t BPLib_BI_DupFilter; /** \brief Duplicate bundle filter */
+
+/* =================== */
+/* Function Prototypes */
+/* =================== */
+
+/**
+ * \brief     Adds a bundle to the duplicate filter
+ * \details   The bundle is keyed on its source EID, creation timestamp and fragment offset
+ *            and goes in the partition for the period it expires in
+ * \param[in] PrimaryBlock Primary block of the bundle
+ * \param[in] DtnTime Current DTN time, 0 if unknown
+ * \return    Whether the bundle was added and may have been seen before
+ */
+BPLib_BI_DupResult_t BPLib_BI_DupFilterAdd(const BPLib_PrimaryBlock_t* PrimaryBlock, uint64_t DtnTime);
+
+/**
+ * \brief     Removes a bundle added by BPLib_BI_DupFilterAdd() from the duplicate filter
+ * \note      Nothing is removed if the bundle's partition has since been reused
+ * \param[in] PrimaryBlock Primary block of the bundle
+ * \param[in] DtnTime DTN time the bundle was added at, which picks the same partition
+ */
+void BPLib_BI_DupFilterRemove(const BPLib_PrimaryBlock_t* PrimaryBlock, uint64_t DtnTime);
+
+/**
+ * \brief Clears every partition of the duplicate filter
+ */
+void BPLib_BI_DupFilterReset(void);
+
+#endif /* BPLIB_BI_INTERNAL_H */
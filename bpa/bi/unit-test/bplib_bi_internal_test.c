@@ -0,0 +1,199 @@
+/*
+ * NASA Docket No. GSC-19,559-1, and identified as "Delay/Disruption Tolerant Networking 
+ * (DTN) Bundle Protocol (BP) v7 Core Flight System (cFS) Application Build 7.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this 
+ * file except in compliance with the License. You may obtain a copy of the License at 
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0 
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under 
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF 
+ * ANY KIND, either express or implied. See the License for the specific language 
+ * governing permissions and limitations under the License. The copyright notice to be 
+ * included in the software is as follows: 
+ *
+ * Copyright 2025 United States Government as represented by the Administrator of the 
+ * National Aeronautics and Space Administration. All Rights Reserved.
+ *
+ */
+
+/*
+ * Include
+ */
+
+#include "bplib_bi_test_utils.h"
+#include "bplib_bi_internal.h"
+
+/* DTN time in the middle of a partition period */
+#define BPLIB_BI_TEST_NOW ((uint64_t) 1000 * BPLIB_BI_DUP_PARTITION_MS + 500)
+
+/* Total of the counters in one partition of the duplicate filter */
+static uint32_t BPLib_BI_Test_CounterSum(uint32_t PartitionIdx)
+{
+    uint32_t Sum = 0;
+    uint32_t i;
+
+    for (i = 0; i < BPLIB_BI_DUP_COUNTERS; i++)
+    {
+        Sum += BPLib_BI_DupFilter.Partitions[PartitionIdx].Counters[i];
+    }
+
+    return Sum;
+}
+
+/* Test that bundles without a DTN expiry in a current period are not tracked */
+void Test_BPLib_BI_DupFilterAdd_Untracked(void)
+{
+    BPLib_PrimaryBlock_t PrimaryBlock;
+
+    memset(&PrimaryBlock, 0, sizeof(PrimaryBlock));
+    PrimaryBlock.Timestamp.CreateTime = BPLIB_BI_TEST_NOW;
+    PrimaryBlock.Lifetime = 1000;
+
+    /* Unknown DTN time */
+    UtAssert_INT32_EQ(BPLib_BI_DupFilterAdd(&PrimaryBlock, 0), BPLIB_BI_DUP_UNTRACKED);
+
+    /* Expired in a past period */
+    UtAssert_INT32_EQ(BPLib_BI_DupFilterAdd(&PrimaryBlock, BPLIB_BI_TEST_NOW + BPLIB_BI_DUP_PARTITION_MS),
+                      BPLIB_BI_DUP_UNTRACKED);
+
+    /* No creation time */
+    PrimaryBlock.Timestamp.CreateTime = 0;
+    UtAssert_INT32_EQ(BPLib_BI_DupFilterAdd(&PrimaryBlock, BPLIB_BI_TEST_NOW), BPLIB_BI_DUP_UNTRACKED);
+}
+
+/* Test that a bundle is seen the second time it is added, and only that bundle */
+void Test_BPLib_BI_DupFilterAdd_Nominal(void)
+{
+    BPLib_PrimaryBlock_t PrimaryBlock;
+
+    memset(&PrimaryBlock, 0, sizeof(PrimaryBlock));
+    PrimaryBlock.SrcEID.Node = 10;
+    PrimaryBlock.SrcEID.Service = 1;
+    PrimaryBlock.Timestamp.CreateTime = BPLIB_BI_TEST_NOW;
+    PrimaryBlock.Lifetime = 1000;
+
+    UtAssert_INT32_EQ(BPLib_BI_DupFilterAdd(&PrimaryBlock, BPLIB_BI_TEST_NOW), BPLIB_BI_DUP_NEW);
+    UtAssert_INT32_EQ(BPLib_BI_DupFilterAdd(&PrimaryBlock, BPLIB_BI_TEST_NOW), BPLIB_BI_DUP_SEEN);
+
+    PrimaryBlock.Timestamp.SequenceNumber = 1;
+    UtAssert_INT32_EQ(BPLib_BI_DupFilterAdd(&PrimaryBlock, BPLIB_BI_TEST_NOW), BPLIB_BI_DUP_NEW);
+
+    PrimaryBlock.FragmentOffset = 100;
+    UtAssert_INT32_EQ(BPLib_BI_DupFilterAdd(&PrimaryBlock, BPLIB_BI_TEST_NOW), BPLIB_BI_DUP_NEW);
+
+    UtAssert_UINT32_EQ(BPLib_BI_Test_CounterSum(1000 % BPLIB_BI_DUP_PARTITIONS), 4 * BPLIB_BI_DUP_HASHES);
+}
+
+/* Test that a removed bundle is no longer seen */
+void Test_BPLib_BI_DupFilterRemove_Nominal(void)
+{
+    BPLib_PrimaryBlock_t PrimaryBlock;
+
+    memset(&PrimaryBlock, 0, sizeof(PrimaryBlock));
+    PrimaryBlock.Timestamp.CreateTime = BPLIB_BI_TEST_NOW;
+    PrimaryBlock.Lifetime = 1000;
+
+    UtAssert_INT32_EQ(BPLib_BI_DupFilterAdd(&PrimaryBlock, BPLIB_BI_TEST_NOW), BPLIB_BI_DUP_NEW);
+    BPLib_BI_DupFilterRemove(&PrimaryBlock, BPLIB_BI_TEST_NOW);
+    UtAssert_UINT32_EQ(BPLib_BI_Test_CounterSum(1000 % BPLIB_BI_DUP_PARTITIONS), 0);
+    UtAssert_INT32_EQ(BPLib_BI_DupFilterAdd(&PrimaryBlock, BPLIB_BI_TEST_NOW), BPLIB_BI_DUP_NEW);
+
+    /* Removing from a partition that was never claimed does nothing */
+    PrimaryBlock.Lifetime = 2 * BPLIB_BI_DUP_PARTITION_MS;
+    BPLib_BI_DupFilterRemove(&PrimaryBlock, BPLIB_BI_TEST_NOW);
+    UtAssert_UINT32_EQ(BPLib_BI_Test_CounterSum(1002 % BPLIB_BI_DUP_PARTITIONS), 0);
+}
+
+/* Test that saturated counters are left set when a bundle is removed */
+void Test_BPLib_BI_DupFilterRemove_Saturated(void)
+{
+    BPLib_PrimaryBlock_t PrimaryBlock;
+    uint32_t i;
+
+    memset(&PrimaryBlock, 0, sizeof(PrimaryBlock));
+    PrimaryBlock.Timestamp.CreateTime = BPLIB_BI_TEST_NOW;
+    PrimaryBlock.Lifetime = 1000;
+
+    for (i = 0; i < UINT8_MAX + 10; i++)
+    {
+        (void) BPLib_BI_DupFilterAdd(&PrimaryBlock, BPLIB_BI_TEST_NOW);
+    }
+    for (i = 0; i < UINT8_MAX + 10; i++)
+    {
+        BPLib_BI_DupFilterRemove(&PrimaryBlock, BPLIB_BI_TEST_NOW);
+    }
+
+    UtAssert_INT32_EQ(BPLib_BI_DupFilterAdd(&PrimaryBlock, BPLIB_BI_TEST_NOW), BPLIB_BI_DUP_SEEN);
+}
+
+/* Test that a partition is cleared and reused once its period is over */
+void Test_BPLib_BI_DupFilterAdd_RollOff(void)
+{
+    BPLib_PrimaryBlock_t Old;
+    BPLib_PrimaryBlock_t New;
+    uint32_t PartitionIdx = 1000 % BPLIB_BI_DUP_PARTITIONS;
+
+    memset(&Old, 0, sizeof(Old));
+    Old.Timestamp.CreateTime = BPLIB_BI_TEST_NOW;
+    Old.Lifetime = 1000;
+    UtAssert_INT32_EQ(BPLib_BI_DupFilterAdd(&Old, BPLIB_BI_TEST_NOW), BPLIB_BI_DUP_NEW);
+
+    /* A period later, the bundle expiring BPLIB_BI_DUP_PARTITIONS periods out takes over the partition */
+    memset(&New, 0, sizeof(New));
+    New.SrcEID.Node = 20;
+    New.Timestamp.CreateTime = BPLIB_BI_TEST_NOW + BPLIB_BI_DUP_PARTITION_MS;
+    New.Lifetime = (BPLIB_BI_DUP_PARTITIONS - 1) * BPLIB_BI_DUP_PARTITION_MS;
+    UtAssert_INT32_EQ(BPLib_BI_DupFilterAdd(&New, BPLIB_BI_TEST_NOW + BPLIB_BI_DUP_PARTITION_MS),
+                      BPLIB_BI_DUP_NEW);
+
+    UtAssert_UINT32_EQ(BPLib_BI_DupFilter.Partitions[PartitionIdx].Epoch, 1000 + BPLIB_BI_DUP_PARTITIONS);
+    UtAssert_UINT32_EQ(BPLib_BI_Test_CounterSum(PartitionIdx), BPLIB_BI_DUP_HASHES);
+
+    /* The old bundle's period is gone, removing it does nothing */
+    BPLib_BI_DupFilterRemove(&Old, BPLIB_BI_TEST_NOW + BPLIB_BI_DUP_PARTITION_MS);
+    UtAssert_UINT32_EQ(BPLib_BI_Test_CounterSum(PartitionIdx), BPLIB_BI_DUP_HASHES);
+}
+
+/* Test that bundles expiring past the last partition go in the last partition */
+void Test_BPLib_BI_DupFilterAdd_LongLifetime(void)
+{
+    BPLib_PrimaryBlock_t PrimaryBlock;
+    uint32_t PartitionIdx = (1000 + BPLIB_BI_DUP_PARTITIONS - 1) % BPLIB_BI_DUP_PARTITIONS;
+
+    memset(&PrimaryBlock, 0, sizeof(PrimaryBlock));
+    PrimaryBlock.Timestamp.CreateTime = BPLIB_BI_TEST_NOW;
+    PrimaryBlock.Lifetime = 100 * BPLIB_BI_DUP_PARTITIONS * BPLIB_BI_DUP_PARTITION_MS;
+
+    UtAssert_INT32_EQ(BPLib_BI_DupFilterAdd(&PrimaryBlock, BPLIB_BI_TEST_NOW), BPLIB_BI_DUP_NEW);
+    UtAssert_INT32_EQ(BPLib_BI_DupFilterAdd(&PrimaryBlock, BPLIB_BI_TEST_NOW), BPLIB_BI_DUP_SEEN);
+
+    UtAssert_UINT32_EQ(BPLib_BI_DupFilter.Partitions[PartitionIdx].Epoch, 1000 + BPLIB_BI_DUP_PARTITIONS - 1);
+    UtAssert_UINT32_EQ(BPLib_BI_Test_CounterSum(PartitionIdx), 2 * BPLIB_BI_DUP_HASHES);
+}
+
+/* Test that a reset forgets every bundle */
+void Test_BPLib_BI_DupFilterReset_Nominal(void)
+{
+    BPLib_PrimaryBlock_t PrimaryBlock;
+
+    memset(&PrimaryBlock, 0, sizeof(PrimaryBlock));
+    PrimaryBlock.Timestamp.CreateTime = BPLIB_BI_TEST_NOW;
+    PrimaryBlock.Lifetime = 1000;
+
+    UtAssert_INT32_EQ(BPLib_BI_DupFilterAdd(&PrimaryBlock, BPLIB_BI_TEST_NOW), BPLIB_BI_DUP_NEW);
+    BPLib_BI_DupFilterReset();
+    UtAssert_INT32_EQ(BPLib_BI_DupFilterAdd(&PrimaryBlock, BPLIB_BI_TEST_NOW), BPLIB_BI_DUP_NEW);
+}
+
+void TestBplibBiInternal_Register(void)
+{
+    UtTest_Add(Test_BPLib_BI_DupFilterAdd_Untracked, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_DupFilterAdd_Untracked");
+    UtTest_Add(Test_BPLib_BI_DupFilterAdd_Nominal, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_DupFilterAdd_Nominal");
+    UtTest_Add(Test_BPLib_BI_DupFilterAdd_RollOff, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_DupFilterAdd_RollOff");
+    UtTest_Add(Test_BPLib_BI_DupFilterAdd_LongLifetime, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_DupFilterAdd_LongLifetime");
+    UtTest_Add(Test_BPLib_BI_DupFilterRemove_Nominal, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_DupFilterRemove_Nominal");
+    UtTest_Add(Test_BPLib_BI_DupFilterRemove_Saturated, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_DupFilterRemove_Saturated");
+    UtTest_Add(Test_BPLib_BI_DupFilterReset_Nominal, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_DupFilterReset_Nominal");
+}
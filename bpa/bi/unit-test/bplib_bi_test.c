@@ -24,7 +24,10 @@
 
 #include "bplib_bi_test_utils.h"
 
+#include "bplib_bi_internal.h"
 #include "bplib_cbor.h"
+#include "bplib_qm_handlers.h"
+#include "bplib_stor_handlers.h"
 
 void Test_BPLib_BI_RecvFullBundleIn_NullInputErrors(void)
 {
@@ -42,7 +45,7 @@ void Test_BPLib_BI_RecvFullBundleIn_NullInputErrors(void)
     UtAssert_STUB_COUNT(BPLib_CBOR_DecodeBundle, 0);
     UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
     UtAssert_STUB_COUNT(BPLib_EM_SendEvent, 0);
-    UtAssert_STUB_COUNT(BPLib_AS_Increment, 0);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 0);
     UtAssert_STUB_COUNT(BPLib_QM_CreateJob, 0);
 }
 
@@ -62,7 +65,7 @@ void Test_BPLib_BI_RecvFullBundleIn_MemAllocError(void)
     UtAssert_STUB_COUNT(BPLib_CBOR_DecodeBundle, 0);
     UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
     UtAssert_STUB_COUNT(BPLib_EM_SendEvent, 0);
-    UtAssert_STUB_COUNT(BPLib_AS_Increment, 0);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 0);
     UtAssert_STUB_COUNT(BPLib_QM_CreateJob, 0);
 }
 
@@ -85,8 +88,8 @@ void Test_BPLib_BI_RecvFullBundleIn_LenErr(void)
     UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
     UtAssert_STUB_COUNT(BPLib_EM_SendEvent, 1);
     UtAssert_EQ(BPLib_AS_Counter_t, BUNDLE_COUNT_DELETED_TOO_LONG, 
-                                                Context_BPLib_AS_Increment[0].Counter);
-    UtAssert_STUB_COUNT(BPLib_AS_Increment, 3);
+                                                Context_BPLib_AS_IncrementSlot[0].Counter);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 3);
     UtAssert_STUB_COUNT(BPLib_QM_CreateJob, 0);
 }
 
@@ -109,8 +112,8 @@ void Test_BPLib_BI_RecvFullBundleIn_HopErr(void)
     UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
     UtAssert_STUB_COUNT(BPLib_EM_SendEvent, 1);
     UtAssert_EQ(BPLib_AS_Counter_t, BUNDLE_COUNT_DELETED_HOP_EXCEEDED, 
-                                                Context_BPLib_AS_Increment[0].Counter);
-    UtAssert_STUB_COUNT(BPLib_AS_Increment, 3);
+                                                Context_BPLib_AS_IncrementSlot[0].Counter);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 3);
     UtAssert_STUB_COUNT(BPLib_QM_CreateJob, 0);
 }
 
@@ -134,8 +137,8 @@ void Test_BPLib_BI_RecvFullBundleIn_BlkErr(void)
     UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
     UtAssert_STUB_COUNT(BPLib_EM_SendEvent, 1);
     UtAssert_EQ(BPLib_AS_Counter_t, BUNDLE_COUNT_DELETED_UNSUPPORTED_BLOCK, 
-                                                Context_BPLib_AS_Increment[0].Counter);
-    UtAssert_STUB_COUNT(BPLib_AS_Increment, 3);
+                                                Context_BPLib_AS_IncrementSlot[0].Counter);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 3);
     UtAssert_STUB_COUNT(BPLib_QM_CreateJob, 0);
 }
 
@@ -159,8 +162,8 @@ void Test_BPLib_BI_RecvFullBundleIn_UnintellErr(void)
     UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
     UtAssert_STUB_COUNT(BPLib_EM_SendEvent, 1);
     UtAssert_EQ(BPLib_AS_Counter_t, BUNDLE_COUNT_DELETED_UNINTELLIGIBLE, 
-                                                Context_BPLib_AS_Increment[0].Counter);
-    UtAssert_STUB_COUNT(BPLib_AS_Increment, 3);
+                                                Context_BPLib_AS_IncrementSlot[0].Counter);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 3);
     UtAssert_STUB_COUNT(BPLib_QM_CreateJob, 0);
 }
 
@@ -185,8 +188,8 @@ void Test_BPLib_BI_RecvFullBundleIn_ExpireErr(void)
     UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
     UtAssert_STUB_COUNT(BPLib_EM_SendEvent, 1);
     UtAssert_EQ(BPLib_AS_Counter_t, BUNDLE_COUNT_DELETED_EXPIRED, 
-                                                Context_BPLib_AS_Increment[0].Counter);
-    UtAssert_STUB_COUNT(BPLib_AS_Increment, 3);
+                                                Context_BPLib_AS_IncrementSlot[0].Counter);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 3);
     UtAssert_STUB_COUNT(BPLib_QM_CreateJob, 0);
 }
 
@@ -208,10 +211,36 @@ void Test_BPLib_BI_RecvFullBundleIn_Nominal(void)
     UtAssert_STUB_COUNT(BPLib_CBOR_DecodeBundle, 1);
     UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
     UtAssert_STUB_COUNT(BPLib_EM_SendEvent, 0);
-    UtAssert_STUB_COUNT(BPLib_AS_Increment, 1);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 2);
     UtAssert_STUB_COUNT(BPLib_QM_CreateJob, 1);
 }
 
+/* Test that a received bundle is counted against its source as well as the node */
+void Test_BPLib_BI_RecvFullBundleIn_SourceCounted(void)
+{
+    BPLib_Instance_t Instance;
+    char BundleIn[32];
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_MEM_BundleAlloc), (UT_IntReturn_t) &DeserializedBundle);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_CBOR_DecodeBundle), BPLIB_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_AS_ResolveSourceSlot), 3);
+    DeserializedBundle.blocks.PrimaryBlock.BundleProcFlags = BPLIB_BUNDLE_PROC_FRAG_FLAG;
+    DeserializedBundle.blocks.PrimaryBlock.TotalAduLength  = 100;
+    DeserializedBundle.blocks.PayloadHeader.DataSize       = 10;
+
+    UtAssert_INT32_EQ(BPLib_BI_RecvFullBundleIn(&Instance, BundleIn, sizeof(BundleIn), 0), BPLIB_SUCCESS);
+
+    /* The source is resolved once for all of the bundle's counters */
+    UtAssert_STUB_COUNT(BPLib_AS_ResolveSourceSlot, 1);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 4);
+    UtAssert_UINT16_EQ(Context_BPLib_AS_IncrementSlot[0].Slot, BPLIB_AS_NODE_CNTR_INDICATOR);
+    UtAssert_UINT16_EQ(Context_BPLib_AS_IncrementSlot[1].Slot, 3);
+    UtAssert_EQ(BPLib_AS_Counter_t, Context_BPLib_AS_IncrementSlot[1].Counter, BUNDLE_COUNT_RECEIVED);
+    UtAssert_UINT32_EQ(Context_BPLib_AS_IncrementSlot[1].Amount, 1);
+    UtAssert_UINT16_EQ(Context_BPLib_AS_IncrementSlot[3].Slot, 3);
+    UtAssert_EQ(BPLib_AS_Counter_t, Context_BPLib_AS_IncrementSlot[3].Counter, BUNDLE_COUNT_RECEIVED_FRAGMENT);
+}
+
 /* Test that bundle ingress when the contact ID is invalid */
 void Test_BPLib_BI_RecvFullBundleIn_IdErr(void)
 {
@@ -246,7 +275,7 @@ void Test_BPLib_BI_RecvFullBundleIn_Invalid(void)
     UtAssert_STUB_COUNT(BPLib_CBOR_DecodeBundle, 1);
     UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
     UtAssert_STUB_COUNT(BPLib_EM_SendEvent, 1);
-    UtAssert_STUB_COUNT(BPLib_AS_Increment, 3);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 3);
     UtAssert_STUB_COUNT(BPLib_QM_CreateJob, 0);
 }
 
@@ -269,10 +298,218 @@ void Test_BPLib_BI_RecvFullBundleIn_JobFail(void)
     UtAssert_STUB_COUNT(BPLib_CBOR_DecodeBundle, 1);
     UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
     UtAssert_STUB_COUNT(BPLib_EM_SendEvent, 1);
-    UtAssert_STUB_COUNT(BPLib_AS_Increment, 2);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 2);
     UtAssert_STUB_COUNT(BPLib_QM_CreateJob, 1);
 }
 
+/* Test that a bundle received again is dropped once storage confirms it has a copy */
+void Test_BPLib_BI_RecvFullBundleIn_Duplicate(void)
+{
+    BPLib_Instance_t Instance;
+    char BundleIn[32];
+    bool Found = true;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_MEM_BundleAlloc), (UT_IntReturn_t) &DeserializedBundle);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_CBOR_DecodeBundle), BPLIB_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 1000500);
+    UT_SetDataBuffer(UT_KEY(BPLib_STOR_FindDuplicate), &Found, sizeof(Found), false);
+    UT_SetHandlerFunction(UT_KEY(BPLib_STOR_FindDuplicate), UT_Handler_BPLib_STOR_FindDuplicate, NULL);
+    DeserializedBundle.blocks.PrimaryBlock.Timestamp.CreateTime = 1000000;
+    DeserializedBundle.blocks.PrimaryBlock.Timestamp.SequenceNumber = 7;
+
+    UtAssert_INT32_EQ(BPLib_BI_RecvFullBundleIn(&Instance, BundleIn, sizeof(BundleIn), 0), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPLib_STOR_FindDuplicate, 0);
+
+    UtAssert_INT32_EQ(BPLib_BI_RecvFullBundleIn(&Instance, BundleIn, sizeof(BundleIn), 0),
+                      BPLIB_BI_DUPLICATE_BUNDLE_ERR);
+    UtAssert_STUB_COUNT(BPLib_STOR_FindDuplicate, 1);
+    UtAssert_STUB_COUNT(BPLib_QM_CreateJob, 1);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 5);
+    UtAssert_EQ(BPLib_AS_Counter_t, BUNDLE_COUNT_REDUNDANT, Context_BPLib_AS_IncrementSlot[2].Counter);
+}
+
+/* Test that a possible duplicate storage has no copy of is still ingressed */
+void Test_BPLib_BI_RecvFullBundleIn_DuplicateNotStored(void)
+{
+    BPLib_Instance_t Instance;
+    char BundleIn[32];
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_MEM_BundleAlloc), (UT_IntReturn_t) &DeserializedBundle);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_CBOR_DecodeBundle), BPLIB_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 1000500);
+    DeserializedBundle.blocks.PrimaryBlock.Timestamp.CreateTime = 1000000;
+
+    UtAssert_INT32_EQ(BPLib_BI_RecvFullBundleIn(&Instance, BundleIn, sizeof(BundleIn), 0), BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(BPLib_BI_RecvFullBundleIn(&Instance, BundleIn, sizeof(BundleIn), 0), BPLIB_SUCCESS);
+
+    UtAssert_STUB_COUNT(BPLib_STOR_FindDuplicate, 1);
+    UtAssert_STUB_COUNT(BPLib_QM_CreateJob, 2);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
+}
+
+/* Test that a bundle QM could not queue is taken back out of the duplicate filter */
+void Test_BPLib_BI_RecvFullBundleIn_JobFailForgetsDuplicate(void)
+{
+    BPLib_Instance_t Instance;
+    char BundleIn[32];
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_MEM_BundleAlloc), (UT_IntReturn_t) &DeserializedBundle);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_CBOR_DecodeBundle), BPLIB_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 1000500);
+    UT_SetDeferredRetcode(UT_KEY(BPLib_QM_CreateJob), 1, BPLIB_ERROR);
+    DeserializedBundle.blocks.PrimaryBlock.Timestamp.CreateTime = 1000000;
+
+    UtAssert_INT32_EQ(BPLib_BI_RecvFullBundleIn(&Instance, BundleIn, sizeof(BundleIn), 0), BPLIB_ERROR);
+    UtAssert_INT32_EQ(BPLib_BI_RecvFullBundleIn(&Instance, BundleIn, sizeof(BundleIn), 0), BPLIB_SUCCESS);
+
+    UtAssert_STUB_COUNT(BPLib_STOR_FindDuplicate, 0);
+}
+
+/* Test that a bundle is taken back out of the partition it was added to even if time moves on */
+void Test_BPLib_BI_RecvFullBundleIn_JobFailForgetsAtAddTime(void)
+{
+    BPLib_Instance_t Instance;
+    char BundleIn[32];
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_MEM_BundleAlloc), (UT_IntReturn_t) &DeserializedBundle);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_CBOR_DecodeBundle), BPLIB_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 1000500);
+    UT_SetDeferredRetcode(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 3, 1000500 + BPLIB_BI_DUP_PARTITION_MS);
+    UT_SetDeferredRetcode(UT_KEY(BPLib_QM_CreateJob), 1, BPLIB_ERROR);
+    DeserializedBundle.blocks.PrimaryBlock.Timestamp.CreateTime = 1000000;
+
+    /* Long enough to be clamped into the last partition, which moves with the DTN time */
+    DeserializedBundle.blocks.PrimaryBlock.Lifetime = 100 * BPLIB_BI_DUP_PARTITIONS * BPLIB_BI_DUP_PARTITION_MS;
+
+    UtAssert_INT32_EQ(BPLib_BI_RecvFullBundleIn(&Instance, BundleIn, sizeof(BundleIn), 0), BPLIB_ERROR);
+    UtAssert_INT32_EQ(BPLib_BI_DupFilterAdd(&DeserializedBundle.blocks.PrimaryBlock, 1000500), BPLIB_BI_DUP_NEW);
+}
+
+/* Test that batch bundle ingress rejects NULL inputs and invalid contact IDs */
+void Test_BPLib_BI_RecvBundlesIn_InputErrors(void)
+{
+    BPLib_Instance_t Instance;
+    char BundleIn[32];
+    const void *BundlesIn[1] = { BundleIn };
+    size_t Sizes[1] = { sizeof(BundleIn) };
+    BPLib_Status_t Statuses[1];
+
+    UtAssert_INT32_EQ(BPLib_BI_RecvBundlesIn(NULL, BundlesIn, Sizes, 1, 0, Statuses), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_BI_RecvBundlesIn(&Instance, NULL, Sizes, 1, 0, Statuses), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_BI_RecvBundlesIn(&Instance, BundlesIn, NULL, 1, 0, Statuses), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_BI_RecvBundlesIn(&Instance, BundlesIn, Sizes, 1, 0, NULL), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_BI_RecvBundlesIn(&Instance, BundlesIn, Sizes, 1, BPLIB_MAX_NUM_CONTACTS, Statuses),
+                      BPLIB_INVALID_CONT_ID_ERR);
+
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleAlloc, 0);
+    UtAssert_STUB_COUNT(BPLib_QM_CreateJobs, 0);
+}
+
+/* Test that a batch of well-formed bundles is queued with one job batch */
+void Test_BPLib_BI_RecvBundlesIn_Nominal(void)
+{
+    BPLib_Instance_t Instance;
+    char BundleIn[3][32];
+    const void *BundlesIn[3] = { BundleIn[0], BundleIn[1], BundleIn[2] };
+    size_t Sizes[3] = { 32, 32, 32 };
+    BPLib_Status_t Statuses[3];
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_MEM_BundleAlloc), (UT_IntReturn_t) &DeserializedBundle);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_CBOR_DecodeBundle), BPLIB_SUCCESS);
+    UT_SetHandlerFunction(UT_KEY(BPLib_QM_CreateJobs), UT_Handler_BPLib_QM_CreateJobs, NULL);
+
+    UtAssert_INT32_EQ(BPLib_BI_RecvBundlesIn(&Instance, BundlesIn, Sizes, 3, 0, Statuses), BPLIB_SUCCESS);
+
+    UtAssert_INT32_EQ(Statuses[0], BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(Statuses[1], BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(Statuses[2], BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleAlloc, 3);
+    UtAssert_STUB_COUNT(BPLib_CBOR_DecodeBundle, 3);
+    UtAssert_STUB_COUNT(BPLib_QM_CreateJobs, 1);
+    UtAssert_STUB_COUNT(BPLib_QM_CreateJob, 0);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
+    UtAssert_STUB_COUNT(BPLib_EM_SendEvent, 0);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 6);
+}
+
+/* Test that a bundle failing to decode is dropped without affecting the rest of the batch */
+void Test_BPLib_BI_RecvBundlesIn_DecodeErr(void)
+{
+    BPLib_Instance_t Instance;
+    char BundleIn[3][32];
+    const void *BundlesIn[3] = { BundleIn[0], BundleIn[1], BundleIn[2] };
+    size_t Sizes[3] = { 32, 32, 32 };
+    BPLib_Status_t Statuses[3];
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_MEM_BundleAlloc), (UT_IntReturn_t) &DeserializedBundle);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_CBOR_DecodeBundle), BPLIB_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(BPLib_CBOR_DecodeBundle), 2, BPLIB_CBOR_DEC_BUNDLE_TOO_LONG_DEC_ERR);
+    UT_SetHandlerFunction(UT_KEY(BPLib_QM_CreateJobs), UT_Handler_BPLib_QM_CreateJobs, NULL);
+
+    UtAssert_INT32_EQ(BPLib_BI_RecvBundlesIn(&Instance, BundlesIn, Sizes, 3, 0, Statuses),
+                      BPLIB_CBOR_DEC_BUNDLE_TOO_LONG_DEC_ERR);
+
+    UtAssert_INT32_EQ(Statuses[0], BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(Statuses[1], BPLIB_CBOR_DEC_BUNDLE_TOO_LONG_DEC_ERR);
+    UtAssert_INT32_EQ(Statuses[2], BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPLib_QM_CreateJobs, 1);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
+    UtAssert_STUB_COUNT(BPLib_EM_SendEvent, 1);
+}
+
+/* Test that bundles QM could not queue are freed and reported */
+void Test_BPLib_BI_RecvBundlesIn_JobFail(void)
+{
+    BPLib_Instance_t Instance;
+    char BundleIn[2][32];
+    const void *BundlesIn[2] = { BundleIn[0], BundleIn[1] };
+    size_t Sizes[2] = { 32, 32 };
+    BPLib_Status_t Statuses[2];
+    size_t NumCreated = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_MEM_BundleAlloc), (UT_IntReturn_t) &DeserializedBundle);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_CBOR_DecodeBundle), BPLIB_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_CreateJobs), BPLIB_QM_PUSH_ERROR);
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_CreateJobs), &NumCreated, sizeof(NumCreated), false);
+    UT_SetHandlerFunction(UT_KEY(BPLib_QM_CreateJobs), UT_Handler_BPLib_QM_CreateJobs, NULL);
+
+    UtAssert_INT32_EQ(BPLib_BI_RecvBundlesIn(&Instance, BundlesIn, Sizes, 2, 0, Statuses), BPLIB_QM_PUSH_ERROR);
+
+    UtAssert_INT32_EQ(Statuses[0], BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(Statuses[1], BPLIB_QM_PUSH_ERROR);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
+    UtAssert_STUB_COUNT(BPLib_EM_SendEvent, 1);
+}
+
+/* Test that a duplicate bundle in a batch is dropped without affecting the rest of the batch */
+void Test_BPLib_BI_RecvBundlesIn_Duplicate(void)
+{
+    BPLib_Instance_t Instance;
+    char BundleIn[2][32];
+    const void *BundlesIn[2] = { BundleIn[0], BundleIn[1] };
+    size_t Sizes[2] = { 32, 32 };
+    BPLib_Status_t Statuses[2];
+    bool Found = true;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_MEM_BundleAlloc), (UT_IntReturn_t) &DeserializedBundle);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_CBOR_DecodeBundle), BPLIB_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 1000500);
+    UT_SetDataBuffer(UT_KEY(BPLib_STOR_FindDuplicate), &Found, sizeof(Found), false);
+    UT_SetHandlerFunction(UT_KEY(BPLib_STOR_FindDuplicate), UT_Handler_BPLib_STOR_FindDuplicate, NULL);
+    UT_SetHandlerFunction(UT_KEY(BPLib_QM_CreateJobs), UT_Handler_BPLib_QM_CreateJobs, NULL);
+    DeserializedBundle.blocks.PrimaryBlock.Timestamp.CreateTime = 1000000;
+
+    UtAssert_INT32_EQ(BPLib_BI_RecvBundlesIn(&Instance, BundlesIn, Sizes, 2, 0, Statuses),
+                      BPLIB_BI_DUPLICATE_BUNDLE_ERR);
+
+    UtAssert_INT32_EQ(Statuses[0], BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(Statuses[1], BPLIB_BI_DUPLICATE_BUNDLE_ERR);
+    UtAssert_STUB_COUNT(BPLib_STOR_FindDuplicate, 1);
+    UtAssert_STUB_COUNT(BPLib_QM_CreateJobs, 1);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
+}
+
 void Test_BPLib_BI_RecvCtrlMsg_Nominal(void)
 {
     BPLib_CLA_CtrlMsg_t* MsgPtr = NULL;
@@ -368,6 +605,28 @@ void Test_BPLib_BI_ValidateBundle_BlockNumErr(void)
     UtAssert_INT32_EQ(BPLib_BI_ValidateBundle(&DeserializedBundle), BPLIB_BI_INVALID_BUNDLE_ERR);        
 }
 
+/* Test that bundle validation fails when a fragment's payload lies outside its ADU */
+void Test_BPLib_BI_ValidateBundle_FragmentErr(void)
+{
+    DeserializedBundle.blocks.PrimaryBlock.Timestamp.CreateTime = 10;
+    DeserializedBundle.blocks.PrimaryBlock.BundleProcFlags = BPLIB_BUNDLE_PROC_FRAG_FLAG;
+    DeserializedBundle.blocks.PrimaryBlock.FragmentOffset = 100;
+    DeserializedBundle.blocks.PrimaryBlock.TotalAduLength = 200;
+    DeserializedBundle.blocks.PayloadHeader.DataSize = 100;
+
+    UtAssert_INT32_EQ(BPLib_BI_ValidateBundle(&DeserializedBundle), BPLIB_SUCCESS);
+
+    DeserializedBundle.blocks.PayloadHeader.DataSize = 101;
+    UtAssert_INT32_EQ(BPLib_BI_ValidateBundle(&DeserializedBundle), BPLIB_BI_FRAGMENT_ERR);
+
+    DeserializedBundle.blocks.PayloadHeader.DataSize = 0;
+    UtAssert_INT32_EQ(BPLib_BI_ValidateBundle(&DeserializedBundle), BPLIB_BI_FRAGMENT_ERR);
+
+    DeserializedBundle.blocks.PayloadHeader.DataSize = 1;
+    DeserializedBundle.blocks.PrimaryBlock.FragmentOffset = 200;
+    UtAssert_INT32_EQ(BPLib_BI_ValidateBundle(&DeserializedBundle), BPLIB_BI_FRAGMENT_ERR);
+}
+
 void Test_BPLib_BI_BlobCopyOut_InputBundleNullError(void)
 {
     BPLib_Status_t ReturnStatus;
@@ -456,6 +715,225 @@ void Test_BPLib_BI_BlobCopyOut_Nominal(void)
     UtAssert_STUB_COUNT(BPLib_CBOR_EncodeBundle, 1);
 }
 
+/* Fragment the encoder was last given */
+static BPLib_Bundle_t BPLib_BI_Test_Slice;
+
+/* Encode to 40 bytes of blocks plus the payload data */
+static void UT_Handler_BPLib_CBOR_EncodeBundle_Slice(void *UserObj, UT_EntryKey_t FuncKey,
+                                                     const UT_StubContext_t *Context)
+{
+    BPLib_Bundle_t *StoredBundle   = UT_Hook_GetArgValueByName(Context, "StoredBundle", BPLib_Bundle_t *);
+    size_t         *NumBytesCopied = UT_Hook_GetArgValueByName(Context, "NumBytesCopied", size_t *);
+    int32           Status;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+
+    BPLib_BI_Test_Slice = *StoredBundle;
+    if (Status == BPLIB_SUCCESS)
+    {
+        *NumBytesCopied = 40 + StoredBundle->blocks.PayloadHeader.DataSize;
+    }
+}
+
+/* Set up DeserializedBundle as a stored bundle with 1000 bytes of payload */
+static void BPLib_BI_Test_InitStoredBundle(BPLib_MEM_Block_t *FirstBlock)
+{
+    memset(FirstBlock, 0, sizeof(*FirstBlock));
+    DeserializedBundle.blob = FirstBlock;
+    DeserializedBundle.blocks.PayloadHeader.DataOffsetStart = 50;
+    DeserializedBundle.blocks.PayloadHeader.DataSize = 1000;
+    DeserializedBundle.blocks.ExtBlocks[1].Header.BlockProcFlags = BPLIB_BLOCK_PROC_REPLCT_FRAG_FLAG;
+
+    UT_SetHandlerFunction(UT_KEY(BPLib_CBOR_EncodeBundle), UT_Handler_BPLib_CBOR_EncodeBundle_Slice, NULL);
+}
+
+/* Test that fragment copy out rejects null arguments */
+void Test_BPLib_BI_FragmentCopyOut_Null(void)
+{
+    BPLib_MEM_Block_t FirstBlock;
+    uint8_t OutputBuffer[500];
+    size_t NumBytesCopied;
+    size_t PayloadBytes;
+
+    UtAssert_INT32_EQ(BPLib_BI_FragmentCopyOut(NULL, 0, OutputBuffer, sizeof(OutputBuffer),
+                                               &NumBytesCopied, &PayloadBytes), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_BI_FragmentCopyOut(&DeserializedBundle, 0, OutputBuffer, sizeof(OutputBuffer),
+                                               &NumBytesCopied, &PayloadBytes), BPLIB_NULL_PTR_ERROR);
+
+    BPLib_BI_Test_InitStoredBundle(&FirstBlock);
+    UtAssert_INT32_EQ(BPLib_BI_FragmentCopyOut(&DeserializedBundle, 0, NULL, sizeof(OutputBuffer),
+                                               &NumBytesCopied, &PayloadBytes), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_BI_FragmentCopyOut(&DeserializedBundle, 0, OutputBuffer, sizeof(OutputBuffer),
+                                               NULL, &PayloadBytes), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_BI_FragmentCopyOut(&DeserializedBundle, 0, OutputBuffer, sizeof(OutputBuffer),
+                                               &NumBytesCopied, NULL), BPLIB_NULL_PTR_ERROR);
+    UtAssert_STUB_COUNT(BPLib_CBOR_EncodeBundle, 0);
+}
+
+/* Test that a fragment cannot start past the end of the payload */
+void Test_BPLib_BI_FragmentCopyOut_BadOffset(void)
+{
+    BPLib_MEM_Block_t FirstBlock;
+    uint8_t OutputBuffer[500];
+    size_t NumBytesCopied;
+    size_t PayloadBytes;
+
+    BPLib_BI_Test_InitStoredBundle(&FirstBlock);
+
+    UtAssert_INT32_EQ(BPLib_BI_FragmentCopyOut(&DeserializedBundle, 1000, OutputBuffer, sizeof(OutputBuffer),
+                                               &NumBytesCopied, &PayloadBytes), BPLIB_BI_INVALID_BUNDLE_ERR);
+    UtAssert_UINT32_EQ(NumBytesCopied, 0);
+    UtAssert_UINT32_EQ(PayloadBytes, 0);
+    UtAssert_STUB_COUNT(BPLib_CBOR_EncodeBundle, 0);
+}
+
+/* Test that the first fragment fills the buffer and keeps every extension block */
+void Test_BPLib_BI_FragmentCopyOut_First(void)
+{
+    BPLib_MEM_Block_t FirstBlock;
+    uint8_t OutputBuffer[500];
+    size_t NumBytesCopied;
+    size_t PayloadBytes;
+
+    BPLib_BI_Test_InitStoredBundle(&FirstBlock);
+
+    UtAssert_INT32_EQ(BPLib_BI_FragmentCopyOut(&DeserializedBundle, 0, OutputBuffer, sizeof(OutputBuffer),
+                                               &NumBytesCopied, &PayloadBytes), BPLIB_SUCCESS);
+
+    /* 460 bytes of room, less 2 for the longer payload byte string head */
+    UtAssert_UINT32_EQ(PayloadBytes, 458);
+    UtAssert_UINT32_EQ(NumBytesCopied, 498);
+    UtAssert_STUB_COUNT(BPLib_CBOR_EncodeBundle, 2);
+
+    UtAssert_BOOL_TRUE(BPLib_BI_Test_Slice.blocks.PrimaryBlock.BundleProcFlags & BPLIB_BUNDLE_PROC_FRAG_FLAG);
+    UtAssert_UINT32_EQ(BPLib_BI_Test_Slice.blocks.PrimaryBlock.FragmentOffset, 0);
+    UtAssert_UINT32_EQ(BPLib_BI_Test_Slice.blocks.PrimaryBlock.TotalAduLength, 1000);
+    UtAssert_UINT32_EQ(BPLib_BI_Test_Slice.blocks.PayloadHeader.DataOffsetStart, 50);
+    UtAssert_ADDRESS_EQ(BPLib_BI_Test_Slice.blob, &FirstBlock);
+    UtAssert_UINT32_EQ(BPLib_BI_Test_Slice.blocks.ExtBlocks[0].Header.BlockType, BPLib_BlockType_HopCount);
+    UtAssert_UINT32_EQ(BPLib_BI_Test_Slice.blocks.ExtBlocks[2].Header.BlockType, BPLib_BlockType_PrevNode);
+
+    /* The stored bundle is left as it was */
+    UtAssert_BOOL_FALSE(DeserializedBundle.blocks.PrimaryBlock.BundleProcFlags & BPLIB_BUNDLE_PROC_FRAG_FLAG);
+    UtAssert_UINT32_EQ(DeserializedBundle.blocks.PayloadHeader.DataSize, 1000);
+}
+
+/* Test that a later fragment takes the rest of the payload and only replicated extension blocks */
+void Test_BPLib_BI_FragmentCopyOut_Last(void)
+{
+    BPLib_MEM_Block_t FirstBlock;
+    uint8_t OutputBuffer[500];
+    size_t NumBytesCopied;
+    size_t PayloadBytes;
+
+    BPLib_BI_Test_InitStoredBundle(&FirstBlock);
+
+    UtAssert_INT32_EQ(BPLib_BI_FragmentCopyOut(&DeserializedBundle, 600, OutputBuffer, sizeof(OutputBuffer),
+                                               &NumBytesCopied, &PayloadBytes), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(PayloadBytes, 400);
+    UtAssert_UINT32_EQ(NumBytesCopied, 440);
+
+    UtAssert_UINT32_EQ(BPLib_BI_Test_Slice.blocks.PrimaryBlock.FragmentOffset, 600);
+    UtAssert_UINT32_EQ(BPLib_BI_Test_Slice.blocks.PrimaryBlock.TotalAduLength, 1000);
+    UtAssert_UINT32_EQ(BPLib_BI_Test_Slice.blocks.PayloadHeader.DataOffsetStart, 650);
+    UtAssert_UINT32_EQ(BPLib_BI_Test_Slice.blocks.ExtBlocks[0].Header.BlockType, BPLib_BlockType_Age);
+    UtAssert_UINT32_EQ(BPLib_BI_Test_Slice.blocks.ExtBlocks[1].Header.BlockType, BPLib_BlockType_Reserved);
+}
+
+/* Test that fragmenting a fragment keeps offsets relative to the original ADU */
+void Test_BPLib_BI_FragmentCopyOut_OfFragment(void)
+{
+    BPLib_MEM_Block_t FirstBlock;
+    uint8_t OutputBuffer[500];
+    size_t NumBytesCopied;
+    size_t PayloadBytes;
+
+    BPLib_BI_Test_InitStoredBundle(&FirstBlock);
+    DeserializedBundle.blocks.PrimaryBlock.BundleProcFlags = BPLIB_BUNDLE_PROC_FRAG_FLAG;
+    DeserializedBundle.blocks.PrimaryBlock.FragmentOffset = 100;
+    DeserializedBundle.blocks.PrimaryBlock.TotalAduLength = 5000;
+
+    UtAssert_INT32_EQ(BPLib_BI_FragmentCopyOut(&DeserializedBundle, 200, OutputBuffer, sizeof(OutputBuffer),
+                                               &NumBytesCopied, &PayloadBytes), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(BPLib_BI_Test_Slice.blocks.PrimaryBlock.FragmentOffset, 300);
+    UtAssert_UINT32_EQ(BPLib_BI_Test_Slice.blocks.PrimaryBlock.TotalAduLength, 5000);
+}
+
+/* Test that no fragment is made when too little of the payload fits */
+void Test_BPLib_BI_FragmentCopyOut_NoRoom(void)
+{
+    BPLib_MEM_Block_t FirstBlock;
+    uint8_t OutputBuffer[500];
+    size_t NumBytesCopied;
+    size_t PayloadBytes;
+
+    BPLib_BI_Test_InitStoredBundle(&FirstBlock);
+
+    /* Nothing but the blocks fit */
+    UtAssert_INT32_EQ(BPLib_BI_FragmentCopyOut(&DeserializedBundle, 0, OutputBuffer, 40,
+                                               &NumBytesCopied, &PayloadBytes), BPLIB_BI_FRAG_NO_ROOM_ERR);
+
+    /* Less than BPLIB_BI_FRAG_MIN_PAYLOAD fits */
+    UtAssert_INT32_EQ(BPLib_BI_FragmentCopyOut(&DeserializedBundle, 0, OutputBuffer,
+                                               40 + BPLIB_BI_FRAG_MIN_PAYLOAD,
+                                               &NumBytesCopied, &PayloadBytes), BPLIB_BI_FRAG_NO_ROOM_ERR);
+    UtAssert_UINT32_EQ(NumBytesCopied, 0);
+    UtAssert_UINT32_EQ(PayloadBytes, 0);
+    UtAssert_STUB_COUNT(BPLib_CBOR_EncodeBundle, 2);
+
+    /* A last fragment smaller than BPLIB_BI_FRAG_MIN_PAYLOAD is fine */
+    UtAssert_INT32_EQ(BPLib_BI_FragmentCopyOut(&DeserializedBundle, 990, OutputBuffer, 60,
+                                               &NumBytesCopied, &PayloadBytes), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(PayloadBytes, 10);
+}
+
+/* Test that an encode failure is passed on */
+void Test_BPLib_BI_FragmentCopyOut_EncodeErr(void)
+{
+    BPLib_MEM_Block_t FirstBlock;
+    uint8_t OutputBuffer[500];
+    size_t NumBytesCopied;
+    size_t PayloadBytes;
+
+    BPLib_BI_Test_InitStoredBundle(&FirstBlock);
+    UT_SetDeferredRetcode(UT_KEY(BPLib_CBOR_EncodeBundle), 1, BPLIB_ERROR);
+
+    UtAssert_INT32_EQ(BPLib_BI_FragmentCopyOut(&DeserializedBundle, 0, OutputBuffer, sizeof(OutputBuffer),
+                                               &NumBytesCopied, &PayloadBytes), BPLIB_ERROR);
+    UtAssert_UINT32_EQ(PayloadBytes, 0);
+    UtAssert_STUB_COUNT(BPLib_CBOR_EncodeBundle, 1);
+}
+
+/* Test that trimming a bundle leaves the fragment holding the rest of its payload */
+void Test_BPLib_BI_FragmentTrim_Nominal(void)
+{
+    BPLib_MEM_Block_t FirstBlock;
+
+    BPLib_BI_Test_InitStoredBundle(&FirstBlock);
+
+    UtAssert_INT32_EQ(BPLib_BI_FragmentTrim(&DeserializedBundle, 600), BPLIB_SUCCESS);
+    UtAssert_BOOL_TRUE(DeserializedBundle.blocks.PrimaryBlock.BundleProcFlags & BPLIB_BUNDLE_PROC_FRAG_FLAG);
+    UtAssert_UINT32_EQ(DeserializedBundle.blocks.PrimaryBlock.FragmentOffset, 600);
+    UtAssert_UINT32_EQ(DeserializedBundle.blocks.PrimaryBlock.TotalAduLength, 1000);
+    UtAssert_UINT32_EQ(DeserializedBundle.blocks.PayloadHeader.DataOffsetStart, 650);
+    UtAssert_UINT32_EQ(DeserializedBundle.blocks.PayloadHeader.DataSize, 400);
+    UtAssert_BOOL_TRUE(DeserializedBundle.blocks.PrimaryBlock.RequiresEncode);
+    UtAssert_BOOL_TRUE(DeserializedBundle.blocks.PayloadHeader.RequiresEncode);
+    UtAssert_ADDRESS_EQ(DeserializedBundle.blob, &FirstBlock);
+}
+
+/* Test that a bundle cannot be trimmed to nothing */
+void Test_BPLib_BI_FragmentTrim_BadOffset(void)
+{
+    BPLib_MEM_Block_t FirstBlock;
+
+    UtAssert_INT32_EQ(BPLib_BI_FragmentTrim(NULL, 0), BPLIB_NULL_PTR_ERROR);
+
+    BPLib_BI_Test_InitStoredBundle(&FirstBlock);
+    UtAssert_INT32_EQ(BPLib_BI_FragmentTrim(&DeserializedBundle, 1000), BPLIB_BI_INVALID_BUNDLE_ERR);
+    UtAssert_UINT32_EQ(DeserializedBundle.blocks.PayloadHeader.DataSize, 1000);
+}
+
 void TestBplibBi_Register(void)
 {
     UtTest_Add(Test_BPLib_BI_RecvFullBundleIn_NullInputErrors, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvFullBundleIn_NullInputErrors");
@@ -465,10 +943,20 @@ void TestBplibBi_Register(void)
     UtTest_Add(Test_BPLib_BI_RecvFullBundleIn_HopErr, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvFullBundleIn_HopErr");
     UtTest_Add(Test_BPLib_BI_RecvFullBundleIn_BlkErr, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvFullBundleIn_BlkErr");
     UtTest_Add(Test_BPLib_BI_RecvFullBundleIn_Nominal, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvFullBundleIn_Nominal");
+    UtTest_Add(Test_BPLib_BI_RecvFullBundleIn_SourceCounted, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvFullBundleIn_SourceCounted");
     UtTest_Add(Test_BPLib_BI_RecvFullBundleIn_Invalid, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvFullBundleIn_Invalid");
     UtTest_Add(Test_BPLib_BI_RecvFullBundleIn_JobFail, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvFullBundleIn_JobFail");
     UtTest_Add(Test_BPLib_BI_RecvFullBundleIn_IdErr, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvFullBundleIn_IdErr");
     UtTest_Add(Test_BPLib_BI_RecvFullBundleIn_ExpireErr, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvFullBundleIn_ExpireErr");
+    UtTest_Add(Test_BPLib_BI_RecvFullBundleIn_Duplicate, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvFullBundleIn_Duplicate");
+    UtTest_Add(Test_BPLib_BI_RecvFullBundleIn_DuplicateNotStored, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvFullBundleIn_DuplicateNotStored");
+    UtTest_Add(Test_BPLib_BI_RecvFullBundleIn_JobFailForgetsDuplicate, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvFullBundleIn_JobFailForgetsDuplicate");
+    UtTest_Add(Test_BPLib_BI_RecvFullBundleIn_JobFailForgetsAtAddTime, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvFullBundleIn_JobFailForgetsAtAddTime");
+    UtTest_Add(Test_BPLib_BI_RecvBundlesIn_InputErrors, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvBundlesIn_InputErrors");
+    UtTest_Add(Test_BPLib_BI_RecvBundlesIn_Nominal, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvBundlesIn_Nominal");
+    UtTest_Add(Test_BPLib_BI_RecvBundlesIn_DecodeErr, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvBundlesIn_DecodeErr");
+    UtTest_Add(Test_BPLib_BI_RecvBundlesIn_JobFail, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvBundlesIn_JobFail");
+    UtTest_Add(Test_BPLib_BI_RecvBundlesIn_Duplicate, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvBundlesIn_Duplicate");
     UtTest_Add(Test_BPLib_BI_RecvCtrlMsg_Nominal, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_RecvCtrlMsg_Nominal");
 
     UtTest_Add(Test_BPLib_BI_ValidateBundle_Null, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_ValidateBundle_Null");
@@ -481,10 +969,22 @@ void TestBplibBi_Register(void)
     UtTest_Add(Test_BPLib_BI_ValidateBundle_Expired, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_ValidateBundle_Expired");
     UtTest_Add(Test_BPLib_BI_ValidateBundle_PayloadNumErr, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_ValidateBundle_PayloadNumErr");
     UtTest_Add(Test_BPLib_BI_ValidateBundle_BlockNumErr, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_ValidateBundle_BlockNumErr");
+    UtTest_Add(Test_BPLib_BI_ValidateBundle_FragmentErr, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_ValidateBundle_FragmentErr");
 
     UtTest_Add(Test_BPLib_BI_BlobCopyOut_InputBundleNullError, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_BlobCopyOut_InputBundleNullError");
     UtTest_Add(Test_BPLib_BI_BlobCopyOut_InputBundleBlobNullError, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_BlobCopyOut_InputBundleBlobNullError");
     UtTest_Add(Test_BPLib_BI_BlobCopyOut_OutputBundleBufNullError, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_BlobCopyOut_OutputBundleBufNullError");
     UtTest_Add(Test_BPLib_BI_BlobCopyOut_OutputSizeBufNullError, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_BlobCopyOut_OutputSizeBufNullError");
     UtTest_Add(Test_BPLib_BI_BlobCopyOut_Nominal, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_BlobCopyOut_Nominal");
+
+    UtTest_Add(Test_BPLib_BI_FragmentCopyOut_Null, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_FragmentCopyOut_Null");
+    UtTest_Add(Test_BPLib_BI_FragmentCopyOut_BadOffset, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_FragmentCopyOut_BadOffset");
+    UtTest_Add(Test_BPLib_BI_FragmentCopyOut_First, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_FragmentCopyOut_First");
+    UtTest_Add(Test_BPLib_BI_FragmentCopyOut_Last, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_FragmentCopyOut_Last");
+    UtTest_Add(Test_BPLib_BI_FragmentCopyOut_OfFragment, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_FragmentCopyOut_OfFragment");
+    UtTest_Add(Test_BPLib_BI_FragmentCopyOut_NoRoom, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_FragmentCopyOut_NoRoom");
+    UtTest_Add(Test_BPLib_BI_FragmentCopyOut_EncodeErr, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_FragmentCopyOut_EncodeErr");
+
+    UtTest_Add(Test_BPLib_BI_FragmentTrim_Nominal, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_FragmentTrim_Nominal");
+    UtTest_Add(Test_BPLib_BI_FragmentTrim_BadOffset, BPLib_BI_Test_Setup, BPLib_BI_Test_Teardown, "Test_BPLib_BI_FragmentTrim_BadOffset");
 }
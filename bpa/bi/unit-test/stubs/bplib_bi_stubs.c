@@ -47,6 +47,67 @@ BPLib_Status_t BPLib_BI_BlobCopyOut(BPLib_Bundle_t *StoredBundle, void *OutputBu
     return UT_GenStub_GetReturnValue(BPLib_BI_BlobCopyOut, BPLib_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_BI_FragmentCopyOut()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_BI_FragmentCopyOut(BPLib_Bundle_t *StoredBundle, size_t PayloadOffset, void *OutputBuffer,
+                                        size_t OutputBufferSize, size_t *NumBytesCopied, size_t *PayloadBytes)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_BI_FragmentCopyOut, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_BI_FragmentCopyOut, BPLib_Bundle_t *, StoredBundle);
+    UT_GenStub_AddParam(BPLib_BI_FragmentCopyOut, size_t, PayloadOffset);
+    UT_GenStub_AddParam(BPLib_BI_FragmentCopyOut, void *, OutputBuffer);
+    UT_GenStub_AddParam(BPLib_BI_FragmentCopyOut, size_t, OutputBufferSize);
+    UT_GenStub_AddParam(BPLib_BI_FragmentCopyOut, size_t *, NumBytesCopied);
+    UT_GenStub_AddParam(BPLib_BI_FragmentCopyOut, size_t *, PayloadBytes);
+
+    UT_GenStub_Execute(BPLib_BI_FragmentCopyOut, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_BI_FragmentCopyOut, BPLib_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_BI_FragmentTrim()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_BI_FragmentTrim(BPLib_Bundle_t *Bundle, size_t PayloadOffset)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_BI_FragmentTrim, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_BI_FragmentTrim, BPLib_Bundle_t *, Bundle);
+    UT_GenStub_AddParam(BPLib_BI_FragmentTrim, size_t, PayloadOffset);
+
+    UT_GenStub_Execute(BPLib_BI_FragmentTrim, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_BI_FragmentTrim, BPLib_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_BI_RecvBundlesIn()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_BI_RecvBundlesIn(BPLib_Instance_t *Inst, const void *const *BundlesIn, const size_t *Sizes,
+                                      uint32_t NumBundles, uint32_t ContId, BPLib_Status_t *Statuses)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_BI_RecvBundlesIn, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_BI_RecvBundlesIn, BPLib_Instance_t *, Inst);
+    UT_GenStub_AddParam(BPLib_BI_RecvBundlesIn, const void *const *, BundlesIn);
+    UT_GenStub_AddParam(BPLib_BI_RecvBundlesIn, const size_t *, Sizes);
+    UT_GenStub_AddParam(BPLib_BI_RecvBundlesIn, uint32_t, NumBundles);
+    UT_GenStub_AddParam(BPLib_BI_RecvBundlesIn, uint32_t, ContId);
+    UT_GenStub_AddParam(BPLib_BI_RecvBundlesIn, BPLib_Status_t *, Statuses);
+
+    UT_GenStub_Execute(BPLib_BI_RecvBundlesIn, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_BI_RecvBundlesIn, BPLib_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_BI_RecvCtrlMsg()
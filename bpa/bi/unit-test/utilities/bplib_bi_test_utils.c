@@ -24,6 +24,7 @@
 
 #include "bplib_bi_test_utils.h"
 #include "bplib_time_handlers.h"
+#include "bplib_bi_internal.h"
 
 /*
 ** Global Data
@@ -52,7 +53,9 @@ void BPLib_BI_Test_Setup(void)
     DeserializedBundle.blocks.ExtBlocks[2].Header.BlockNum = 4;
     DeserializedBundle.blocks.ExtBlocks[3].Header.BlockType = BPLib_BlockType_Reserved;
 
-    UT_SetHandlerFunction(UT_KEY(BPLib_AS_Increment), UT_Handler_BPLib_AS_Increment, NULL);
+    UT_SetHandlerFunction(UT_KEY(BPLib_AS_IncrementSlot), UT_Handler_BPLib_AS_IncrementSlot, NULL);
+
+    BPLib_BI_DupFilterReset();
 }
 
 void BPLib_BI_Test_Teardown(void)
@@ -63,4 +66,5 @@ void BPLib_BI_Test_Teardown(void)
 void UtTest_Setup(void)
 {
     TestBplibBi_Register();
+    TestBplibBiInternal_Register();
 }
@@ -49,5 +49,6 @@ void BPLib_BI_Test_Setup(void);
 void BPLib_BI_Test_Teardown(void);
 
 void TestBplibBi_Register(void);
+void TestBplibBiInternal_Register(void);
 
 #endif /* BPLIB_BI_TEST_UTILS_H */
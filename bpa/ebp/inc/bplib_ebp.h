@@ -35,6 +35,9 @@
 
 BPLib_Status_t BPLib_EBP_InitializeExtensionBlocks(BPLib_Bundle_t *Bundle, uint32_t ChanId);
 
+/* Same as BPLib_EBP_InitializeExtensionBlocks, for callers already holding the NC lock */
+BPLib_Status_t BPLib_EBP_InitializeExtensionBlocksUnlocked(BPLib_BBlocks_t *Blocks, uint32_t ChanId);
+
 BPLib_Status_t BPLib_EBP_UpdateExtensionBlocks(BPLib_Bundle_t *Bundle);
 
 #endif /* BPLIB_EBP_H */
@@ -31,11 +31,27 @@
 */
 
 BPLib_Status_t BPLib_EBP_InitializeExtensionBlocks(BPLib_Bundle_t *Bundle, uint32_t ChanId)
+{
+    BPLib_Status_t Status;
+
+    if (Bundle == NULL)
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    BPLib_NC_ReaderLock();
+    Status = BPLib_EBP_InitializeExtensionBlocksUnlocked(&Bundle->blocks, ChanId);
+    BPLib_NC_ReaderUnlock();
+
+    return Status;
+}
+
+BPLib_Status_t BPLib_EBP_InitializeExtensionBlocksUnlocked(BPLib_BBlocks_t *Blocks, uint32_t ChanId)
 {
     BPLib_PI_Config_t *CurrCanonConfig;
     uint8_t CurrExtBlkIdx = 0;
 
-    if (Bundle == NULL)
+    if (Blocks == NULL)
     {
         return BPLIB_NULL_PTR_ERROR;
     }
@@ -45,32 +61,30 @@ BPLib_Status_t BPLib_EBP_InitializeExtensionBlocks(BPLib_Bundle_t *Bundle, uint3
         return BPLIB_INVALID_CHAN_ID_ERR;
     }
 
-    BPLib_NC_ReaderLock();
-
     CurrCanonConfig = &BPLib_NC_ConfigPtrs.ChanConfigPtr->Configs[ChanId];
 
     /* Initialize previous node block */
     if (CurrCanonConfig->PrevNodeBlkConfig.IncludeBlock)
     {
-        Bundle->blocks.ExtBlocks[CurrExtBlkIdx].Header.BlockType = BPLib_BlockType_PrevNode;
-        Bundle->blocks.ExtBlocks[CurrExtBlkIdx].Header.CrcType = CurrCanonConfig->PrevNodeBlkConfig.CrcType;
-        Bundle->blocks.ExtBlocks[CurrExtBlkIdx].Header.BlockNum = CurrCanonConfig->PrevNodeBlkConfig.BlockNum;
-        Bundle->blocks.ExtBlocks[CurrExtBlkIdx].Header.BlockProcFlags = CurrCanonConfig->PrevNodeBlkConfig.BlockProcFlags;        
+        Blocks->ExtBlocks[CurrExtBlkIdx].Header.BlockType = BPLib_BlockType_PrevNode;
+        Blocks->ExtBlocks[CurrExtBlkIdx].Header.CrcType = CurrCanonConfig->PrevNodeBlkConfig.CrcType;
+        Blocks->ExtBlocks[CurrExtBlkIdx].Header.BlockNum = CurrCanonConfig->PrevNodeBlkConfig.BlockNum;
+        Blocks->ExtBlocks[CurrExtBlkIdx].Header.BlockProcFlags = CurrCanonConfig->PrevNodeBlkConfig.BlockProcFlags;        
 
-        Bundle->blocks.ExtBlocks[CurrExtBlkIdx].Header.RequiresEncode = true;
+        Blocks->ExtBlocks[CurrExtBlkIdx].Header.RequiresEncode = true;
 
         CurrExtBlkIdx++;
     }
 
     /* Initialize age block */
-    if (CurrCanonConfig->AgeBlkConfig.IncludeBlock || Bundle->blocks.PrimaryBlock.Timestamp.CreateTime == 0)
+    if (CurrCanonConfig->AgeBlkConfig.IncludeBlock || Blocks->PrimaryBlock.Timestamp.CreateTime == 0)
     {
-        Bundle->blocks.ExtBlocks[CurrExtBlkIdx].Header.BlockType = BPLib_BlockType_Age;
-        Bundle->blocks.ExtBlocks[CurrExtBlkIdx].Header.CrcType = CurrCanonConfig->AgeBlkConfig.CrcType;
-        Bundle->blocks.ExtBlocks[CurrExtBlkIdx].Header.BlockNum = CurrCanonConfig->AgeBlkConfig.BlockNum;
-        Bundle->blocks.ExtBlocks[CurrExtBlkIdx].Header.BlockProcFlags = CurrCanonConfig->AgeBlkConfig.BlockProcFlags;          
+        Blocks->ExtBlocks[CurrExtBlkIdx].Header.BlockType = BPLib_BlockType_Age;
+        Blocks->ExtBlocks[CurrExtBlkIdx].Header.CrcType = CurrCanonConfig->AgeBlkConfig.CrcType;
+        Blocks->ExtBlocks[CurrExtBlkIdx].Header.BlockNum = CurrCanonConfig->AgeBlkConfig.BlockNum;
+        Blocks->ExtBlocks[CurrExtBlkIdx].Header.BlockProcFlags = CurrCanonConfig->AgeBlkConfig.BlockProcFlags;          
 
-        Bundle->blocks.ExtBlocks[CurrExtBlkIdx].Header.RequiresEncode = true;
+        Blocks->ExtBlocks[CurrExtBlkIdx].Header.RequiresEncode = true;
 
         CurrExtBlkIdx++;
     }
@@ -78,20 +92,18 @@ BPLib_Status_t BPLib_EBP_InitializeExtensionBlocks(BPLib_Bundle_t *Bundle, uint3
     /* Initialize hop count block */
     if (CurrCanonConfig->HopCountBlkConfig.IncludeBlock)
     {
-        Bundle->blocks.ExtBlocks[CurrExtBlkIdx].Header.BlockType = BPLib_BlockType_HopCount;
-        Bundle->blocks.ExtBlocks[CurrExtBlkIdx].Header.CrcType = CurrCanonConfig->HopCountBlkConfig.CrcType;
-        Bundle->blocks.ExtBlocks[CurrExtBlkIdx].Header.BlockNum = CurrCanonConfig->HopCountBlkConfig.BlockNum;
-        Bundle->blocks.ExtBlocks[CurrExtBlkIdx].Header.BlockProcFlags = CurrCanonConfig->HopCountBlkConfig.BlockProcFlags;
+        Blocks->ExtBlocks[CurrExtBlkIdx].Header.BlockType = BPLib_BlockType_HopCount;
+        Blocks->ExtBlocks[CurrExtBlkIdx].Header.CrcType = CurrCanonConfig->HopCountBlkConfig.CrcType;
+        Blocks->ExtBlocks[CurrExtBlkIdx].Header.BlockNum = CurrCanonConfig->HopCountBlkConfig.BlockNum;
+        Blocks->ExtBlocks[CurrExtBlkIdx].Header.BlockProcFlags = CurrCanonConfig->HopCountBlkConfig.BlockProcFlags;
 
-        Bundle->blocks.ExtBlocks[CurrExtBlkIdx].Header.RequiresEncode = true;
+        Blocks->ExtBlocks[CurrExtBlkIdx].Header.RequiresEncode = true;
 
-        Bundle->blocks.ExtBlocks[CurrExtBlkIdx].BlockData.HopCountData.HopLimit = CurrCanonConfig->HopLimit;
+        Blocks->ExtBlocks[CurrExtBlkIdx].BlockData.HopCountData.HopLimit = CurrCanonConfig->HopLimit;
 
         CurrExtBlkIdx++;
     }
 
-    BPLib_NC_ReaderUnlock();
-
     return BPLIB_SUCCESS;
 }
 
@@ -33,6 +33,13 @@ void Test_BPLib_EBP_InitBlocks_Null(void)
     UtAssert_INT32_EQ(Status, BPLIB_NULL_PTR_ERROR);
 }
 
+/* Test that unlocked block initialization fails when the blocks are null */
+void Test_BPLib_EBP_InitBlocksUnlocked_Null(void)
+{
+    UtAssert_INT32_EQ(BPLib_EBP_InitializeExtensionBlocksUnlocked(NULL, 0), BPLIB_NULL_PTR_ERROR);
+    UtAssert_STUB_COUNT(BPLib_NC_ReaderLock, 0);
+}
+
 /* Test that block initialization fails when channel ID is invalid */
 void Test_BPLib_EBP_InitBlocks_ChanIdErr(void)
 {
@@ -240,6 +247,7 @@ void Test_BPLib_EBP_UpdateBlocks_PrevNode(void)
 void TestBplibEbp_Register(void)
 {
     ADD_TEST(Test_BPLib_EBP_InitBlocks_Null);
+    ADD_TEST(Test_BPLib_EBP_InitBlocksUnlocked_Null);
     ADD_TEST(Test_BPLib_EBP_InitBlocks_ChanIdErr);
     ADD_TEST(Test_BPLib_EBP_InitBlocks_PrevNode);
     ADD_TEST(Test_BPLib_EBP_InitBlocks_AgeCfg);
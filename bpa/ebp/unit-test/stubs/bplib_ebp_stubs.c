@@ -44,6 +44,23 @@ BPLib_Status_t BPLib_EBP_InitializeExtensionBlocks(BPLib_Bundle_t *Bundle, uint3
     return UT_GenStub_GetReturnValue(BPLib_EBP_InitializeExtensionBlocks, BPLib_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_EBP_InitializeExtensionBlocksUnlocked()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_EBP_InitializeExtensionBlocksUnlocked(BPLib_BBlocks_t *Blocks, uint32_t ChanId)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_EBP_InitializeExtensionBlocksUnlocked, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_EBP_InitializeExtensionBlocksUnlocked, BPLib_BBlocks_t *, Blocks);
+    UT_GenStub_AddParam(BPLib_EBP_InitializeExtensionBlocksUnlocked, uint32_t, ChanId);
+
+    UT_GenStub_Execute(BPLib_EBP_InitializeExtensionBlocksUnlocked, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_EBP_InitializeExtensionBlocksUnlocked, BPLib_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_EBP_UpdateExtensionBlocks()
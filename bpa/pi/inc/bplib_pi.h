@@ -92,6 +92,21 @@ typedef struct
     BPLib_PI_Config_t Configs[BPLIB_MAX_NUM_CHANNELS];
 } BPLib_PI_ChannelTable_t;
 
+/**
+** \brief Per-channel bundle template
+**
+** \par Description
+**      The block metadata that BPLib_PI_Ingress would otherwise rebuild from the
+**      channel configuration for every ADU. Only the creation timestamp, sequence
+**      number and payload size are filled in per bundle.
+*/
+typedef struct
+{
+    BPLib_BBlocks_t Blocks;    /** \brief Primary, extension and payload block metadata */
+    bool            Valid;     /** \brief Template was built from the current channel table */
+    bool            HasAgeBlk; /** \brief Template already includes an age block */
+} BPLib_PI_Template_t;
+
 
 /*
 ** Exported Functions
@@ -101,8 +116,9 @@ typedef struct
  * \brief Add Application
  *
  *  \par Description
- *       Run add-application directive operations by updating the app state and
- *       calling the relevant framework proxy function
+ *       Run add-application directive operations by updating the app state,
+ *       setting up the channel's delivery rate shaping, and calling the relevant
+ *       framework proxy function
  *
  *  \par Assumptions, External Events, and Notes:
  *       None
@@ -166,6 +182,20 @@ BPLib_Status_t BPLib_PI_StopApplication(uint32_t ChanId);
  */
 BPLib_Status_t BPLib_PI_RemoveApplication(BPLib_Instance_t *Inst, uint32_t ChanId);
 
+/**
+ * \brief Refresh bundle templates
+ *
+ *  \par Description
+ *       Rebuild the bundle template of every channel from the channel configuration table
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       - The caller must hold the NC lock. NC calls this at initialization and every
+ *         time a new channel table is loaded.
+ *       - If the channel table is not available, the templates are invalidated and
+ *         BPLib_PI_Ingress builds each bundle from the configuration directly.
+ */
+void BPLib_PI_RefreshTemplates(void);
+
 /**
  * \brief Validate configurations
  *
@@ -200,6 +230,8 @@ BPLib_Status_t BPLib_PI_ValidateConfigs(void *TblData);
  *
  *  \return Execution status
  *  \retval BPLIB_SUCCESS Operation was successful
+ *  \retval BPLIB_MEM_POOL_CONGESTED The ADU was shed because the memory pool is above
+ *          its high watermark
  */
 BPLib_Status_t BPLib_PI_Ingress(BPLib_Instance_t *Inst, uint32_t ChanId, 
                                                         void *AduPtr, size_t AduSize);
@@ -211,7 +243,10 @@ BPLib_Status_t BPLib_PI_Ingress(BPLib_Instance_t *Inst, uint32_t ChanId,
  *       PI pulls an ADU off the relevant channel out queue to return to calling function
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       A channel with a nonzero EgressBitsPerCycle has its ADUs delivered no faster than
+ *       that rate, waiting up to Timeout for the rate to allow the next one. A bundle
+ *       fragment is held for reassembly and its ADU is returned once every fragment has
+ *       arrived. A held fragment with no ADU to return yet returns BPLIB_PI_TIMEOUT.
  *
  *  \param[in] Inst Pointer to an the BPLib instance state struct
  *  \param[in] ChanId Channel ID
@@ -222,9 +257,30 @@ BPLib_Status_t BPLib_PI_Ingress(BPLib_Instance_t *Inst, uint32_t ChanId,
  *
  *  \return Execution status
  *  \retval BPLIB_SUCCESS Operation was successful
+ *  \retval BPLIB_PI_TIMEOUT No ADU was ready before Timeout
+ *  \retval BPLIB_BI_FRAGMENT_ERR A fragment could not be held for reassembly and was dropped
  */
 BPLib_Status_t BPLib_PI_Egress(BPLib_Instance_t *Inst, uint32_t ChanId, void *AduPtr, 
                                     size_t *AduSize, size_t BufLen, uint32_t Timeout);
 
+/**
+ * \brief Expire Reassembly
+ *
+ *  \par Description
+ *       Drops every bundle held for reassembly whose missing fragments have not arrived
+ *       within BPLIB_PI_REASM_TIMEOUT_MS
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Meant to be called periodically, alongside the other maintenance of the instance,
+ *       so held fragments time out even when no further fragments are delivered
+ *
+ *  \param[in] Inst Pointer to an the BPLib instance state struct
+ *
+ *  \return Execution status
+ *  \retval BPLIB_SUCCESS Operation was successful
+ *  \retval BPLIB_NULL_PTR_ERROR Inst is NULL
+ */
+BPLib_Status_t BPLib_PI_ExpireReassembly(BPLib_Instance_t *Inst);
+
                                     
 #endif /* BPLIB_PI_H */
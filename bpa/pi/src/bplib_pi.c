@@ -29,24 +29,60 @@
 */
 
 #include "bplib_pi.h"
+#include "bplib_pi_internal.h"
 #include "bplib_mem.h"
 #include "bplib_fwp.h"
 #include "bplib_nc.h"
 #include "bplib_ebp.h"
 #include "bplib_stor.h"
 #include "bplib_cbor.h"
+#include "bplib_pl.h"
 #include <stdio.h>
+#include <string.h>
 
 /* 
 ** Global Data 
 */
 
-uint64_t      BPLib_PI_SequenceNums[BPLIB_MAX_NUM_CHANNELS];
+uint64_t            BPLib_PI_SequenceNums[BPLIB_MAX_NUM_CHANNELS];
+BPLib_PI_Template_t BPLib_PI_Templates[BPLIB_MAX_NUM_CHANNELS];
+
+/* Delivery rate of each channel, set up from EgressBitsPerCycle */
+static BPLib_TIME_Shaper_t BPLib_PI_EgressShapers[BPLIB_MAX_NUM_CHANNELS];
 
 /*
 ** Internal Function Definitions
 */
 
+/* Populate the per-channel block metadata, caller must hold the NC lock */
+static void BPLib_PI_InitBlocks(BPLib_BBlocks_t *Blocks, uint32_t ChanId)
+{
+    BPLib_PI_Config_t *CurrCanonConfig = &BPLib_NC_ConfigPtrs.ChanConfigPtr->Configs[ChanId];
+
+    /* Mark the primary block as "dirty" */
+    Blocks->PrimaryBlock.RequiresEncode = true;
+
+    /* Set primary block based on channel table configurations */
+    BPLib_EID_CopyEids(&(Blocks->PrimaryBlock.DestEID), CurrCanonConfig->DestEID);
+    BPLib_EID_CopyEids(&(Blocks->PrimaryBlock.ReportToEID), CurrCanonConfig->ReportToEID);
+    BPLib_EID_CopyEids(&(Blocks->PrimaryBlock.SrcEID), BPLIB_EID_INSTANCE);
+    Blocks->PrimaryBlock.SrcEID.Service = CurrCanonConfig->LocalServiceNumber;
+
+    Blocks->PrimaryBlock.BundleProcFlags = CurrCanonConfig->BundleProcFlags;
+    Blocks->PrimaryBlock.CrcType = CurrCanonConfig->CrcType;
+    Blocks->PrimaryBlock.Lifetime = CurrCanonConfig->Lifetime;
+
+    /* Initialize payload block */
+    Blocks->PayloadHeader.BlockType = BPLib_BlockType_Payload;
+    Blocks->PayloadHeader.CrcType = CurrCanonConfig->PayloadBlkConfig.CrcType;
+    Blocks->PayloadHeader.BlockNum = 1;
+    Blocks->PayloadHeader.BlockProcFlags = CurrCanonConfig->PayloadBlkConfig.BlockProcFlags;    
+
+    /* Fill out the rest of the payload block metadata */
+    Blocks->PayloadHeader.RequiresEncode = true;
+    Blocks->PayloadHeader.DataOffsetStart = 0;
+}
+
 /* Validate general canonical block configurations */
 BPLib_Status_t BPLib_PI_ValidateCanBlkConfig(BPLib_PI_CanBlkConfig_t *CanBlkConfig, 
                                                 uint32_t *BlockNums, uint8_t *BlockNumsInArr)
@@ -103,6 +139,7 @@ BPLib_Status_t BPLib_PI_AddApplication(uint32_t ChanId)
 {
     BPLib_NC_ApplicationState_t AppState;
     BPLib_Status_t Status = BPLIB_SUCCESS;
+    size_t EgressBitsPerCycle;
 
     /* Check for channel ID validity */
     if (ChanId >= BPLIB_MAX_NUM_CHANNELS)
@@ -128,6 +165,13 @@ BPLib_Status_t BPLib_PI_AddApplication(uint32_t ChanId)
     /* Initialize sequence number */
     BPLib_PI_SequenceNums[ChanId] = 0;
 
+    /* Shape delivery to the channel's configured rate */
+    BPLib_NC_ReaderLock();
+    EgressBitsPerCycle = BPLib_NC_ConfigPtrs.ChanConfigPtr->Configs[ChanId].EgressBitsPerCycle;
+    BPLib_NC_ReaderUnlock();
+
+    BPLib_TIME_ShaperInit(&BPLib_PI_EgressShapers[ChanId], EgressBitsPerCycle, BPLib_TIME_GetMonotonicTime());
+
     /* Do any framework-specific operations */
     Status = BPLib_FWP_ProxyCallbacks.BPA_ADUP_AddApplication(ChanId);
     if (Status == BPLIB_SUCCESS)
@@ -276,14 +320,17 @@ BPLib_Status_t BPLib_PI_RemoveApplication(BPLib_Instance_t *Inst, uint32_t ChanI
                                 Status, ChanId);
 
             /* Bundle is effectively getting dropped */
-            BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DELETED, 1);
-            BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DISCARDED, 1);
+            BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DELETED, 1);
+            BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DISCARDED, 1);
 
             /* This is still considered a successful directive just with some bundle loss */
             Status = BPLIB_SUCCESS;
         }
     }
 
+    /* Fragments held for reassembly can no longer be delivered */
+    BPLib_PI_ReasmFlush(Inst, ChanId);
+
     /* Reset sequence number */
     BPLib_PI_SequenceNums[ChanId] = 0;
     
@@ -399,12 +446,53 @@ BPLib_Status_t BPLib_PI_ValidateConfigs(void *TblData)
     return BPLIB_SUCCESS;
 }
 
+/* Rebuild the bundle templates from the channel table */
+void BPLib_PI_RefreshTemplates(void)
+{
+    uint32_t ChanId;
+    uint32_t ExtBlkIdx;
+    BPLib_PI_Template_t *Template;
+
+    for (ChanId = 0; ChanId < BPLIB_MAX_NUM_CHANNELS; ChanId++)
+    {
+        Template = &BPLib_PI_Templates[ChanId];
+        memset(Template, 0, sizeof(BPLib_PI_Template_t));
+
+        if (BPLib_NC_ConfigPtrs.ChanConfigPtr == NULL)
+        {
+            continue;
+        }
+
+        BPLib_PI_InitBlocks(&Template->Blocks, ChanId);
+
+        /* 
+        ** Build the extension blocks for a bundle with a valid DTN creation time. Bundles
+        ** created without one need an age block, which ingress adds when the template
+        ** does not already include it
+        */
+        Template->Blocks.PrimaryBlock.Timestamp.CreateTime = 1;
+        (void) BPLib_EBP_InitializeExtensionBlocksUnlocked(&Template->Blocks, ChanId);
+        Template->Blocks.PrimaryBlock.Timestamp.CreateTime = 0;
+
+        for (ExtBlkIdx = 0; ExtBlkIdx < BPLIB_MAX_NUM_EXTENSION_BLOCKS; ExtBlkIdx++)
+        {
+            if (Template->Blocks.ExtBlocks[ExtBlkIdx].Header.BlockType == BPLib_BlockType_Age)
+            {
+                Template->HasAgeBlk = true;
+            }
+        }
+
+        Template->Valid = true;
+    }
+}
+
 /* Ingress an ADU */
 BPLib_Status_t BPLib_PI_Ingress(BPLib_Instance_t* Inst, uint32_t ChanId, 
                                                             void *AduPtr, size_t AduSize)
 {
     BPLib_Bundle_t *NewBundle;
-    BPLib_PI_Config_t *CurrCanonConfig;
+    BPLib_PI_Template_t *Template;
+    BPLib_AS_Slot_t SrcSlot = BPLIB_AS_INVALID_SLOT;
     BPLib_Status_t Status = BPLIB_SUCCESS;
 
     /* Channel ID must be within array index limits */
@@ -421,8 +509,15 @@ BPLib_Status_t BPLib_PI_Ingress(BPLib_Instance_t* Inst, uint32_t ChanId,
         return BPLIB_NULL_PTR_ERROR;
     }
 
+    /* Shed new ADUs early while the pool is above its high watermark */
+    if (BPLib_MEM_PoolIsCongested(&Inst->pool))
+    {
+        BPLib_NC_ReaderUnlock();
+        return BPLIB_MEM_POOL_CONGESTED;
+    }
+
     /* Indicate ADU reception */
-    BPLib_AS_Increment(BPLIB_EID_INSTANCE, ADU_COUNT_RECEIVED, 1);
+    BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, ADU_COUNT_RECEIVED, 1);
 
     /* Allocate Bundle based on AduSize */
     NewBundle = BPLib_MEM_BundleAlloc(&Inst->pool, (const void*)AduPtr, AduSize);
@@ -432,20 +527,17 @@ BPLib_Status_t BPLib_PI_Ingress(BPLib_Instance_t* Inst, uint32_t ChanId,
     }
     else
     {
-        /* Mark the primary block as "dirty" */
-        NewBundle->blocks.PrimaryBlock.RequiresEncode = true;
-
-        CurrCanonConfig = &BPLib_NC_ConfigPtrs.ChanConfigPtr->Configs[ChanId];
+        Template = &BPLib_PI_Templates[ChanId];
 
-        /* Set primary block based on channel table configurations */
-        BPLib_EID_CopyEids(&(NewBundle->blocks.PrimaryBlock.DestEID), CurrCanonConfig->DestEID);
-        BPLib_EID_CopyEids(&(NewBundle->blocks.PrimaryBlock.ReportToEID), CurrCanonConfig->ReportToEID);
-        BPLib_EID_CopyEids(&(NewBundle->blocks.PrimaryBlock.SrcEID), BPLIB_EID_INSTANCE);
-        NewBundle->blocks.PrimaryBlock.SrcEID.Service = CurrCanonConfig->LocalServiceNumber;
-
-        NewBundle->blocks.PrimaryBlock.BundleProcFlags = CurrCanonConfig->BundleProcFlags;
-        NewBundle->blocks.PrimaryBlock.CrcType = CurrCanonConfig->CrcType;
-        NewBundle->blocks.PrimaryBlock.Lifetime = CurrCanonConfig->Lifetime;
+        /* Start from the channel's template, or build the blocks if there is none */
+        if (Template->Valid)
+        {
+            memcpy(&NewBundle->blocks, &Template->Blocks, sizeof(BPLib_BBlocks_t));
+        }
+        else
+        {
+            BPLib_PI_InitBlocks(&NewBundle->blocks, ChanId);
+        }
 
         /* 
         ** Try to set creation timestamp. If no valid DTN time can be found, the CreateTime
@@ -464,31 +556,35 @@ BPLib_Status_t BPLib_PI_Ingress(BPLib_Instance_t* Inst, uint32_t ChanId,
             BPLib_PI_SequenceNums[ChanId] = 0;
         }
 
-        /* Initialize payload block */
-        NewBundle->blocks.PayloadHeader.BlockType = BPLib_BlockType_Payload;
-        NewBundle->blocks.PayloadHeader.CrcType = CurrCanonConfig->PayloadBlkConfig.CrcType;
-        NewBundle->blocks.PayloadHeader.BlockNum = 1;
-        NewBundle->blocks.PayloadHeader.BlockProcFlags = CurrCanonConfig->PayloadBlkConfig.BlockProcFlags;    
-
-        /* Fill out the rest of the payload block metadata */
-        NewBundle->blocks.PayloadHeader.RequiresEncode = true;
-        NewBundle->blocks.PayloadHeader.DataOffsetStart = 0;
         NewBundle->blocks.PayloadHeader.DataSize = AduSize;
 
-        /* Initialize the extension block data - parameters have been validated, ignore return code */
-        (void) BPLib_EBP_InitializeExtensionBlocks(NewBundle, ChanId);
+        /* 
+        ** Initialize the extension block data unless the template already covers it. 
+        ** Parameters have been validated, ignore return code
+        */
+        if (!Template->Valid || 
+            (NewBundle->blocks.PrimaryBlock.Timestamp.CreateTime == 0 && !Template->HasAgeBlk))
+        {
+            (void) BPLib_EBP_InitializeExtensionBlocks(NewBundle, ChanId);
+        }
+
+        /* The bundle belongs to the queue once the job is created */
+        SrcSlot = BPLib_AS_ResolveSourceSlot(&NewBundle->blocks.PrimaryBlock.SrcEID);
 
         Status = BPLib_QM_CreateJob(Inst, NewBundle, CHANNEL_IN_PI_TO_EBP, QM_PRI_NORMAL, QM_WAIT_FOREVER);
     }
 
     if (Status == BPLIB_SUCCESS)
     {
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_GENERATED_ACCEPTED, 1);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_GENERATED_ACCEPTED, 1);
+        BPLib_AS_IncrementSlot(SrcSlot, ADU_COUNT_RECEIVED, 1);
+        BPLib_AS_IncrementSlot(SrcSlot, BUNDLE_COUNT_GENERATED_ACCEPTED, 1);
+        BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_INGESTED, ChanId, AduSize);
     }
     else 
     {
         BPLib_MEM_BundleFree(&Inst->pool, NewBundle);
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_GENERATED_REJECTED, 1);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_GENERATED_REJECTED, 1);
         BPLib_EM_SendEvent(BPLIB_PI_INGRESS_ERR_EID, BPLib_EM_EventType_ERROR,
             "[ADU In #%d]: Failed to ingress an ADU. Error = %d.",
             ChanId, Status);
@@ -504,6 +600,7 @@ BPLib_Status_t BPLib_PI_Egress(BPLib_Instance_t *Inst, uint32_t ChanId, void *Ad
                                     size_t *AduSize, size_t BufLen, uint32_t Timeout)
 {
     BPLib_Bundle_t    *Bundle = NULL;
+    BPLib_AS_Slot_t    SrcSlot = BPLIB_AS_INVALID_SLOT;
     BPLib_Status_t     Status;
 
     /* Null checks */
@@ -518,9 +615,52 @@ BPLib_Status_t BPLib_PI_Egress(BPLib_Instance_t *Inst, uint32_t ChanId, void *Ad
     }
     *AduSize = 0;
 
-    /* Get the next bundle in the channel egress queue */
-    Status = BPLib_QM_DuctPull(Inst, ChanId, true, Timeout, &Bundle);
+    /* Hold off until the channel's delivery rate allows another ADU, then get the next
+    ** bundle in the channel egress queue
+    */
+    Status = BPLib_TIME_ShaperWait(&BPLib_PI_EgressShapers[ChanId], NULL, &Timeout);
+    if (Status == BPLIB_SUCCESS)
+    {
+        Status = BPLib_QM_DuctPull(Inst, ChanId, true, Timeout, &Bundle);
+    }
+
     if (Status == BPLIB_SUCCESS)
+    {
+        SrcSlot = BPLib_AS_ResolveSourceSlot(&Bundle->blocks.PrimaryBlock.SrcEID);
+    }
+
+    if (Status == BPLIB_SUCCESS &&
+        (Bundle->blocks.PrimaryBlock.BundleProcFlags & BPLIB_BUNDLE_PROC_FRAG_FLAG))
+    {
+        BPLIB_PL_TRACE_BUNDLE(BPLIB_PL_TRACE_PI_DELIVER, Bundle, 0, (int32_t) ChanId);
+
+        /* Fragments are held until the whole ADU can be delivered, the bundle is taken over.
+        ** The reassembled bundle is counted as delivered once, not once per fragment.
+        */
+        Status = BPLib_PI_ReasmAdd(Inst, ChanId, Bundle, AduPtr, BufLen, AduSize,
+                                   BPLib_TIME_GetMonotonicTime());
+        if (Status == BPLIB_SUCCESS && *AduSize != 0)
+        {
+            BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, ADU_COUNT_DELIVERED, 1);
+            BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DELIVERED, 1);
+            BPLib_AS_IncrementSlot(SrcSlot, ADU_COUNT_DELIVERED, 1);
+            BPLib_AS_IncrementSlot(SrcSlot, BUNDLE_COUNT_DELIVERED, 1);
+            BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_DELIVERED, ChanId, *AduSize);
+            BPLib_TIME_ShaperConsume(&BPLib_PI_EgressShapers[ChanId], *AduSize);
+        }
+        else if (Status == BPLIB_SUCCESS)
+        {
+            /* Nothing to deliver yet */
+            Status = BPLIB_TIMEOUT;
+        }
+        else
+        {
+            BPLib_EM_SendEvent(BPLIB_PI_EGRESS_ERR_EID, BPLib_EM_EventType_ERROR,
+                            "[ADU Out #%d]: Error reassembling ADU for egress, Status = %d.",
+                            ChanId, Status);
+        }
+    }
+    else if (Status == BPLIB_SUCCESS)
     {
         /* Copy out the contents of the bundle payload to the return pointer */
         Status = BPLib_MEM_CopyOutFromOffset(Bundle,
@@ -528,10 +668,14 @@ BPLib_Status_t BPLib_PI_Egress(BPLib_Instance_t *Inst, uint32_t ChanId, void *Ad
                                 Bundle->blocks.PayloadHeader.DataSize, AduPtr, BufLen);
         if (Status == BPLIB_SUCCESS)
         {
-            BPLib_AS_Increment(BPLIB_EID_INSTANCE, ADU_COUNT_DELIVERED, 1);
-            BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DELIVERED, 1);
+            BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, ADU_COUNT_DELIVERED, 1);
+            BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DELIVERED, 1);
+            BPLib_AS_IncrementSlot(SrcSlot, ADU_COUNT_DELIVERED, 1);
+            BPLib_AS_IncrementSlot(SrcSlot, BUNDLE_COUNT_DELIVERED, 1);
 
             *AduSize = Bundle->blocks.PayloadHeader.DataSize;
+            BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_DELIVERED, ChanId, *AduSize);
+            BPLib_TIME_ShaperConsume(&BPLib_PI_EgressShapers[ChanId], *AduSize);
         }
         else
         {
@@ -540,6 +684,8 @@ BPLib_Status_t BPLib_PI_Egress(BPLib_Instance_t *Inst, uint32_t ChanId, void *Ad
                             ChanId, Status);
         }
 
+        BPLIB_PL_TRACE_BUNDLE(BPLIB_PL_TRACE_PI_DELIVER, Bundle, 0, (int32_t) ChanId);
+
         /* Free the bundle */
         BPLib_MEM_BundleFree(&Inst->pool, Bundle);
     }
@@ -551,3 +697,16 @@ BPLib_Status_t BPLib_PI_Egress(BPLib_Instance_t *Inst, uint32_t ChanId, void *Ad
 
     return Status;
 }
+
+/* Drop held fragments that timed out waiting for the rest of their bundle */
+BPLib_Status_t BPLib_PI_ExpireReassembly(BPLib_Instance_t *Inst)
+{
+    if (Inst == NULL)
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    BPLib_PI_ReasmExpire(Inst, BPLib_TIME_GetMonotonicTime());
+
+    return BPLIB_SUCCESS;
+}
@@ -0,0 +1,320 @@
+/*
+ * NASA Docket No. GSC-19,559-1, and identified as "Delay/Disruption Tolerant Networking 
+ * (DTN) Bundle Protocol (BP) v7 Core Flight System (cFS) Application Build 7.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this 
+ * file except in compliance with the License. You may obtain a copy of the License at 
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0 
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under 
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF 
+ * ANY KIND, either express or implied. See the License for the specific language 
+ * governing permissions and limitations under the License. The copyright notice to be 
+ * included in the software is as follows: 
+ *
+ * Copyright 2025 United States Government as represented by the Administrator of the 
+ * National Aeronautics and Space Administration. All Rights Reserved.
+ *
+ */
+
+/*
+** Include
+*/
+
+#include "bplib_pi_internal.h"
+#include "bplib_as.h"
+#include "bplib_eid.h"
+
+#include <string.h>
+
+/*
+** Global Data
+*/
+
+BPLib_PI_Reasm_t BPLib_PI_Reasm = { .Lock = PTHREAD_MUTEX_INITIALIZER };
+
+/*
+** Internal Function Definitions
+*/
+
+/* Free every fragment a slot holds and release the slot, caller must hold the lock */
+static void BPLib_PI_ReasmRelease(BPLib_Instance_t *Inst, BPLib_PI_ReasmSlot_t *Slot)
+{
+    uint32_t i;
+
+    for (i = 0; i < Slot->NumFrags; i++)
+    {
+        BPLib_MEM_BundleFree(&Inst->pool, Slot->Frags[i].Bundle);
+    }
+
+    BPLib_PI_Reasm.BytesReserved -= Slot->TotalAduLength;
+    memset(Slot, 0, sizeof(*Slot));
+}
+
+/* End of the ADU bytes the fragments cover contiguously from Start, caller must hold the lock */
+static uint64_t BPLib_PI_ReasmCovered(const BPLib_PI_ReasmSlot_t *Slot, uint64_t Start)
+{
+    uint64_t End = Start;
+    uint32_t i;
+
+    for (i = 0; i < Slot->NumFrags && Slot->Frags[i].Offset <= End; i++)
+    {
+        if (Slot->Frags[i].Offset + Slot->Frags[i].Length > End)
+        {
+            End = Slot->Frags[i].Offset + Slot->Frags[i].Length;
+        }
+    }
+
+    return End;
+}
+
+/* Slot reassembling the bundle a fragment belongs to, claiming a free one if none is, caller must hold the lock */
+static BPLib_PI_ReasmSlot_t *BPLib_PI_ReasmFindSlot(const BPLib_PrimaryBlock_t *PrimaryBlock, uint32_t ChanId,
+                                                    int64_t Now)
+{
+    BPLib_PI_ReasmSlot_t *Free = NULL;
+    BPLib_PI_ReasmSlot_t *Slot;
+    uint32_t i;
+
+    for (i = 0; i < BPLIB_PI_REASM_SLOTS; i++)
+    {
+        Slot = &BPLib_PI_Reasm.Slots[i];
+        if (!Slot->InUse)
+        {
+            if (Free == NULL)
+            {
+                Free = Slot;
+            }
+        }
+        else if (BPLib_EID_IsMatch(&PrimaryBlock->SrcEID, &Slot->SrcEID) &&
+                 PrimaryBlock->Timestamp.CreateTime == Slot->Timestamp.CreateTime &&
+                 PrimaryBlock->Timestamp.SequenceNumber == Slot->Timestamp.SequenceNumber)
+        {
+            /* Fragments of one bundle all carry its ADU length */
+            return (PrimaryBlock->TotalAduLength == Slot->TotalAduLength) ? Slot : NULL;
+        }
+    }
+
+    /* Every slot reserves its whole ADU up front so a slot can always complete */
+    if (Free == NULL ||
+        BPLib_PI_Reasm.BytesReserved + PrimaryBlock->TotalAduLength > BPLIB_PI_REASM_MAX_BYTES)
+    {
+        return NULL;
+    }
+
+    Free->InUse          = true;
+    Free->ChanId         = ChanId;
+    Free->SrcEID         = PrimaryBlock->SrcEID;
+    Free->Timestamp      = PrimaryBlock->Timestamp;
+    Free->TotalAduLength = PrimaryBlock->TotalAduLength;
+    Free->Deadline       = Now + BPLIB_PI_REASM_TIMEOUT_MS;
+    Free->NumFrags       = 0;
+    BPLib_PI_Reasm.BytesReserved += PrimaryBlock->TotalAduLength;
+
+    return Free;
+}
+
+/* Drop bundles whose missing fragments have not arrived in time, caller must hold the lock */
+static uint32_t BPLib_PI_ReasmExpireLocked(BPLib_Instance_t *Inst, int64_t Now)
+{
+    uint32_t Expired = 0;
+    uint32_t i;
+
+    for (i = 0; i < BPLIB_PI_REASM_SLOTS; i++)
+    {
+        if (BPLib_PI_Reasm.Slots[i].InUse && Now >= BPLib_PI_Reasm.Slots[i].Deadline)
+        {
+            Expired += BPLib_PI_Reasm.Slots[i].NumFrags;
+            BPLib_PI_ReasmRelease(Inst, &BPLib_PI_Reasm.Slots[i]);
+        }
+    }
+
+    return Expired;
+}
+
+/*
+** Function Definitions
+*/
+
+BPLib_Status_t BPLib_PI_ReasmAdd(BPLib_Instance_t *Inst, uint32_t ChanId, BPLib_Bundle_t *Fragment,
+                                 void *AduPtr, size_t BufLen, size_t *AduSize, int64_t Now)
+{
+    BPLib_PrimaryBlock_t *PrimaryBlock;
+    BPLib_PI_ReasmSlot_t *Slot = NULL;
+    BPLib_PI_ReasmSlot_t  Whole;
+    BPLib_Status_t        Status = BPLIB_SUCCESS;
+    bool                  Redundant = false;
+    uint64_t              Offset;
+    uint64_t              Length;
+    uint64_t              Pos;
+    uint32_t              Expired;
+    uint32_t              i;
+
+    if ((Inst == NULL) || (Fragment == NULL) || (AduPtr == NULL) || (AduSize == NULL))
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    *AduSize     = 0;
+    PrimaryBlock = &Fragment->blocks.PrimaryBlock;
+    Offset       = PrimaryBlock->FragmentOffset;
+    Length       = Fragment->blocks.PayloadHeader.DataSize;
+
+    pthread_mutex_lock(&BPLib_PI_Reasm.Lock);
+
+    /* Free up what timed out before looking for room */
+    Expired = BPLib_PI_ReasmExpireLocked(Inst, Now);
+
+    if (Length != 0 && Offset < PrimaryBlock->TotalAduLength &&
+        Length <= PrimaryBlock->TotalAduLength - Offset)
+    {
+        Slot = BPLib_PI_ReasmFindSlot(PrimaryBlock, ChanId, Now);
+    }
+
+    if (Slot == NULL)
+    {
+        Status = BPLIB_BI_FRAGMENT_ERR;
+    }
+    else if (BPLib_PI_ReasmCovered(Slot, Offset) >= Offset + Length)
+    {
+        /* Everything this fragment carries has already arrived */
+        Redundant = true;
+    }
+    else if (Slot->NumFrags == BPLIB_PI_REASM_MAX_FRAGS)
+    {
+        Status = BPLIB_BI_FRAGMENT_ERR;
+    }
+    else
+    {
+        /* Keep the fragments in order of offset */
+        for (i = Slot->NumFrags; i > 0 && Slot->Frags[i - 1].Offset > Offset; i--)
+        {
+            Slot->Frags[i] = Slot->Frags[i - 1];
+        }
+
+        Slot->Frags[i].Bundle = Fragment;
+        Slot->Frags[i].Offset = Offset;
+        Slot->Frags[i].Length = Length;
+        Slot->NumFrags++;
+        Fragment = NULL;
+
+        /* Take a whole ADU out of the slots so it can be copied without the lock */
+        if (BPLib_PI_ReasmCovered(Slot, 0) >= Slot->TotalAduLength)
+        {
+            Whole = *Slot;
+            BPLib_PI_Reasm.BytesReserved -= Slot->TotalAduLength;
+            memset(Slot, 0, sizeof(*Slot));
+        }
+        else
+        {
+            Slot = NULL;
+        }
+    }
+
+    pthread_mutex_unlock(&BPLib_PI_Reasm.Lock);
+
+    if (Expired != 0)
+    {
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DISCARDED, Expired);
+    }
+
+    if (Fragment != NULL)
+    {
+        /* The fragment was not held */
+        if (Redundant)
+        {
+            BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_REDUNDANT, 1);
+        }
+        else
+        {
+            BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_FRAGMENT_ERROR, 1);
+        }
+
+        BPLib_MEM_BundleFree(&Inst->pool, Fragment);
+    }
+    else if (Slot != NULL)
+    {
+        /* Copy each fragment's new bytes straight from its pool chunks into the ADU */
+        if (Whole.TotalAduLength > BufLen)
+        {
+            Status = BPLIB_BUF_LEN_ERROR;
+        }
+
+        Pos = 0;
+        for (i = 0; i < Whole.NumFrags; i++)
+        {
+            if (Status == BPLIB_SUCCESS && Whole.Frags[i].Offset + Whole.Frags[i].Length > Pos)
+            {
+                Length = Whole.Frags[i].Offset + Whole.Frags[i].Length - Pos;
+                Status = BPLib_MEM_CopyOutFromOffset(Whole.Frags[i].Bundle,
+                            Whole.Frags[i].Bundle->blocks.PayloadHeader.DataOffsetStart +
+                            (Pos - Whole.Frags[i].Offset),
+                            Length, (uint8_t *) AduPtr + Pos, BufLen - Pos);
+                Pos += Length;
+            }
+
+            BPLib_MEM_BundleFree(&Inst->pool, Whole.Frags[i].Bundle);
+        }
+
+        if (Status == BPLIB_SUCCESS)
+        {
+            *AduSize = Whole.TotalAduLength;
+            BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_REASSEMBLED, 1);
+        }
+        else
+        {
+            BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DISCARDED, Whole.NumFrags);
+        }
+    }
+
+    return Status;
+}
+
+void BPLib_PI_ReasmExpire(BPLib_Instance_t *Inst, int64_t Now)
+{
+    uint32_t Expired;
+
+    if (Inst == NULL)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&BPLib_PI_Reasm.Lock);
+    Expired = BPLib_PI_ReasmExpireLocked(Inst, Now);
+    pthread_mutex_unlock(&BPLib_PI_Reasm.Lock);
+
+    if (Expired != 0)
+    {
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DISCARDED, Expired);
+    }
+}
+
+void BPLib_PI_ReasmFlush(BPLib_Instance_t *Inst, uint32_t ChanId)
+{
+    uint32_t Dropped = 0;
+    uint32_t i;
+
+    if (Inst == NULL)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&BPLib_PI_Reasm.Lock);
+
+    for (i = 0; i < BPLIB_PI_REASM_SLOTS; i++)
+    {
+        if (BPLib_PI_Reasm.Slots[i].InUse && BPLib_PI_Reasm.Slots[i].ChanId == ChanId)
+        {
+            Dropped += BPLib_PI_Reasm.Slots[i].NumFrags;
+            BPLib_PI_ReasmRelease(Inst, &BPLib_PI_Reasm.Slots[i]);
+        }
+    }
+
+    pthread_mutex_unlock(&BPLib_PI_Reasm.Lock);
+
+    if (Dropped != 0)
+    {
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DISCARDED, Dropped);
+    }
+}
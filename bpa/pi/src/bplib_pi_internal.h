@@ -0,0 +1,144 @@
+/*
+ * NASA Docket No. GSC-19,559-1, and identified as "Delay/Disruption Tolerant Networking 
+ * (DTN) Bundle Protocol (BP) v7 Core Flight System (cFS) Application Build 7.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this 
+ * file except in compliance with the License. You may obtain a copy of the License at 
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0 
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under 
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF 
+ * ANY KIND, either express or implied. See the License for the specific language 
+ * governing permissions and limitations under the License. The copyright notice to be 
+ * included in the software is as follows: 
+ *
+ * Copyright 2025 United States Government as represented by the Administrator of the 
+ * National Aeronautics and Space Administration. All Rights Reserved.
+ *
+ */
+
+/**
+ * @file
+ *
+ * Private header file for internal Payload Interface functions
+ */
+
+#ifndef BPLIB_PI_INTERNAL_H
+#define BPLIB_PI_INTERNAL_H
+
+/*
+** Include
+*/
+
+#include "bplib_api_types.h"
+#include "bplib_mem.h"
+
+#include <pthread.h>
+
+/*
+** Type Definitions
+*/
+
+/**
+ * \brief Fragment held for reassembly
+ */
+typedef struct
+{
+    BPLib_Bundle_t *Bundle; /** \brief Fragment, its payload stays in its own pool chunks */
+    uint64_t        Offset; /** \brief Offset of the fragment's payload in the ADU */
+    uint64_t        Length; /** \brief Number of ADU bytes the fragment carries */
+} BPLib_PI_ReasmFrag_t;
+
+/**
+ * \brief   Bundle being reassembled from its fragments
+ * \details Fragments are kept in order of offset. A slot is identified by the source EID and
+ *          creation timestamp its fragments share.
+ */
+typedef struct
+{
+    bool                      InUse;                              /** \brief Slot holds fragments */
+    uint32_t                  ChanId;                             /** \brief Channel the ADU is delivered on */
+    BPLib_EID_t               SrcEID;                             /** \brief Source of the bundle */
+    BPLib_CreationTimeStamp_t Timestamp;                          /** \brief Creation timestamp of the bundle */
+    uint64_t                  TotalAduLength;                     /** \brief Length of the whole ADU */
+    int64_t                   Deadline;                           /** \brief Monotonic time the slot times out at */
+    uint32_t                  NumFrags;                           /** \brief Number of fragments held */
+    BPLib_PI_ReasmFrag_t      Frags[BPLIB_PI_REASM_MAX_FRAGS];    /** \brief Fragments held, by offset */
+} BPLib_PI_ReasmSlot_t;
+
+/**
+ * \brief   Fragment reassembly state
+ * \details Every slot reserves its total ADU length, and no more than BPLIB_PI_REASM_MAX_BYTES
+ *          is reserved at once
+ */
+typedef struct
+{
+    pthread_mutex_t      Lock;                          /** \brief Guards the slots */
+    uint64_t             BytesReserved;                 /** \brief ADU bytes reserved by slots in use */
+    BPLib_PI_ReasmSlot_t Slots[BPLIB_PI_REASM_SLOTS];   /** \brief Bundles being reassembled */
+} BPLib_PI_Reasm_t;
+
+/*
+** Global Data
+*/
+
+extern BPLib_PI_Reasm_t BPLib_PI_Reasm; /** \brief Fragment reassembly state */
+
+/*
+** Function Prototypes
+*/
+
+/**
+ * \brief Adds a fragment to the bundle it is part of, delivering the ADU once it is whole
+ *
+ *  \par Description
+ *       The fragment is held, in the pool chunks it was received in, until fragments
+ *       covering the whole ADU have arrived. The ADU is then copied from every fragment
+ *       straight into AduPtr and the fragments are freed. Bundles that have waited
+ *       BPLIB_PI_REASM_TIMEOUT_MS for their missing fragments are dropped first, as they
+ *       also are by BPLib_PI_ReasmExpire when no fragments arrive.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The fragment is always taken over: it is held, freed once it is no longer needed,
+ *       or freed if it cannot be reassembled.
+ *
+ *  \param[in] Inst Pointer to the BPLib instance the fragment's pool belongs to
+ *  \param[in] ChanId Channel the ADU is delivered on
+ *  \param[in] Fragment Fragment to add
+ *  \param[out] AduPtr Buffer for the reassembled ADU
+ *  \param[in] BufLen Length of AduPtr
+ *  \param[out] AduSize Size of the reassembled ADU, 0 if the ADU is not yet whole
+ *  \param[in] Now Current monotonic time
+ *
+ *  \return Execution status
+ *  \retval BPLIB_SUCCESS The fragment was held or completed the ADU
+ *  \retval BPLIB_BI_FRAGMENT_ERR The fragment was dropped: it does not agree with the
+ *          fragments held for its bundle, or there was no room to hold it
+ *  \retval BPLIB_BUF_LEN_ERROR The ADU was whole but did not fit in BufLen and was dropped
+ */
+BPLib_Status_t BPLib_PI_ReasmAdd(BPLib_Instance_t *Inst, uint32_t ChanId, BPLib_Bundle_t *Fragment,
+                                 void *AduPtr, size_t BufLen, size_t *AduSize, int64_t Now);
+
+/**
+ * \brief Drops every bundle that has waited too long for its missing fragments
+ *
+ *  \par Description
+ *       Bundles whose BPLIB_PI_REASM_TIMEOUT_MS has run out are dropped and their fragments
+ *       freed, so a bundle whose last fragment never arrives does not hold its slot until
+ *       some other fragment is delivered.
+ *
+ *  \param[in] Inst Pointer to the BPLib instance the fragments' pool belongs to
+ *  \param[in] Now Current monotonic time
+ */
+void BPLib_PI_ReasmExpire(BPLib_Instance_t *Inst, int64_t Now);
+
+/**
+ * \brief Drops every bundle being reassembled for a channel
+ *
+ *  \param[in] Inst Pointer to the BPLib instance the fragments' pool belongs to
+ *  \param[in] ChanId Channel whose bundles are dropped
+ */
+void BPLib_PI_ReasmFlush(BPLib_Instance_t *Inst, uint32_t ChanId);
+
+#endif /* BPLIB_PI_INTERNAL_H */
@@ -0,0 +1,353 @@
+/*
+ * NASA Docket No. GSC-19,559-1, and identified as "Delay/Disruption Tolerant Networking 
+ * (DTN) Bundle Protocol (BP) v7 Core Flight System (cFS) Application Build 7.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this 
+ * file except in compliance with the License. You may obtain a copy of the License at 
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0 
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under 
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF 
+ * ANY KIND, either express or implied. See the License for the specific language 
+ * governing permissions and limitations under the License. The copyright notice to be 
+ * included in the software is as follows: 
+ *
+ * Copyright 2025 United States Government as represented by the Administrator of the 
+ * National Aeronautics and Space Administration. All Rights Reserved.
+ *
+ */
+
+/*
+ * Include
+ */
+
+#include "bplib_pi_test_utils.h"
+
+/* Offsets and lengths copied out of fragments by the last reassembly */
+static uint64_t BPLib_PI_Test_CopyOffsets[4];
+static uint64_t BPLib_PI_Test_CopyLengths[4];
+static uint32_t BPLib_PI_Test_NumCopies;
+
+static void UT_Handler_BPLib_MEM_CopyOutFromOffset_Record(void *UserObj, UT_EntryKey_t FuncKey,
+                                                          const UT_StubContext_t *Context)
+{
+    uint64_t Offset         = UT_Hook_GetArgValueByName(Context, "Offset", uint64_t);
+    uint64_t NumBytesToCopy = UT_Hook_GetArgValueByName(Context, "NumBytesToCopy", uint64_t);
+
+    if (BPLib_PI_Test_NumCopies < 4)
+    {
+        BPLib_PI_Test_CopyOffsets[BPLib_PI_Test_NumCopies] = Offset;
+        BPLib_PI_Test_CopyLengths[BPLib_PI_Test_NumCopies] = NumBytesToCopy;
+    }
+
+    BPLib_PI_Test_NumCopies++;
+}
+
+/* Fragment of a 100 byte ADU from the source node given */
+static void BPLib_PI_Test_InitFragment(BPLib_Bundle_t *Fragment, uint64_t Node, uint64_t Offset, uint64_t Length)
+{
+    memset(Fragment, 0, sizeof(*Fragment));
+    Fragment->blocks.PrimaryBlock.BundleProcFlags = BPLIB_BUNDLE_PROC_FRAG_FLAG;
+    Fragment->blocks.PrimaryBlock.SrcEID.Node = Node;
+    Fragment->blocks.PrimaryBlock.FragmentOffset = Offset;
+    Fragment->blocks.PrimaryBlock.TotalAduLength = 100;
+    Fragment->blocks.PayloadHeader.DataOffsetStart = 20;
+    Fragment->blocks.PayloadHeader.DataSize = Length;
+}
+
+/* Test that fragments arriving out of order are reassembled into the ADU */
+void Test_BPLib_PI_ReasmAdd_Nominal(void)
+{
+    BPLib_Bundle_t Fragments[2];
+    uint8_t        Adu[100];
+    size_t         AduSize;
+
+    BPLib_PI_Test_InitFragment(&Fragments[0], 1, 50, 50);
+    BPLib_PI_Test_InitFragment(&Fragments[1], 1, 0, 50);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), true);
+    UT_SetHandlerFunction(UT_KEY(BPLib_MEM_CopyOutFromOffset), UT_Handler_BPLib_MEM_CopyOutFromOffset_Record, NULL);
+    BPLib_PI_Test_NumCopies = 0;
+
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragments[0], Adu, sizeof(Adu), &AduSize, 0), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(AduSize, 0);
+    UtAssert_BOOL_TRUE(BPLib_PI_Reasm.Slots[0].InUse);
+    UtAssert_UINT32_EQ(BPLib_PI_Reasm.BytesReserved, 100);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
+
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragments[1], Adu, sizeof(Adu), &AduSize, 0), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(AduSize, 100);
+    UtAssert_BOOL_FALSE(BPLib_PI_Reasm.Slots[0].InUse);
+    UtAssert_UINT32_EQ(BPLib_PI_Reasm.BytesReserved, 0);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 2);
+
+    /* Copied in order of offset, straight from each fragment's payload */
+    UtAssert_UINT32_EQ(BPLib_PI_Test_NumCopies, 2);
+    UtAssert_UINT32_EQ(BPLib_PI_Test_CopyOffsets[0], 20);
+    UtAssert_UINT32_EQ(BPLib_PI_Test_CopyLengths[0], 50);
+    UtAssert_UINT32_EQ(BPLib_PI_Test_CopyOffsets[1], 20);
+    UtAssert_UINT32_EQ(BPLib_PI_Test_CopyLengths[1], 50);
+}
+
+/* Test that bytes several fragments carry are copied once */
+void Test_BPLib_PI_ReasmAdd_Overlap(void)
+{
+    BPLib_Bundle_t Fragments[2];
+    uint8_t        Adu[100];
+    size_t         AduSize;
+
+    BPLib_PI_Test_InitFragment(&Fragments[0], 1, 0, 60);
+    BPLib_PI_Test_InitFragment(&Fragments[1], 1, 40, 60);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), true);
+    UT_SetHandlerFunction(UT_KEY(BPLib_MEM_CopyOutFromOffset), UT_Handler_BPLib_MEM_CopyOutFromOffset_Record, NULL);
+    BPLib_PI_Test_NumCopies = 0;
+
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragments[0], Adu, sizeof(Adu), &AduSize, 0), BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragments[1], Adu, sizeof(Adu), &AduSize, 0), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(AduSize, 100);
+
+    UtAssert_UINT32_EQ(BPLib_PI_Test_NumCopies, 2);
+    UtAssert_UINT32_EQ(BPLib_PI_Test_CopyLengths[0], 60);
+    UtAssert_UINT32_EQ(BPLib_PI_Test_CopyOffsets[1], 40);
+    UtAssert_UINT32_EQ(BPLib_PI_Test_CopyLengths[1], 40);
+}
+
+/* Test that a fragment carrying nothing new is dropped */
+void Test_BPLib_PI_ReasmAdd_Redundant(void)
+{
+    BPLib_Bundle_t Fragments[2];
+    uint8_t        Adu[100];
+    size_t         AduSize;
+
+    BPLib_PI_Test_InitFragment(&Fragments[0], 1, 0, 60);
+    BPLib_PI_Test_InitFragment(&Fragments[1], 1, 10, 50);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), true);
+
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragments[0], Adu, sizeof(Adu), &AduSize, 0), BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragments[1], Adu, sizeof(Adu), &AduSize, 0), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(AduSize, 0);
+    UtAssert_UINT32_EQ(BPLib_PI_Reasm.Slots[0].NumFrags, 1);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
+}
+
+/* Test that fragments which do not fit their ADU are dropped */
+void Test_BPLib_PI_ReasmAdd_Invalid(void)
+{
+    BPLib_Bundle_t Fragment;
+    uint8_t        Adu[100];
+    size_t         AduSize;
+
+    /* Empty */
+    BPLib_PI_Test_InitFragment(&Fragment, 1, 0, 0);
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragment, Adu, sizeof(Adu), &AduSize, 0), BPLIB_BI_FRAGMENT_ERR);
+
+    /* Starts past the end of the ADU */
+    BPLib_PI_Test_InitFragment(&Fragment, 1, 100, 10);
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragment, Adu, sizeof(Adu), &AduSize, 0), BPLIB_BI_FRAGMENT_ERR);
+
+    /* Runs past the end of the ADU */
+    BPLib_PI_Test_InitFragment(&Fragment, 1, 90, 11);
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragment, Adu, sizeof(Adu), &AduSize, 0), BPLIB_BI_FRAGMENT_ERR);
+
+    /* Disagrees with the ADU length of the fragments held */
+    BPLib_PI_Test_InitFragment(&Fragment, 1, 0, 10);
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragment, Adu, sizeof(Adu), &AduSize, 0), BPLIB_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), true);
+    Fragment.blocks.PrimaryBlock.FragmentOffset = 10;
+    Fragment.blocks.PrimaryBlock.TotalAduLength = 200;
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragment, Adu, sizeof(Adu), &AduSize, 0), BPLIB_BI_FRAGMENT_ERR);
+
+    UtAssert_UINT32_EQ(AduSize, 0);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 4);
+    UtAssert_UINT32_EQ(BPLib_PI_Reasm.Slots[0].NumFrags, 1);
+}
+
+/* Test that fragments are dropped once the slots, reserved bytes or fragments per slot run out */
+void Test_BPLib_PI_ReasmAdd_NoRoom(void)
+{
+    BPLib_Bundle_t Fragment;
+    uint8_t        Adu[100];
+    size_t         AduSize;
+    uint32_t       i;
+
+    /* ADU larger than reassembly may reserve */
+    BPLib_PI_Test_InitFragment(&Fragment, 1, 0, 10);
+    Fragment.blocks.PrimaryBlock.TotalAduLength = BPLIB_PI_REASM_MAX_BYTES + 1;
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragment, Adu, sizeof(Adu), &AduSize, 0), BPLIB_BI_FRAGMENT_ERR);
+
+    /* Every slot in use by another bundle */
+    for (i = 0; i < BPLIB_PI_REASM_SLOTS; i++)
+    {
+        BPLib_PI_Test_InitFragment(&Fragment, i + 1, 0, 10);
+        UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragment, Adu, sizeof(Adu), &AduSize, 0), BPLIB_SUCCESS);
+    }
+
+    UtAssert_UINT32_EQ(BPLib_PI_Reasm.BytesReserved, 100 * BPLIB_PI_REASM_SLOTS);
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragment, Adu, sizeof(Adu), &AduSize, 0), BPLIB_BI_FRAGMENT_ERR);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 2);
+
+    /* Every fragment of a slot in use, none of them adjacent */
+    memset(BPLib_PI_Reasm.Slots, 0, sizeof(BPLib_PI_Reasm.Slots));
+    BPLib_PI_Reasm.BytesReserved = 0;
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), true);
+    for (i = 0; i < BPLIB_PI_REASM_MAX_FRAGS; i++)
+    {
+        BPLib_PI_Test_InitFragment(&Fragment, 1, i, 1);
+        Fragment.blocks.PrimaryBlock.FragmentOffset = 2 * i;
+        Fragment.blocks.PrimaryBlock.TotalAduLength = 2 * BPLIB_PI_REASM_MAX_FRAGS;
+        UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragment, Adu, sizeof(Adu), &AduSize, 0), BPLIB_SUCCESS);
+    }
+
+    Fragment.blocks.PrimaryBlock.FragmentOffset = 1;
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragment, Adu, sizeof(Adu), &AduSize, 0), BPLIB_BI_FRAGMENT_ERR);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 3);
+}
+
+/* Test that a bundle whose fragments do not all arrive in time is dropped */
+void Test_BPLib_PI_ReasmAdd_Timeout(void)
+{
+    BPLib_Bundle_t Fragments[3];
+    uint8_t        Adu[100];
+    size_t         AduSize;
+
+    BPLib_PI_Test_InitFragment(&Fragments[0], 1, 0, 10);
+    BPLib_PI_Test_InitFragment(&Fragments[1], 1, 10, 10);
+    BPLib_PI_Test_InitFragment(&Fragments[2], 2, 0, 10);
+
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragments[0], Adu, sizeof(Adu), &AduSize, 0), BPLIB_SUCCESS);
+
+    /* Not yet timed out */
+    UT_SetDeferredRetcode(UT_KEY(BPLib_EID_IsMatch), 1, true);
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragments[1], Adu, sizeof(Adu), &AduSize,
+                                        BPLIB_PI_REASM_TIMEOUT_MS - 1), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(BPLib_PI_Reasm.Slots[0].NumFrags, 2);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
+
+    /* Timed out, the slot is freed for the next bundle */
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragments[2], Adu, sizeof(Adu), &AduSize,
+                                        BPLIB_PI_REASM_TIMEOUT_MS), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 2);
+    UtAssert_UINT32_EQ(BPLib_PI_Reasm.Slots[0].NumFrags, 1);
+    UtAssert_UINT32_EQ(BPLib_PI_Reasm.Slots[0].SrcEID.Node, 2);
+    UtAssert_UINT32_EQ(BPLib_PI_Reasm.BytesReserved, 100);
+}
+
+/* Test that a whole ADU too large for the buffer given is dropped */
+void Test_BPLib_PI_ReasmAdd_BufLen(void)
+{
+    BPLib_Bundle_t Fragment;
+    uint8_t        Adu[100];
+    size_t         AduSize;
+
+    BPLib_PI_Test_InitFragment(&Fragment, 1, 0, 100);
+
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragment, Adu, 50, &AduSize, 0), BPLIB_BUF_LEN_ERROR);
+    UtAssert_UINT32_EQ(AduSize, 0);
+    UtAssert_STUB_COUNT(BPLib_MEM_CopyOutFromOffset, 0);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
+    UtAssert_BOOL_FALSE(BPLib_PI_Reasm.Slots[0].InUse);
+    UtAssert_UINT32_EQ(BPLib_PI_Reasm.BytesReserved, 0);
+}
+
+/* Test that a failed copy drops the ADU */
+void Test_BPLib_PI_ReasmAdd_BadCopy(void)
+{
+    BPLib_Bundle_t Fragments[2];
+    uint8_t        Adu[100];
+    size_t         AduSize;
+
+    BPLib_PI_Test_InitFragment(&Fragments[0], 1, 0, 50);
+    BPLib_PI_Test_InitFragment(&Fragments[1], 1, 50, 50);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), true);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_MEM_CopyOutFromOffset), BPLIB_ERROR);
+
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragments[0], Adu, sizeof(Adu), &AduSize, 0), BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragments[1], Adu, sizeof(Adu), &AduSize, 0), BPLIB_ERROR);
+    UtAssert_UINT32_EQ(AduSize, 0);
+    UtAssert_STUB_COUNT(BPLib_MEM_CopyOutFromOffset, 1);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 2);
+}
+
+/* Test reassembly null checks */
+void Test_BPLib_PI_ReasmAdd_Null(void)
+{
+    BPLib_Bundle_t Fragment;
+    uint8_t        Adu[100];
+    size_t         AduSize;
+
+    BPLib_PI_Test_InitFragment(&Fragment, 1, 0, 10);
+
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(NULL, 0, &Fragment, Adu, sizeof(Adu), &AduSize, 0), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, NULL, Adu, sizeof(Adu), &AduSize, 0), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragment, NULL, sizeof(Adu), &AduSize, 0), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragment, Adu, sizeof(Adu), NULL, 0), BPLIB_NULL_PTR_ERROR);
+}
+
+/* Test that expiring drops only the bundles that have timed out */
+void Test_BPLib_PI_ReasmExpire_Nominal(void)
+{
+    BPLib_Bundle_t Fragments[2];
+    uint8_t        Adu[100];
+    size_t         AduSize;
+
+    BPLib_PI_Test_InitFragment(&Fragments[0], 1, 0, 10);
+    BPLib_PI_Test_InitFragment(&Fragments[1], 2, 0, 10);
+
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragments[0], Adu, sizeof(Adu), &AduSize, 0), BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragments[1], Adu, sizeof(Adu), &AduSize, 1), BPLIB_SUCCESS);
+
+    BPLib_PI_ReasmExpire(NULL, BPLIB_PI_REASM_TIMEOUT_MS);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
+
+    BPLib_PI_ReasmExpire(&BplibInst, BPLIB_PI_REASM_TIMEOUT_MS - 1);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 0);
+
+    BPLib_PI_ReasmExpire(&BplibInst, BPLIB_PI_REASM_TIMEOUT_MS);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 1);
+    UtAssert_BOOL_FALSE(BPLib_PI_Reasm.Slots[0].InUse);
+    UtAssert_BOOL_TRUE(BPLib_PI_Reasm.Slots[1].InUse);
+    UtAssert_UINT32_EQ(BPLib_PI_Reasm.BytesReserved, 100);
+}
+
+/* Test that flushing a channel frees every fragment held for it */
+void Test_BPLib_PI_ReasmFlush_Nominal(void)
+{
+    BPLib_Bundle_t Fragments[3];
+    uint8_t        Adu[100];
+    size_t         AduSize;
+
+    BPLib_PI_Test_InitFragment(&Fragments[0], 1, 0, 10);
+    BPLib_PI_Test_InitFragment(&Fragments[1], 2, 0, 10);
+    BPLib_PI_Test_InitFragment(&Fragments[2], 3, 0, 10);
+
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragments[0], Adu, sizeof(Adu), &AduSize, 0), BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Fragments[1], Adu, sizeof(Adu), &AduSize, 0), BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 1, &Fragments[2], Adu, sizeof(Adu), &AduSize, 0), BPLIB_SUCCESS);
+
+    BPLib_PI_ReasmFlush(NULL, 0);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
+
+    BPLib_PI_ReasmFlush(&BplibInst, 0);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 2);
+    UtAssert_BOOL_FALSE(BPLib_PI_Reasm.Slots[0].InUse);
+    UtAssert_BOOL_FALSE(BPLib_PI_Reasm.Slots[1].InUse);
+    UtAssert_BOOL_TRUE(BPLib_PI_Reasm.Slots[2].InUse);
+    UtAssert_UINT32_EQ(BPLib_PI_Reasm.BytesReserved, 100);
+}
+
+void TestBplibPiInternal_Register(void)
+{
+    ADD_TEST(Test_BPLib_PI_ReasmAdd_Nominal);
+    ADD_TEST(Test_BPLib_PI_ReasmAdd_Overlap);
+    ADD_TEST(Test_BPLib_PI_ReasmAdd_Redundant);
+    ADD_TEST(Test_BPLib_PI_ReasmAdd_Invalid);
+    ADD_TEST(Test_BPLib_PI_ReasmAdd_NoRoom);
+    ADD_TEST(Test_BPLib_PI_ReasmAdd_Timeout);
+    ADD_TEST(Test_BPLib_PI_ReasmAdd_BufLen);
+    ADD_TEST(Test_BPLib_PI_ReasmAdd_BadCopy);
+    ADD_TEST(Test_BPLib_PI_ReasmAdd_Null);
+    ADD_TEST(Test_BPLib_PI_ReasmExpire_Nominal);
+    ADD_TEST(Test_BPLib_PI_ReasmFlush_Nominal);
+}
@@ -33,6 +33,7 @@ void Test_BPLib_PI_AddApplication_Nominal(void)
 
     UtAssert_INT32_EQ(BPLib_PI_AddApplication(ChanId), BPLIB_SUCCESS);
     UtAssert_STUB_COUNT(BPLib_NC_SetAppState, 1);
+    UtAssert_STUB_COUNT(BPLib_TIME_ShaperInit, 1);
 }
 
 /* Test nominal add application function when the state is added */
@@ -211,6 +212,30 @@ void Test_BPLib_PI_RemoveApplication_Nominal(void)
 }
 
 
+/* Test that removing an application drops the fragments held for its channel */
+void Test_BPLib_PI_RemoveApplication_Reassembly(void)
+{
+    uint32_t ChanId = 0;
+    uint8_t AduPtr[10];
+    size_t AduSize;
+    BPLib_Bundle_t Bundle;
+
+    memset(&Bundle, 0, sizeof(Bundle));
+    Bundle.blocks.PrimaryBlock.BundleProcFlags = BPLIB_BUNDLE_PROC_FRAG_FLAG;
+    Bundle.blocks.PrimaryBlock.TotalAduLength = 10;
+    Bundle.blocks.PayloadHeader.DataSize = 4;
+
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, ChanId, &Bundle, AduPtr, sizeof(AduPtr), &AduSize, 0),
+                      BPLIB_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_NC_GetAppState), BPLIB_NC_APP_STATE_STOPPED);
+
+    UtAssert_INT32_EQ(BPLib_PI_RemoveApplication(&BplibInst, ChanId), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
+    UtAssert_BOOL_FALSE(BPLib_PI_Reasm.Slots[0].InUse);
+    UtAssert_UINT32_EQ(BPLib_PI_Reasm.BytesReserved, 0);
+}
+
 /* Test BPLib_PI_RemoveApplication */
 void Test_BPLib_PI_RemoveApplication_Added(void)
 {
@@ -744,10 +769,103 @@ void Test_BPLib_PI_Ingress_NullMem(void)
     UT_SetDeferredRetcode(UT_KEY(BPLib_MEM_BundleAlloc), 1, (UT_IntReturn_t) NULL);
 
     UtAssert_INT32_EQ(BPLib_PI_Ingress(&BplibInst, ChanId, AduPtr, AduSize), BPLIB_NULL_PTR_ERROR);
-    UtAssert_STUB_COUNT(BPLib_AS_Increment, 2);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 2);
     UtAssert_INT32_EQ(context_BPLib_EM_SendEvent[0].EventID, BPLIB_PI_INGRESS_ERR_EID);
 }
 
+/* Test ingress function building the bundle from the channel template */
+void Test_BPLib_PI_Ingress_Template(void)
+{
+    uint32_t ChanId = 0;
+    uint8_t AduPtr[10];
+    size_t AduSize = sizeof(AduPtr);
+    BPLib_Bundle_t Bundle;
+
+    memset(&Bundle, 0, sizeof(Bundle));
+
+    TestChanTbl.Configs[ChanId].Lifetime = 5000;
+    BPLib_PI_RefreshTemplates();
+
+    UT_SetDeferredRetcode(UT_KEY(BPLib_MEM_BundleAlloc), 1, (UT_IntReturn_t) &Bundle);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetDtnTime), 1000);
+
+    UtAssert_INT32_EQ(BPLib_PI_Ingress(&BplibInst, ChanId, AduPtr, AduSize), BPLIB_SUCCESS);
+
+    /* The template covers the extension blocks when a DTN time is available */
+    UtAssert_STUB_COUNT(BPLib_EBP_InitializeExtensionBlocks, 0);
+    UtAssert_EQ(uint64_t, Bundle.blocks.PrimaryBlock.Lifetime, 5000);
+    UtAssert_EQ(uint64_t, Bundle.blocks.PrimaryBlock.Timestamp.CreateTime, 1000);
+    UtAssert_EQ(uint64_t, Bundle.blocks.PrimaryBlock.Timestamp.SequenceNumber, 0);
+    UtAssert_EQ(size_t, Bundle.blocks.PayloadHeader.DataSize, AduSize);
+    UtAssert_EQ(uint64_t, Bundle.blocks.PayloadHeader.BlockType, BPLib_BlockType_Payload);
+}
+
+/* Test ingress function adding an age block when the template has none and there is no DTN time */
+void Test_BPLib_PI_Ingress_TemplateNoDtnTime(void)
+{
+    uint32_t ChanId = 0;
+    uint8_t AduPtr[10];
+    size_t AduSize = sizeof(AduPtr);
+    BPLib_Bundle_t Bundle;
+
+    memset(&Bundle, 0, sizeof(Bundle));
+
+    BPLib_PI_RefreshTemplates();
+
+    UT_SetDeferredRetcode(UT_KEY(BPLib_MEM_BundleAlloc), 1, (UT_IntReturn_t) &Bundle);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetDtnTime), 0);
+
+    UtAssert_INT32_EQ(BPLib_PI_Ingress(&BplibInst, ChanId, AduPtr, AduSize), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPLib_EBP_InitializeExtensionBlocks, 1);
+}
+
+/* Test refreshing the bundle templates */
+void Test_BPLib_PI_RefreshTemplates_Nominal(void)
+{
+    uint32_t ChanId = 1;
+
+    TestChanTbl.Configs[ChanId].Lifetime = 1234;
+    TestChanTbl.Configs[ChanId].LocalServiceNumber = 42;
+
+    BPLib_PI_RefreshTemplates();
+
+    UtAssert_STUB_COUNT(BPLib_EBP_InitializeExtensionBlocksUnlocked, BPLIB_MAX_NUM_CHANNELS);
+    UtAssert_BOOL_TRUE(BPLib_PI_Templates[ChanId].Valid);
+    UtAssert_BOOL_FALSE(BPLib_PI_Templates[ChanId].HasAgeBlk);
+    UtAssert_EQ(uint64_t, BPLib_PI_Templates[ChanId].Blocks.PrimaryBlock.Lifetime, 1234);
+    UtAssert_EQ(uint64_t, BPLib_PI_Templates[ChanId].Blocks.PrimaryBlock.SrcEID.Service, 42);
+    UtAssert_EQ(uint64_t, BPLib_PI_Templates[ChanId].Blocks.PrimaryBlock.Timestamp.CreateTime, 0);
+}
+
+/* Test refreshing the bundle templates without a channel table */
+void Test_BPLib_PI_RefreshTemplates_NullTable(void)
+{
+    BPLib_PI_Templates[0].Valid = true;
+    BPLib_NC_ConfigPtrs.ChanConfigPtr = NULL;
+
+    BPLib_PI_RefreshTemplates();
+
+    UtAssert_STUB_COUNT(BPLib_EBP_InitializeExtensionBlocksUnlocked, 0);
+    UtAssert_BOOL_FALSE(BPLib_PI_Templates[0].Valid);
+}
+
+/* Test ingress function shedding while the pool is congested */
+void Test_BPLib_PI_Ingress_PoolCongested(void)
+{
+    uint32_t ChanId = 0;
+    uint8_t AduPtr[10];
+    size_t AduSize = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_MEM_PoolIsCongested), true);
+
+    UtAssert_INT32_EQ(BPLib_PI_Ingress(&BplibInst, ChanId, AduPtr, AduSize), BPLIB_MEM_POOL_CONGESTED);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleAlloc, 0);
+
+    /* Ensure Node Config is locked and unlocked */
+    UtAssert_STUB_COUNT(BPLib_NC_ReaderLock, 1);
+    UtAssert_STUB_COUNT(BPLib_NC_ReaderUnlock, 1);
+}
+
 /* Test nominal egress function */
 void Test_BPLib_PI_Egress_Nominal(void)
 {
@@ -759,6 +877,7 @@ void Test_BPLib_PI_Egress_Nominal(void)
     BPLib_Bundle_t Bundle;
     BPLib_Bundle_t *BundlePtr = &Bundle;
 
+    memset(&Bundle, 0, sizeof(Bundle));
     Bundle.blocks.PayloadHeader.DataSize = 10;
 
     UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_DuctPull), BPLIB_SUCCESS);
@@ -766,6 +885,33 @@ void Test_BPLib_PI_Egress_Nominal(void)
 
     UtAssert_INT32_EQ(BPLib_PI_Egress(&BplibInst, ChanId, AduPtr, &AduSize, BufLen, Timeout), BPLIB_SUCCESS);
     UtAssert_INT32_EQ(AduSize, Bundle.blocks.PayloadHeader.DataSize);
+    UtAssert_STUB_COUNT(BPLib_TIME_ShaperConsume, 1);
+}
+
+/* Test a delivered bundle is counted against its source as well as the node */
+void Test_BPLib_PI_Egress_SourceCounted(void)
+{
+    uint32_t ChanId = 0;
+    uint8_t AduPtr[10];
+    size_t AduSize;
+    BPLib_Bundle_t Bundle;
+    BPLib_Bundle_t *BundlePtr = &Bundle;
+
+    memset(&Bundle, 0, sizeof(Bundle));
+    Bundle.blocks.PayloadHeader.DataSize = 10;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_DuctPull), BPLIB_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPull), &BundlePtr, sizeof(BPLib_Bundle_t *), false);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_AS_ResolveSourceSlot), 2);
+
+    UtAssert_INT32_EQ(BPLib_PI_Egress(&BplibInst, ChanId, AduPtr, &AduSize, sizeof(AduPtr), 1000), BPLIB_SUCCESS);
+
+    UtAssert_STUB_COUNT(BPLib_AS_ResolveSourceSlot, 1);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 4);
+    UtAssert_UINT16_EQ(Context_BPLib_AS_IncrementSlot[2].Slot, 2);
+    UtAssert_EQ(BPLib_AS_Counter_t, Context_BPLib_AS_IncrementSlot[2].Counter, ADU_COUNT_DELIVERED);
+    UtAssert_UINT16_EQ(Context_BPLib_AS_IncrementSlot[3].Slot, 2);
+    UtAssert_EQ(BPLib_AS_Counter_t, Context_BPLib_AS_IncrementSlot[3].Counter, BUNDLE_COUNT_DELIVERED);
 }
 
 /* Test egress function when copy fails */
@@ -779,6 +925,7 @@ void Test_BPLib_PI_Egress_BadCopy(void)
     BPLib_Bundle_t Bundle;
     BPLib_Bundle_t *BundlePtr = &Bundle;
 
+    memset(&Bundle, 0, sizeof(Bundle));
     Bundle.blocks.PayloadHeader.DataSize = 10;
     
     UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_DuctPull), BPLIB_SUCCESS);
@@ -790,6 +937,103 @@ void Test_BPLib_PI_Egress_BadCopy(void)
     UtAssert_INT32_EQ(context_BPLib_EM_SendEvent[0].EventID, BPLIB_PI_EGRESS_ERR_EID);
 }
 
+/* Test that a fragment is held and nothing is delivered until its ADU is whole */
+void Test_BPLib_PI_Egress_FragmentHeld(void)
+{
+    uint32_t ChanId = 0;
+    uint8_t AduPtr[10];
+    size_t BufLen = 10;
+    size_t AduSize;
+    uint32_t Timeout = 1000;
+    BPLib_Bundle_t Bundle;
+    BPLib_Bundle_t *BundlePtr = &Bundle;
+
+    memset(&Bundle, 0, sizeof(Bundle));
+    Bundle.blocks.PrimaryBlock.BundleProcFlags = BPLIB_BUNDLE_PROC_FRAG_FLAG;
+    Bundle.blocks.PrimaryBlock.TotalAduLength = 10;
+    Bundle.blocks.PayloadHeader.DataSize = 4;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_DuctPull), BPLIB_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPull), &BundlePtr, sizeof(BPLib_Bundle_t *), false);
+
+    UtAssert_INT32_EQ(BPLib_PI_Egress(&BplibInst, ChanId, AduPtr, &AduSize, BufLen, Timeout), BPLIB_PI_TIMEOUT);
+    UtAssert_INT32_EQ(AduSize, 0);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
+    UtAssert_STUB_COUNT(BPLib_MEM_CopyOutFromOffset, 0);
+    UtAssert_STUB_COUNT(BPLib_TIME_ShaperConsume, 0);
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 0);
+    UtAssert_UINT32_EQ(BPLib_PI_Reasm.BytesReserved, 10);
+}
+
+/* Test that the last fragment of an ADU delivers the reassembled ADU */
+void Test_BPLib_PI_Egress_FragmentReassembled(void)
+{
+    uint32_t ChanId = 0;
+    uint8_t AduPtr[10];
+    size_t BufLen = 10;
+    size_t AduSize;
+    uint32_t Timeout = 1000;
+    BPLib_Bundle_t Bundles[2];
+    BPLib_Bundle_t *BundlePtr;
+
+    memset(Bundles, 0, sizeof(Bundles));
+    Bundles[0].blocks.PrimaryBlock.BundleProcFlags = BPLIB_BUNDLE_PROC_FRAG_FLAG;
+    Bundles[0].blocks.PrimaryBlock.TotalAduLength = 10;
+    Bundles[0].blocks.PayloadHeader.DataSize = 4;
+    Bundles[1] = Bundles[0];
+    Bundles[1].blocks.PrimaryBlock.FragmentOffset = 4;
+    Bundles[1].blocks.PayloadHeader.DataSize = 6;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_DuctPull), BPLIB_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_IsMatch), true);
+
+    BundlePtr = &Bundles[0];
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPull), &BundlePtr, sizeof(BPLib_Bundle_t *), false);
+    UtAssert_INT32_EQ(BPLib_PI_Egress(&BplibInst, ChanId, AduPtr, &AduSize, BufLen, Timeout), BPLIB_PI_TIMEOUT);
+
+    BundlePtr = &Bundles[1];
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPull), &BundlePtr, sizeof(BPLib_Bundle_t *), false);
+    UtAssert_INT32_EQ(BPLib_PI_Egress(&BplibInst, ChanId, AduPtr, &AduSize, BufLen, Timeout), BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(AduSize, 10);
+    UtAssert_STUB_COUNT(BPLib_MEM_CopyOutFromOffset, 2);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 2);
+    UtAssert_STUB_COUNT(BPLib_TIME_ShaperConsume, 1);
+    UtAssert_UINT32_EQ(BPLib_PI_Reasm.BytesReserved, 0);
+
+    /* The reassembled ADU is delivered as one bundle */
+    UtAssert_STUB_COUNT(BPLib_AS_IncrementSlot, 5);
+    UtAssert_EQ(BPLib_AS_Counter_t, Context_BPLib_AS_IncrementSlot[0].Counter, BUNDLE_COUNT_REASSEMBLED);
+    UtAssert_EQ(BPLib_AS_Counter_t, Context_BPLib_AS_IncrementSlot[1].Counter, ADU_COUNT_DELIVERED);
+    UtAssert_EQ(BPLib_AS_Counter_t, Context_BPLib_AS_IncrementSlot[2].Counter, BUNDLE_COUNT_DELIVERED);
+}
+
+/* Test that a fragment which cannot be held is reported */
+void Test_BPLib_PI_Egress_FragmentError(void)
+{
+    uint32_t ChanId = 0;
+    uint8_t AduPtr[10];
+    size_t BufLen = 10;
+    size_t AduSize;
+    uint32_t Timeout = 1000;
+    BPLib_Bundle_t Bundle;
+    BPLib_Bundle_t *BundlePtr = &Bundle;
+
+    /* Fragment runs past the end of its ADU */
+    memset(&Bundle, 0, sizeof(Bundle));
+    Bundle.blocks.PrimaryBlock.BundleProcFlags = BPLIB_BUNDLE_PROC_FRAG_FLAG;
+    Bundle.blocks.PrimaryBlock.FragmentOffset = 8;
+    Bundle.blocks.PrimaryBlock.TotalAduLength = 10;
+    Bundle.blocks.PayloadHeader.DataSize = 4;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_DuctPull), BPLIB_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPull), &BundlePtr, sizeof(BPLib_Bundle_t *), false);
+
+    UtAssert_INT32_EQ(BPLib_PI_Egress(&BplibInst, ChanId, AduPtr, &AduSize, BufLen, Timeout), BPLIB_BI_FRAGMENT_ERR);
+    UtAssert_INT32_EQ(AduSize, 0);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
+    UtAssert_INT32_EQ(context_BPLib_EM_SendEvent[0].EventID, BPLIB_PI_EGRESS_ERR_EID);
+}
+
 /* Test egress function null checks */
 void Test_BPLib_PI_Egress_Null(void)
 {
@@ -836,6 +1080,49 @@ void Test_BPLib_PI_Egress_Timeout(void)
     UtAssert_INT32_EQ(BPLib_PI_Egress(&BplibInst, ChanId, AduPtr, &AduSize, BufLen, Timeout), BPLIB_PI_TIMEOUT);
 }
 
+/* Test that nothing is pulled while the channel is over its delivery rate */
+void Test_BPLib_PI_Egress_RateLimited(void)
+{
+    uint32_t ChanId = 0;
+    uint8_t AduPtr[10];
+    size_t BufLen = 10;
+    size_t AduSize;
+    uint32_t Timeout = 1000;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_ShaperWait), BPLIB_TIMEOUT);
+
+    UtAssert_INT32_EQ(BPLib_PI_Egress(&BplibInst, ChanId, AduPtr, &AduSize, BufLen, Timeout), BPLIB_PI_TIMEOUT);
+    UtAssert_STUB_COUNT(BPLib_QM_DuctPull, 0);
+}
+
+/* Test that held fragments are dropped once they time out */
+void Test_BPLib_PI_ExpireReassembly_Nominal(void)
+{
+    uint8_t AduPtr[10];
+    size_t AduSize;
+    BPLib_Bundle_t Bundle;
+
+    memset(&Bundle, 0, sizeof(Bundle));
+    Bundle.blocks.PrimaryBlock.BundleProcFlags = BPLIB_BUNDLE_PROC_FRAG_FLAG;
+    Bundle.blocks.PrimaryBlock.TotalAduLength = 10;
+    Bundle.blocks.PayloadHeader.DataSize = 4;
+
+    UtAssert_INT32_EQ(BPLib_PI_ReasmAdd(&BplibInst, 0, &Bundle, AduPtr, sizeof(AduPtr), &AduSize, 0),
+                      BPLIB_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetMonotonicTime), BPLIB_PI_REASM_TIMEOUT_MS);
+
+    UtAssert_INT32_EQ(BPLib_PI_ExpireReassembly(&BplibInst), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
+    UtAssert_BOOL_FALSE(BPLib_PI_Reasm.Slots[0].InUse);
+}
+
+/* Test BPLib_PI_ExpireReassembly when inst is null */
+void Test_BPLib_PI_ExpireReassembly_Null(void)
+{
+    UtAssert_INT32_EQ(BPLib_PI_ExpireReassembly(NULL), BPLIB_NULL_PTR_ERROR);
+}
+
 void TestBplibPi_Register(void)
 {
     ADD_TEST(Test_BPLib_PI_AddApplication_Nominal);
@@ -857,6 +1144,7 @@ void TestBplibPi_Register(void)
 
     ADD_TEST(Test_BPLib_PI_RemoveApplication_Nominal);
     ADD_TEST(Test_BPLib_PI_RemoveApplication_NullInst);
+    ADD_TEST(Test_BPLib_PI_RemoveApplication_Reassembly);
     ADD_TEST(Test_BPLib_PI_RemoveApplication_Added);
     ADD_TEST(Test_BPLib_PI_RemoveApplication_BadId);
     ADD_TEST(Test_BPLib_PI_RemoveApplication_BadState);
@@ -887,11 +1175,23 @@ void TestBplibPi_Register(void)
     ADD_TEST(Test_BPLib_PI_Ingress_Null);
     ADD_TEST(Test_BPLib_PI_Ingress_BadChanId);
     ADD_TEST(Test_BPLib_PI_Ingress_NullMem);
+    ADD_TEST(Test_BPLib_PI_Ingress_PoolCongested);
+    ADD_TEST(Test_BPLib_PI_Ingress_Template);
+    ADD_TEST(Test_BPLib_PI_Ingress_TemplateNoDtnTime);
+    ADD_TEST(Test_BPLib_PI_RefreshTemplates_Nominal);
+    ADD_TEST(Test_BPLib_PI_RefreshTemplates_NullTable);
 
     ADD_TEST(Test_BPLib_PI_Egress_Nominal);
+    ADD_TEST(Test_BPLib_PI_Egress_SourceCounted);
     ADD_TEST(Test_BPLib_PI_Egress_Null);
     ADD_TEST(Test_BPLib_PI_Egress_Timeout);
+    ADD_TEST(Test_BPLib_PI_Egress_RateLimited);
     ADD_TEST(Test_BPLib_PI_Egress_BadChanId);
     ADD_TEST(Test_BPLib_PI_Egress_BadCopy);  
+    ADD_TEST(Test_BPLib_PI_Egress_FragmentHeld);
+    ADD_TEST(Test_BPLib_PI_Egress_FragmentReassembled);
+    ADD_TEST(Test_BPLib_PI_Egress_FragmentError);
+    ADD_TEST(Test_BPLib_PI_ExpireReassembly_Nominal);
+    ADD_TEST(Test_BPLib_PI_ExpireReassembly_Null);
     
 }
@@ -65,6 +65,22 @@ BPLib_Status_t BPLib_PI_Egress(BPLib_Instance_t *Inst, uint32_t ChanId, void *Ad
     return UT_GenStub_GetReturnValue(BPLib_PI_Egress, BPLib_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_PI_ExpireReassembly()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_PI_ExpireReassembly(BPLib_Instance_t *Inst)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_PI_ExpireReassembly, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_PI_ExpireReassembly, BPLib_Instance_t *, Inst);
+
+    UT_GenStub_Execute(BPLib_PI_ExpireReassembly, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_PI_ExpireReassembly, BPLib_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_PI_Ingress()
@@ -84,6 +100,17 @@ BPLib_Status_t BPLib_PI_Ingress(BPLib_Instance_t *Inst, uint32_t ChanId, void *A
     return UT_GenStub_GetReturnValue(BPLib_PI_Ingress, BPLib_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_PI_RefreshTemplates()
+ * ----------------------------------------------------
+ */
+void BPLib_PI_RefreshTemplates(void)
+{
+
+    UT_GenStub_Execute(BPLib_PI_RefreshTemplates, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_PI_RemoveApplication()
@@ -57,8 +57,12 @@ void BPLib_PI_Test_Setup(void)
     UT_SetHandlerFunction(UT_KEY(BPLib_EM_SendEvent), UT_Handler_BPLib_EM_SendEvent, NULL);
     UT_SetHandlerFunction(UT_KEY(BPLib_QM_WaitQueueTryPull), UT_Handler_BPLib_QM_WaitQueueTryPull, NULL);
     UT_SetHandlerFunction(UT_KEY(BPLib_QM_DuctPull), UT_Handler_BPLib_QM_DuctPull, NULL);
+    UT_SetHandlerFunction(UT_KEY(BPLib_AS_IncrementSlot), UT_Handler_BPLib_AS_IncrementSlot, NULL);
 
     memset(&BPLib_PI_SequenceNums, 0, sizeof(BPLib_PI_SequenceNums));
+    memset(&BPLib_PI_Templates, 0, sizeof(BPLib_PI_Templates));
+    memset(BPLib_PI_Reasm.Slots, 0, sizeof(BPLib_PI_Reasm.Slots));
+    BPLib_PI_Reasm.BytesReserved = 0;
 }
 
 void BPLib_PI_Test_Teardown(void)
@@ -69,4 +73,5 @@ void BPLib_PI_Test_Teardown(void)
 void UtTest_Setup(void)
 {
     TestBplibPi_Register();
+    TestBplibPiInternal_Register();
 }
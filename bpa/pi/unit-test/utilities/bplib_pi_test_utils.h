@@ -31,10 +31,12 @@
 
 #include "bplib_api_types.h"
 #include "bplib_pi.h"
+#include "bplib_pi_internal.h"
 #include "bplib_fwp.h"
 #include "bplib_nc.h"
 #include "bplib_qm_handlers.h"
 #include "bplib_em_handlers.h"
+#include "bplib_as_handlers.h"
 #include "bpa_fwp_stubs.h"     /* For ADUP stubs */
 
 /* Macro to add test case */
@@ -46,7 +48,9 @@
 */
 
 extern BPLib_Instance_t BplibInst;
+extern BPLib_PI_ChannelTable_t TestChanTbl;
 extern uint64_t BPLib_PI_SequenceNums[BPLIB_MAX_NUM_CHANNELS];
+extern BPLib_PI_Template_t BPLib_PI_Templates[BPLIB_MAX_NUM_CHANNELS];
 
 /*
 ** Function Definitions
@@ -56,5 +60,6 @@ void BPLib_PI_Test_Setup(void);
 void BPLib_PI_Test_Teardown(void);
 
 void TestBplibPi_Register(void);
+void TestBplibPiInternal_Register(void);
 
 #endif /* BPLIB_PI_TEST_UTILS_H */
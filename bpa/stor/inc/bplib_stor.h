@@ -71,6 +71,8 @@ struct BPLib_StorageHkTlm_Payload
     size_t KbBundlesInStor;   /** \brief Kilobytes of storage currently occupied by bundles */
     int64_t  MonotonicTime;     /** \brief Monotonic Time Counter */
     int64_t  CorrelationFactor; /** \brief Time Correlation Factor */
+    uint32_t MemPoolBacking;    /** \brief How the memory pool is backed, see BPLib_MEM_PoolBacking_t */
+    uint32_t MemAllocFailCount; /** \brief Memory block allocations that failed because the pool was empty */
 };
 
 /*
@@ -142,6 +144,28 @@ BPLib_Status_t BPLib_STOR_EgressForID(BPLib_Instance_t* Inst, uint32_t EgressID,
 
 BPLib_Status_t BPLib_STOR_GarbageCollect(BPLib_Instance_t* Inst);
 
+/**
+ * \brief Find a stored copy of a bundle
+ *
+ *  \par Description
+ *       Looks for a bundle with the same source EID, creation timestamp and fragment
+ *       offset as the given bundle in the pending insert batch and in the database
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Bundles that were forwarded without being stored, or that were removed from
+ *       storage after egress, are not found.
+ *
+ *  \param[in] Inst Pointer to a valid BPLib_Instance_t
+ *  \param[in] Bundle Bundle to look for
+ *  \param[out] Found Set to whether a stored copy exists
+ *
+ *  \return Execution status
+ *  \retval BPLIB_SUCCESS The lookup was completed
+ *  \retval BPLIB_NULL_PTR_ERROR An argument was NULL
+ *  \retval BPLIB_STOR_SQL_LOAD_ERR The database lookup failed
+ */
+BPLib_Status_t BPLib_STOR_FindDuplicate(BPLib_Instance_t* Inst, const BPLib_Bundle_t* Bundle, bool* Found);
+
 /**
  * \brief Update values in the STOR housekeeping packet with values of the
  *        BPLib_Instance_t representing the current iteration of FSW
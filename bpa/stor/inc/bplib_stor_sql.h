@@ -32,6 +32,23 @@
 */
 #define BPLIB_STOR_EPOCHOFFSET 946684800000
 
+/* Egress priority of a stored bundle, higher priorities are loaded first. BPv7 bundles carry
+** no class of service, so administrative records (status reports, custody signals) are the
+** only bundles sent ahead of user data.
+*/
+#define BPLIB_STOR_PRIORITY_NORMAL 0
+#define BPLIB_STOR_PRIORITY_ADMIN  1
+
+/* When and how fast an egress can send. Bundles that would not be sent before they expire
+** or before sending stops are left in storage.
+*/
+typedef struct
+{
+    uint64_t SendStart;    /* DTN time sending starts (ms) */
+    uint64_t SendEnd;      /* DTN time sending stops (ms), 0 if unbounded */
+    uint64_t BitsPerCycle; /* Egress rate in bits per BPLIB_RATE_CYCLE_MS, 0 if unshaped */
+} BPLib_SQL_EgressBudget_t;
+
 BPLib_Status_t BPLib_SQL_Init(BPLib_Instance_t* Inst, const char* DbName);
 
 BPLib_Status_t BPLib_SQL_Store(BPLib_Instance_t* Inst, size_t *TotalBytesStored);
@@ -40,13 +57,19 @@ BPLib_Status_t BPLib_SQL_DiscardExpired(BPLib_Instance_t* Inst, size_t* NumDisca
 
 BPLib_Status_t BPLib_SQL_DiscardEgressed(BPLib_Instance_t* Inst, size_t* NumDiscarded);
 
+/* Loads the IDs of bundles for the DestEIDs by priority, then expiry, then size. Budget may be
+** NULL if DTN time is unknown, in which case nothing is left out.
+*/
 BPLib_Status_t BPLib_SQL_FindForEIDs(BPLib_Instance_t* Inst, BPLib_STOR_LoadBatch_t* Batch,
-    BPLib_EID_Pattern_t *DestEIDs, size_t NumEIDs);
+    BPLib_EID_Pattern_t *DestEIDs, size_t NumEIDs, const BPLib_SQL_EgressBudget_t* Budget);
 
 BPLib_Status_t BPLib_SQL_MarkBatchEgressed(BPLib_Instance_t* Inst, BPLib_STOR_LoadBatch_t* Batch);
 
 BPLib_Status_t BPLib_SQL_LoadBundle(BPLib_Instance_t* Inst, int64_t BundleID, BPLib_Bundle_t** Bundle);
 
+/* Finds whether a bundle with the same source, creation timestamp and fragment offset is stored */
+BPLib_Status_t BPLib_SQL_FindBundle(BPLib_Instance_t* Inst, const BPLib_PrimaryBlock_t* PrimaryBlock, bool* Found);
+
 BPLib_Status_t BPLib_SQL_GetDbSize(BPLib_Instance_t *Inst, size_t *DbSize);
 
 #endif /* BPLIB_STOR_SQL_H */
@@ -31,8 +31,11 @@
 #include "bplib_eid.h"
 #include "bplib_as.h"
 #include "bplib_stor_sql.h"
+#include "bplib_pl.h"
+#include "bplib_time.h"
 
 #include <stdio.h>
+#include <string.h>
 
 /* 
 ** Globals
@@ -60,10 +63,13 @@ static BPLib_Status_t BPLib_STOR_FlushPendingUnlocked(BPLib_Instance_t* Inst)
     BPLib_BundleCache_t* CacheInst;
     int i;
     size_t TotalBytesStored = 0;
+    uint64_t StoreStart;
 
     CacheInst = &Inst->BundleStorage;
 
+    StoreStart = BPLib_PL_LatencyStart();
     Status = BPLib_SQL_Store(Inst, &TotalBytesStored);
+    BPLib_PL_LatencyStop(BPLIB_PL_LATENCY_STORE, StoreStart);
 
     if (Status == BPLIB_SUCCESS) 
     {
@@ -72,16 +78,16 @@ static BPLib_Status_t BPLib_STOR_FlushPendingUnlocked(BPLib_Instance_t* Inst)
     }
     else if (Status == BPLIB_STOR_DB_FULL_ERR)
     {
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DELETED, CacheInst->InsertBatchSize);
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DISCARDED, CacheInst->InsertBatchSize);
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DELETED_NO_STORAGE, CacheInst->InsertBatchSize);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DELETED, CacheInst->InsertBatchSize);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DISCARDED, CacheInst->InsertBatchSize);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DELETED_NO_STORAGE, CacheInst->InsertBatchSize);
         BPLib_EM_SendEvent(BPLIB_STOR_DB_FULL_INF_EID, BPLib_EM_EventType_INFORMATION,
             "SQLite database is full, dropping %d bundles", CacheInst->InsertBatchSize);        
     }
     else
     {
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DELETED, CacheInst->InsertBatchSize);
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DISCARDED, CacheInst->InsertBatchSize);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DELETED, CacheInst->InsertBatchSize);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DISCARDED, CacheInst->InsertBatchSize);
         BPLib_EM_SendEvent(BPLIB_STOR_SQL_STORE_ERR_EID, BPLib_EM_EventType_ERROR,
             "BPLib_SQL_Store failed to store bundle. RC=%d", Status);
         
@@ -99,6 +105,16 @@ static BPLib_Status_t BPLib_STOR_FlushPendingUnlocked(BPLib_Instance_t* Inst)
     return Status;
 }
 
+/* Whether two bundles have the same source, creation timestamp and fragment offset */
+static bool BPLib_STOR_IsSameBundle(const BPLib_PrimaryBlock_t* A, const BPLib_PrimaryBlock_t* B)
+{
+    return (A->Timestamp.CreateTime == B->Timestamp.CreateTime) &&
+           (A->Timestamp.SequenceNumber == B->Timestamp.SequenceNumber) &&
+           (A->SrcEID.Node == B->SrcEID.Node) &&
+           (A->SrcEID.Service == B->SrcEID.Service) &&
+           (A->FragmentOffset == B->FragmentOffset);
+}
+
 /*******************************************************************************
 * Exported Functions
 */
@@ -188,6 +204,8 @@ BPLib_Status_t BPLib_STOR_StoreBundle(BPLib_Instance_t* Inst, BPLib_Bundle_t* Bu
     CacheInst = &Inst->BundleStorage;
     pthread_mutex_lock(&CacheInst->lock);
 
+    BPLIB_PL_TRACE_BUNDLE(BPLIB_PL_TRACE_STOR_STORE, Bundle, (uint32_t) CacheInst->InsertBatchSize, 0);
+
     /* Add to the next batch */
     CacheInst->InsertBatch[CacheInst->InsertBatchSize++] = Bundle;
     if (CacheInst->InsertBatchSize == BPLIB_STOR_INSERTBATCHSIZE)
@@ -212,6 +230,9 @@ BPLib_Status_t BPLib_STOR_EgressForID(BPLib_Instance_t* Inst, uint32_t EgressID,
     size_t EgressCnt = 0;
     int64_t CurrBundleID;
     size_t NumEIDs;
+    uint64_t LoadStart;
+    BPLib_SQL_EgressBudget_t Budget;
+    BPLib_CLA_EgressWindow_t Window;
 
     if ((Inst == NULL) || (NumEgressed == NULL))
     {
@@ -264,8 +285,24 @@ BPLib_Status_t BPLib_STOR_EgressForID(BPLib_Instance_t* Inst, uint32_t EgressID,
     /* If the load batch is empty, try to read more from storage */
     if (BPLib_STOR_LoadBatch_IsEmpty(LoadBatch))
     {
+        /* Only load what can be sent before it expires, or before the contact's window ends */
+        memset(&Budget, 0, sizeof(Budget));
+        memset(&Window, 0, sizeof(Window));
+        Budget.SendStart = BPLib_TIME_GetCurrentDtnTime();
+        if ((Budget.SendStart != 0) && !LocalDelivery &&
+            (BPLib_CLA_GetEgressWindow(EgressID, &Window) == BPLIB_SUCCESS))
+        {
+            if (Window.StartTime > Budget.SendStart)
+            {
+                Budget.SendStart = Window.StartTime;
+            }
+            Budget.SendEnd = Window.EndTime;
+            Budget.BitsPerCycle = Window.BitsPerCycle;
+        }
+
         /* Ask SQL to load egressable bundles from the specified Destination EID */
-        Status = BPLib_SQL_FindForEIDs(Inst, LoadBatch, DestEIDs, NumEIDs);
+        Status = BPLib_SQL_FindForEIDs(Inst, LoadBatch, DestEIDs, NumEIDs,
+            (Budget.SendStart != 0) ? &Budget : NULL);
         if (Status != BPLIB_SUCCESS)
         {
             BPLib_EM_SendEvent(BPLIB_STOR_SQL_LOAD_ERR_EID, BPLib_EM_EventType_ERROR,
@@ -289,10 +326,14 @@ BPLib_Status_t BPLib_STOR_EgressForID(BPLib_Instance_t* Inst, uint32_t EgressID,
         while (BPLib_STOR_LoadBatch_PeekNextID(LoadBatch, &CurrBundleID) == BPLIB_SUCCESS)
         {
             /* Set the metadata EID */
+            LoadStart = BPLib_PL_LatencyStart();
             Status = BPLib_SQL_LoadBundle(Inst, CurrBundleID, &CurrBundle);
+            BPLib_PL_LatencyStop(BPLIB_PL_LATENCY_LOAD, LoadStart);
             if (Status == BPLIB_SUCCESS)
             {
                 CurrBundle->Meta.EgressID = EgressID;
+                BPLIB_PL_TRACE_BUNDLE(BPLIB_PL_TRACE_STOR_LOAD, CurrBundle,
+                    (uint32_t) __atomic_load_n(&EgressQueue->size, __ATOMIC_RELAXED), (int32_t) EgressID);
                 if (BPLib_QM_WaitQueueTryPush(EgressQueue, &CurrBundle, QM_NO_WAIT) == false)
                 {
                     /* If QM couldn't accept the bundle, free it. It will be reloaded 
@@ -356,9 +397,9 @@ BPLib_Status_t BPLib_STOR_GarbageCollect(BPLib_Instance_t* Inst)
     }
     else
     {
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DELETED_EXPIRED, NumDiscarded);
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DELETED, NumDiscarded);
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DISCARDED, NumDiscarded);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DELETED_EXPIRED, NumDiscarded);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DELETED, NumDiscarded);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DISCARDED, NumDiscarded);
         CacheInst->BundleCountStored -= NumDiscarded;
     }
 
@@ -370,8 +411,8 @@ BPLib_Status_t BPLib_STOR_GarbageCollect(BPLib_Instance_t* Inst)
     }
     else
     {
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DISCARDED, NumDiscarded);
-        BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DELETED, NumDiscarded);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DISCARDED, NumDiscarded);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DELETED, NumDiscarded);
         CacheInst->BundleCountStored -= NumDiscarded;
     }
 
@@ -380,6 +421,43 @@ BPLib_Status_t BPLib_STOR_GarbageCollect(BPLib_Instance_t* Inst)
     return Status;
 }
 
+BPLib_Status_t BPLib_STOR_FindDuplicate(BPLib_Instance_t* Inst, const BPLib_Bundle_t* Bundle, bool* Found)
+{
+    BPLib_Status_t Status = BPLIB_SUCCESS;
+    BPLib_BundleCache_t* CacheInst;
+    int i;
+
+    if ((Inst == NULL) || (Bundle == NULL) || (Found == NULL))
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    CacheInst = &Inst->BundleStorage;
+    *Found = false;
+
+    pthread_mutex_lock(&CacheInst->lock);
+
+    /* Bundles waiting for the next batch insert aren't in the database yet */
+    for (i = 0; i < CacheInst->InsertBatchSize; i++)
+    {
+        if (BPLib_STOR_IsSameBundle(&CacheInst->InsertBatch[i]->blocks.PrimaryBlock,
+                                    &Bundle->blocks.PrimaryBlock))
+        {
+            *Found = true;
+            break;
+        }
+    }
+
+    if (*Found == false)
+    {
+        Status = BPLib_SQL_FindBundle(Inst, &Bundle->blocks.PrimaryBlock, Found);
+    }
+
+    pthread_mutex_unlock(&CacheInst->lock);
+
+    return Status;
+}
+
 /* Validate Storage table data */
 BPLib_Status_t BPLib_STOR_StorageTblValidateFunc(void *TblData)
 {
@@ -392,6 +470,7 @@ void BPLib_STOR_UpdateHkPkt(BPLib_Instance_t* Inst)
 {
     BPLib_Status_t Status;
     size_t DbSize;
+    BPLib_MEM_PoolStats_t PoolStats;
 
     Status = BPLib_SQL_GetDbSize(Inst, &DbSize);
     if (Status == BPLIB_SUCCESS)
@@ -405,17 +484,24 @@ void BPLib_STOR_UpdateHkPkt(BPLib_Instance_t* Inst)
             "Error getting database size, RC = %d.", Status);    
     }
 
+    /* Read the pool statistics without contending with allocation */
+    memset(&PoolStats, 0, sizeof(PoolStats));
+    BPLib_MEM_PoolGetStats(&Inst->pool, &PoolStats);
+
     /* Update the memory in use*/
-    BPLib_STOR_StoragePayload.BytesMemInUse = ((Inst->pool.impl.num_blocks - Inst->pool.impl.num_free) * Inst->pool.impl.block_size);
+    BPLib_STOR_StoragePayload.BytesMemInUse = ((PoolStats.num_blocks - PoolStats.num_free) * PoolStats.block_size);
 
-    /* Update the highwater mark if needed */
-    if (BPLib_STOR_StoragePayload.BytesMemInUse > BPLib_STOR_StoragePayload.BytesMemHighWater)
-    {
-        BPLib_STOR_StoragePayload.BytesMemHighWater = BPLib_STOR_StoragePayload.BytesMemInUse;
-    }
+    /* Update the highwater mark, tracked exactly by the allocator */
+    BPLib_STOR_StoragePayload.BytesMemHighWater = (PoolStats.num_in_use_hwm * PoolStats.block_size);
 
     /* Update the free memory */
-    BPLib_STOR_StoragePayload.BytesMemFree = (Inst->pool.impl.num_free * Inst->pool.impl.block_size);
+    BPLib_STOR_StoragePayload.BytesMemFree = (PoolStats.num_free * PoolStats.block_size);
+
+    /* Update the count of failed allocations */
+    BPLib_STOR_StoragePayload.MemAllocFailCount = (uint32_t) PoolStats.num_alloc_fail;
+
+    /* Report how the memory pool is backed */
+    BPLib_STOR_StoragePayload.MemPoolBacking = (uint32_t) Inst->pool.backing;
 
     /* Update kilobytes of data in use */
     BPLib_STOR_StoragePayload.KbBundlesInStor = (Inst->BundleStorage.BytesStorageInUse / 1000);
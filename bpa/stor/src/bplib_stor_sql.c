@@ -54,6 +54,10 @@
  * 4. idx_egress_attempted:
  *    - Index on the 'egress_attempted' column in the 'bundle_data' table. This index is designed to speed up
  *      DELETE queries and other queries filtering by 'egress_attempted'.
+ *
+ * 5. idx_bundle_identity:
+ *    - Composite index on the creation timestamp, source node and service and fragment offset of a bundle.
+ *    - This index is designed for the exact duplicate lookups done when a bundle is received.
  */
 static const char* CreateTableSQL = 
 "CREATE TABLE IF NOT EXISTS bundle_data (\n"
@@ -62,7 +66,13 @@ static const char* CreateTableSQL =
 "    egress_attempted INTEGER DEFAULT 0,\n"
 "    dest_node INTEGER,\n"
 "    dest_service INTEGER,\n"
-"    bundle_bytes INTEGER\n"
+"    bundle_bytes INTEGER,\n"
+"    priority INTEGER DEFAULT 0,\n"
+"    src_node INTEGER,\n"
+"    src_service INTEGER,\n"
+"    create_time INTEGER,\n"
+"    seq_num INTEGER,\n"
+"    frag_offset INTEGER\n"
 ");\n"
 "\n"
 "CREATE TABLE IF NOT EXISTS bundle_blobs (\n"
@@ -80,12 +90,23 @@ static const char* CreateTableSQL =
 "    dest_node,\n"
 "    dest_service,\n"
 "    egress_attempted,\n"
+"    priority,\n"
 "    action_timestamp,\n"
+"    bundle_bytes,\n"
 "    id\n"
 ");\n"
 "\n"
 "CREATE INDEX IF NOT EXISTS idx_egress_attempted\n"
-"ON bundle_data (egress_attempted);\n";
+"ON bundle_data (egress_attempted);\n"
+"\n"
+"CREATE INDEX IF NOT EXISTS idx_bundle_identity\n"
+"ON bundle_data (\n"
+"    create_time,\n"
+"    seq_num,\n"
+"    src_node,\n"
+"    src_service,\n"
+"    frag_offset\n"
+");\n";
 
 /* Expire Bundles */
 static const char* DiscardExpiredSQL =
@@ -108,6 +129,41 @@ static const char* DiscardEgressedSQL =
     "WHERE id IN (SELECT id FROM to_delete);";
 static sqlite3_stmt* DiscardEgressedStmt;
 
+/* Schema Versioning */
+/*
+ * The schema version is kept in the database's user_version. Version 0 is a database that was
+ * created before versioning, which may hold a bundle_data table without the priority and bundle
+ * identity columns. CREATE TABLE IF NOT EXISTS leaves such a table alone, so those columns are
+ * added here before the indexes that use them are created.
+ *
+ * Bundles stored before the upgrade are given normal priority and no identity, so they are
+ * still egressed but are never matched as duplicates of a received bundle.
+ */
+#define BPLIB_SQL_SCHEMA_VERSION 1
+
+static const char* const MigrateColumnNames[] = {
+    "priority",
+    "src_node",
+    "src_service",
+    "create_time",
+    "seq_num",
+    "frag_offset"
+};
+
+static const char* const MigrateColumnSQL[] = {
+    "ALTER TABLE bundle_data ADD COLUMN priority INTEGER DEFAULT 0;",
+    "ALTER TABLE bundle_data ADD COLUMN src_node INTEGER;",
+    "ALTER TABLE bundle_data ADD COLUMN src_service INTEGER;",
+    "ALTER TABLE bundle_data ADD COLUMN create_time INTEGER;",
+    "ALTER TABLE bundle_data ADD COLUMN seq_num INTEGER;",
+    "ALTER TABLE bundle_data ADD COLUMN frag_offset INTEGER;"
+};
+
+/* The old egress index is missing the priority column, it is recreated by CreateTableSQL */
+static const char* MigrateBackfillSQL =
+    "UPDATE bundle_data SET priority = 0 WHERE priority IS NULL;\n"
+    "DROP INDEX IF EXISTS idx_egress_id;\n";
+
 
 /*******************************************************************************
 ** Static Functions
@@ -176,6 +232,145 @@ static int BPLib_SQL_GetTotalBundleBytes(sqlite3* db, uint64_t* TotalBytes)
     return SQLStatus;
 }
 
+static int BPLib_SQL_GetSchemaVersion(sqlite3* db, int* Version)
+{
+    sqlite3_stmt* stmt;
+    int SQLStatus;
+
+    SQLStatus = sqlite3_prepare_v2(db, "PRAGMA user_version;", -1, &stmt, NULL);
+    if (SQLStatus != SQLITE_OK)
+    {
+        return SQLStatus;
+    }
+
+    SQLStatus = sqlite3_step(stmt);
+    if (SQLStatus == SQLITE_ROW)
+    {
+        *Version = sqlite3_column_int(stmt, 0);
+        SQLStatus = SQLITE_OK;
+    }
+    sqlite3_finalize(stmt);
+
+    return SQLStatus;
+}
+
+static int BPLib_SQL_HasColumn(sqlite3* db, const char* Column, bool* Found)
+{
+    sqlite3_stmt* stmt;
+    int SQLStatus;
+
+    *Found = false;
+
+    /* table_info returns no rows if bundle_data doesn't exist yet */
+    SQLStatus = sqlite3_prepare_v2(db, "SELECT 1 FROM pragma_table_info('bundle_data') WHERE name = ?;",
+        -1, &stmt, NULL);
+    if (SQLStatus != SQLITE_OK)
+    {
+        return SQLStatus;
+    }
+
+    SQLStatus = sqlite3_bind_text(stmt, 1, Column, -1, SQLITE_STATIC);
+    if (SQLStatus == SQLITE_OK)
+    {
+        SQLStatus = sqlite3_step(stmt);
+        if (SQLStatus == SQLITE_ROW)
+        {
+            *Found = true;
+            SQLStatus = SQLITE_OK;
+        }
+        else if (SQLStatus == SQLITE_DONE)
+        {
+            SQLStatus = SQLITE_OK;
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    return SQLStatus;
+}
+
+/* Brings an existing database up to BPLIB_SQL_SCHEMA_VERSION and creates any missing tables and
+** indexes. Runs as one transaction so a failed upgrade leaves the database as it was.
+*/
+static int BPLib_SQL_MigrateSchema(sqlite3* db)
+{
+    int SQLStatus;
+    int Version;
+    bool TableExists;
+    bool Found;
+    size_t i;
+    char SetVersionSQL[64];
+
+    Version = 0;
+    SQLStatus = BPLib_SQL_GetSchemaVersion(db, &Version);
+    if (SQLStatus != SQLITE_OK)
+    {
+        fprintf(stderr, "Failed to read the storage schema version: %s\n", sqlite3_errmsg(db));
+        return SQLStatus;
+    }
+
+    if (Version > BPLIB_SQL_SCHEMA_VERSION)
+    {
+        fprintf(stderr, "Storage schema version %d is newer than the supported version %d\n",
+                Version, BPLIB_SQL_SCHEMA_VERSION);
+        return SQLITE_MISMATCH;
+    }
+
+    SQLStatus = sqlite3_exec(db, "BEGIN;", 0, 0, NULL);
+    if (SQLStatus != SQLITE_OK)
+    {
+        return SQLStatus;
+    }
+
+    if (Version < BPLIB_SQL_SCHEMA_VERSION)
+    {
+        /* Any column a version 1 table has tells whether there is an old table to upgrade */
+        SQLStatus = BPLib_SQL_HasColumn(db, "id", &TableExists);
+        for (i = 0; SQLStatus == SQLITE_OK && TableExists &&
+             i < sizeof(MigrateColumnNames) / sizeof(MigrateColumnNames[0]); i++)
+        {
+            SQLStatus = BPLib_SQL_HasColumn(db, MigrateColumnNames[i], &Found);
+            if (SQLStatus == SQLITE_OK && !Found)
+            {
+                SQLStatus = sqlite3_exec(db, MigrateColumnSQL[i], 0, 0, NULL);
+            }
+        }
+
+        if (SQLStatus == SQLITE_OK && TableExists)
+        {
+            SQLStatus = sqlite3_exec(db, MigrateBackfillSQL, 0, 0, NULL);
+        }
+
+        if (SQLStatus != SQLITE_OK)
+        {
+            fprintf(stderr, "Failed to upgrade storage schema from version %d: %s\n",
+                    Version, sqlite3_errmsg(db));
+        }
+    }
+
+    /* Create the tables and indexes if they don't already exist */
+    if (SQLStatus == SQLITE_OK)
+    {
+        SQLStatus = sqlite3_exec(db, CreateTableSQL, 0, 0, NULL);
+    }
+
+    if (SQLStatus == SQLITE_OK && Version < BPLIB_SQL_SCHEMA_VERSION)
+    {
+        snprintf(SetVersionSQL, sizeof(SetVersionSQL), "PRAGMA user_version = %d;", BPLIB_SQL_SCHEMA_VERSION);
+        SQLStatus = sqlite3_exec(db, SetVersionSQL, 0, 0, NULL);
+    }
+
+    if (SQLStatus == SQLITE_OK)
+    {
+        SQLStatus = sqlite3_exec(db, "COMMIT;", 0, 0, NULL);
+    }
+    else
+    {
+        sqlite3_exec(db, "ROLLBACK;", 0, 0, NULL);
+    }
+
+    return SQLStatus;
+}
+
 static int BPLib_SQL_InitImpl(BPLib_Instance_t *Inst, sqlite3** db, const char* DbName)
 {
     int SQLStatus;
@@ -240,8 +435,8 @@ static int BPLib_SQL_InitImpl(BPLib_Instance_t *Inst, sqlite3** db, const char*
         return SQLITE_MISUSE;
     }
 
-    /* Create the table if it doesn't already exist */
-    SQLStatus = sqlite3_exec(ActiveDB, CreateTableSQL, 0, 0, NULL);
+    /* Upgrade an older database and create the tables if they don't already exist */
+    SQLStatus = BPLib_SQL_MigrateSchema(ActiveDB);
     if (SQLStatus != SQLITE_OK)
     {
         return SQLStatus;
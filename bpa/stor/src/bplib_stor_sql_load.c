@@ -45,9 +45,29 @@ static const char* MarkEgressedSQL =
     "UPDATE bundle_data SET egress_attempted = 1 WHERE id = ?;";
 static sqlite3_stmt* MarkEgressedStmt;
 
+/* Find bundle by identity */
+static const char* FindBundleSQL =
+    "SELECT 1 FROM bundle_data "
+    "WHERE create_time = ? AND seq_num = ? AND src_node = ? AND src_service = ? AND frag_offset = ? "
+    "LIMIT 1;";
+static sqlite3_stmt* FindBundleStmt;
+
 /*******************************************************************************
 ** Static Functions
 */
+
+/* DTN time an egress finishes sending Bytes, rounded up to the next millisecond */
+static uint64_t BPLib_SQL_SendFinishTime(const BPLib_SQL_EgressBudget_t* Budget, uint64_t Bytes)
+{
+    if (Budget->BitsPerCycle == 0)
+    {
+        return Budget->SendStart;
+    }
+
+    return Budget->SendStart + 
+        ((Bytes * 8 * BPLIB_RATE_CYCLE_MS) + Budget->BitsPerCycle - 1) / Budget->BitsPerCycle;
+}
+
 static int BPLib_SQL_LoadBundleImpl(BPLib_Instance_t* Inst, int64_t BundleID,
     BPLib_Bundle_t** Bundle)
 {
@@ -188,6 +208,7 @@ static int BPLib_SQL_LoadBundleImpl(BPLib_Instance_t* Inst, int64_t BundleID,
     {
         RetBundle = (BPLib_Bundle_t*)(BundleHead);
         RetBundle->blob = BundleHead->next;
+        BPLib_MEM_BundleIndexBlob(RetBundle);
         *Bundle = RetBundle;
 
         /* For consistency with other helpers, set status to SQLITE_OK */
@@ -204,11 +225,15 @@ static int BPLib_SQL_LoadBundleImpl(BPLib_Instance_t* Inst, int64_t BundleID,
 }
 
 static int BPLib_SQL_FindForEIDsImpl(BPLib_Instance_t* Inst, BPLib_STOR_LoadBatch_t* Batch, 
-    BPLib_EID_Pattern_t* DestEIDs, size_t NumEIDs, size_t MaxBundles)
+    BPLib_EID_Pattern_t* DestEIDs, size_t NumEIDs, size_t MaxBundles, const BPLib_SQL_EgressBudget_t* Budget)
 {
     int SQLStatus;
     sqlite3* db = Inst->BundleStorage.db;
     int CurrBundleID, i, BindIndex;
+    uint64_t ExpireTime;
+    uint64_t BundleBytes;
+    uint64_t FinishTime;
+    uint64_t LoadedBytes = 0;
 
     /* Bind parameters for metadata query */
     sqlite3_reset(FindForEgressIDStmt);
@@ -240,7 +265,11 @@ static int BPLib_SQL_FindForEIDsImpl(BPLib_Instance_t* Inst, BPLib_STOR_LoadBatc
             return SQLStatus;
         }
     }
-    SQLStatus = sqlite3_bind_int64(FindForEgressIDStmt, BindIndex++, MaxBundles);
+    /* Rows left out for the budget would otherwise use up the limit, so with a budget the
+    ** query runs until the batch is full or sending has run to the end. A negative limit
+    ** means no limit to SQLite.
+    */
+    SQLStatus = sqlite3_bind_int64(FindForEgressIDStmt, BindIndex++, (Budget != NULL) ? -1 : (int64_t) MaxBundles);
     if (SQLStatus != SQLITE_OK)
     {
         fprintf(stderr, "Failed to bind limit: %s\n", sqlite3_errmsg(db));
@@ -253,6 +282,30 @@ static int BPLib_SQL_FindForEIDsImpl(BPLib_Instance_t* Inst, BPLib_STOR_LoadBatc
     {
         /* Load a single bundle from storage that matches the query */
         CurrBundleID = sqlite3_column_int64(FindForEgressIDStmt, 0);
+
+        /* Leave bundles that cannot be sent in time for a later egress, smaller bundles
+        ** further down may still fit in what is left
+        */
+        if (Budget != NULL)
+        {
+            ExpireTime = (uint64_t)sqlite3_column_int64(FindForEgressIDStmt, 1);
+            BundleBytes = (uint64_t)sqlite3_column_int64(FindForEgressIDStmt, 2);
+            FinishTime = BPLib_SQL_SendFinishTime(Budget, LoadedBytes + BundleBytes);
+            if ((FinishTime > ExpireTime) || ((Budget->SendEnd != 0) && (FinishTime > Budget->SendEnd)))
+            {
+                /* Nothing else fits once sending has already run to the end */
+                if ((Budget->SendEnd != 0) && (BPLib_SQL_SendFinishTime(Budget, LoadedBytes) >= Budget->SendEnd))
+                {
+                    break;
+                }
+
+                SQLStatus = sqlite3_step(FindForEgressIDStmt);
+                continue;
+            }
+
+            LoadedBytes += BundleBytes;
+        }
+
         if (BPLib_STOR_LoadBatch_AddID(Batch, CurrBundleID) != BPLIB_SUCCESS)
         {
             break;
@@ -261,9 +314,53 @@ static int BPLib_SQL_FindForEIDsImpl(BPLib_Instance_t* Inst, BPLib_STOR_LoadBatc
         /* Go to the next row, which corresponds to the next bundle ID */
         SQLStatus = sqlite3_step(FindForEgressIDStmt);
     }
-    if (SQLStatus == SQLITE_DONE)
+    if ((SQLStatus == SQLITE_DONE) || (SQLStatus == SQLITE_ROW))
+    {
+        /* For consistency with other helpers, convert DONE to OK. A ROW means the batch
+        ** was filled before the query ran out of bundles.
+        */
+        SQLStatus = SQLITE_OK;
+    }
+
+    /* Expecting SQLITE_OK */
+    return SQLStatus;
+}
+
+static int BPLib_SQL_FindBundleImpl(const BPLib_PrimaryBlock_t* PrimaryBlock, bool* Found)
+{
+    int SQLStatus;
+
+    SQLStatus = sqlite3_bind_int64(FindBundleStmt, 1, (int64_t)PrimaryBlock->Timestamp.CreateTime);
+    if (SQLStatus == SQLITE_OK)
+    {
+        SQLStatus = sqlite3_bind_int64(FindBundleStmt, 2, (int64_t)PrimaryBlock->Timestamp.SequenceNumber);
+    }
+    if (SQLStatus == SQLITE_OK)
+    {
+        SQLStatus = sqlite3_bind_int64(FindBundleStmt, 3, (int64_t)PrimaryBlock->SrcEID.Node);
+    }
+    if (SQLStatus == SQLITE_OK)
+    {
+        SQLStatus = sqlite3_bind_int64(FindBundleStmt, 4, (int64_t)PrimaryBlock->SrcEID.Service);
+    }
+    if (SQLStatus == SQLITE_OK)
+    {
+        SQLStatus = sqlite3_bind_int64(FindBundleStmt, 5, (int64_t)PrimaryBlock->FragmentOffset);
+    }
+    if (SQLStatus != SQLITE_OK)
+    {
+        return SQLStatus;
+    }
+
+    SQLStatus = sqlite3_step(FindBundleStmt);
+    if (SQLStatus == SQLITE_ROW)
+    {
+        *Found = true;
+        SQLStatus = SQLITE_OK;
+    }
+    else if (SQLStatus == SQLITE_DONE)
     {
-        /* For consistency with other helpers, convert DONE to OK */
+        *Found = false;
         SQLStatus = SQLITE_OK;
     }
 
@@ -334,7 +431,7 @@ static bool BPLib_SQL_HasOverflowed(size_t PrevOffset, size_t NewOffset)
 ** Exported Functions
 */
 BPLib_Status_t BPLib_SQL_FindForEIDs(BPLib_Instance_t* Inst, BPLib_STOR_LoadBatch_t* Batch,
-    BPLib_EID_Pattern_t* DestEIDs, size_t NumEIDs)
+    BPLib_EID_Pattern_t* DestEIDs, size_t NumEIDs, const BPLib_SQL_EgressBudget_t* Budget)
 {
     BPLib_Status_t Status = BPLIB_SUCCESS;
     int SQLStatus, i;
@@ -388,9 +485,12 @@ BPLib_Status_t BPLib_SQL_FindForEIDs(BPLib_Instance_t* Inst, BPLib_STOR_LoadBatc
     }
     WhereClause[Offset] = '\0';
 
-    /* Build the final query */
+    /* Build the final query. Link time goes to the most important bundles first, then to the
+    ** ones closest to expiring, then to the smallest so more of them get through.
+    */
     Offset = snprintf(FindForEgressIdSQL, sizeof(FindForEgressIdSQL),
-        "SELECT id FROM bundle_data WHERE (%s) AND egress_attempted = 0 ORDER BY action_timestamp ASC LIMIT ?;",
+        "SELECT id, action_timestamp, bundle_bytes FROM bundle_data WHERE (%s) AND egress_attempted = 0 "
+        "ORDER BY priority DESC, action_timestamp ASC, bundle_bytes ASC LIMIT ?;",
         WhereClause);
    
     if (Offset >= sizeof(FindForEgressIdSQL))
@@ -411,7 +511,7 @@ BPLib_Status_t BPLib_SQL_FindForEIDs(BPLib_Instance_t* Inst, BPLib_STOR_LoadBatc
     if (Status == BPLIB_SUCCESS)
     {
         /* Run Batch Load Logic */
-        SQLStatus = BPLib_SQL_FindForEIDsImpl(Inst, Batch, DestEIDs, NumEIDs, BPLIB_STOR_LOADBATCHSIZE);
+        SQLStatus = BPLib_SQL_FindForEIDsImpl(Inst, Batch, DestEIDs, NumEIDs, BPLIB_STOR_LOADBATCHSIZE, Budget);
         if (SQLStatus != SQLITE_OK)
         {
             Status = BPLIB_STOR_SQL_LOAD_IDS_ERR;
@@ -501,3 +601,36 @@ BPLib_Status_t BPLib_SQL_LoadBundle(BPLib_Instance_t* Inst, int64_t BundleID, BP
 
     return Status;
 }
+
+BPLib_Status_t BPLib_SQL_FindBundle(BPLib_Instance_t* Inst, const BPLib_PrimaryBlock_t* PrimaryBlock, bool* Found)
+{
+    int SQLStatus;
+    sqlite3* db;
+    BPLib_Status_t Status = BPLIB_SUCCESS;
+
+    if ((Inst == NULL) || (PrimaryBlock == NULL) || (Found == NULL))
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    db = Inst->BundleStorage.db;
+    *Found = false;
+
+    SQLStatus = sqlite3_prepare_v2(db, FindBundleSQL, -1, &FindBundleStmt, 0);
+    if (SQLStatus != SQLITE_OK)
+    {
+        fprintf(stderr, "Programming Error: FindBundleSQL prepare failed, error=%s\n", sqlite3_errmsg(db));
+        return BPLIB_STOR_SQL_LOAD_ERR;
+    }
+
+    SQLStatus = BPLib_SQL_FindBundleImpl(PrimaryBlock, Found);
+    if (SQLStatus != SQLITE_OK)
+    {
+        fprintf(stderr, "FindBundleSQL failed, error=%s\n", sqlite3_errmsg(db));
+        Status = BPLIB_STOR_SQL_LOAD_ERR;
+    }
+
+    sqlite3_finalize(FindBundleStmt);
+
+    return Status;
+}
@@ -29,7 +29,8 @@
 
 /* Insert Bundle Metadata */
 static const char* InsertMetadataSQL = 
-    "INSERT INTO bundle_data (action_timestamp, dest_node, dest_service, bundle_bytes) VALUES (?, ?, ?, ?);";
+    "INSERT INTO bundle_data (action_timestamp, dest_node, dest_service, bundle_bytes, priority, "
+    "src_node, src_service, create_time, seq_num, frag_offset) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
 static sqlite3_stmt* InsertMetadataStmt;
 
 /* Insert Bundle Blob */
@@ -40,6 +41,33 @@ static sqlite3_stmt* InsertBlobStmt;
 /*******************************************************************************
 ** Static Functions
 */
+/* Bind the fields that identify a bundle, used to find stored duplicates */
+static int BPLib_SQL_BindIdentity(BPLib_Bundle_t* Bundle)
+{
+    int SQLStatus;
+    BPLib_PrimaryBlock_t* PrimaryBlock = &Bundle->blocks.PrimaryBlock;
+
+    SQLStatus = sqlite3_bind_int64(InsertMetadataStmt, 6, (int64_t)PrimaryBlock->SrcEID.Node);
+    if (SQLStatus == SQLITE_OK)
+    {
+        SQLStatus = sqlite3_bind_int64(InsertMetadataStmt, 7, (int64_t)PrimaryBlock->SrcEID.Service);
+    }
+    if (SQLStatus == SQLITE_OK)
+    {
+        SQLStatus = sqlite3_bind_int64(InsertMetadataStmt, 8, (int64_t)PrimaryBlock->Timestamp.CreateTime);
+    }
+    if (SQLStatus == SQLITE_OK)
+    {
+        SQLStatus = sqlite3_bind_int64(InsertMetadataStmt, 9, (int64_t)PrimaryBlock->Timestamp.SequenceNumber);
+    }
+    if (SQLStatus == SQLITE_OK)
+    {
+        SQLStatus = sqlite3_bind_int64(InsertMetadataStmt, 10, (int64_t)PrimaryBlock->FragmentOffset);
+    }
+
+    return SQLStatus;
+}
+
 static int BPLib_SQL_StoreMetadata(BPLib_Bundle_t* Bundle, BPLib_BundleCache_t* BundleCache)
 {
     int SQLStatus;
@@ -64,7 +92,27 @@ static int BPLib_SQL_StoreMetadata(BPLib_Bundle_t* Bundle, BPLib_BundleCache_t*
                 SQLStatus = sqlite3_bind_int64(InsertMetadataStmt, 4, (int64_t)Bundle->Meta.TotalBytes);
                 if (SQLStatus == SQLITE_OK)
                 {
-                    SQLStatus = sqlite3_step(InsertMetadataStmt);
+                    /* Add the egress priority to the InsertMetadataStmt variable */
+                    SQLStatus = sqlite3_bind_int(InsertMetadataStmt, 5,
+                        (Bundle->blocks.PrimaryBlock.BundleProcFlags & BPLIB_BUNDLE_PROC_ADMIN_RECORD_FLAG) ?
+                        BPLIB_STOR_PRIORITY_ADMIN : BPLIB_STOR_PRIORITY_NORMAL);
+                    if (SQLStatus == SQLITE_OK)
+                    {
+                        /* Add the source and creation timestamp to the InsertMetadataStmt variable */
+                        SQLStatus = BPLib_SQL_BindIdentity(Bundle);
+                        if (SQLStatus == SQLITE_OK)
+                        {
+                            SQLStatus = sqlite3_step(InsertMetadataStmt);
+                        }
+                        else
+                        {
+                            fprintf(stderr, "Failed to bind bundle identity in store_meta\n");
+                        }
+                    }
+                    else
+                    {
+                        fprintf(stderr, "Failed to bind priority in store_meta\n");
+                    }
                 }
                 else
                 {
@@ -23,6 +23,9 @@
  */
 #include "bplib_stor_test_utils.h"
 #include "bplib_nc.h"
+#include "bplib_cla_handlers.h"
+
+#include <string.h>
 
 /*******************************************************************************
 ** EgressForID Tests
@@ -220,6 +223,138 @@ void Test_BPLib_STOR_EgressForID_SQLFail(void)
     UtAssert_INT32_EQ(context_BPLib_EM_SendEvent[0].EventID, BPLIB_STOR_SQL_LOAD_ERR_EID);
 }
 
+/* Store a test bundle for node 100 service 1 with the given attributes */
+static void BPLib_STOR_Test_StoreSelectionBundle(BPLib_Bundle_t* Bundle, uint64_t CreateTime,
+    uint64_t Lifetime, size_t TotalBytes, uint64_t ProcFlags)
+{
+    BPLib_STOR_Test_CreateTestBundle(Bundle);
+    Bundle->blocks.PrimaryBlock.Timestamp.CreateTime = CreateTime;
+    Bundle->blocks.PrimaryBlock.Lifetime = Lifetime;
+    Bundle->blocks.PrimaryBlock.BundleProcFlags = ProcFlags;
+    Bundle->Meta.TotalBytes = TotalBytes;
+    BPLib_STOR_StoreBundle(&BplibInst, Bundle);
+}
+
+/* Test STOR_EgressForID loads by priority, then expiry, then size */
+void Test_BPLib_STOR_EgressForID_SelectionOrder(void)
+{
+    BPLib_Bundle_t Bundles[4];
+    BPLib_STOR_LoadBatch_t* Batch = &BplibInst.BundleStorage.ContactLoadBatches[0];
+    size_t NumEgressed = 0;
+    uint32_t i;
+
+    BPLib_NC_ConfigPtrs.ContactsConfigPtr->ContactSet[0].DestEIDs[0].MaxNode = 100;
+    BPLib_NC_ConfigPtrs.ContactsConfigPtr->ContactSet[0].DestEIDs[0].MinNode = 100;
+    BPLib_NC_ConfigPtrs.ContactsConfigPtr->ContactSet[0].DestEIDs[0].MaxService = 1;
+    BPLib_NC_ConfigPtrs.ContactsConfigPtr->ContactSet[0].DestEIDs[0].MinService = 1;
+
+    /* IDs 1 to 4 in storage */
+    BPLib_STOR_Test_StoreSelectionBundle(&Bundles[0], 1000000, 5000, 1000, 0);
+    BPLib_STOR_Test_StoreSelectionBundle(&Bundles[1], 1000000, 1000, 1000, 0);
+    BPLib_STOR_Test_StoreSelectionBundle(&Bundles[2], 1000000, 9000, 1000, BPLIB_BUNDLE_PROC_ADMIN_RECORD_FLAG);
+    BPLib_STOR_Test_StoreSelectionBundle(&Bundles[3], 1000000, 1000, 500, 0);
+    BPLib_STOR_FlushPending(&BplibInst);
+
+    /* Without DTN time nothing is left out, only ordered */
+    UtAssert_INT32_EQ(BPLib_STOR_EgressForID(&BplibInst, 0, false, &NumEgressed), BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(Batch->Size, 4);
+    UtAssert_INT32_EQ(Batch->BundleIDs[0], 3);
+    UtAssert_INT32_EQ(Batch->BundleIDs[1], 4);
+    UtAssert_INT32_EQ(Batch->BundleIDs[2], 2);
+    UtAssert_INT32_EQ(Batch->BundleIDs[3], 1);
+
+    for (i = 0; i < 4; i++)
+    {
+        BPLib_STOR_Test_FreeTestBundle(&Bundles[i]);
+    }
+}
+
+/* Test STOR_EgressForID leaves out bundles the contact cannot send in time */
+void Test_BPLib_STOR_EgressForID_WindowFit(void)
+{
+    BPLib_Bundle_t Bundles[5];
+    BPLib_STOR_LoadBatch_t* Batch = &BplibInst.BundleStorage.ContactLoadBatches[0];
+    BPLib_CLA_EgressWindow_t Window;
+    size_t NumEgressed = 0;
+    uint64_t Now = 1000000;
+    uint32_t i;
+
+    BPLib_NC_ConfigPtrs.ContactsConfigPtr->ContactSet[0].DestEIDs[0].MaxNode = 100;
+    BPLib_NC_ConfigPtrs.ContactsConfigPtr->ContactSet[0].DestEIDs[0].MinNode = 100;
+    BPLib_NC_ConfigPtrs.ContactsConfigPtr->ContactSet[0].DestEIDs[0].MaxService = 1;
+    BPLib_NC_ConfigPtrs.ContactsConfigPtr->ContactSet[0].DestEIDs[0].MinService = 1;
+
+    /* The window ends in 2.6 seconds and sends 1000 bytes a second */
+    memset(&Window, 0, sizeof(Window));
+    Window.EndTime = Now + 2600;
+    Window.BitsPerCycle = 8000;
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), Now);
+    UT_SetHandlerFunction(UT_KEY(BPLib_CLA_GetEgressWindow), UT_Handler_BPLib_CLA_GetEgressWindow, NULL);
+    UT_SetDataBuffer(UT_KEY(BPLib_CLA_GetEgressWindow), &Window, sizeof(Window), false);
+
+    /* IDs 1 to 5 in storage */
+    BPLib_STOR_Test_StoreSelectionBundle(&Bundles[0], Now, 10000, 1000, 0); /* Sent second */
+    BPLib_STOR_Test_StoreSelectionBundle(&Bundles[1], Now, 1500, 1000, 0);  /* Sent first, just in time */
+    BPLib_STOR_Test_StoreSelectionBundle(&Bundles[2], Now, 10000, 1500, 0); /* Does not fit the window */
+    BPLib_STOR_Test_StoreSelectionBundle(&Bundles[3], Now, 20000, 500, 0);  /* Fits what is left */
+    BPLib_STOR_Test_StoreSelectionBundle(&Bundles[4], Now, 500, 1000, 0);   /* Expires before it is sent */
+    BPLib_STOR_FlushPending(&BplibInst);
+
+    UtAssert_INT32_EQ(BPLib_STOR_EgressForID(&BplibInst, 0, false, &NumEgressed), BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(Batch->Size, 3);
+    UtAssert_INT32_EQ(Batch->BundleIDs[0], 2);
+    UtAssert_INT32_EQ(Batch->BundleIDs[1], 1);
+    UtAssert_INT32_EQ(Batch->BundleIDs[2], 4);
+
+    for (i = 0; i < 5; i++)
+    {
+        BPLib_STOR_Test_FreeTestBundle(&Bundles[i]);
+    }
+}
+
+/* Test STOR_EgressForID steps past more bundles that do not fit than a load batch holds */
+void Test_BPLib_STOR_EgressForID_WindowFitSkipsMany(void)
+{
+    BPLib_Bundle_t Expiring;
+    BPLib_Bundle_t Fits;
+    BPLib_STOR_LoadBatch_t* Batch = &BplibInst.BundleStorage.ContactLoadBatches[0];
+    BPLib_CLA_EgressWindow_t Window;
+    size_t NumEgressed = 0;
+    uint64_t Now = 1000000;
+    uint32_t i;
+
+    BPLib_NC_ConfigPtrs.ContactsConfigPtr->ContactSet[0].DestEIDs[0].MaxNode = 100;
+    BPLib_NC_ConfigPtrs.ContactsConfigPtr->ContactSet[0].DestEIDs[0].MinNode = 100;
+    BPLib_NC_ConfigPtrs.ContactsConfigPtr->ContactSet[0].DestEIDs[0].MaxService = 1;
+    BPLib_NC_ConfigPtrs.ContactsConfigPtr->ContactSet[0].DestEIDs[0].MinService = 1;
+
+    memset(&Window, 0, sizeof(Window));
+    Window.BitsPerCycle = 8000;
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), Now);
+    UT_SetHandlerFunction(UT_KEY(BPLib_CLA_GetEgressWindow), UT_Handler_BPLib_CLA_GetEgressWindow, NULL);
+    UT_SetDataBuffer(UT_KEY(BPLib_CLA_GetEgressWindow), &Window, sizeof(Window), false);
+
+    /* More bundles that expire before they could be sent than a batch holds are selected
+    ** first, the one that fits comes after all of them
+    */
+    BPLib_STOR_Test_CreateTestBundle(&Expiring);
+    Expiring.blocks.PrimaryBlock.Timestamp.CreateTime = Now;
+    Expiring.blocks.PrimaryBlock.Lifetime = 500;
+    for (i = 0; i <= BPLIB_STOR_LOADBATCHSIZE; i++)
+    {
+        BPLib_STOR_StoreBundle(&BplibInst, &Expiring);
+    }
+    BPLib_STOR_Test_StoreSelectionBundle(&Fits, Now, 10000, 1000, 0);
+    BPLib_STOR_FlushPending(&BplibInst);
+
+    UtAssert_INT32_EQ(BPLib_STOR_EgressForID(&BplibInst, 0, false, &NumEgressed), BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(Batch->Size, 1);
+    UtAssert_INT32_EQ(Batch->BundleIDs[0], BPLIB_STOR_LOADBATCHSIZE + 2);
+
+    BPLib_STOR_Test_FreeTestBundle(&Expiring);
+    BPLib_STOR_Test_FreeTestBundle(&Fits);
+}
+
 void TestBplib_STOR_Load_Register(void)
 {
     /* Load (Egress) Tests */
@@ -229,4 +364,7 @@ void TestBplib_STOR_Load_Register(void)
     UtTest_Add(Test_BPLib_STOR_EgressForID_WaitQueuePushFail, BPLib_STOR_Test_SetupOneBundleStored, BPLib_STOR_Test_TeardownOneBundleStored, "Test_BPLib_STOR_Egress_WaitQueuePushFail");
     UtTest_Add(Test_BPLib_STOR_EgressForID_NoBundles, BPLib_STOR_Test_SetupOneBundleStored, BPLib_STOR_Test_TeardownOneBundleStored, "Test_BPLib_STOR_EgressForID_NoBundles");
     UtTest_Add(Test_BPLib_STOR_EgressForID_SQLFail, BPLib_STOR_Test_SetupOneBundleStored, BPLib_STOR_Test_TeardownOneBundleStored, "Test_BPLib_STOR_Egress_SQLFail");
+    UtTest_Add(Test_BPLib_STOR_EgressForID_SelectionOrder, BPLib_STOR_Test_Setup, BPLib_STOR_Test_Teardown, "Test_BPLib_STOR_EgressForID_SelectionOrder");
+    UtTest_Add(Test_BPLib_STOR_EgressForID_WindowFit, BPLib_STOR_Test_Setup, BPLib_STOR_Test_Teardown, "Test_BPLib_STOR_EgressForID_WindowFit");
+    UtTest_Add(Test_BPLib_STOR_EgressForID_WindowFitSkipsMany, BPLib_STOR_Test_Setup, BPLib_STOR_Test_Teardown, "Test_BPLib_STOR_EgressForID_WindowFitSkipsMany");
 }
@@ -188,6 +188,73 @@ void Test_BPLib_STOR_StoreBundle_StoreBatch(void)
     BPLib_STOR_Test_FreeTestBundle(&Bundle);
 }
 
+/* Test FindDuplicate rejects NULL parameters */
+void Test_BPLib_STOR_FindDuplicate_NullParams(void)
+{
+    BPLib_Bundle_t Bundle;
+    bool Found;
+
+    UtAssert_INT32_EQ(BPLib_STOR_FindDuplicate(NULL, &Bundle, &Found), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_STOR_FindDuplicate(&BplibInst, NULL, &Found), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_STOR_FindDuplicate(&BplibInst, &Bundle, NULL), BPLIB_NULL_PTR_ERROR);
+}
+
+/* Test FindDuplicate finds bundles both waiting for the batch insert and in the database */
+void Test_BPLib_STOR_FindDuplicate_Nominal(void)
+{
+    BPLib_Bundle_t Bundle;
+    BPLib_Bundle_t Copy;
+    bool Found;
+
+    BPLib_STOR_Test_CreateTestBundle(&Bundle);
+    Bundle.blocks.PrimaryBlock.SrcEID.Node = 30;
+    Bundle.blocks.PrimaryBlock.SrcEID.Service = 2;
+    Bundle.blocks.PrimaryBlock.Timestamp.SequenceNumber = 12;
+    Bundle.blocks.PrimaryBlock.FragmentOffset = 500;
+    memcpy(&Copy, &Bundle, sizeof(Copy));
+
+    /* Nothing stored yet */
+    Found = true;
+    UtAssert_INT32_EQ(BPLib_STOR_FindDuplicate(&BplibInst, &Copy, &Found), BPLIB_SUCCESS);
+    UtAssert_BOOL_FALSE(Found);
+
+    /* Pending insert */
+    UtAssert_INT32_EQ(BPLib_STOR_StoreBundle(&BplibInst, &Bundle), BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(BPLib_STOR_FindDuplicate(&BplibInst, &Copy, &Found), BPLIB_SUCCESS);
+    UtAssert_BOOL_TRUE(Found);
+
+    /* In the database */
+    UtAssert_INT32_EQ(BPLib_STOR_FlushPending(&BplibInst), BPLIB_SUCCESS);
+    Found = false;
+    UtAssert_INT32_EQ(BPLib_STOR_FindDuplicate(&BplibInst, &Copy, &Found), BPLIB_SUCCESS);
+    UtAssert_BOOL_TRUE(Found);
+
+    /* Any difference in the identity is a different bundle */
+    Copy.blocks.PrimaryBlock.FragmentOffset = 0;
+    UtAssert_INT32_EQ(BPLib_STOR_FindDuplicate(&BplibInst, &Copy, &Found), BPLIB_SUCCESS);
+    UtAssert_BOOL_FALSE(Found);
+
+    Copy.blocks.PrimaryBlock.FragmentOffset = 500;
+    Copy.blocks.PrimaryBlock.SrcEID.Node = 31;
+    UtAssert_INT32_EQ(BPLib_STOR_FindDuplicate(&BplibInst, &Copy, &Found), BPLIB_SUCCESS);
+    UtAssert_BOOL_FALSE(Found);
+
+    BPLib_STOR_Test_FreeTestBundle(&Bundle);
+}
+
+/* Test FindDuplicate reports database errors */
+void Test_BPLib_STOR_FindDuplicate_SQLFail(void)
+{
+    BPLib_Bundle_t Bundle;
+    bool Found;
+
+    memset(&Bundle, 0, sizeof(Bundle));
+    BplibInst.BundleStorage.db = NULL;
+
+    UtAssert_INT32_EQ(BPLib_STOR_FindDuplicate(&BplibInst, &Bundle, &Found), BPLIB_STOR_SQL_LOAD_ERR);
+    UtAssert_BOOL_FALSE(Found);
+}
+
 void TestBplib_STOR_Store_Register(void)
 {
     /* Store Tests */
@@ -201,4 +268,9 @@ void TestBplib_STOR_Store_Register(void)
     UtTest_Add(Test_BPLib_STOR_FlushPending_NoBundles, BPLib_STOR_Test_Setup, BPLib_STOR_Test_Teardown, "Test_BPLib_STOR_FlushPending_NoBundles");
     UtTest_Add(Test_BPLib_STOR_FlushPending_Nominal, BPLib_STOR_Test_Setup, BPLib_STOR_Test_Teardown, "Test_BPLib_STOR_FlushPending_Nominal");
     UtTest_Add(Test_BPLib_STOR_FlushPending_SQLFail, BPLib_STOR_Test_Setup, BPLib_STOR_Test_Teardown, "Test_BPLib_STOR_FlushPending_SQLFail");
+
+    /* FindDuplicate Tests */
+    UtTest_Add(Test_BPLib_STOR_FindDuplicate_NullParams, BPLib_STOR_Test_Setup, BPLib_STOR_Test_Teardown, "Test_BPLib_STOR_FindDuplicate_NullParams");
+    UtTest_Add(Test_BPLib_STOR_FindDuplicate_Nominal, BPLib_STOR_Test_Setup, BPLib_STOR_Test_Teardown, "Test_BPLib_STOR_FindDuplicate_Nominal");
+    UtTest_Add(Test_BPLib_STOR_FindDuplicate_SQLFail, BPLib_STOR_Test_Setup, BPLib_STOR_Test_Teardown, "Test_BPLib_STOR_FindDuplicate_SQLFail");
 }
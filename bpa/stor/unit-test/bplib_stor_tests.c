@@ -26,6 +26,35 @@
 #include "bplib_qm_handlers.h"
 
 #include <stdlib.h>
+#include <stdio.h>
+
+#define BPLIB_STOR_TEST_OLD_DBNAME "bplib-storage-migrate-test.db"
+
+/* Creates a database with the bundle_data table as it was before the schema was versioned */
+static void BPLib_STOR_Test_CreateOldDb(int Version)
+{
+    sqlite3* db;
+    char SQL[64];
+
+    remove(BPLIB_STOR_TEST_OLD_DBNAME);
+    UtAssert_INT32_EQ(sqlite3_open(BPLIB_STOR_TEST_OLD_DBNAME, &db), SQLITE_OK);
+    UtAssert_INT32_EQ(sqlite3_exec(db,
+        "CREATE TABLE bundle_data (id INTEGER PRIMARY KEY AUTOINCREMENT, action_timestamp INTEGER, "
+        "egress_attempted INTEGER DEFAULT 0, dest_node INTEGER, dest_service INTEGER, bundle_bytes INTEGER);"
+        "CREATE INDEX idx_egress_id ON bundle_data (dest_node, dest_service, egress_attempted, action_timestamp, id);"
+        "INSERT INTO bundle_data (action_timestamp, dest_node, dest_service, bundle_bytes) VALUES (1, 2, 3, 100);",
+        0, 0, NULL), SQLITE_OK);
+    snprintf(SQL, sizeof(SQL), "PRAGMA user_version = %d;", Version);
+    UtAssert_INT32_EQ(sqlite3_exec(db, SQL, 0, 0, NULL), SQLITE_OK);
+    sqlite3_close(db);
+}
+
+static void BPLib_STOR_Test_RemoveOldDb(void)
+{
+    remove(BPLIB_STOR_TEST_OLD_DBNAME);
+    remove(BPLIB_STOR_TEST_OLD_DBNAME "-wal");
+    remove(BPLIB_STOR_TEST_OLD_DBNAME "-shm");
+}
 
 /*
 ** Test function for
@@ -50,6 +79,59 @@ void Test_BPLib_STOR_InitStoredCount(void)
     UtAssert_EQ(uint32_t, BplibInst.BundleStorage.BundleCountStored, 1);
 }
 
+/* Test an existing database from before the priority and identity columns is upgraded in place */
+void Test_BPLib_STOR_InitMigratesOldSchema(void)
+{
+    BPLib_Instance_t OldInst;
+    sqlite3_stmt* stmt;
+
+    memset(&OldInst, 0, sizeof(OldInst));
+    BPLib_STOR_Test_CreateOldDb(0);
+
+    UtAssert_INT32_EQ(BPLib_SQL_Init(&OldInst, BPLIB_STOR_TEST_OLD_DBNAME), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(OldInst.BundleStorage.BundleCountStored, 1);
+    UtAssert_UINT32_EQ(OldInst.BundleStorage.BytesStorageInUse, 100);
+
+    /* The stored bundle kept its data and has normal priority and no identity */
+    UtAssert_INT32_EQ(sqlite3_prepare_v2(OldInst.BundleStorage.db,
+        "SELECT priority, create_time, bundle_bytes FROM bundle_data ORDER BY priority DESC;", -1, &stmt, NULL),
+        SQLITE_OK);
+    UtAssert_INT32_EQ(sqlite3_step(stmt), SQLITE_ROW);
+    UtAssert_INT32_EQ(sqlite3_column_int(stmt, 0), BPLIB_STOR_PRIORITY_NORMAL);
+    UtAssert_INT32_EQ(sqlite3_column_type(stmt, 1), SQLITE_NULL);
+    UtAssert_INT32_EQ(sqlite3_column_int(stmt, 2), 100);
+    sqlite3_finalize(stmt);
+
+    /* The egress index was rebuilt with the priority column */
+    UtAssert_INT32_EQ(sqlite3_prepare_v2(OldInst.BundleStorage.db,
+        "SELECT 1 FROM pragma_index_info('idx_egress_id') WHERE name = 'priority';", -1, &stmt, NULL), SQLITE_OK);
+    UtAssert_INT32_EQ(sqlite3_step(stmt), SQLITE_ROW);
+    sqlite3_finalize(stmt);
+
+    UtAssert_INT32_EQ(sqlite3_prepare_v2(OldInst.BundleStorage.db, "PRAGMA user_version;", -1, &stmt, NULL),
+        SQLITE_OK);
+    UtAssert_INT32_EQ(sqlite3_step(stmt), SQLITE_ROW);
+    UtAssert_INT32_EQ(sqlite3_column_int(stmt, 0), 1);
+    sqlite3_finalize(stmt);
+
+    sqlite3_close(OldInst.BundleStorage.db);
+    BPLib_STOR_Test_RemoveOldDb();
+}
+
+/* Test a database written by a newer schema version is refused */
+void Test_BPLib_STOR_InitNewerSchema(void)
+{
+    BPLib_Instance_t NewInst;
+
+    memset(&NewInst, 0, sizeof(NewInst));
+    BPLib_STOR_Test_CreateOldDb(99);
+
+    UtAssert_INT32_EQ(BPLib_SQL_Init(&NewInst, BPLIB_STOR_TEST_OLD_DBNAME), BPLIB_STOR_SQL_INIT_ERR);
+
+    sqlite3_close(NewInst.BundleStorage.db);
+    BPLib_STOR_Test_RemoveOldDb();
+}
+
 /* Test Destroy runs without segfault */
 void Test_BPLib_STOR_Destroy(void)
 {
@@ -86,14 +168,14 @@ void Test_BPLib_STOR_GarbageCollect_NominalExpired(void)
     UtAssert_INT32_EQ(BPLib_STOR_GarbageCollect(&BplibInst), BPLIB_SUCCESS);
 
     UtAssert_EQ(BPLib_AS_Counter_t, BUNDLE_COUNT_DELETED_EXPIRED, 
-                                                Context_BPLib_AS_Increment[0].Counter);
-    UtAssert_INT32_EQ(0, Context_BPLib_AS_Increment[0].Amount);
+                                                Context_BPLib_AS_IncrementSlot[0].Counter);
+    UtAssert_INT32_EQ(0, Context_BPLib_AS_IncrementSlot[0].Amount);
     UtAssert_EQ(BPLib_AS_Counter_t, BUNDLE_COUNT_DELETED, 
-                                                Context_BPLib_AS_Increment[1].Counter);
-    UtAssert_INT32_EQ(0, Context_BPLib_AS_Increment[1].Amount);
+                                                Context_BPLib_AS_IncrementSlot[1].Counter);
+    UtAssert_INT32_EQ(0, Context_BPLib_AS_IncrementSlot[1].Amount);
     UtAssert_EQ(BPLib_AS_Counter_t, BUNDLE_COUNT_DISCARDED, 
-                                                Context_BPLib_AS_Increment[2].Counter);
-    UtAssert_INT32_EQ(0, Context_BPLib_AS_Increment[2].Amount);
+                                                Context_BPLib_AS_IncrementSlot[2].Counter);
+    UtAssert_INT32_EQ(0, Context_BPLib_AS_IncrementSlot[2].Amount);
     UtAssert_EQ(uint32_t, BplibInst.BundleStorage.BundleCountStored, 1);
 
     /* Skip counters 3,4 which are for DiscardEgressed */
@@ -102,14 +184,14 @@ void Test_BPLib_STOR_GarbageCollect_NominalExpired(void)
     UT_SetDeferredRetcode(UT_KEY(BPA_TIMEP_GetHostTime), 1, INT64_MAX);
     UtAssert_INT32_EQ(BPLib_STOR_GarbageCollect(&BplibInst), BPLIB_SUCCESS);
     UtAssert_EQ(BPLib_AS_Counter_t, BUNDLE_COUNT_DELETED_EXPIRED, 
-                                                Context_BPLib_AS_Increment[5].Counter);
-    UtAssert_INT32_EQ(1, Context_BPLib_AS_Increment[5].Amount);
+                                                Context_BPLib_AS_IncrementSlot[5].Counter);
+    UtAssert_INT32_EQ(1, Context_BPLib_AS_IncrementSlot[5].Amount);
     UtAssert_EQ(BPLib_AS_Counter_t, BUNDLE_COUNT_DELETED, 
-                                                Context_BPLib_AS_Increment[6].Counter);
-    UtAssert_INT32_EQ(1, Context_BPLib_AS_Increment[6].Amount);
+                                                Context_BPLib_AS_IncrementSlot[6].Counter);
+    UtAssert_INT32_EQ(1, Context_BPLib_AS_IncrementSlot[6].Amount);
     UtAssert_EQ(BPLib_AS_Counter_t, BUNDLE_COUNT_DISCARDED, 
-                                                Context_BPLib_AS_Increment[7].Counter);
-    UtAssert_INT32_EQ(1, Context_BPLib_AS_Increment[7].Amount);
+                                                Context_BPLib_AS_IncrementSlot[7].Counter);
+    UtAssert_INT32_EQ(1, Context_BPLib_AS_IncrementSlot[7].Amount);
     UtAssert_EQ(uint32_t, BplibInst.BundleStorage.BundleCountStored, 0);
 }
 
@@ -128,6 +210,7 @@ void Test_BPLib_STOR_GarbageCollect_SQLFail(void)
 
 void Test_BPLib_STOR_UpdateHkPkt_Nominal(void)
 {
+    BPLib_MEM_PoolStats_t PoolStats;
     size_t ExpectedBytesMemInUse;
     size_t ExpectedBytesMemHighWater;
     size_t ExpectedBytesMemFree;
@@ -135,21 +218,30 @@ void Test_BPLib_STOR_UpdateHkPkt_Nominal(void)
 
     memset((void*) &BPLib_STOR_StoragePayload, 0, sizeof(BPLib_StorageHkTlm_Payload_t));
 
-    BplibInst.pool.impl.num_blocks = 10;
-    BplibInst.pool.impl.num_free   = 20;
-    BplibInst.pool.impl.block_size = 30;
+    PoolStats.num_blocks     = 30;
+    PoolStats.num_free       = 20;
+    PoolStats.block_size     = 40;
+    PoolStats.num_in_use_hwm = 25;
+    PoolStats.num_alloc_fail = 3;
+    BplibInst.pool.backing   = BPLIB_MEM_BACKING_THP;
+
+    UT_SetHandlerFunction(UT_KEY(BPLib_MEM_PoolGetStats), UT_Handler_BPLib_MEM_PoolGetStats, NULL);
+    UT_SetDataBuffer(UT_KEY(BPLib_MEM_PoolGetStats), &PoolStats, sizeof(PoolStats), false);
 
-    ExpectedBytesMemInUse     = ((BplibInst.pool.impl.num_blocks - BplibInst.pool.impl.num_free) * BplibInst.pool.impl.block_size);
-    ExpectedBytesMemHighWater = ExpectedBytesMemInUse;
-    ExpectedBytesMemFree      = (BplibInst.pool.impl.num_free * BplibInst.pool.impl.block_size);
+    ExpectedBytesMemInUse     = ((PoolStats.num_blocks - PoolStats.num_free) * PoolStats.block_size);
+    ExpectedBytesMemHighWater = (PoolStats.num_in_use_hwm * PoolStats.block_size);
+    ExpectedBytesMemFree      = (PoolStats.num_free * PoolStats.block_size);
     ExpectedKbStorageInUse    = (BplibInst.BundleStorage.BytesStorageInUse / 1000);
 
     BPLib_STOR_UpdateHkPkt(&BplibInst);
 
+    UtAssert_STUB_COUNT(BPLib_MEM_PoolGetStats, 1);
     UtAssert_EQ(size_t, BPLib_STOR_StoragePayload.BytesMemInUse,     ExpectedBytesMemInUse);
     UtAssert_EQ(size_t, BPLib_STOR_StoragePayload.BytesMemHighWater, ExpectedBytesMemHighWater);
     UtAssert_EQ(size_t, BPLib_STOR_StoragePayload.BytesMemFree,      ExpectedBytesMemFree);
     UtAssert_EQ(size_t, BPLib_STOR_StoragePayload.KbStorageInUse,    ExpectedKbStorageInUse);
+    UtAssert_UINT32_EQ(BPLib_STOR_StoragePayload.MemAllocFailCount,  PoolStats.num_alloc_fail);
+    UtAssert_UINT32_EQ(BPLib_STOR_StoragePayload.MemPoolBacking,     BPLIB_MEM_BACKING_THP);
 }
 
 
@@ -160,6 +252,8 @@ void TestBplib_STOR_Register(void)
     UtTest_Add(Test_BPLib_STOR_Init, BPLib_STOR_Test_Setup, BPLib_STOR_Test_Teardown, "Test_BPLib_STOR_Init_NullInst");
     UtTest_Add(Test_BPLib_STOR_Destroy, BPLib_STOR_Test_Setup, BPLib_STOR_Test_Teardown, "Test_BPLib_STOR_Destroy");
     UtTest_Add(Test_BPLib_STOR_InitStoredCount, BPLib_STOR_Test_SetupOneBundleStored, BPLib_STOR_Test_TeardownOneBundleStored, "Test_BPLib_STOR_InitStoredCount");
+    UtTest_Add(Test_BPLib_STOR_InitMigratesOldSchema, BPLib_STOR_Test_Setup, BPLib_STOR_Test_Teardown, "Test_BPLib_STOR_InitMigratesOldSchema");
+    UtTest_Add(Test_BPLib_STOR_InitNewerSchema, BPLib_STOR_Test_Setup, BPLib_STOR_Test_Teardown, "Test_BPLib_STOR_InitNewerSchema");
 
     /* Storage Table Tests */
     UtTest_Add(Test_BPLib_STOR_StorageTblValidateFunc_Nominal, BPLib_STOR_Test_Setup, BPLib_STOR_Test_Teardown, "Test_BPLib_STOR_StorageTblValidateFunc_Nominal");
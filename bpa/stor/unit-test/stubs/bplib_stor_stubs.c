@@ -61,6 +61,24 @@ BPLib_Status_t BPLib_STOR_EgressForID(BPLib_Instance_t *Inst, uint32_t EgressID,
     return UT_GenStub_GetReturnValue(BPLib_STOR_EgressForID, BPLib_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_STOR_FindDuplicate()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_STOR_FindDuplicate(BPLib_Instance_t *Inst, const BPLib_Bundle_t *Bundle, bool *Found)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_STOR_FindDuplicate, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_STOR_FindDuplicate, BPLib_Instance_t *, Inst);
+    UT_GenStub_AddParam(BPLib_STOR_FindDuplicate, const BPLib_Bundle_t *, Bundle);
+    UT_GenStub_AddParam(BPLib_STOR_FindDuplicate, bool *, Found);
+
+    UT_GenStub_Execute(BPLib_STOR_FindDuplicate, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_STOR_FindDuplicate, BPLib_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_STOR_FlushPending()
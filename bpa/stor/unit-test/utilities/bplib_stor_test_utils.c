@@ -101,7 +101,7 @@ void BPLib_STOR_Test_Setup(void)
 
     UT_SetHandlerFunction(UT_KEY(BPLib_EM_SendEvent), UT_Handler_BPLib_EM_SendEvent, NULL);
     UT_SetHandlerFunction(UT_KEY(BPLib_QM_WaitQueueTryPush), UT_Handler_BPLib_QM_WaitQueueTryPush, NULL);
-    UT_SetHandlerFunction(UT_KEY(BPLib_AS_Increment), UT_Handler_BPLib_AS_Increment, NULL);
+    UT_SetHandlerFunction(UT_KEY(BPLib_AS_IncrementSlot), UT_Handler_BPLib_AS_IncrementSlot, NULL);
     UT_SetHandlerFunction(UT_KEY(BPLib_AS_Decrement), UT_Handler_BPLib_AS_Decrement, NULL);
 
     /* Init Storage */
@@ -35,6 +35,7 @@
 #include "bplib_stor_sql.h"
 #include "bplib_em_handlers.h"
 #include "bplib_qm_handlers.h"
+#include "bplib_mem_handlers.h"
 #include "bpa_fwp_stubs.h"
 
 /*
@@ -20,6 +20,7 @@
 
 #include "bplib_cbor_internal.h"
 #include <stdio.h>
+#include <inttypes.h>
 
 /*******************************************************************************
 * RFC-9171 Primary Block Parsing Definition
@@ -34,6 +35,8 @@ struct _PrimaryBlockParser
     QCBOR_EIDParser ReportEIDParser;
     QCBOR_TimestampParser CreationTimestampParser;
     QCBOR_UInt64Parser LifetimeParser;
+    QCBOR_UInt64Parser FragmentOffsetParser;
+    QCBOR_UInt64Parser TotalAduLengthParser;
     QCBOR_CRCParser CRCParser;
 };
 
@@ -47,6 +50,8 @@ static struct _PrimaryBlockParser PrimaryBlockParser = {
     .ReportEIDParser = BPLib_QCBOR_ReportToEidParserImpl,
     .CreationTimestampParser = BPLib_QCBOR_TimestampParserImpl,
     .LifetimeParser = BPLib_QCBOR_UInt64ParserImpl,
+    .FragmentOffsetParser = BPLib_QCBOR_UInt64ParserImpl,
+    .TotalAduLengthParser = BPLib_QCBOR_UInt64ParserImpl,
     .CRCParser = BPLib_QCBOR_CRCParserImpl
 };
 
@@ -179,6 +184,27 @@ BPLib_Status_t BPLib_CBOR_DecodePrimary(QCBORDecodeContext* ctx, BPLib_Bundle_t*
         return BPLIB_CBOR_DEC_PRIM_LIFETIME_DEC_ERR;
     }
 
+    /* Fragment Offset and Total ADU Length, only present in fragments */
+    if (bundle->blocks.PrimaryBlock.BundleProcFlags & BPLIB_BUNDLE_PROC_FRAG_FLAG)
+    {
+        Status = PrimaryBlockParser.FragmentOffsetParser(ctx, &bundle->blocks.PrimaryBlock.FragmentOffset);
+        if (Status != BPLIB_SUCCESS)
+        {
+            return BPLIB_CBOR_DEC_PRIM_FRAG_OFFSET_DEC_ERR;
+        }
+
+        Status = PrimaryBlockParser.TotalAduLengthParser(ctx, &bundle->blocks.PrimaryBlock.TotalAduLength);
+        if (Status != BPLIB_SUCCESS)
+        {
+            return BPLIB_CBOR_DEC_PRIM_ADU_LEN_DEC_ERR;
+        }
+    }
+    else
+    {
+        bundle->blocks.PrimaryBlock.FragmentOffset = 0;
+        bundle->blocks.PrimaryBlock.TotalAduLength = 0;
+    }
+
     /* CRC Value */
     Status = PrimaryBlockParser.CRCParser(ctx, &bundle->blocks.PrimaryBlock.CrcVal,
                                                 bundle->blocks.PrimaryBlock.CrcType);
@@ -233,6 +259,8 @@ BPLib_Status_t BPLib_CBOR_DecodePrimary(QCBORDecodeContext* ctx, BPLib_Bundle_t*
     printf("\t Timestamp (created, seq): %lu, %lu\n", bundle->blocks.PrimaryBlock.Timestamp.CreateTime,
                                                       bundle->blocks.PrimaryBlock.Timestamp.SequenceNumber);
     printf("\t Lifetime: %lu\n", bundle->blocks.PrimaryBlock.Lifetime);
+    printf("\t Fragment Offset, Total ADU Length: %" PRIu64 ", %" PRIu64 "\n",
+           bundle->blocks.PrimaryBlock.FragmentOffset, bundle->blocks.PrimaryBlock.TotalAduLength);
     printf("\t CRC Value: 0x%lX\n", bundle->blocks.PrimaryBlock.CrcVal);
     printf("\t Requires Encode: %u\n", bundle->blocks.PrimaryBlock.RequiresEncode);
     printf("\t Block Offset Start: %lu\n", bundle->blocks.PrimaryBlock.BlockOffsetStart);
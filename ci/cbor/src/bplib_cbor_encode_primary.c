@@ -65,10 +65,12 @@ BPLib_Status_t BPLib_CBOR_EncodePrimary(BPLib_Bundle_t* StoredBundle,
 
         QCBOREncode_AddUInt64(&Context, StoredBundle->blocks.PrimaryBlock.Lifetime);
 
-        // TODO these fields are only present in fragmented bundles, will add logic to
-        // distinguish fragmented and unfragmented bundles later
-        // QCBOREncode_AddUInt64(&Context, StoredBundle->blocks.PrimaryBlock.FragmentOffset);
-        // QCBOREncode_AddUInt64(&Context, StoredBundle->blocks.PrimaryBlock.TotalAduLength);
+        /* Fragment Offset and Total ADU Length are only present in fragments */
+        if (StoredBundle->blocks.PrimaryBlock.BundleProcFlags & BPLIB_BUNDLE_PROC_FRAG_FLAG)
+        {
+            QCBOREncode_AddUInt64(&Context, StoredBundle->blocks.PrimaryBlock.FragmentOffset);
+            QCBOREncode_AddUInt64(&Context, StoredBundle->blocks.PrimaryBlock.TotalAduLength);
+        }
 
         /* Set CRC value to 0, real value will be jammed in after encoding is done */
         StoredBundle->blocks.PrimaryBlock.CrcVal = 0;
@@ -127,9 +127,9 @@ void Test_BPLib_CBOR_DecodePrimary_NoCanonBlks(void)
 
 void Test_BPLib_CBOR_DecodePrimary_InvalidFlags(void)
 {
-    /* Primary block with flags set to 0x0f (byte 4) */
+    /* Primary block with flags set to 0x0e (byte 4) */
     uint8_t UnsupportedFlagPrimaryBlk[] = {
-        0x9f, 0x89, 0x07, 0x0f, 0x01, 0x82, 0x02, 0x82,
+        0x9f, 0x89, 0x07, 0x0e, 0x01, 0x82, 0x02, 0x82,
         0x18, 0xc8, 0x01, 0x82, 0x02, 0x82, 0x18, 0x64,
         0x01, 0x82, 0x02, 0x82, 0x18, 0x64, 0x01, 0x82,
         0x1b, 0x00, 0x00, 0x00, 0xaf, 0xe9, 0x53, 0x7a,
@@ -157,6 +157,70 @@ void Test_BPLib_CBOR_DecodePrimary_InvalidFlags(void)
     UtAssert_INT32_EQ(BPLib_CBOR_DecodePrimary(&ctx, &Bundle, UnsupportedFlagPrimaryBlk), BPLIB_SUCCESS);
 }
 
+/* Test a fragment's primary block, which carries the fragment offset and total ADU length */
+void Test_BPLib_CBOR_DecodePrimary_Fragment(void)
+{
+    /* Primary block with the fragment flag set (byte 4), offset 1000 and total ADU length 5000 */
+    uint8_t FragmentPrimaryBlk[] = {
+        0x9f, 0x8b, 0x07, 0x01, 0x01, 0x82, 0x02, 0x82,
+        0x18, 0xc8, 0x01, 0x82, 0x02, 0x82, 0x18, 0x64,
+        0x01, 0x82, 0x02, 0x82, 0x18, 0x64, 0x01, 0x82,
+        0x1b, 0x00, 0x00, 0x00, 0xaf, 0xe9, 0x53, 0x7a,
+        0x38, 0x00, 0x1a, 0x00, 0x36, 0xee, 0x80, 0x19,
+        0x03, 0xe8, 0x19, 0x13, 0x88, 0x42, 0x0b, 0x19,
+        0x86, 0x01, 0x01, 0x00, 0x01, 0x54, 0xaa, 0xaa,
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+        0xaa, 0xaa, 0x42, 0xc6, 0x8f, 0xff,
+    };
+
+    BPLib_Bundle_t Bundle;
+    QCBORDecodeContext ctx;
+    UsefulBufC UBufC;
+    QCBORItem OuterArr;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_CRC_Calculate), 0xB19);
+
+    /* Initialize QCBOR context */
+    UBufC.ptr = (const void *)(FragmentPrimaryBlk);
+    UBufC.len = sizeof(FragmentPrimaryBlk);
+    QCBORDecode_Init(&ctx, UBufC, QCBOR_DECODE_MODE_NORMAL);
+    QCBORDecode_EnterArray(&ctx, &OuterArr);
+
+    UtAssert_INT32_EQ(BPLib_CBOR_DecodePrimary(&ctx, &Bundle, FragmentPrimaryBlk), BPLIB_SUCCESS);
+    UtAssert_EQ(uint64_t, Bundle.blocks.PrimaryBlock.FragmentOffset, 1000);
+    UtAssert_EQ(uint64_t, Bundle.blocks.PrimaryBlock.TotalAduLength, 5000);
+    UtAssert_EQ(uint64_t, Bundle.blocks.PrimaryBlock.Lifetime, 3600000);
+}
+
+/* Test a primary block with the fragment flag set but no fragment fields */
+void Test_BPLib_CBOR_DecodePrimary_FragmentNoOffset(void)
+{
+    /* Primary block with the fragment flag set (byte 4) */
+    uint8_t FragmentPrimaryBlk[] = {
+        0x9f, 0x89, 0x07, 0x01, 0x01, 0x82, 0x02, 0x82,
+        0x18, 0xc8, 0x01, 0x82, 0x02, 0x82, 0x18, 0x64,
+        0x01, 0x82, 0x02, 0x82, 0x18, 0x64, 0x01, 0x82,
+        0x1b, 0x00, 0x00, 0x00, 0xaf, 0xe9, 0x53, 0x7a,
+        0x38, 0x00, 0x1a, 0x00, 0x36, 0xee, 0x80, 0x42,
+        0x0b, 0x19, 0xff
+    };
+
+    BPLib_Bundle_t Bundle;
+    QCBORDecodeContext ctx;
+    UsefulBufC UBufC;
+    QCBORItem OuterArr;
+
+    /* Initialize QCBOR context */
+    UBufC.ptr = (const void *)(FragmentPrimaryBlk);
+    UBufC.len = sizeof(FragmentPrimaryBlk);
+    QCBORDecode_Init(&ctx, UBufC, QCBOR_DECODE_MODE_NORMAL);
+    QCBORDecode_EnterArray(&ctx, &OuterArr);
+
+    UtAssert_INT32_EQ(BPLib_CBOR_DecodePrimary(&ctx, &Bundle, FragmentPrimaryBlk),
+                      BPLIB_CBOR_DEC_PRIM_FRAG_OFFSET_DEC_ERR);
+}
+
 void Test_BPLib_CBOR_DecodePrimary_CrcNone(void)
 {
     /* Primary block with CRC set to none (byte 5) */
@@ -580,6 +644,8 @@ void TestBplibCborDecodeInternal_Register(void)
     UtTest_Add(Test_BPLib_CBOR_DecodePrimary_InvalidFlags, BPLib_CBOR_Test_Setup, BPLib_CBOR_Test_Teardown, "Test_BPLib_CBOR_DecodePrimary_InvalidFlags");
     UtTest_Add(Test_BPLib_CBOR_DecodePrimary_CrcNone, BPLib_CBOR_Test_Setup, BPLib_CBOR_Test_Teardown, "Test_BPLib_CBOR_DecodePrimary_CrcNone");
     UtTest_Add(Test_BPLib_CBOR_DecodePrimary_NoCanonBlks, BPLib_CBOR_Test_Setup, BPLib_CBOR_Test_Teardown, "Test_BPLib_CBOR_DecodePrimary_NoCanonBlks");
+    UtTest_Add(Test_BPLib_CBOR_DecodePrimary_Fragment, BPLib_CBOR_Test_Setup, BPLib_CBOR_Test_Teardown, "Test_BPLib_CBOR_DecodePrimary_Fragment");
+    UtTest_Add(Test_BPLib_CBOR_DecodePrimary_FragmentNoOffset, BPLib_CBOR_Test_Setup, BPLib_CBOR_Test_Teardown, "Test_BPLib_CBOR_DecodePrimary_FragmentNoOffset");
     
     UtTest_Add(Test_BPLib_CBOR_DecodeCanonical_InvalidCrc, BPLib_CBOR_Test_Setup, BPLib_CBOR_Test_Teardown, "Test_BPLib_CBOR_DecodeCanonical_InvalidCrc");
     UtTest_Add(Test_BPLib_CBOR_DecodeCanonical_BadBlockNum, BPLib_CBOR_Test_Setup, BPLib_CBOR_Test_Teardown, "Test_BPLib_CBOR_DecodeCanonical_BadBlockNum");
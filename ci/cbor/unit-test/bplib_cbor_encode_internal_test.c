@@ -151,6 +151,56 @@ void Test_BPLib_CBOR_EncodePrimary_Crc32(void)
 }
 
 
+void Test_BPLib_CBOR_EncodePrimary_Fragment(void)
+{
+    BPLib_Status_t ReturnStatus;
+    BPLib_Bundle_t StoredBundleIn;
+    char OutputBuffer[512];
+    size_t OutputBufferSize = sizeof(OutputBuffer);
+    size_t NumBytesCopied = 0;
+
+    /* Setup nominal inputs */
+    memset(&StoredBundleIn, 0, sizeof(StoredBundleIn));
+
+    StoredBundleIn.blocks.PrimaryBlock.BundleProcFlags = BPLIB_BUNDLE_PROC_FRAG_FLAG;
+    StoredBundleIn.blocks.PrimaryBlock.CrcType = BPLib_CRC_Type_CRC32C;
+
+    StoredBundleIn.blocks.PrimaryBlock.DestEID.Scheme = BPLIB_EID_SCHEME_IPN;
+    StoredBundleIn.blocks.PrimaryBlock.DestEID.IpnSspFormat = BPLIB_EID_IPN_SSP_FORMAT_TWO_DIGIT;
+    StoredBundleIn.blocks.PrimaryBlock.DestEID.Allocator = 0;
+    StoredBundleIn.blocks.PrimaryBlock.DestEID.Node = 200;
+    StoredBundleIn.blocks.PrimaryBlock.DestEID.Service = 2;
+
+    StoredBundleIn.blocks.PrimaryBlock.SrcEID.Scheme = BPLIB_EID_SCHEME_IPN;
+    StoredBundleIn.blocks.PrimaryBlock.SrcEID.IpnSspFormat = BPLIB_EID_IPN_SSP_FORMAT_TWO_DIGIT;
+    StoredBundleIn.blocks.PrimaryBlock.SrcEID.Allocator = 0;
+    StoredBundleIn.blocks.PrimaryBlock.SrcEID.Node = 300;
+    StoredBundleIn.blocks.PrimaryBlock.SrcEID.Service = 3;
+
+    StoredBundleIn.blocks.PrimaryBlock.ReportToEID.Scheme = BPLIB_EID_SCHEME_IPN;
+    StoredBundleIn.blocks.PrimaryBlock.ReportToEID.IpnSspFormat = BPLIB_EID_IPN_SSP_FORMAT_TWO_DIGIT;
+    StoredBundleIn.blocks.PrimaryBlock.ReportToEID.Allocator = 0;
+    StoredBundleIn.blocks.PrimaryBlock.ReportToEID.Node = 400;
+    StoredBundleIn.blocks.PrimaryBlock.ReportToEID.Service = 4;
+
+    StoredBundleIn.blocks.PrimaryBlock.Timestamp.CreateTime = 12;
+    StoredBundleIn.blocks.PrimaryBlock.Timestamp.SequenceNumber = 34;
+
+    StoredBundleIn.blocks.PrimaryBlock.Lifetime = 0;
+    StoredBundleIn.blocks.PrimaryBlock.FragmentOffset = 1000;
+    StoredBundleIn.blocks.PrimaryBlock.TotalAduLength = 5000;
+
+    StoredBundleIn.blocks.PrimaryBlock.CrcVal = 0xdeadbeef;
+
+    /* Call UUT and check status */
+    ReturnStatus = BPLib_CBOR_EncodePrimary(&StoredBundleIn, OutputBuffer, OutputBufferSize, &NumBytesCopied);
+    UtAssert_INT32_EQ(ReturnStatus, BPLIB_SUCCESS);
+    /* Fragment offset and total ADU length add 3 bytes each */
+    UtAssert_EQ(size_t, NumBytesCopied, 40);
+    UtAssert_UINT8_EQ((uint8_t) OutputBuffer[0], 0x8a);
+}
+
+
 void Test_BPLib_CBOR_EncodePrimary_CrcNone(void)
 {
     BPLib_Status_t ReturnStatus;
@@ -349,6 +399,7 @@ void TestBplibCborEncodeInternal_Register(void)
     UtTest_Add(Test_BPLib_CBOR_EncodePrimary_NullInputErrors, BPLib_CBOR_Test_Setup, BPLib_CBOR_Test_Teardown, "Test_BPLib_CBOR_EncodePrimary_NullInputErrors");
     UtTest_Add(Test_BPLib_CBOR_EncodePrimary_Crc16, BPLib_CBOR_Test_Setup, BPLib_CBOR_Test_Teardown, "Test_BPLib_CBOR_EncodePrimary_Crc16");
     UtTest_Add(Test_BPLib_CBOR_EncodePrimary_Crc32, BPLib_CBOR_Test_Setup, BPLib_CBOR_Test_Teardown, "Test_BPLib_CBOR_EncodePrimary_Crc32");
+    UtTest_Add(Test_BPLib_CBOR_EncodePrimary_Fragment, BPLib_CBOR_Test_Setup, BPLib_CBOR_Test_Teardown, "Test_BPLib_CBOR_EncodePrimary_Fragment");
     UtTest_Add(Test_BPLib_CBOR_EncodePrimary_CrcNone, BPLib_CBOR_Test_Setup, BPLib_CBOR_Test_Teardown, "Test_BPLib_CBOR_EncodePrimary_CrcNone");
 
     UtTest_Add(Test_BPLib_CBOR_EncodeExtensionBlock_NullInputErrors, BPLib_CBOR_Test_Setup, BPLib_CBOR_Test_Teardown, "Test_BPLib_CBOR_EncodeExtensionBlock_NullInputErrors");
@@ -36,6 +36,8 @@
 #define BPLIB_EID_PATTERN_MAX_NODE      BPLIB_EID_PATTERN_MAX
 #define BPLIB_EID_PATTERN_MAX_SERVICE   BPLIB_EID_PATTERN_MAX
 
+#define BPLIB_EID_PATTERN_SET_MAX       64 /* One bit per pattern in a uint64_t match mask */
+
 /* ======== */
 /* Typedefs */
 /* ======== */
@@ -98,6 +100,26 @@ typedef struct
     uint64_t MinService;
 } BPLib_EID_Pattern_t;
 
+/**
+ * \brief Compiled set of EID patterns in structure-of-arrays layout
+ *
+ * Built by BPLib_EID_PatternSetCompile and matched against one EID at a time by
+ * BPLib_EID_PatternSetMatch. Entry i holds the fields of pattern i. Invalid patterns and
+ * the padding entries after the last pattern never match.
+ */
+typedef struct
+{
+    uint64_t Scheme[BPLIB_EID_PATTERN_SET_MAX];
+    uint64_t IpnSspFormat[BPLIB_EID_PATTERN_SET_MAX];
+    uint64_t MinAllocator[BPLIB_EID_PATTERN_SET_MAX];
+    uint64_t MaxAllocator[BPLIB_EID_PATTERN_SET_MAX];
+    uint64_t MinNode[BPLIB_EID_PATTERN_SET_MAX];
+    uint64_t MaxNode[BPLIB_EID_PATTERN_SET_MAX];
+    uint64_t MinService[BPLIB_EID_PATTERN_SET_MAX];
+    uint64_t MaxService[BPLIB_EID_PATTERN_SET_MAX];
+    uint32_t NumPatterns;
+} BPLib_EID_PatternSet_t;
+
 /* =========== */
 /* Global Data */
 /* =========== */
@@ -186,4 +208,33 @@ void BPLib_EID_CopyEidPatterns(BPLib_EID_Pattern_t *EID_Actual, BPLib_EID_Patter
  */
 bool BPLib_EID_PatternIsMatch(BPLib_EID_t* EID_Actual, BPLib_EID_Pattern_t* EID_Pattern);
 
+/**
+ * \brief     Compile EID patterns into a pattern set
+ * \details   Pattern i of the array becomes bit i of the masks returned by
+ *            BPLib_EID_PatternSetMatch
+ * \param[out] Set (BPLib_EID_PatternSet_t*) Pattern set to fill in
+ * \param[in] Patterns (const BPLib_EID_Pattern_t*) Array of patterns, may be NULL if
+ *            NumPatterns is 0
+ * \param[in] NumPatterns (uint32_t) Number of patterns in the array
+ * \return    Execution status
+ * \retval    BPLIB_SUCCESS: The pattern set was compiled
+ * \retval    BPLIB_NULL_PTR_ERROR: Set or Patterns was NULL
+ * \retval    BPLIB_EID_PATTERN_SET_TOO_BIG: NumPatterns is over BPLIB_EID_PATTERN_SET_MAX
+ * \ref       BPLib_EID_PatternSet_t
+ */
+BPLib_Status_t BPLib_EID_PatternSetCompile(BPLib_EID_PatternSet_t* Set, const BPLib_EID_Pattern_t* Patterns,
+                                           uint32_t NumPatterns);
+
+/**
+ * \brief     Match one EID against every pattern of a pattern set
+ * \details   Bit i of the result is set when BPLib_EID_PatternIsMatch would return true
+ *            for pattern i. Four patterns are compared per step with AVX2 when the
+ *            library is built for it, otherwise a branch-free scalar loop is used.
+ * \param[in] EID_Actual (const BPLib_EID_t*) EID that is to be evaluated
+ * \param[in] Set (const BPLib_EID_PatternSet_t*) Compiled pattern set
+ * \return    Bitmask of matching patterns
+ * \ref       BPLib_EID_PatternSet_t
+ */
+uint64_t BPLib_EID_PatternSetMatch(const BPLib_EID_t* EID_Actual, const BPLib_EID_PatternSet_t* Set);
+
 #endif /* BPLIB_EID_H */
\ No newline at end of file
@@ -24,6 +24,12 @@
 
 #include "bplib_eid.h"
 
+#include <string.h>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 /* =========== */
 /* Global Data */
 /* =========== */
@@ -52,6 +58,87 @@ BPLib_EID_t BPLIB_EID_INSTANCE = {.Scheme       = BPLIB_LOCAL_EID_SCHEME,
                                   .Node         = BPLIB_LOCAL_EID_NODE_NUM,
                                   .Service      = BPLIB_LOCAL_EID_SERVICE_NUM};
 
+/* ========================== */
+/* Local Function Definitions */
+/* ========================== */
+
+#ifndef __AVX2__
+/* Match pattern set entries [0, NumEntries) one at a time without branching */
+static uint64_t BPLib_EID_PatternSetMatchScalar(const BPLib_EID_t* EID_Actual, const BPLib_EID_PatternSet_t* Set,
+                                                uint32_t NumEntries)
+{
+    const uint64_t Scheme    = EID_Actual->Scheme;
+    const uint64_t Format    = EID_Actual->IpnSspFormat;
+    const uint64_t Allocator = EID_Actual->Allocator;
+    const uint64_t Node      = EID_Actual->Node;
+    const uint64_t Service   = EID_Actual->Service;
+    uint64_t Mask = 0;
+    uint32_t i;
+    int      SkipAllocator;
+    int      IsMatch;
+
+    /* The allocator is only compared for 3-digit EIDs */
+    SkipAllocator = (Format != BPLIB_EID_IPN_SSP_FORMAT_THREE_DIGIT);
+
+    for (i = 0; i < NumEntries; i++)
+    {
+        IsMatch = (Scheme == Set->Scheme[i]) & (Format == Set->IpnSspFormat[i]) &
+                  (SkipAllocator | ((Allocator >= Set->MinAllocator[i]) & (Allocator <= Set->MaxAllocator[i]))) &
+                  (Node    >= Set->MinNode[i])    & (Node    <= Set->MaxNode[i]) &
+                  (Service >= Set->MinService[i]) & (Service <= Set->MaxService[i]);
+
+        Mask |= (uint64_t) IsMatch << i;
+    }
+
+    return Mask;
+}
+#else
+/* Match pattern set entries [0, NumEntries) four at a time, NumEntries must be a multiple of 4 */
+static uint64_t BPLib_EID_PatternSetMatchAvx2(const BPLib_EID_t* EID_Actual, const BPLib_EID_PatternSet_t* Set,
+                                              uint32_t NumEntries)
+{
+    /* AVX2 only compares signed 64-bit lanes, flipping the sign bit makes them unsigned compares */
+    const __m256i Sign      = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i Scheme    = _mm256_set1_epi64x((int64_t) EID_Actual->Scheme);
+    const __m256i Format    = _mm256_set1_epi64x((int64_t) EID_Actual->IpnSspFormat);
+    const __m256i Allocator = _mm256_xor_si256(_mm256_set1_epi64x((int64_t) EID_Actual->Allocator), Sign);
+    const __m256i Node      = _mm256_xor_si256(_mm256_set1_epi64x((int64_t) EID_Actual->Node), Sign);
+    const __m256i Service   = _mm256_xor_si256(_mm256_set1_epi64x((int64_t) EID_Actual->Service), Sign);
+    const __m256i CheckAllocator = _mm256_set1_epi64x(
+        (EID_Actual->IpnSspFormat == BPLIB_EID_IPN_SSP_FORMAT_THREE_DIGIT) ? -1 : 0);
+    uint64_t Mask = 0;
+    uint32_t i;
+    __m256i  Ok;
+    __m256i  Out;
+    __m256i  AllocatorOut;
+
+#define BPLIB_EID_LOAD(Field)         _mm256_loadu_si256((const __m256i*) &Set->Field[i])
+#define BPLIB_EID_LOAD_BIASED(Field)  _mm256_xor_si256(BPLIB_EID_LOAD(Field), Sign)
+
+    for (i = 0; i < NumEntries; i += 4)
+    {
+        Ok = _mm256_and_si256(_mm256_cmpeq_epi64(BPLIB_EID_LOAD(Scheme), Scheme),
+                              _mm256_cmpeq_epi64(BPLIB_EID_LOAD(IpnSspFormat), Format));
+
+        Out = _mm256_or_si256(_mm256_cmpgt_epi64(BPLIB_EID_LOAD_BIASED(MinNode), Node),
+                              _mm256_cmpgt_epi64(Node, BPLIB_EID_LOAD_BIASED(MaxNode)));
+        Out = _mm256_or_si256(Out, _mm256_cmpgt_epi64(BPLIB_EID_LOAD_BIASED(MinService), Service));
+        Out = _mm256_or_si256(Out, _mm256_cmpgt_epi64(Service, BPLIB_EID_LOAD_BIASED(MaxService)));
+
+        AllocatorOut = _mm256_or_si256(_mm256_cmpgt_epi64(BPLIB_EID_LOAD_BIASED(MinAllocator), Allocator),
+                                       _mm256_cmpgt_epi64(Allocator, BPLIB_EID_LOAD_BIASED(MaxAllocator)));
+        Out = _mm256_or_si256(Out, _mm256_and_si256(AllocatorOut, CheckAllocator));
+
+        Mask |= (uint64_t) _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_andnot_si256(Out, Ok))) << i;
+    }
+
+#undef BPLIB_EID_LOAD
+#undef BPLIB_EID_LOAD_BIASED
+
+    return Mask;
+}
+#endif
+
 /* ==================== */
 /* Function Definitions */
 /* ==================== */
@@ -260,4 +347,57 @@ bool BPLib_EID_PatternIsMatch(BPLib_EID_t* EID_Actual, BPLib_EID_Pattern_t* EID_
     }
 
     return IsMatch;
-}
\ No newline at end of file
+}
+
+BPLib_Status_t BPLib_EID_PatternSetCompile(BPLib_EID_PatternSet_t* Set, const BPLib_EID_Pattern_t* Patterns,
+                                           uint32_t NumPatterns)
+{
+    uint32_t i;
+
+    if (Set == NULL || (Patterns == NULL && NumPatterns != 0))
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    if (NumPatterns > BPLIB_EID_PATTERN_SET_MAX)
+    {
+        return BPLIB_EID_PATTERN_SET_TOO_BIG;
+    }
+
+    memset(Set, 0, sizeof(BPLib_EID_PatternSet_t));
+
+    for (i = 0; i < BPLIB_EID_PATTERN_SET_MAX; i++)
+    {
+        if (i < NumPatterns && BPLib_EID_PatternIsValid((BPLib_EID_Pattern_t*) &Patterns[i]))
+        {
+            Set->Scheme[i]       = Patterns[i].Scheme;
+            Set->IpnSspFormat[i] = Patterns[i].IpnSspFormat;
+            Set->MinAllocator[i] = Patterns[i].MinAllocator;
+            Set->MaxAllocator[i] = Patterns[i].MaxAllocator;
+            Set->MinNode[i]      = Patterns[i].MinNode;
+            Set->MaxNode[i]      = Patterns[i].MaxNode;
+            Set->MinService[i]   = Patterns[i].MinService;
+            Set->MaxService[i]   = Patterns[i].MaxService;
+        }
+        else
+        {
+            /* An empty node range never matches, whatever the other fields hold */
+            Set->MinNode[i] = BPLIB_EID_PATTERN_MAX_NODE;
+            Set->MaxNode[i] = 0;
+        }
+    }
+
+    Set->NumPatterns = NumPatterns;
+
+    return BPLIB_SUCCESS;
+}
+
+uint64_t BPLib_EID_PatternSetMatch(const BPLib_EID_t* EID_Actual, const BPLib_EID_PatternSet_t* Set)
+{
+#ifdef __AVX2__
+    /* Entries past the last pattern never match, so round up to whole vectors */
+    return BPLib_EID_PatternSetMatchAvx2(EID_Actual, Set, (Set->NumPatterns + 3) & ~3u);
+#else
+    return BPLib_EID_PatternSetMatchScalar(EID_Actual, Set, Set->NumPatterns);
+#endif
+}
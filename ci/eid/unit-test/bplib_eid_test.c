@@ -576,6 +576,120 @@ void Test_BPLib_EID_CopyEidPatterns_Nominal(void)
     UtAssert_EQ(uint64_t, Actual.MinService, Ref.MinService);
 }
 
+void Test_BPLib_EID_PatternSetCompile_Null(void)
+{
+    BPLib_EID_PatternSet_t Set;
+
+    UtAssert_INT32_EQ(BPLib_EID_PatternSetCompile(NULL, &EID_Pattern, 1), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_EID_PatternSetCompile(&Set, NULL, 1), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_EID_PatternSetCompile(&Set, NULL, 0), BPLIB_SUCCESS);
+    UtAssert_EQ(uint64_t, BPLib_EID_PatternSetMatch(&EID_Actual, &Set), 0);
+}
+
+void Test_BPLib_EID_PatternSetCompile_TooBig(void)
+{
+    BPLib_EID_PatternSet_t Set;
+    BPLib_EID_Pattern_t    Patterns[BPLIB_EID_PATTERN_SET_MAX + 1];
+
+    memset(Patterns, 0, sizeof(Patterns));
+
+    UtAssert_INT32_EQ(BPLib_EID_PatternSetCompile(&Set, Patterns, BPLIB_EID_PATTERN_SET_MAX + 1),
+                      BPLIB_EID_PATTERN_SET_TOO_BIG);
+}
+
+void Test_BPLib_EID_PatternSetMatch_Full(void)
+{
+    BPLib_EID_PatternSet_t Set;
+    BPLib_EID_Pattern_t    Patterns[BPLIB_EID_PATTERN_SET_MAX];
+    uint32_t               i;
+
+    /* Every pattern is a node wildcard except pattern 5, which covers a different node */
+    for (i = 0; i < BPLIB_EID_PATTERN_SET_MAX; i++)
+    {
+        Patterns[i].Scheme       = BPLIB_EID_SCHEME_IPN;
+        Patterns[i].IpnSspFormat = BPLIB_EID_IPN_SSP_FORMAT_TWO_DIGIT;
+        Patterns[i].MinAllocator = 0;
+        Patterns[i].MaxAllocator = 0;
+        Patterns[i].MinNode      = 0;
+        Patterns[i].MaxNode      = BPLIB_EID_PATTERN_MAX_NODE;
+        Patterns[i].MinService   = 0;
+        Patterns[i].MaxService   = BPLIB_EID_PATTERN_MAX_SERVICE;
+    }
+
+    Patterns[5].MinNode = 200;
+    Patterns[5].MaxNode = 300;
+
+    EID_Actual.Scheme       = BPLIB_EID_SCHEME_IPN;
+    EID_Actual.IpnSspFormat = BPLIB_EID_IPN_SSP_FORMAT_TWO_DIGIT;
+    EID_Actual.Node         = 100;
+    EID_Actual.Service      = 1;
+
+    UtAssert_INT32_EQ(BPLib_EID_PatternSetCompile(&Set, Patterns, BPLIB_EID_PATTERN_SET_MAX), BPLIB_SUCCESS);
+    UtAssert_EQ(uint64_t, BPLib_EID_PatternSetMatch(&EID_Actual, &Set), ~((uint64_t) 1 << 5));
+}
+
+/* Compare the pattern set matcher with BPLib_EID_PatternIsMatch over pseudo-random inputs */
+void Test_BPLib_EID_PatternSetMatch_MatchesScalar(void)
+{
+    BPLib_EID_PatternSet_t Set;
+    BPLib_EID_Pattern_t    Patterns[7];
+    uint64_t               Expected;
+    uint64_t               Actual;
+    uint32_t               Seed = 12345;
+    uint32_t               Mismatches = 0;
+    uint32_t               Trial;
+    uint32_t               i;
+
+    /* Small values so ranges are hit often, and some fields at the edges of the unsigned range */
+    #define NEXT_RAND() (Seed = Seed * 1103515245u + 12345u, (Seed >> 16) & 0x7)
+    #define RAND_FIELD() ((NEXT_RAND() == 7) ? BPLIB_EID_PATTERN_MAX : (uint64_t) NEXT_RAND())
+
+    for (Trial = 0; Trial < 2000; Trial++)
+    {
+        for (i = 0; i < 7; i++)
+        {
+            Patterns[i].Scheme       = (NEXT_RAND() & 1) ? BPLIB_EID_SCHEME_IPN : BPLIB_EID_SCHEME_DTN;
+            Patterns[i].IpnSspFormat = (NEXT_RAND() & 1) ? BPLIB_EID_IPN_SSP_FORMAT_THREE_DIGIT :
+                                                           BPLIB_EID_IPN_SSP_FORMAT_TWO_DIGIT;
+            Patterns[i].MinAllocator = RAND_FIELD();
+            Patterns[i].MaxAllocator = RAND_FIELD();
+            Patterns[i].MinNode      = RAND_FIELD();
+            Patterns[i].MaxNode      = RAND_FIELD();
+            Patterns[i].MinService   = RAND_FIELD();
+            Patterns[i].MaxService   = RAND_FIELD();
+        }
+
+        EID_Actual.Scheme       = (NEXT_RAND() & 1) ? BPLIB_EID_SCHEME_IPN : BPLIB_EID_SCHEME_DTN;
+        EID_Actual.IpnSspFormat = (NEXT_RAND() & 1) ? BPLIB_EID_IPN_SSP_FORMAT_THREE_DIGIT :
+                                                      BPLIB_EID_IPN_SSP_FORMAT_TWO_DIGIT;
+        EID_Actual.Allocator    = RAND_FIELD();
+        EID_Actual.Node         = RAND_FIELD();
+        EID_Actual.Service      = RAND_FIELD();
+
+        Expected = 0;
+        for (i = 0; i < 7; i++)
+        {
+            if (BPLib_EID_PatternIsMatch(&EID_Actual, &Patterns[i]))
+            {
+                Expected |= (uint64_t) 1 << i;
+            }
+        }
+
+        (void) BPLib_EID_PatternSetCompile(&Set, Patterns, 7);
+        Actual = BPLib_EID_PatternSetMatch(&EID_Actual, &Set);
+
+        if (Actual != Expected)
+        {
+            Mismatches++;
+        }
+    }
+
+    #undef NEXT_RAND
+    #undef RAND_FIELD
+
+    UtAssert_UINT32_EQ(Mismatches, 0);
+}
+
 void TestBplibEid_Register(void)
 {
     ADD_TEST(Test_BPLib_EID_IsValid_DTN_Nominal);
@@ -620,4 +734,9 @@ void TestBplibEid_Register(void)
 
     ADD_TEST(Test_BPLib_EID_CopyEidPatterns_Null);
     ADD_TEST(Test_BPLib_EID_CopyEidPatterns_Nominal);
+
+    ADD_TEST(Test_BPLib_EID_PatternSetCompile_Null);
+    ADD_TEST(Test_BPLib_EID_PatternSetCompile_TooBig);
+    ADD_TEST(Test_BPLib_EID_PatternSetMatch_Full);
+    ADD_TEST(Test_BPLib_EID_PatternSetMatch_MatchesScalar);
 }
\ No newline at end of file
@@ -171,3 +171,38 @@ bool BPLib_EID_PatternIsValid(BPLib_EID_Pattern_t *EID_Pattern)
 
     return UT_GenStub_GetReturnValue(BPLib_EID_PatternIsValid, bool);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_EID_PatternSetCompile()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_EID_PatternSetCompile(BPLib_EID_PatternSet_t *Set, const BPLib_EID_Pattern_t *Patterns, uint32_t NumPatterns)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_EID_PatternSetCompile, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_EID_PatternSetCompile, BPLib_EID_PatternSet_t *, Set);
+    UT_GenStub_AddParam(BPLib_EID_PatternSetCompile, const BPLib_EID_Pattern_t *, Patterns);
+    UT_GenStub_AddParam(BPLib_EID_PatternSetCompile, uint32_t, NumPatterns);
+
+    UT_GenStub_Execute(BPLib_EID_PatternSetCompile, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_EID_PatternSetCompile, BPLib_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_EID_PatternSetMatch()
+ * ----------------------------------------------------
+ */
+uint64_t BPLib_EID_PatternSetMatch(const BPLib_EID_t *EID_Actual, const BPLib_EID_PatternSet_t *Set)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_EID_PatternSetMatch, uint64_t);
+
+    UT_GenStub_AddParam(BPLib_EID_PatternSetMatch, const BPLib_EID_t *, EID_Actual);
+    UT_GenStub_AddParam(BPLib_EID_PatternSetMatch, const BPLib_EID_PatternSet_t *, Set);
+
+    UT_GenStub_Execute(BPLib_EID_PatternSetMatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_EID_PatternSetMatch, uint64_t);
+}
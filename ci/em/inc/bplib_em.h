@@ -47,6 +47,16 @@ typedef enum
     BPLib_EM_EventType_CRITICAL    = 5
 } BPLib_EM_EventType_t;
 
+typedef struct
+{
+    uint32_t Sent;         /* Events passed to the event proxy */
+    uint32_t Filtered;     /* Events dropped by the type filter or a disabled event ID */
+    uint32_t Suppressed;   /* Events dropped by rate limiting */
+    uint32_t Deferred;     /* Events queued for deferred formatting */
+    uint32_t Dropped;      /* Deferred events lost because the ring was full */
+    uint32_t FormatErrors; /* Deferred events lost because their text could not be formatted */
+} BPLib_EM_Stats_t;
+
 /* ================== */
 /* Exported Functions */
 /* ================== */
@@ -62,12 +72,59 @@ BPLib_Status_t BPLib_EM_Init(void);
 
 /**
   * \brief   Platform-independent software event generation
-  * \details Description
-  *          Platform-independent routine generation of a software event
+  * \details Platform-independent routine generation of a software event.
+  *          Events below the filter level, events whose ID is disabled and events over
+  *          the per-ID rate limit are dropped before the text is formatted. In deferred
+  *          mode the arguments are captured and formatting happens in
+  *          BPLib_EM_FlushDeferred.
+  * \note    Deferred events keep a pointer to EventText, which must be a string literal
   * \return  Execution status
-  * \retval  BPLIB_SUCCESS (0): Event was successful generated
+  * \retval  BPLIB_SUCCESS (0): Event was successful generated or queued
+  * \retval  BPLIB_EM_APP_SQUELCHED: Event was filtered, rate limited or the deferred ring was full
   * \retval  BPLIB_EM_EXPANDED_TEXT_ERROR (-14u): An error occured when using vsprintf
   */
 BPLib_Status_t BPLib_EM_SendEvent(uint16_t EventID, BPLib_EM_EventType_t EventType, char const* EventText, ...);
 
+/**
+  * \brief   Set the event filter level
+  * \details Events with a type below MinType are dropped. BPLib_EM_EventType_UNKNOWN passes
+  *          every event.
+  * \param[in] MinType Lowest event type to send
+  */
+void BPLib_EM_SetFilterLevel(BPLib_EM_EventType_t MinType);
+
+/**
+  * \brief   Enable or disable a single event ID
+  * \note    Event IDs that are equal modulo BPLIB_EM_FILTER_TABLE_SIZE share a setting
+  * \param[in] EventID Event ID to change
+  * \param[in] Enabled false to drop every event with this ID
+  */
+void BPLib_EM_SetEventEnabled(uint16_t EventID, bool Enabled);
+
+/**
+  * \brief   Enable or disable deferred event formatting
+  * \details While enabled, BPLib_EM_SendEvent copies the event ID and raw arguments into
+  *          a ring and returns; BPLib_EM_FlushDeferred formats and sends them later.
+  * \param[in] Deferred true to defer formatting
+  */
+void BPLib_EM_SetDeferred(bool Deferred);
+
+/**
+  * \brief   Format and send deferred events
+  * \details Drains up to MaxEvents events from the deferred ring, oldest first. An event
+  *          whose text cannot be formatted is dropped and counted in FormatErrors.
+  * \param[in] MaxEvents Maximum number of events to send
+  * \return  Number of events sent
+  */
+uint32_t BPLib_EM_FlushDeferred(uint32_t MaxEvents);
+
+/**
+  * \brief   Get the event counters
+  * \param[out] Stats Copy of the event counters
+  * \return  Execution status
+  * \retval  BPLIB_SUCCESS: Counters were copied
+  * \retval  BPLIB_NULL_PTR_ERROR: Stats is NULL
+  */
+BPLib_Status_t BPLib_EM_GetStats(BPLib_EM_Stats_t* Stats);
+
 #endif /* BPLIB_EM_H */
@@ -26,6 +26,476 @@
 #include "bplib_fwp.h"
 #include <string.h>
 #include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+/* ====== */
+/* Macros */
+/* ====== */
+
+#define BPLIB_EM_MAX_CONVERSION_LEN (16u) /* Longest single conversion specifier a deferred event may use */
+
+/* ======== */
+/* Typedefs */
+/* ======== */
+
+/* How a captured format argument was passed */
+typedef enum
+{
+    BPLib_EM_ArgKind_NONE = 0, /* "%%", no argument */
+    BPLib_EM_ArgKind_INT,
+    BPLib_EM_ArgKind_LONG,
+    BPLib_EM_ArgKind_LLONG,
+    BPLib_EM_ArgKind_SIZE,
+    BPLib_EM_ArgKind_INTMAX,
+    BPLib_EM_ArgKind_PTRDIFF,
+    BPLib_EM_ArgKind_DOUBLE,
+    BPLib_EM_ArgKind_PTR,
+    BPLib_EM_ArgKind_STR
+} BPLib_EM_ArgKind_t;
+
+/* A captured format argument */
+typedef union
+{
+    unsigned long long Int;
+    double             Dbl;
+    const void*        Ptr;
+    size_t             StrOffset; /* Offset of the copied string in BPLib_EM_DeferredEvent_t.Strings */
+} BPLib_EM_DeferredArg_t;
+
+/* An event waiting to be formatted */
+typedef struct
+{
+    uint16_t               EventID;
+    uint16_t               EventType;
+    uint32_t               Suppressed; /* Events with this ID suppressed in the previous window */
+    char const*            Spec;
+    BPLib_EM_DeferredArg_t Args[BPLIB_EM_DEFERRED_MAX_ARGS];
+    char                   Strings[BPLIB_EM_DEFERRED_STR_SIZE];
+} BPLib_EM_DeferredEvent_t;
+
+/* Deferred event ring slot */
+typedef struct
+{
+    uint32_t                 Seq; /* Position of the event this slot is ready for, see BPLib_EM_Enqueue */
+    BPLib_EM_DeferredEvent_t Event;
+} BPLib_EM_DeferredSlot_t;
+
+/* Per-event ID filter and rate limit state */
+typedef struct
+{
+    uint64_t WindowStartMs; /* Start of the current rate limiting window */
+    uint32_t Count;         /* Events seen in the current window */
+    uint32_t Suppressed;    /* Events dropped in the current window */
+    bool     Disabled;      /* Drop every event for this ID */
+} BPLib_EM_Filter_t;
+
+/* =========== */
+/* Global Data */
+/* =========== */
+
+static BPLib_EM_EventType_t     BPLib_EM_FilterLevel;
+static bool                     BPLib_EM_DeferredMode;
+static BPLib_EM_Filter_t        BPLib_EM_Filters[BPLIB_EM_FILTER_TABLE_SIZE];
+static BPLib_EM_Stats_t         BPLib_EM_Stats;
+
+static uint32_t                 BPLib_EM_DeferredHead;
+static uint32_t                 BPLib_EM_DeferredTail;
+static BPLib_EM_DeferredSlot_t  BPLib_EM_DeferredRing[BPLIB_EM_DEFERRED_RING_SIZE];
+
+/* ============================= */
+/* Internal Function Definitions */
+/* ============================= */
+
+static uint64_t BPLib_EM_GetTimeMs(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return ((uint64_t) Now.tv_sec * 1000u) + ((uint64_t) Now.tv_nsec / 1000000u);
+}
+
+/* Count an event against its rate limit, true if it may be sent */
+static bool BPLib_EM_RateCheck(BPLib_EM_Filter_t* Filter, uint32_t* Suppressed)
+{
+    uint64_t Now;
+    uint64_t Start;
+
+    *Suppressed = 0;
+
+    if (BPLIB_EM_RATE_LIMIT == 0)
+    {
+        return true;
+    }
+
+    Now   = BPLib_EM_GetTimeMs();
+    Start = __atomic_load_n(&Filter->WindowStartMs, __ATOMIC_RELAXED);
+    if ((Now - Start) >= BPLIB_EM_RATE_WINDOW_MS &&
+        __atomic_compare_exchange_n(&Filter->WindowStartMs, &Start, Now, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+        /* This thread opened a new window: report what the old one dropped */
+        __atomic_store_n(&Filter->Count, 0, __ATOMIC_RELAXED);
+        *Suppressed = __atomic_exchange_n(&Filter->Suppressed, 0, __ATOMIC_RELAXED);
+    }
+
+    if (__atomic_fetch_add(&Filter->Count, 1, __ATOMIC_RELAXED) >= BPLIB_EM_RATE_LIMIT)
+    {
+        __atomic_fetch_add(&Filter->Suppressed, 1, __ATOMIC_RELAXED);
+        return false;
+    }
+
+    return true;
+}
+
+/* Length of the conversion specifier at Spec (which points at a '%'), 0 if it can't be deferred */
+static size_t BPLib_EM_ParseConversion(char const* Spec, BPLib_EM_ArgKind_t* Kind)
+{
+    size_t Len = 1;
+    int    Longs = 0;
+    char   Length = '\0';
+
+    if (Spec[Len] == '%')
+    {
+        *Kind = BPLib_EM_ArgKind_NONE;
+        return 2;
+    }
+
+    /* Flags, width and precision. '*' would consume an extra argument and is not supported. */
+    while (Spec[Len] != '\0' && strchr("-+ #0123456789.", Spec[Len]) != NULL)
+    {
+        Len++;
+    }
+
+    /* Length modifier */
+    while (Spec[Len] == 'l' || Spec[Len] == 'h')
+    {
+        Longs += (Spec[Len] == 'l');
+        Length = Spec[Len];
+        Len++;
+    }
+    if (Length == '\0' && Spec[Len] != '\0' && strchr("zjtL", Spec[Len]) != NULL)
+    {
+        Length = Spec[Len];
+        Len++;
+    }
+
+    switch (Spec[Len])
+    {
+        case 'd': case 'i': case 'u': case 'o': case 'x': case 'X':
+            if (Longs == 1)
+                *Kind = BPLib_EM_ArgKind_LONG;
+            else if (Longs == 2)
+                *Kind = BPLib_EM_ArgKind_LLONG;
+            else if (Length == 'z')
+                *Kind = BPLib_EM_ArgKind_SIZE;
+            else if (Length == 'j')
+                *Kind = BPLib_EM_ArgKind_INTMAX;
+            else if (Length == 't')
+                *Kind = BPLib_EM_ArgKind_PTRDIFF;
+            else if (Length == 'L' || Longs > 2)
+                return 0;
+            else
+                *Kind = BPLib_EM_ArgKind_INT;
+            break;
+        case 'c':
+            if (Length != '\0')
+            {
+                return 0;
+            }
+            *Kind = BPLib_EM_ArgKind_INT;
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            if (Length != '\0' && Length != 'l')
+            {
+                return 0;
+            }
+            *Kind = BPLib_EM_ArgKind_DOUBLE;
+            break;
+        case 'p':
+            *Kind = BPLib_EM_ArgKind_PTR;
+            break;
+        case 's':
+            if (Length != '\0')
+            {
+                return 0;
+            }
+            *Kind = BPLib_EM_ArgKind_STR;
+            break;
+        default:
+            /* %n, wide characters and anything unknown */
+            return 0;
+    }
+
+    Len++;
+    return (Len < BPLIB_EM_MAX_CONVERSION_LEN) ? Len : 0;
+}
+
+/* Capture the arguments of an event, false if Spec can't be deferred */
+static bool BPLib_EM_Capture(BPLib_EM_DeferredEvent_t* Event, char const* Spec, va_list ArgPtr)
+{
+    BPLib_EM_ArgKind_t Kind;
+    uint32_t           NumArgs = 0;
+    size_t             StrUsed = 0;
+    size_t             ConvLen;
+    size_t             StrLen;
+    const char*        Str;
+
+    if (Spec == NULL)
+    {
+        return false;
+    }
+
+    for (; *Spec != '\0'; Spec++)
+    {
+        if (*Spec != '%')
+        {
+            continue;
+        }
+
+        ConvLen = BPLib_EM_ParseConversion(Spec, &Kind);
+        if (ConvLen == 0)
+        {
+            return false;
+        }
+        Spec += ConvLen - 1;
+
+        if (Kind == BPLib_EM_ArgKind_NONE)
+        {
+            continue;
+        }
+        if (NumArgs == BPLIB_EM_DEFERRED_MAX_ARGS)
+        {
+            return false;
+        }
+
+        switch (Kind)
+        {
+            case BPLib_EM_ArgKind_INT:
+                Event->Args[NumArgs].Int = (unsigned long long) va_arg(ArgPtr, int);
+                break;
+            case BPLib_EM_ArgKind_LONG:
+                Event->Args[NumArgs].Int = (unsigned long long) va_arg(ArgPtr, long);
+                break;
+            case BPLib_EM_ArgKind_LLONG:
+                Event->Args[NumArgs].Int = (unsigned long long) va_arg(ArgPtr, long long);
+                break;
+            case BPLib_EM_ArgKind_SIZE:
+                Event->Args[NumArgs].Int = (unsigned long long) va_arg(ArgPtr, size_t);
+                break;
+            case BPLib_EM_ArgKind_INTMAX:
+                Event->Args[NumArgs].Int = (unsigned long long) va_arg(ArgPtr, intmax_t);
+                break;
+            case BPLib_EM_ArgKind_PTRDIFF:
+                Event->Args[NumArgs].Int = (unsigned long long) va_arg(ArgPtr, ptrdiff_t);
+                break;
+            case BPLib_EM_ArgKind_DOUBLE:
+                Event->Args[NumArgs].Dbl = va_arg(ArgPtr, double);
+                break;
+            case BPLib_EM_ArgKind_PTR:
+                Event->Args[NumArgs].Ptr = va_arg(ArgPtr, void*);
+                break;
+            default:
+                /* Strings are copied, the caller's buffer may be gone by the time this is formatted */
+                Str = va_arg(ArgPtr, const char*);
+                if (Str == NULL)
+                {
+                    Str = "(null)";
+                }
+                StrLen = strnlen(Str, BPLIB_EM_DEFERRED_STR_SIZE - StrUsed - 1);
+                memcpy(&Event->Strings[StrUsed], Str, StrLen);
+                Event->Strings[StrUsed + StrLen] = '\0';
+                Event->Args[NumArgs].StrOffset = StrUsed;
+                StrUsed += StrLen;
+                if (StrUsed < BPLIB_EM_DEFERRED_STR_SIZE - 1)
+                {
+                    StrUsed++;
+                }
+                break;
+        }
+
+        NumArgs++;
+    }
+
+    return true;
+}
+
+/* Format a captured event, the deferred counterpart of vsnprintf */
+static int BPLib_EM_FormatDeferred(const BPLib_EM_DeferredEvent_t* Event, char* Text, size_t TextSize)
+{
+    BPLib_EM_ArgKind_t            Kind;
+    const BPLib_EM_DeferredArg_t* Arg = Event->Args;
+    char const*                   Spec = Event->Spec;
+    char                          Conv[BPLIB_EM_MAX_CONVERSION_LEN];
+    size_t                        ConvLen;
+    size_t                        Used = 0;
+    char*                         Out;
+    size_t                        Room;
+    int                           Len;
+
+    for (; *Spec != '\0'; Spec++)
+    {
+        if (*Spec != '%')
+        {
+            if (Used + 1 < TextSize)
+            {
+                Text[Used] = *Spec;
+            }
+            Used++;
+            continue;
+        }
+
+        /* Spec was already validated by BPLib_EM_Capture */
+        ConvLen = BPLib_EM_ParseConversion(Spec, &Kind);
+        memcpy(Conv, Spec, ConvLen);
+        Conv[ConvLen] = '\0';
+        Spec += ConvLen - 1;
+
+        /* Keep measuring once the text is full, like vsnprintf */
+        Out  = (Used < TextSize) ? Text + Used : NULL;
+        Room = (Used < TextSize) ? TextSize - Used : 0;
+
+        switch (Kind)
+        {
+            case BPLib_EM_ArgKind_NONE:
+                Len = snprintf(Out, Room, "%%");
+                break;
+            case BPLib_EM_ArgKind_INT:
+                Len = snprintf(Out, Room, Conv, (int) Arg->Int);
+                break;
+            case BPLib_EM_ArgKind_LONG:
+                Len = snprintf(Out, Room, Conv, (long) Arg->Int);
+                break;
+            case BPLib_EM_ArgKind_LLONG:
+                Len = snprintf(Out, Room, Conv, (long long) Arg->Int);
+                break;
+            case BPLib_EM_ArgKind_SIZE:
+                Len = snprintf(Out, Room, Conv, (size_t) Arg->Int);
+                break;
+            case BPLib_EM_ArgKind_INTMAX:
+                Len = snprintf(Out, Room, Conv, (intmax_t) Arg->Int);
+                break;
+            case BPLib_EM_ArgKind_PTRDIFF:
+                Len = snprintf(Out, Room, Conv, (ptrdiff_t) Arg->Int);
+                break;
+            case BPLib_EM_ArgKind_DOUBLE:
+                Len = snprintf(Out, Room, Conv, Arg->Dbl);
+                break;
+            case BPLib_EM_ArgKind_PTR:
+                Len = snprintf(Out, Room, Conv, Arg->Ptr);
+                break;
+            default:
+                Len = snprintf(Out, Room, Conv,
+                               &Event->Strings[Arg->StrOffset]);
+                break;
+        }
+
+        if (Len < 0)
+        {
+            return Len;
+        }
+        if (Kind != BPLib_EM_ArgKind_NONE)
+        {
+            Arg++;
+        }
+        Used += (size_t) Len;
+    }
+
+    if (TextSize > 0)
+    {
+        Text[(Used < TextSize) ? Used : TextSize - 1] = '\0';
+    }
+
+    return (int) Used;
+}
+
+/* Add the suppressed event count to the event text and send it */
+static void BPLib_EM_Deliver(uint16_t EventID, BPLib_EM_EventType_t EventType, char* Text, int Length,
+                             uint32_t Suppressed)
+{
+    if (Suppressed != 0 && (size_t) Length < BPLIB_EM_EXPANDED_EVENT_SIZE)
+    {
+        snprintf(Text + Length, BPLIB_EM_EXPANDED_EVENT_SIZE - (size_t) Length, " (%lu suppressed)",
+                 (unsigned long) Suppressed);
+    }
+
+    BPLib_FWP_ProxyCallbacks.BPA_EVP_SendEvent(EventID, EventType, Text);
+    __atomic_fetch_add(&BPLib_EM_Stats.Sent, 1, __ATOMIC_RELAXED);
+}
+
+/* Queue a captured event, false if the ring is full. Safe for any number of producers and consumers. */
+static bool BPLib_EM_Enqueue(const BPLib_EM_DeferredEvent_t* Event)
+{
+    BPLib_EM_DeferredSlot_t* Slot;
+    uint32_t Pos;
+    uint32_t Seq;
+
+    Pos = __atomic_load_n(&BPLib_EM_DeferredTail, __ATOMIC_RELAXED);
+    for (;;)
+    {
+        Slot = &BPLib_EM_DeferredRing[Pos & (BPLIB_EM_DEFERRED_RING_SIZE - 1)];
+        Seq  = __atomic_load_n(&Slot->Seq, __ATOMIC_ACQUIRE);
+
+        if ((int32_t) (Seq - Pos) == 0)
+        {
+            if (__atomic_compare_exchange_n(&BPLib_EM_DeferredTail, &Pos, Pos + 1, true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if ((int32_t) (Seq - Pos) < 0)
+        {
+            return false;
+        }
+        else
+        {
+            Pos = __atomic_load_n(&BPLib_EM_DeferredTail, __ATOMIC_RELAXED);
+        }
+    }
+
+    Slot->Event = *Event;
+    __atomic_store_n(&Slot->Seq, Pos + 1, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+/* Take the oldest queued event, false if the ring is empty */
+static bool BPLib_EM_Dequeue(BPLib_EM_DeferredEvent_t* Event)
+{
+    BPLib_EM_DeferredSlot_t* Slot;
+    uint32_t Pos;
+    uint32_t Seq;
+
+    Pos = __atomic_load_n(&BPLib_EM_DeferredHead, __ATOMIC_RELAXED);
+    for (;;)
+    {
+        Slot = &BPLib_EM_DeferredRing[Pos & (BPLIB_EM_DEFERRED_RING_SIZE - 1)];
+        Seq  = __atomic_load_n(&Slot->Seq, __ATOMIC_ACQUIRE);
+
+        if ((int32_t) (Seq - (Pos + 1)) == 0)
+        {
+            if (__atomic_compare_exchange_n(&BPLib_EM_DeferredHead, &Pos, Pos + 1, true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if ((int32_t) (Seq - (Pos + 1)) < 0)
+        {
+            return false;
+        }
+        else
+        {
+            Pos = __atomic_load_n(&BPLib_EM_DeferredHead, __ATOMIC_RELAXED);
+        }
+    }
+
+    *Event = Slot->Event;
+    __atomic_store_n(&Slot->Seq, Pos + BPLIB_EM_DEFERRED_RING_SIZE, __ATOMIC_RELEASE);
+
+    return true;
+}
 
 /* ==================== */
 /* Function Definitions */
@@ -35,11 +505,24 @@
 BPLib_Status_t BPLib_EM_Init(void)
 {
     BPLib_Status_t Status;
+    uint32_t i;
 
     /* Initialize the Status as BPLIB_SUCCESS and
        leave open to change under future circumstances */
     Status = BPLIB_SUCCESS;
 
+    BPLib_EM_FilterLevel = BPLib_EM_EventType_UNKNOWN;
+    BPLib_EM_DeferredMode = false;
+    memset(BPLib_EM_Filters, 0, sizeof(BPLib_EM_Filters));
+    memset(&BPLib_EM_Stats, 0, sizeof(BPLib_EM_Stats));
+
+    BPLib_EM_DeferredHead = 0;
+    BPLib_EM_DeferredTail = 0;
+    for (i = 0; i < BPLIB_EM_DEFERRED_RING_SIZE; i++)
+    {
+        BPLib_EM_DeferredRing[i].Seq = i;
+    }
+
     BPLib_FWP_ProxyCallbacks.BPA_EVP_Init();
 
     return Status;
@@ -52,12 +535,59 @@ BPLib_Status_t BPLib_EM_SendEvent(uint16_t EventID, BPLib_EM_EventType_t EventTy
     char ExpandedEventText[BPLIB_EM_EXPANDED_EVENT_SIZE];
     int ExpandedLength;
     va_list EventTextArgPtr;
+    va_list CaptureArgPtr;
+    BPLib_EM_Filter_t* Filter;
+    BPLib_EM_DeferredEvent_t Deferred;
+    uint32_t Suppressed;
+    bool Captured;
 
     // Default to success status
     Status = BPLIB_SUCCESS;
 
+    // Drop filtered and rate limited events before doing any formatting
+    Filter = &BPLib_EM_Filters[EventID & (BPLIB_EM_FILTER_TABLE_SIZE - 1)];
+    if (EventType < __atomic_load_n(&BPLib_EM_FilterLevel, __ATOMIC_RELAXED) ||
+        __atomic_load_n(&Filter->Disabled, __ATOMIC_RELAXED))
+    {
+        __atomic_fetch_add(&BPLib_EM_Stats.Filtered, 1, __ATOMIC_RELAXED);
+        return BPLIB_EM_APP_SQUELCHED;
+    }
+    if (!BPLib_EM_RateCheck(Filter, &Suppressed))
+    {
+        __atomic_fetch_add(&BPLib_EM_Stats.Suppressed, 1, __ATOMIC_RELAXED);
+        return BPLIB_EM_APP_SQUELCHED;
+    }
+
     // Gather conversion specifiers from remaining arguments
     va_start(EventTextArgPtr, Spec);
+
+    if (__atomic_load_n(&BPLib_EM_DeferredMode, __ATOMIC_RELAXED))
+    {
+        va_copy(CaptureArgPtr, EventTextArgPtr);
+        Captured = BPLib_EM_Capture(&Deferred, Spec, CaptureArgPtr);
+        va_end(CaptureArgPtr);
+
+        if (Captured)
+        {
+            va_end(EventTextArgPtr);
+
+            Deferred.EventID = EventID;
+            Deferred.EventType = (uint16_t) EventType;
+            Deferred.Suppressed = Suppressed;
+            Deferred.Spec = Spec;
+            if (!BPLib_EM_Enqueue(&Deferred))
+            {
+                __atomic_fetch_add(&BPLib_EM_Stats.Dropped, 1, __ATOMIC_RELAXED);
+                return BPLIB_EM_APP_SQUELCHED;
+            }
+
+            __atomic_fetch_add(&BPLib_EM_Stats.Deferred, 1, __ATOMIC_RELAXED);
+            return BPLIB_SUCCESS;
+        }
+
+        // Formats that can't be captured are sent immediately
+    }
+
     ExpandedLength = vsnprintf(ExpandedEventText, BPLIB_EM_EXPANDED_EVENT_SIZE, Spec, EventTextArgPtr);
     va_end(EventTextArgPtr);
 
@@ -67,8 +597,66 @@ BPLib_Status_t BPLib_EM_SendEvent(uint16_t EventID, BPLib_EM_EventType_t EventTy
     }
     else
     {
-        BPLib_FWP_ProxyCallbacks.BPA_EVP_SendEvent(EventID, EventType, ExpandedEventText);
+        BPLib_EM_Deliver(EventID, EventType, ExpandedEventText, ExpandedLength, Suppressed);
     }
 
     return Status;
 }
+
+void BPLib_EM_SetFilterLevel(BPLib_EM_EventType_t MinType)
+{
+    __atomic_store_n(&BPLib_EM_FilterLevel, MinType, __ATOMIC_RELAXED);
+}
+
+void BPLib_EM_SetEventEnabled(uint16_t EventID, bool Enabled)
+{
+    __atomic_store_n(&BPLib_EM_Filters[EventID & (BPLIB_EM_FILTER_TABLE_SIZE - 1)].Disabled, !Enabled,
+                     __ATOMIC_RELAXED);
+}
+
+void BPLib_EM_SetDeferred(bool Deferred)
+{
+    __atomic_store_n(&BPLib_EM_DeferredMode, Deferred, __ATOMIC_RELAXED);
+}
+
+uint32_t BPLib_EM_FlushDeferred(uint32_t MaxEvents)
+{
+    BPLib_EM_DeferredEvent_t Event;
+    char ExpandedEventText[BPLIB_EM_EXPANDED_EVENT_SIZE];
+    int ExpandedLength;
+    uint32_t NumSent = 0;
+
+    while (NumSent < MaxEvents && BPLib_EM_Dequeue(&Event))
+    {
+        ExpandedLength = BPLib_EM_FormatDeferred(&Event, ExpandedEventText, sizeof(ExpandedEventText));
+        if (ExpandedLength >= 0)
+        {
+            BPLib_EM_Deliver(Event.EventID, (BPLib_EM_EventType_t) Event.EventType, ExpandedEventText,
+                             ExpandedLength, Event.Suppressed);
+            NumSent++;
+        }
+        else
+        {
+            __atomic_fetch_add(&BPLib_EM_Stats.FormatErrors, 1, __ATOMIC_RELAXED);
+        }
+    }
+
+    return NumSent;
+}
+
+BPLib_Status_t BPLib_EM_GetStats(BPLib_EM_Stats_t* Stats)
+{
+    if (Stats == NULL)
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    Stats->Sent         = __atomic_load_n(&BPLib_EM_Stats.Sent, __ATOMIC_RELAXED);
+    Stats->Filtered     = __atomic_load_n(&BPLib_EM_Stats.Filtered, __ATOMIC_RELAXED);
+    Stats->Suppressed   = __atomic_load_n(&BPLib_EM_Stats.Suppressed, __ATOMIC_RELAXED);
+    Stats->Deferred     = __atomic_load_n(&BPLib_EM_Stats.Deferred, __ATOMIC_RELAXED);
+    Stats->Dropped      = __atomic_load_n(&BPLib_EM_Stats.Dropped, __ATOMIC_RELAXED);
+    Stats->FormatErrors = __atomic_load_n(&BPLib_EM_Stats.FormatErrors, __ATOMIC_RELAXED);
+
+    return BPLIB_SUCCESS;
+}
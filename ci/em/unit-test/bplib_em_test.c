@@ -193,9 +193,136 @@ void Test_BPA_EM_SendEvent_ExpandedTextError(void)
     UtAssert_EQ(BPLib_Status_t, Status, BPLIB_EM_EXPANDED_TEXT_ERROR);
 }
 
+void Test_BPLib_EM_SendEvent_Filtered(void)
+{
+    BPLib_EM_Stats_t Stats;
+
+    /* Events below the filter level are dropped without reaching the proxy */
+    BPLib_EM_SetFilterLevel(BPLib_EM_EventType_INFORMATION);
+    UtAssert_EQ(BPLib_Status_t, BPLib_EM_SendEvent(1, BPLib_EM_EventType_DEBUG, "debug %d", 1), BPLIB_EM_APP_SQUELCHED);
+    UtAssert_EQ(BPLib_Status_t, BPLib_EM_SendEvent(1, BPLib_EM_EventType_INFORMATION, "info %d", 1), BPLIB_SUCCESS);
+
+    /* Disabled event IDs are dropped regardless of type */
+    BPLib_EM_SetEventEnabled(2, false);
+    UtAssert_EQ(BPLib_Status_t, BPLib_EM_SendEvent(2, BPLib_EM_EventType_ERROR, "error %d", 2), BPLIB_EM_APP_SQUELCHED);
+    BPLib_EM_SetEventEnabled(2, true);
+    UtAssert_EQ(BPLib_Status_t, BPLib_EM_SendEvent(2, BPLib_EM_EventType_ERROR, "error %d", 2), BPLIB_SUCCESS);
+
+    UtAssert_STUB_COUNT(BPA_EVP_SendEvent, 2);
+    UtAssert_EQ(BPLib_Status_t, BPLib_EM_GetStats(&Stats), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Stats.Sent, 2);
+    UtAssert_UINT32_EQ(Stats.Filtered, 2);
+}
+
+void Test_BPLib_EM_SendEvent_RateLimited(void)
+{
+    BPLib_EM_Stats_t Stats;
+    uint32_t i;
+
+    for (i = 0; i < BPLIB_EM_RATE_LIMIT; i++)
+    {
+        UtAssert_EQ(BPLib_Status_t, BPLib_EM_SendEvent(3, BPLib_EM_EventType_ERROR, "storm %u", i), BPLIB_SUCCESS);
+    }
+    UtAssert_EQ(BPLib_Status_t, BPLib_EM_SendEvent(3, BPLib_EM_EventType_ERROR, "storm %u", i), BPLIB_EM_APP_SQUELCHED);
+
+    /* Other event IDs have their own limit */
+    UtAssert_EQ(BPLib_Status_t, BPLib_EM_SendEvent(4, BPLib_EM_EventType_ERROR, "calm"), BPLIB_SUCCESS);
+
+    UtAssert_STUB_COUNT(BPA_EVP_SendEvent, BPLIB_EM_RATE_LIMIT + 1);
+    UtAssert_EQ(BPLib_Status_t, BPLib_EM_GetStats(&Stats), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Stats.Suppressed, 1);
+}
+
+void Test_BPLib_EM_SendEvent_Deferred(void)
+{
+    BPLib_EM_Stats_t Stats;
+    char Name[16];
+
+    BPLib_EM_SetDeferred(true);
+
+    /* The string argument must be copied, not referenced */
+    strncpy(Name, "fish", sizeof(Name));
+    UtAssert_EQ(BPLib_Status_t, BPLib_EM_SendEvent(5, BPLib_EM_EventType_INFORMATION,
+        "deferred %d %s %.2f %lu%% %zu", -7, Name, 1.5, 99ul, (size_t) 3), BPLIB_SUCCESS);
+    strncpy(Name, "bird", sizeof(Name));
+    UtAssert_STUB_COUNT(BPA_EVP_SendEvent, 0);
+
+    UtAssert_UINT32_EQ(BPLib_EM_FlushDeferred(10), 1);
+    UtAssert_STUB_COUNT(BPA_EVP_SendEvent, 1);
+    UtAssert_EQ(uint16_t, context_BPA_EVP_SendEvent.EventID, 5);
+    UtAssert_STRINGBUF_EQ("deferred -7 fish 1.50 99% 3", BPLIB_EM_EXPANDED_EVENT_SIZE,
+                            context_BPA_EVP_SendEvent.Spec, BPLIB_EM_EXPANDED_EVENT_SIZE);
+
+    /* Formats that can't be captured are sent right away */
+    UtAssert_EQ(BPLib_Status_t, BPLib_EM_SendEvent(6, BPLib_EM_EventType_INFORMATION, "width %*d", 4, 2), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPA_EVP_SendEvent, 2);
+    UtAssert_STRINGBUF_EQ("width    2", BPLIB_EM_EXPANDED_EVENT_SIZE,
+                            context_BPA_EVP_SendEvent.Spec, BPLIB_EM_EXPANDED_EVENT_SIZE);
+
+    UtAssert_UINT32_EQ(BPLib_EM_FlushDeferred(10), 0);
+    UtAssert_EQ(BPLib_Status_t, BPLib_EM_GetStats(&Stats), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Stats.Deferred, 1);
+    UtAssert_UINT32_EQ(Stats.Sent, 2);
+}
+
+void Test_BPLib_EM_SendEvent_DeferredFull(void)
+{
+    BPLib_EM_Stats_t Stats;
+    uint32_t i;
+
+    BPLib_EM_SetDeferred(true);
+
+    /* Spread the events over IDs so the rate limit doesn't kick in first */
+    for (i = 0; i < BPLIB_EM_DEFERRED_RING_SIZE; i++)
+    {
+        UtAssert_EQ(BPLib_Status_t, BPLib_EM_SendEvent(i, BPLib_EM_EventType_INFORMATION, "event %u", i), BPLIB_SUCCESS);
+    }
+    UtAssert_EQ(BPLib_Status_t, BPLib_EM_SendEvent(i, BPLib_EM_EventType_INFORMATION, "event %u", i), BPLIB_EM_APP_SQUELCHED);
+
+    UtAssert_UINT32_EQ(BPLib_EM_FlushDeferred(1), 1);
+    UtAssert_STRINGBUF_EQ("event 0", BPLIB_EM_EXPANDED_EVENT_SIZE,
+                            context_BPA_EVP_SendEvent.Spec, BPLIB_EM_EXPANDED_EVENT_SIZE);
+    UtAssert_UINT32_EQ(BPLib_EM_FlushDeferred(BPLIB_EM_DEFERRED_RING_SIZE), BPLIB_EM_DEFERRED_RING_SIZE - 1);
+    UtAssert_STRINGBUF_EQ("event 63", BPLIB_EM_EXPANDED_EVENT_SIZE,
+                            context_BPA_EVP_SendEvent.Spec, BPLIB_EM_EXPANDED_EVENT_SIZE);
+
+    UtAssert_EQ(BPLib_Status_t, BPLib_EM_GetStats(&Stats), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Stats.Dropped, 1);
+}
+
+void Test_BPLib_EM_FlushDeferred_FormatError(void)
+{
+    BPLib_EM_Stats_t Stats;
+
+    BPLib_EM_SetDeferred(true);
+
+    /* A width too large for vsnprintf is captured but can't be formatted */
+    UtAssert_EQ(BPLib_Status_t, BPLib_EM_SendEvent(7, BPLib_EM_EventType_INFORMATION, "bad %2147483648d", 1), BPLIB_SUCCESS);
+    UtAssert_EQ(BPLib_Status_t, BPLib_EM_SendEvent(8, BPLib_EM_EventType_INFORMATION, "good %d", 1), BPLIB_SUCCESS);
+
+    UtAssert_UINT32_EQ(BPLib_EM_FlushDeferred(10), 1);
+    UtAssert_STUB_COUNT(BPA_EVP_SendEvent, 1);
+    UtAssert_EQ(uint16_t, context_BPA_EVP_SendEvent.EventID, 8);
+
+    UtAssert_EQ(BPLib_Status_t, BPLib_EM_GetStats(&Stats), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Stats.FormatErrors, 1);
+    UtAssert_UINT32_EQ(Stats.Sent, 1);
+}
+
+void Test_BPLib_EM_GetStats_Null(void)
+{
+    UtAssert_EQ(BPLib_Status_t, BPLib_EM_GetStats(NULL), BPLIB_NULL_PTR_ERROR);
+}
+
 void TestBplibEm_Register(void)
 {
     ADD_TEST(Test_BPLib_EM_Init_Nominal);
     ADD_TEST(Test_BPA_EM_SendEvent_Nominal);
     ADD_TEST(Test_BPA_EM_SendEvent_ExpandedTextError);
+    ADD_TEST(Test_BPLib_EM_SendEvent_Filtered);
+    ADD_TEST(Test_BPLib_EM_SendEvent_RateLimited);
+    ADD_TEST(Test_BPLib_EM_SendEvent_Deferred);
+    ADD_TEST(Test_BPLib_EM_SendEvent_DeferredFull);
+    ADD_TEST(Test_BPLib_EM_FlushDeferred_FormatError);
+    ADD_TEST(Test_BPLib_EM_GetStats_Null);
 }
\ No newline at end of file
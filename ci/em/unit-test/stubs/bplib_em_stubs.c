@@ -27,6 +27,38 @@
 #include "bplib_em.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_EM_FlushDeferred()
+ * ----------------------------------------------------
+ */
+uint32_t BPLib_EM_FlushDeferred(uint32_t MaxEvents)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_EM_FlushDeferred, uint32_t);
+
+    UT_GenStub_AddParam(BPLib_EM_FlushDeferred, uint32_t, MaxEvents);
+
+    UT_GenStub_Execute(BPLib_EM_FlushDeferred, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_EM_FlushDeferred, uint32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_EM_GetStats()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_EM_GetStats(BPLib_EM_Stats_t *Stats)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_EM_GetStats, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_EM_GetStats, BPLib_EM_Stats_t *, Stats);
+
+    UT_GenStub_Execute(BPLib_EM_GetStats, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_EM_GetStats, BPLib_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_EM_Init()
@@ -53,4 +85,41 @@ BPLib_Status_t BPLib_EM_SendEvent(uint16_t EventID, BPLib_EM_EventType_t EventTy
     UT_GenStub_Execute(BPLib_EM_SendEvent, Basic, NULL);
 
     return UT_GenStub_GetReturnValue(BPLib_EM_SendEvent, BPLib_Status_t);
-}
\ No newline at end of file
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_EM_SetDeferred()
+ * ----------------------------------------------------
+ */
+void BPLib_EM_SetDeferred(bool Deferred)
+{
+    UT_GenStub_AddParam(BPLib_EM_SetDeferred, bool, Deferred);
+
+    UT_GenStub_Execute(BPLib_EM_SetDeferred, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_EM_SetEventEnabled()
+ * ----------------------------------------------------
+ */
+void BPLib_EM_SetEventEnabled(uint16_t EventID, bool Enabled)
+{
+    UT_GenStub_AddParam(BPLib_EM_SetEventEnabled, uint16_t, EventID);
+    UT_GenStub_AddParam(BPLib_EM_SetEventEnabled, bool, Enabled);
+
+    UT_GenStub_Execute(BPLib_EM_SetEventEnabled, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_EM_SetFilterLevel()
+ * ----------------------------------------------------
+ */
+void BPLib_EM_SetFilterLevel(BPLib_EM_EventType_t MinType)
+{
+    UT_GenStub_AddParam(BPLib_EM_SetFilterLevel, BPLib_EM_EventType_t, MinType);
+
+    UT_GenStub_Execute(BPLib_EM_SetFilterLevel, Basic, NULL);
+}
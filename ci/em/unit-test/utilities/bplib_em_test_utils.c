@@ -49,6 +49,9 @@ void BPLib_EM_Test_Setup(void)
     BPLib_FWP_ProxyCallbacks.BPA_EVP_SendEvent = BPA_EVP_SendEvent;
 
     UT_SetHandlerFunction(UT_KEY(BPA_EVP_SendEvent), UT_Handler_BPA_EVP_SendEvent, NULL);
+
+    /* Clear filters, rate limits and deferred events left by earlier tests */
+    (void) BPLib_EM_Init();
 }
 
 void BPLib_EM_Test_Teardown(void)
@@ -37,8 +37,23 @@ typedef struct BPLib_MEM_PoolImpl
     size_t block_size; /**< Size of each block in the pool, in bytes. */
     size_t num_free; /**< Number of free blocks available */
     size_t num_init; /**< Number of initialized blocks. */
+    size_t num_in_use_hwm; /**< Highest number of blocks ever allocated at once. */
+    size_t num_alloc_fail; /**< Number of allocations that failed because the pool was empty. */
 } BPLib_MEM_PoolImpl_t;
 
+/**
+ * @struct BPLib_MEM_PoolStats_t
+ * @brief Snapshot of the statistics of a memory pool.
+ */
+typedef struct BPLib_MEM_PoolStats
+{
+    size_t num_blocks; /**< The maximum number of blocks that can be allocated by the pool. */
+    size_t block_size; /**< Size of each block in the pool, in bytes. */
+    size_t num_free; /**< Number of free blocks available */
+    size_t num_in_use_hwm; /**< Highest number of blocks ever allocated at once. */
+    size_t num_alloc_fail; /**< Number of allocations that failed because the pool was empty. */
+} BPLib_MEM_PoolStats_t;
+
 /**
  * @brief Initializes the memory pool implementation.
  * 
@@ -84,4 +99,18 @@ void* BPLib_MEM_PoolImplAlloc(BPLib_MEM_PoolImpl_t* pool);
  */
 void BPLib_MEM_PoolImplFree(BPLib_MEM_PoolImpl_t* pool, void* to_free);
 
+/**
+ * @brief Reads the statistics of the memory pool implementation.
+ * 
+ * The statistics are only modified by allocation and free, which are serialized by
+ * the caller, and each one is stored and loaded atomically. This function can
+ * therefore be called without holding the lock that serializes allocation. Each
+ * field is individually consistent; the snapshot as a whole may straddle an
+ * allocation.
+ * 
+ * @param[in] pool Pointer to the memory pool implementation.
+ * @param[out] stats Pointer to the statistics snapshot to fill.
+ */
+void BPLib_MEM_PoolImplGetStats(const BPLib_MEM_PoolImpl_t* pool, BPLib_MEM_PoolStats_t* stats);
+
 #endif /* BPLIB_MEM_BEN_ALLOCATOR_H */
@@ -25,14 +25,46 @@
 #include "bplib_bblocks.h"
 
 #include <pthread.h>
+#include <stdbool.h>
 
 /**
  ** \brief Defines the size of a memory block user data if used as a bytearray
 */
 #define BPLIB_MEM_CHUNKSIZE (512U)
 
+/**
+ ** \brief Number of blob chunks a bundle can track in its chunk index
+ **
+ ** \par Description
+ **      Chunks at positions beyond this value are still reachable, they are just
+ **      found by walking the chain forward from the last indexed chunk. The default
+ **      covers a bundle of BPLIB_MAX_BUNDLE_LEN bytes. Must be at least 1.
+*/
+#ifndef BPLIB_MEM_CHUNK_INDEX_LEN
+#define BPLIB_MEM_CHUNK_INDEX_LEN ((BPLIB_MAX_BUNDLE_LEN + BPLIB_MEM_CHUNKSIZE - 1) / BPLIB_MEM_CHUNKSIZE)
+#endif
+
+/**
+ ** \brief Size in bytes of an explicit hugepage, used to round MAP_HUGETLB mappings
+*/
+#ifndef BPLIB_MEM_HUGEPAGE_SIZE
+#define BPLIB_MEM_HUGEPAGE_SIZE (2U * 1024U * 1024U)
+#endif
+
 typedef struct BPLib_MEM_Block BPLib_MEM_Block_t;
 
+/**
+ * @enum BPLib_MEM_PoolBacking_t
+ * @brief Describes where the memory behind a pool came from.
+ */
+typedef enum BPLib_MEM_PoolBacking
+{
+    BPLIB_MEM_BACKING_USER    = 0, /**< Caller-provided memory passed to BPLib_MEM_PoolInit */
+    BPLIB_MEM_BACKING_PAGES   = 1, /**< Anonymous mapping using the base page size */
+    BPLIB_MEM_BACKING_THP     = 2, /**< Anonymous mapping advised to use transparent hugepages */
+    BPLIB_MEM_BACKING_HUGETLB = 3  /**< Anonymous mapping taken from the reserved hugepage pool */
+} BPLib_MEM_PoolBacking_t;
+
 /**
  * @struct BPLib_Bundle_t
  * @brief Represents the entire bundle, including its blocks and an additional blob for other data.
@@ -42,6 +74,8 @@ typedef struct BPLib_Bundle
     BPLib_BundleMetaData_t  Meta;
     BPLib_BBlocks_t         blocks;
     struct BPLib_MEM_Block* blob;
+    struct BPLib_MEM_Block* blob_index[BPLIB_MEM_CHUNK_INDEX_LEN]; /**< Direct pointers to the first blob chunks */
+    size_t                  blob_index_len; /**< Number of valid entries in blob_index, 0 if not indexed */
 } BPLib_Bundle_t;
 
 /**
@@ -79,6 +113,12 @@ typedef struct BPLib_MEM_Pool
 {
     BPLib_MEM_PoolImpl_t impl; /**< The pool implementation (details hidden) */
     pthread_mutex_t lock; /**< Mutex for synchronizing access to the pool */
+    BPLib_MEM_PoolBacking_t backing; /**< How the pool memory was obtained */
+    void* mapped_mem; /**< Start of the mapping owned by the pool, NULL if caller-provided */
+    size_t mapped_len; /**< Length of the mapping owned by the pool */
+    size_t low_watermark; /**< Blocks in use at or below which a congested pool recovers */
+    size_t high_watermark; /**< Blocks in use at or above which the pool is congested, 0 disables */
+    volatile bool congested; /**< Set between the high and low watermark crossings */
 } BPLib_MEM_Pool_t;
 
 /**
@@ -94,10 +134,76 @@ typedef struct BPLib_MEM_Pool
  */
 BPLib_Status_t BPLib_MEM_PoolInit(BPLib_MEM_Pool_t* pool, void* init_mem, size_t init_size);
 
+/**
+ * @brief Initializes a memory pool over an anonymous mapping owned by the pool.
+ * 
+ * The requested backing is a preference. BPLIB_MEM_BACKING_HUGETLB falls back to
+ * BPLIB_MEM_BACKING_THP when no hugepages are reserved, and BPLIB_MEM_BACKING_THP
+ * falls back to BPLIB_MEM_BACKING_PAGES when transparent hugepages are unavailable.
+ * The backing actually obtained is recorded in pool->backing. The mapping is not
+ * prefaulted, so each page is placed on the NUMA node of the thread that first
+ * allocates from it. The mapping is released by BPLib_MEM_PoolDestroy.
+ * 
+ * @param[out] pool Pointer to the memory pool to initialize.
+ * @param[in] init_size Size of the mapping in bytes.
+ * @param[in] backing Preferred backing, must not be BPLIB_MEM_BACKING_USER.
+ * 
+ * @return Status of the operation.
+ * @retval BPLIB_SUCCESS The pool was initialized.
+ * @retval BPLIB_ERROR The pool is NULL or the backing is invalid.
+ * @retval BPLIB_MEM_MAP_ERR The mapping could not be created.
+ */
+BPLib_Status_t BPLib_MEM_PoolMapInit(BPLib_MEM_Pool_t* pool, size_t init_size, BPLib_MEM_PoolBacking_t backing);
+
+/**
+ * @brief Sets the pressure watermarks of a memory pool.
+ * 
+ * The pool becomes congested once the number of blocks in use reaches high_blocks and
+ * stays congested until it falls back to low_blocks. Ingress sheds new bundles while
+ * the pool is congested, so the remaining headroom is left for bundles already in
+ * the pipeline. Setting high_blocks to 0 disables admission control.
+ * 
+ * @param[in] pool Pointer to the memory pool.
+ * @param[in] low_blocks Blocks in use at which a congested pool recovers.
+ * @param[in] high_blocks Blocks in use at which the pool becomes congested.
+ * 
+ * @return Status of the operation.
+ * @retval BPLIB_SUCCESS The watermarks were set.
+ * @retval BPLIB_ERROR The pool is NULL or low_blocks is not below high_blocks.
+ */
+BPLib_Status_t BPLib_MEM_PoolSetWatermarks(BPLib_MEM_Pool_t* pool, size_t low_blocks, size_t high_blocks);
+
+/**
+ * @brief Reports whether a memory pool is above its high watermark.
+ * 
+ * This is a lock-free read of the flag maintained on every block allocation and
+ * free. CLAs can poll it to apply flow control before the pool is exhausted.
+ * 
+ * @param[in] pool Pointer to the memory pool.
+ * 
+ * @return true if the pool is congested, false otherwise or if pool is NULL.
+ */
+bool BPLib_MEM_PoolIsCongested(const BPLib_MEM_Pool_t* pool);
+
+/**
+ * @brief Reads the statistics of a memory pool without taking the pool lock.
+ * 
+ * Intended for telemetry, so that housekeeping never contends with allocation.
+ * 
+ * @param[in] pool Pointer to the memory pool.
+ * @param[out] stats Pointer to the statistics snapshot to fill.
+ * 
+ * @return Status of the operation.
+ * @retval BPLIB_SUCCESS The statistics were read.
+ * @retval BPLIB_NULL_PTR_ERROR The pool or stats pointer is NULL.
+ */
+BPLib_Status_t BPLib_MEM_PoolGetStats(const BPLib_MEM_Pool_t* pool, BPLib_MEM_PoolStats_t* stats);
+
 /**
  * @brief Destroys a memory pool.
  * 
- * This function destroys the memory pool and frees any allocated resources.
+ * This function destroys the memory pool and frees any allocated resources,
+ * including a mapping created by BPLib_MEM_PoolMapInit.
  * 
  * @param[in] pool Pointer to the memory pool to destroy.
  */
@@ -171,6 +277,18 @@ BPLib_Bundle_t* BPLib_MEM_BundleAlloc(BPLib_MEM_Pool_t* pool, const void* blob_d
  */
 void BPLib_MEM_BundleFree(BPLib_MEM_Pool_t* pool, BPLib_Bundle_t* bundle);
 
+/**
+ * @brief Builds the chunk index of a bundle's blob.
+ * 
+ * This function records a pointer to each of the first BPLIB_MEM_CHUNK_INDEX_LEN chunks of
+ * the bundle's blob so that offset lookups don't need to walk the chain from its head.
+ * It must be called again any time the blob chain is replaced. BPLib_MEM_BundleAlloc calls
+ * this function itself.
+ * 
+ * @param[in] bundle Pointer to the bundle to index.
+ */
+void BPLib_MEM_BundleIndexBlob(BPLib_Bundle_t* bundle);
+
 /**
  * @brief Copies the blob data out of a bundle.
  * 
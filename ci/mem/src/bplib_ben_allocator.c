@@ -44,6 +44,13 @@
 
 typedef uint64_t MemIndex_t;
 
+/* Statistics are only written while allocation is serialized, but they may be
+** read by telemetry without the lock. Relaxed atomic accesses keep those reads
+** tear-free without adding any ordering cost to the data path.
+*/
+#define BPLIB_BEN_STAT_STORE(field, val)  __atomic_store_n(&(field), (val), __ATOMIC_RELAXED)
+#define BPLIB_BEN_STAT_LOAD(field)        __atomic_load_n(&(field), __ATOMIC_RELAXED)
+
 /*******************************************************************************
  * Static Functions
  */
@@ -130,14 +137,18 @@ void* BPLib_MEM_PoolImplAlloc(BPLib_MEM_PoolImpl_t* pool)
     {
         p = (MemIndex_t *)(AddrFromIndex(pool, pool->num_init));
         *p = pool->num_init + 1;
-        pool->num_init++; 
+        BPLIB_BEN_STAT_STORE(pool->num_init, pool->num_init + 1);
     }
 
     ret = NULL;
     if (pool->num_free > 0)
     {
         ret = (void *)pool->mem_next;
-        pool->num_free--;
+        BPLIB_BEN_STAT_STORE(pool->num_free, pool->num_free - 1);
+        if ((pool->num_blocks - pool->num_free) > pool->num_in_use_hwm)
+        {
+            BPLIB_BEN_STAT_STORE(pool->num_in_use_hwm, pool->num_blocks - pool->num_free);
+        }
         if (pool->num_free != 0 && pool->mem_next != NULL)
         {
             pool->mem_next = (void*) AddrFromIndex(pool, *((MemIndex_t*)pool->mem_next));
@@ -147,6 +158,10 @@ void* BPLib_MEM_PoolImplAlloc(BPLib_MEM_PoolImpl_t* pool)
             pool->mem_next = NULL;
         }
     }
+    else
+    {
+        BPLIB_BEN_STAT_STORE(pool->num_alloc_fail, pool->num_alloc_fail + 1);
+    }
 
     return ret;
 }
@@ -168,5 +183,19 @@ void BPLib_MEM_PoolImplFree(BPLib_MEM_PoolImpl_t* pool, void* to_free)
         (*(MemIndex_t*)to_free) = pool->num_blocks;
         pool->mem_next = (void*)(to_free);
     }
-    pool->num_free++;
+    BPLIB_BEN_STAT_STORE(pool->num_free, pool->num_free + 1);
+}
+
+void BPLib_MEM_PoolImplGetStats(const BPLib_MEM_PoolImpl_t* pool, BPLib_MEM_PoolStats_t* stats)
+{
+    if (pool == NULL || stats == NULL)
+    {
+        return;
+    }
+
+    stats->num_blocks = pool->num_blocks;
+    stats->block_size = pool->block_size;
+    stats->num_free = BPLIB_BEN_STAT_LOAD(pool->num_free);
+    stats->num_in_use_hwm = BPLIB_BEN_STAT_LOAD(pool->num_in_use_hwm);
+    stats->num_alloc_fail = BPLIB_BEN_STAT_LOAD(pool->num_alloc_fail);
 }
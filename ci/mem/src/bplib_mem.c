@@ -27,6 +27,32 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+
+/*******************************************************************************
+* Static Functions
+*/
+
+/* Must be called with the pool lock held */
+static void BPLib_MEM_PoolUpdatePressure(BPLib_MEM_Pool_t* pool)
+{
+    size_t in_use;
+
+    if (pool->high_watermark == 0)
+    {
+        return;
+    }
+
+    in_use = pool->impl.num_blocks - pool->impl.num_free;
+    if (!pool->congested && in_use >= pool->high_watermark)
+    {
+        pool->congested = true;
+    }
+    else if (pool->congested && in_use <= pool->low_watermark)
+    {
+        pool->congested = false;
+    }
+}
 
 /*******************************************************************************
 * Exported Functions
@@ -44,6 +70,118 @@ BPLib_Status_t BPLib_MEM_PoolInit(BPLib_MEM_Pool_t* pool, void* init_mem, size_t
         sizeof(BPLib_MEM_Block_t));
 }
 
+BPLib_Status_t BPLib_MEM_PoolMapInit(BPLib_MEM_Pool_t* pool, size_t init_size, BPLib_MEM_PoolBacking_t backing)
+{
+    BPLib_Status_t Status;
+    void* MappedMem;
+    size_t MappedLen;
+
+    if (pool == NULL || init_size == 0)
+    {
+        return BPLIB_ERROR;
+    }
+
+    if (backing != BPLIB_MEM_BACKING_PAGES && backing != BPLIB_MEM_BACKING_THP &&
+        backing != BPLIB_MEM_BACKING_HUGETLB)
+    {
+        return BPLIB_ERROR;
+    }
+
+    MappedMem = MAP_FAILED;
+    MappedLen = init_size;
+
+    #ifdef MAP_HUGETLB
+    if (backing == BPLIB_MEM_BACKING_HUGETLB)
+    {
+        /* Explicit hugepage mappings must be a whole number of hugepages */
+        MappedLen = ((init_size + BPLIB_MEM_HUGEPAGE_SIZE - 1) / BPLIB_MEM_HUGEPAGE_SIZE) *
+            BPLIB_MEM_HUGEPAGE_SIZE;
+        MappedMem = mmap(NULL, MappedLen, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+    #endif
+
+    if (MappedMem == MAP_FAILED)
+    {
+        /* No hugepages reserved (or not supported), fall back to transparent hugepages */
+        if (backing == BPLIB_MEM_BACKING_HUGETLB)
+        {
+            backing = BPLIB_MEM_BACKING_THP;
+        }
+
+        MappedLen = init_size;
+        MappedMem = mmap(NULL, MappedLen, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (MappedMem == MAP_FAILED)
+        {
+            return BPLIB_MEM_MAP_ERR;
+        }
+
+        if (backing == BPLIB_MEM_BACKING_THP)
+        {
+            #ifdef MADV_HUGEPAGE
+            if (madvise(MappedMem, MappedLen, MADV_HUGEPAGE) != 0)
+            {
+                backing = BPLIB_MEM_BACKING_PAGES;
+            }
+            #else
+            backing = BPLIB_MEM_BACKING_PAGES;
+            #endif
+        }
+    }
+
+    Status = BPLib_MEM_PoolInit(pool, MappedMem, MappedLen);
+    if (Status != BPLIB_SUCCESS)
+    {
+        munmap(MappedMem, MappedLen);
+        return Status;
+    }
+
+    pool->backing = backing;
+    pool->mapped_mem = MappedMem;
+    pool->mapped_len = MappedLen;
+
+    return BPLIB_SUCCESS;
+}
+
+BPLib_Status_t BPLib_MEM_PoolSetWatermarks(BPLib_MEM_Pool_t* pool, size_t low_blocks, size_t high_blocks)
+{
+    if (pool == NULL || (high_blocks != 0 && low_blocks >= high_blocks))
+    {
+        return BPLIB_ERROR;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->low_watermark = low_blocks;
+    pool->high_watermark = high_blocks;
+    pool->congested = false;
+    BPLib_MEM_PoolUpdatePressure(pool);
+    pthread_mutex_unlock(&pool->lock);
+
+    return BPLIB_SUCCESS;
+}
+
+bool BPLib_MEM_PoolIsCongested(const BPLib_MEM_Pool_t* pool)
+{
+    if (pool == NULL)
+    {
+        return false;
+    }
+
+    return pool->congested;
+}
+
+BPLib_Status_t BPLib_MEM_PoolGetStats(const BPLib_MEM_Pool_t* pool, BPLib_MEM_PoolStats_t* stats)
+{
+    if (pool == NULL || stats == NULL)
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    BPLib_MEM_PoolImplGetStats(&pool->impl, stats);
+    return BPLIB_SUCCESS;
+}
+
 void BPLib_MEM_PoolDestroy(BPLib_MEM_Pool_t* pool)
 {
     if (pool == NULL)
@@ -53,6 +191,10 @@ void BPLib_MEM_PoolDestroy(BPLib_MEM_Pool_t* pool)
 
     pthread_mutex_destroy(&pool->lock);
     BPLib_MEM_PoolImplDestroy(&pool->impl);
+    if (pool->mapped_mem != NULL)
+    {
+        munmap(pool->mapped_mem, pool->mapped_len);
+    }
     memset(pool, 0, sizeof(BPLib_MEM_Pool_t));
 }
 
@@ -67,6 +209,7 @@ BPLib_MEM_Block_t* BPLib_MEM_BlockAlloc(BPLib_MEM_Pool_t* pool)
 
     pthread_mutex_lock(&pool->lock);
     block = (BPLib_MEM_Block_t*)(BPLib_MEM_PoolImplAlloc(&pool->impl));
+    BPLib_MEM_PoolUpdatePressure(pool);
     pthread_mutex_unlock(&pool->lock);
     if (block != NULL)
     {
@@ -85,6 +228,7 @@ void BPLib_MEM_BlockFree(BPLib_MEM_Pool_t* pool, BPLib_MEM_Block_t* block)
 
     pthread_mutex_lock(&pool->lock);
     BPLib_MEM_PoolImplFree(&pool->impl, (void*)block);
+    BPLib_MEM_PoolUpdatePressure(pool);
     pthread_mutex_unlock(&pool->lock);
 }
 
@@ -204,6 +348,9 @@ BPLib_Bundle_t* BPLib_MEM_BundleAlloc(BPLib_MEM_Pool_t* pool, const void* blob_d
     /* Save the total size of the bundle in bytes */
     bundle->Meta.TotalBytes = bytes_copied;
 
+    /* Index the blob chunks so later offset lookups don't walk the chain */
+    BPLib_MEM_BundleIndexBlob(bundle);
+
     return bundle;
 }
 
@@ -224,6 +371,25 @@ void BPLib_MEM_BundleFree(BPLib_MEM_Pool_t* pool, BPLib_Bundle_t* bundle)
     BPLib_MEM_BlockFree(pool, (BPLib_MEM_Block_t*)bundle);
 }
 
+void BPLib_MEM_BundleIndexBlob(BPLib_Bundle_t* bundle)
+{
+    BPLib_MEM_Block_t* curr_block;
+
+    if (bundle == NULL)
+    {
+        return;
+    }
+
+    bundle->blob_index_len = 0;
+    curr_block = bundle->blob;
+    while ((curr_block != NULL) && (bundle->blob_index_len < BPLIB_MEM_CHUNK_INDEX_LEN))
+    {
+        bundle->blob_index[bundle->blob_index_len] = curr_block;
+        bundle->blob_index_len++;
+        curr_block = curr_block->next;
+    }
+}
+
 BPLib_Status_t BPLib_MEM_BlobCopyOut(BPLib_Bundle_t* bundle, void* out_buffer, size_t max_len, size_t* out_size)
 {
     BPLib_MEM_Block_t* curr_block;
@@ -282,16 +448,34 @@ BPLib_Status_t BPLib_MEM_CopyOutFromOffset(BPLib_Bundle_t* Bundle, uint64_t Offs
     }
 
     /* find the first blob that contains data after the offset */
-    CurrentBlock = Bundle->blob;
-    NumBytesLeftToSkip = Offset;
     ExpectedMemBlockNumber = Offset / BPLIB_MEM_CHUNKSIZE;
-    for (CurrentMemBlockNumber = 0; CurrentMemBlockNumber < ExpectedMemBlockNumber; CurrentMemBlockNumber++)
+    NumBytesLeftToSkip = Offset - (ExpectedMemBlockNumber * BPLIB_MEM_CHUNKSIZE);
+    if (ExpectedMemBlockNumber < Bundle->blob_index_len)
     {
-        NumBytesLeftToSkip -= BPLIB_MEM_CHUNKSIZE;
-        CurrentBlock = CurrentBlock->next;
-        if (CurrentBlock == NULL)
+        /* The chunk index resolves the block directly */
+        CurrentBlock = Bundle->blob_index[ExpectedMemBlockNumber];
+    }
+    else
+    {
+        /* Walk forward from the last indexed chunk, or from the head if there is no index */
+        if (Bundle->blob_index_len > 0)
         {
-            return BPLIB_BUF_LEN_ERROR;
+            CurrentMemBlockNumber = Bundle->blob_index_len - 1;
+            CurrentBlock = Bundle->blob_index[CurrentMemBlockNumber];
+        }
+        else
+        {
+            CurrentMemBlockNumber = 0;
+            CurrentBlock = Bundle->blob;
+        }
+
+        for (; CurrentMemBlockNumber < ExpectedMemBlockNumber; CurrentMemBlockNumber++)
+        {
+            CurrentBlock = CurrentBlock->next;
+            if (CurrentBlock == NULL)
+            {
+                return BPLIB_BUF_LEN_ERROR;
+            }
         }
     }
 
@@ -56,9 +56,244 @@ void Test_BPLib_MEM_CopyOutFromOffset_BadSize(void)
     UtAssert_INT32_EQ(BPLib_MEM_CopyOutFromOffset(&Bundle, 0, NumBytesToCopy, OutputBuffer, OutputBufferSize), BPLIB_BUF_LEN_ERROR);
 }
 
+/* Chain NumBlocks test blocks into a blob, filling each byte with its blob offset */
+static void Test_BPLib_MEM_BuildBlob(BPLib_Bundle_t* Bundle, BPLib_MEM_Block_t* Blocks, size_t NumBlocks)
+{
+    size_t i, j;
+
+    memset(Bundle, 0, sizeof(BPLib_Bundle_t));
+    memset(Blocks, 0, NumBlocks * sizeof(BPLib_MEM_Block_t));
+    for (i = 0; i < NumBlocks; i++)
+    {
+        for (j = 0; j < BPLIB_MEM_CHUNKSIZE; j++)
+        {
+            Blocks[i].user_data.raw_bytes[j] = (uint8_t)((i * BPLIB_MEM_CHUNKSIZE) + j);
+        }
+        Blocks[i].used_len = BPLIB_MEM_CHUNKSIZE;
+        Blocks[i].next = (i + 1 < NumBlocks) ? &Blocks[i + 1] : NULL;
+    }
+    Bundle->blob = &Blocks[0];
+}
+
+void Test_BPLib_MEM_BundleIndexBlob_Nominal(void)
+{
+    BPLib_MEM_Block_t Blocks[3];
+    BPLib_Bundle_t Bundle;
+
+    Test_BPLib_MEM_BuildBlob(&Bundle, Blocks, 3);
+
+    BPLib_MEM_BundleIndexBlob(&Bundle);
+
+    UtAssert_EQ(size_t, Bundle.blob_index_len, 3);
+    UtAssert_ADDRESS_EQ(Bundle.blob_index[0], &Blocks[0]);
+    UtAssert_ADDRESS_EQ(Bundle.blob_index[1], &Blocks[1]);
+    UtAssert_ADDRESS_EQ(Bundle.blob_index[2], &Blocks[2]);
+}
+
+void Test_BPLib_MEM_BundleIndexBlob_NullBlob(void)
+{
+    BPLib_Bundle_t Bundle;
+
+    memset(&Bundle, 0, sizeof(Bundle));
+    Bundle.blob_index_len = 2;
+
+    BPLib_MEM_BundleIndexBlob(&Bundle);
+    UtAssert_EQ(size_t, Bundle.blob_index_len, 0);
+
+    /* Should not crash */
+    BPLib_MEM_BundleIndexBlob(NULL);
+}
+
+void Test_BPLib_MEM_CopyOutFromOffset_Indexed(void)
+{
+    BPLib_MEM_Block_t Blocks[3];
+    BPLib_Bundle_t Bundle;
+    uint8_t OutputBuffer[600];
+    uint64_t Offset = BPLIB_MEM_CHUNKSIZE + 100;
+    size_t i;
+
+    Test_BPLib_MEM_BuildBlob(&Bundle, Blocks, 3);
+    BPLib_MEM_BundleIndexBlob(&Bundle);
+
+    /* Corrupt the chain past the head, so only the index can find the right block */
+    Blocks[0].next = NULL;
+
+    UtAssert_INT32_EQ(BPLib_MEM_CopyOutFromOffset(&Bundle, Offset, sizeof(OutputBuffer),
+        OutputBuffer, sizeof(OutputBuffer)), BPLIB_SUCCESS);
+    for (i = 0; i < sizeof(OutputBuffer); i++)
+    {
+        UtAssert_UINT8_EQ(OutputBuffer[i], (uint8_t)(Offset + i));
+    }
+}
+
+void Test_BPLib_MEM_CopyOutFromOffset_PastIndex(void)
+{
+    static BPLib_MEM_Block_t Blocks[BPLIB_MEM_CHUNK_INDEX_LEN + 2];
+    BPLib_Bundle_t Bundle;
+    uint8_t OutputBuffer[16];
+    uint64_t Offset = ((BPLIB_MEM_CHUNK_INDEX_LEN + 1) * BPLIB_MEM_CHUNKSIZE) + 8;
+    size_t i;
+
+    Test_BPLib_MEM_BuildBlob(&Bundle, Blocks, BPLIB_MEM_CHUNK_INDEX_LEN + 2);
+    BPLib_MEM_BundleIndexBlob(&Bundle);
+    UtAssert_EQ(size_t, Bundle.blob_index_len, BPLIB_MEM_CHUNK_INDEX_LEN);
+
+    UtAssert_INT32_EQ(BPLib_MEM_CopyOutFromOffset(&Bundle, Offset, sizeof(OutputBuffer),
+        OutputBuffer, sizeof(OutputBuffer)), BPLIB_SUCCESS);
+    for (i = 0; i < sizeof(OutputBuffer); i++)
+    {
+        UtAssert_UINT8_EQ(OutputBuffer[i], (uint8_t)(Offset + i));
+    }
+
+    /* Offset past the end of the chain */
+    Offset = (BPLIB_MEM_CHUNK_INDEX_LEN + 2) * BPLIB_MEM_CHUNKSIZE;
+    UtAssert_INT32_EQ(BPLib_MEM_CopyOutFromOffset(&Bundle, Offset, sizeof(OutputBuffer),
+        OutputBuffer, sizeof(OutputBuffer)), BPLIB_BUF_LEN_ERROR);
+}
+
+void Test_BPLib_MEM_PoolMapInit_Nominal(void)
+{
+    BPLib_MEM_Pool_t Pool;
+    BPLib_MEM_Block_t* Block;
+
+    UtAssert_INT32_EQ(BPLib_MEM_PoolMapInit(&Pool, 64 * sizeof(BPLib_MEM_Block_t),
+        BPLIB_MEM_BACKING_PAGES), BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(Pool.backing, BPLIB_MEM_BACKING_PAGES);
+    UtAssert_NOT_NULL(Pool.mapped_mem);
+    UtAssert_EQ(size_t, Pool.mapped_len, 64 * sizeof(BPLib_MEM_Block_t));
+
+    Block = BPLib_MEM_BlockAlloc(&Pool);
+    UtAssert_NOT_NULL(Block);
+    BPLib_MEM_BlockFree(&Pool, Block);
+
+    BPLib_MEM_PoolDestroy(&Pool);
+    UtAssert_NULL(Pool.mapped_mem);
+}
+
+void Test_BPLib_MEM_PoolMapInit_HugepageFallback(void)
+{
+    BPLib_MEM_Pool_t Pool;
+    BPLib_MEM_Block_t* Block;
+
+    /* Succeeds whether or not hugepages are reserved on this host */
+    UtAssert_INT32_EQ(BPLib_MEM_PoolMapInit(&Pool, 64 * sizeof(BPLib_MEM_Block_t),
+        BPLIB_MEM_BACKING_HUGETLB), BPLIB_SUCCESS);
+    UtAssert_True(Pool.backing != BPLIB_MEM_BACKING_USER, "Pool backing is a mapping");
+    UtAssert_True(Pool.mapped_len >= 64 * sizeof(BPLib_MEM_Block_t), "Mapping covers the request");
+
+    Block = BPLib_MEM_BlockAlloc(&Pool);
+    UtAssert_NOT_NULL(Block);
+    BPLib_MEM_BlockFree(&Pool, Block);
+
+    BPLib_MEM_PoolDestroy(&Pool);
+}
+
+void Test_BPLib_MEM_PoolMapInit_BadInputs(void)
+{
+    BPLib_MEM_Pool_t Pool;
+
+    UtAssert_INT32_EQ(BPLib_MEM_PoolMapInit(NULL, 4096, BPLIB_MEM_BACKING_PAGES), BPLIB_ERROR);
+    UtAssert_INT32_EQ(BPLib_MEM_PoolMapInit(&Pool, 0, BPLIB_MEM_BACKING_PAGES), BPLIB_ERROR);
+    UtAssert_INT32_EQ(BPLib_MEM_PoolMapInit(&Pool, 4096, BPLIB_MEM_BACKING_USER), BPLIB_ERROR);
+}
+
+void Test_BPLib_MEM_PoolSetWatermarks_Hysteresis(void)
+{
+    BPLib_MEM_Pool_t Pool;
+    BPLib_MEM_Block_t* Blocks[4];
+    size_t i;
+
+    UtAssert_INT32_EQ(BPLib_MEM_PoolMapInit(&Pool, 8 * sizeof(BPLib_MEM_Block_t),
+        BPLIB_MEM_BACKING_PAGES), BPLIB_SUCCESS);
+    UtAssert_INT32_EQ(BPLib_MEM_PoolSetWatermarks(&Pool, 2, 4), BPLIB_SUCCESS);
+
+    for (i = 0; i < 4; i++)
+    {
+        UtAssert_BOOL_FALSE(BPLib_MEM_PoolIsCongested(&Pool));
+        Blocks[i] = BPLib_MEM_BlockAlloc(&Pool);
+        UtAssert_NOT_NULL(Blocks[i]);
+    }
+
+    /* Congested at the high watermark, stays congested until the low watermark */
+    UtAssert_BOOL_TRUE(BPLib_MEM_PoolIsCongested(&Pool));
+    BPLib_MEM_BlockFree(&Pool, Blocks[3]);
+    UtAssert_BOOL_TRUE(BPLib_MEM_PoolIsCongested(&Pool));
+    BPLib_MEM_BlockFree(&Pool, Blocks[2]);
+    UtAssert_BOOL_FALSE(BPLib_MEM_PoolIsCongested(&Pool));
+
+    BPLib_MEM_BlockFree(&Pool, Blocks[1]);
+    BPLib_MEM_BlockFree(&Pool, Blocks[0]);
+    BPLib_MEM_PoolDestroy(&Pool);
+}
+
+void Test_BPLib_MEM_PoolSetWatermarks_BadInputs(void)
+{
+    BPLib_MEM_Pool_t Pool;
+
+    memset(&Pool, 0, sizeof(Pool));
+
+    UtAssert_INT32_EQ(BPLib_MEM_PoolSetWatermarks(NULL, 2, 4), BPLIB_ERROR);
+    UtAssert_INT32_EQ(BPLib_MEM_PoolSetWatermarks(&Pool, 4, 4), BPLIB_ERROR);
+    UtAssert_INT32_EQ(BPLib_MEM_PoolSetWatermarks(&Pool, 5, 4), BPLIB_ERROR);
+    UtAssert_BOOL_FALSE(BPLib_MEM_PoolIsCongested(NULL));
+}
+
+void Test_BPLib_MEM_PoolGetStats_Nominal(void)
+{
+    BPLib_MEM_Pool_t Pool;
+    BPLib_MEM_PoolStats_t Stats;
+    BPLib_MEM_Block_t* Blocks[4];
+    size_t i;
+
+    UtAssert_INT32_EQ(BPLib_MEM_PoolMapInit(&Pool, 4 * sizeof(BPLib_MEM_Block_t),
+        BPLIB_MEM_BACKING_PAGES), BPLIB_SUCCESS);
+
+    for (i = 0; i < 4; i++)
+    {
+        Blocks[i] = BPLib_MEM_BlockAlloc(&Pool);
+        UtAssert_NOT_NULL(Blocks[i]);
+    }
+
+    /* The pool is empty, so this allocation fails and is counted */
+    UtAssert_NULL(BPLib_MEM_BlockAlloc(&Pool));
+
+    BPLib_MEM_BlockFree(&Pool, Blocks[3]);
+    BPLib_MEM_BlockFree(&Pool, Blocks[2]);
+
+    UtAssert_INT32_EQ(BPLib_MEM_PoolGetStats(&Pool, &Stats), BPLIB_SUCCESS);
+    UtAssert_EQ(size_t, Stats.num_blocks, 4);
+    UtAssert_EQ(size_t, Stats.block_size, sizeof(BPLib_MEM_Block_t));
+    UtAssert_EQ(size_t, Stats.num_free, 2);
+    UtAssert_EQ(size_t, Stats.num_in_use_hwm, 4);
+    UtAssert_EQ(size_t, Stats.num_alloc_fail, 1);
+
+    BPLib_MEM_BlockFree(&Pool, Blocks[1]);
+    BPLib_MEM_BlockFree(&Pool, Blocks[0]);
+    BPLib_MEM_PoolDestroy(&Pool);
+}
+
+void Test_BPLib_MEM_PoolGetStats_Null(void)
+{
+    BPLib_MEM_Pool_t Pool;
+    BPLib_MEM_PoolStats_t Stats;
+
+    UtAssert_INT32_EQ(BPLib_MEM_PoolGetStats(NULL, &Stats), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_MEM_PoolGetStats(&Pool, NULL), BPLIB_NULL_PTR_ERROR);
+}
 
 void TestBplibMem_Register(void)
 {
     UtTest_Add(Test_BPLib_MEM_CopyOutFromOffset_NullInputErrors, BPLib_MEM_Test_Setup, BPLib_MEM_Test_Teardown, "Test_BPLib_MEM_CopyOutFromOffset_NullInputErrors");
     UtTest_Add(Test_BPLib_MEM_CopyOutFromOffset_BadSize, BPLib_MEM_Test_Setup, BPLib_MEM_Test_Teardown, "Test_BPLib_MEM_CopyOutFromOffset_BadSize");
+    UtTest_Add(Test_BPLib_MEM_BundleIndexBlob_Nominal, BPLib_MEM_Test_Setup, BPLib_MEM_Test_Teardown, "Test_BPLib_MEM_BundleIndexBlob_Nominal");
+    UtTest_Add(Test_BPLib_MEM_BundleIndexBlob_NullBlob, BPLib_MEM_Test_Setup, BPLib_MEM_Test_Teardown, "Test_BPLib_MEM_BundleIndexBlob_NullBlob");
+    UtTest_Add(Test_BPLib_MEM_CopyOutFromOffset_Indexed, BPLib_MEM_Test_Setup, BPLib_MEM_Test_Teardown, "Test_BPLib_MEM_CopyOutFromOffset_Indexed");
+    UtTest_Add(Test_BPLib_MEM_CopyOutFromOffset_PastIndex, BPLib_MEM_Test_Setup, BPLib_MEM_Test_Teardown, "Test_BPLib_MEM_CopyOutFromOffset_PastIndex");
+    UtTest_Add(Test_BPLib_MEM_PoolMapInit_Nominal, BPLib_MEM_Test_Setup, BPLib_MEM_Test_Teardown, "Test_BPLib_MEM_PoolMapInit_Nominal");
+    UtTest_Add(Test_BPLib_MEM_PoolMapInit_HugepageFallback, BPLib_MEM_Test_Setup, BPLib_MEM_Test_Teardown, "Test_BPLib_MEM_PoolMapInit_HugepageFallback");
+    UtTest_Add(Test_BPLib_MEM_PoolMapInit_BadInputs, BPLib_MEM_Test_Setup, BPLib_MEM_Test_Teardown, "Test_BPLib_MEM_PoolMapInit_BadInputs");
+    UtTest_Add(Test_BPLib_MEM_PoolSetWatermarks_Hysteresis, BPLib_MEM_Test_Setup, BPLib_MEM_Test_Teardown, "Test_BPLib_MEM_PoolSetWatermarks_Hysteresis");
+    UtTest_Add(Test_BPLib_MEM_PoolSetWatermarks_BadInputs, BPLib_MEM_Test_Setup, BPLib_MEM_Test_Teardown, "Test_BPLib_MEM_PoolSetWatermarks_BadInputs");
+    UtTest_Add(Test_BPLib_MEM_PoolGetStats_Nominal, BPLib_MEM_Test_Setup, BPLib_MEM_Test_Teardown, "Test_BPLib_MEM_PoolGetStats_Nominal");
+    UtTest_Add(Test_BPLib_MEM_PoolGetStats_Null, BPLib_MEM_Test_Setup, BPLib_MEM_Test_Teardown, "Test_BPLib_MEM_PoolGetStats_Null");
 }
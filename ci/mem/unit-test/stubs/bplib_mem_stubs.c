@@ -52,7 +52,6 @@ BPLib_Status_t BPLib_MEM_CopyOutFromOffset(BPLib_Bundle_t* Bundle,
     return UT_GenStub_GetReturnValue(BPLib_MEM_CopyOutFromOffset, BPLib_Status_t);
 }
 
-
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_MEM_BlobCopyOut()
@@ -162,6 +161,18 @@ void BPLib_MEM_BundleFree(BPLib_MEM_Pool_t *pool, BPLib_Bundle_t *bundle)
     UT_GenStub_Execute(BPLib_MEM_BundleFree, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_MEM_BundleIndexBlob()
+ * ----------------------------------------------------
+ */
+void BPLib_MEM_BundleIndexBlob(BPLib_Bundle_t *bundle)
+{
+    UT_GenStub_AddParam(BPLib_MEM_BundleIndexBlob, BPLib_Bundle_t *, bundle);
+
+    UT_GenStub_Execute(BPLib_MEM_BundleIndexBlob, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_MEM_PoolDestroy()
@@ -174,6 +185,23 @@ void BPLib_MEM_PoolDestroy(BPLib_MEM_Pool_t *pool)
     UT_GenStub_Execute(BPLib_MEM_PoolDestroy, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_MEM_PoolGetStats()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_MEM_PoolGetStats(const BPLib_MEM_Pool_t *pool, BPLib_MEM_PoolStats_t *stats)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_MEM_PoolGetStats, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_MEM_PoolGetStats, const BPLib_MEM_Pool_t *, pool);
+    UT_GenStub_AddParam(BPLib_MEM_PoolGetStats, BPLib_MEM_PoolStats_t *, stats);
+
+    UT_GenStub_Execute(BPLib_MEM_PoolGetStats, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_MEM_PoolGetStats, BPLib_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_MEM_PoolInit()
@@ -191,3 +219,55 @@ BPLib_Status_t BPLib_MEM_PoolInit(BPLib_MEM_Pool_t *pool, void *init_mem, size_t
 
     return UT_GenStub_GetReturnValue(BPLib_MEM_PoolInit, BPLib_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_MEM_PoolIsCongested()
+ * ----------------------------------------------------
+ */
+bool BPLib_MEM_PoolIsCongested(const BPLib_MEM_Pool_t *pool)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_MEM_PoolIsCongested, bool);
+
+    UT_GenStub_AddParam(BPLib_MEM_PoolIsCongested, const BPLib_MEM_Pool_t *, pool);
+
+    UT_GenStub_Execute(BPLib_MEM_PoolIsCongested, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_MEM_PoolIsCongested, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_MEM_PoolMapInit()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_MEM_PoolMapInit(BPLib_MEM_Pool_t *pool, size_t init_size, BPLib_MEM_PoolBacking_t backing)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_MEM_PoolMapInit, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_MEM_PoolMapInit, BPLib_MEM_Pool_t *, pool);
+    UT_GenStub_AddParam(BPLib_MEM_PoolMapInit, size_t, init_size);
+    UT_GenStub_AddParam(BPLib_MEM_PoolMapInit, BPLib_MEM_PoolBacking_t, backing);
+
+    UT_GenStub_Execute(BPLib_MEM_PoolMapInit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_MEM_PoolMapInit, BPLib_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_MEM_PoolSetWatermarks()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_MEM_PoolSetWatermarks(BPLib_MEM_Pool_t *pool, size_t low_blocks, size_t high_blocks)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_MEM_PoolSetWatermarks, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_MEM_PoolSetWatermarks, BPLib_MEM_Pool_t *, pool);
+    UT_GenStub_AddParam(BPLib_MEM_PoolSetWatermarks, size_t, low_blocks);
+    UT_GenStub_AddParam(BPLib_MEM_PoolSetWatermarks, size_t, high_blocks);
+
+    UT_GenStub_Execute(BPLib_MEM_PoolSetWatermarks, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_MEM_PoolSetWatermarks, BPLib_Status_t);
+}
@@ -26,6 +26,91 @@
 */
 
 #include "bplib_api_types.h"
+#include "bplib_cfg.h"
+
+/*
+** Latency Histogram IDs
+*/
+
+#define BPLIB_PL_LATENCY_DECODE         (0u) /* Decoding a received bundle */
+#define BPLIB_PL_LATENCY_ROUTE          (1u) /* Routing a bundle to an egress queue or storage */
+#define BPLIB_PL_LATENCY_STORE          (2u) /* Writing a batch of bundles to storage */
+#define BPLIB_PL_LATENCY_LOAD           (3u) /* Loading a bundle from storage */
+#define BPLIB_PL_LATENCY_ENCODE         (4u) /* Encoding a bundle for a CLA */
+#define BPLIB_PL_LATENCY_QUEUE          (5u) /* Time a bundle job spends in the worker job queue */
+#define BPLIB_PL_NUM_LATENCY_IDS        (6u)
+
+/*
+** Bundle Trace Points
+*/
+
+#define BPLIB_PL_TRACE_BI_RECV          (0u) /* Bundle received from a CLA, Arg is the ingress status */
+#define BPLIB_PL_TRACE_QM_QUEUED        (1u) /* Job queued for a worker, Arg is the next job state */
+#define BPLIB_PL_TRACE_QM_RUN           (2u) /* Worker started a job, Arg is the job state */
+#define BPLIB_PL_TRACE_QM_EGRESS        (3u) /* Bundle routed to an egress queue, Arg is the egress ID */
+#define BPLIB_PL_TRACE_STOR_STORE       (4u) /* Bundle handed to storage */
+#define BPLIB_PL_TRACE_STOR_LOAD        (5u) /* Bundle loaded from storage, Arg is the egress ID */
+#define BPLIB_PL_TRACE_CLA_EGRESS       (6u) /* Bundle sent to a CLA, Arg is the contact ID */
+#define BPLIB_PL_TRACE_PI_DELIVER       (7u) /* Bundle delivered to an application, Arg is the channel ID */
+#define BPLIB_PL_NUM_TRACE_POINTS       (8u)
+
+/**
+ * \brief Record a trace point for a bundle
+ *
+ *  \par Description
+ *       Convenience wrapper around BPLib_PL_Trace that identifies the bundle by its
+ *       source EID and creation timestamp
+ */
+#define BPLIB_PL_TRACE_BUNDLE(Point, Bundle, QueueDepth, Arg)                                \
+    BPLib_PL_Trace((Point), (Bundle)->blocks.PrimaryBlock.SrcEID.Node,                      \
+                   (Bundle)->blocks.PrimaryBlock.SrcEID.Service,                            \
+                   (Bundle)->blocks.PrimaryBlock.Timestamp.CreateTime,                      \
+                   (Bundle)->blocks.PrimaryBlock.Timestamp.SequenceNumber, (QueueDepth), (Arg))
+
+#define BPLIB_PL_LATENCY_SUB_BUCKETS    (1u << BPLIB_PL_LATENCY_SUB_BUCKET_BITS)
+#define BPLIB_PL_LATENCY_NUM_BUCKETS    ((BPLIB_PL_LATENCY_MAX_BITS - BPLIB_PL_LATENCY_SUB_BUCKET_BITS + 1) * \
+                                          BPLIB_PL_LATENCY_SUB_BUCKETS)
+
+/*
+** Type Definitions
+*/
+
+/**
+ * \brief Log-linear latency histogram
+ *
+ *  \par Description
+ *       Values below BPLIB_PL_LATENCY_SUB_BUCKETS nanoseconds get a bucket each. Above that,
+ *       every power of two is split into BPLIB_PL_LATENCY_SUB_BUCKETS equal buckets, so the
+ *       relative error is bounded by 1 / BPLIB_PL_LATENCY_SUB_BUCKETS.
+ */
+typedef struct
+{
+    uint64_t Count;                                  /**< \brief Number of samples */
+    uint64_t SumNs;                                  /**< \brief Sum of all samples in nanoseconds */
+    uint64_t MaxNs;                                  /**< \brief Largest sample in nanoseconds */
+    uint32_t Buckets[BPLIB_PL_LATENCY_NUM_BUCKETS];  /**< \brief Samples per bucket */
+} BPLib_PL_LatencyHist_t;
+
+/**
+ * \brief Bundle trace record
+ *
+ *  \par Description
+ *       Fixed-size binary record written by BPLib_PL_Trace. Records are never formatted on
+ *       the traced path, use BPLib_PL_TraceDecode to turn them into text.
+ */
+typedef struct
+{
+    uint64_t TimeNs;         /**< \brief Monotonic time of the trace point in nanoseconds */
+    uint64_t SrcNode;        /**< \brief Node number of the bundle's source EID */
+    uint64_t SrcService;     /**< \brief Service number of the bundle's source EID */
+    uint64_t CreateTime;     /**< \brief Bundle creation time */
+    uint64_t SequenceNumber; /**< \brief Bundle creation sequence number */
+    uint32_t Seq;            /**< \brief Position of the record in its ring, starting at 1 */
+    uint16_t Point;          /**< \brief Trace point, one of BPLIB_PL_TRACE_* */
+    uint16_t Ring;           /**< \brief Ring (thread) that wrote the record */
+    uint32_t QueueDepth;     /**< \brief Depth of the queue involved, 0 if none */
+    int32_t  Arg;            /**< \brief Trace point specific argument */
+} BPLib_PL_TraceRecord_t;
 
 
 /*
@@ -80,4 +165,202 @@ BPLib_Status_t BPLib_PL_PerfLogEntry(uint32_t PerfLogID);
  */
 BPLib_Status_t BPLib_PL_PerfLogExit(uint32_t PerfLogID);
 
+/**
+ * \brief Enable or disable latency histograms
+ *
+ *  \par Description
+ *       Latency recording is disabled by default. While disabled, BPLib_PL_LatencyStart
+ *       returns 0 without reading the clock and BPLib_PL_LatencyStop returns immediately.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] Enabled true to start recording latencies
+ */
+void BPLib_PL_SetLatencyEnabled(bool Enabled);
+
+/**
+ * \brief Start timing a latency sample
+ *
+ *  \par Description
+ *       Reads the monotonic clock if latency recording is enabled
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \return Start time in nanoseconds, or 0 if latency recording is disabled
+ */
+uint64_t BPLib_PL_LatencyStart(void);
+
+/**
+ * \brief Finish timing a latency sample
+ *
+ *  \par Description
+ *       Adds the time since StartNs to the histogram for LatencyID. Samples from
+ *       different threads are recorded concurrently; only BPLib_PL_ResetLatency blocks them.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Samples with a StartNs of 0 (recording was disabled when they started) and
+ *       out-of-range IDs are ignored
+ *
+ *  \param[in] LatencyID Histogram to add the sample to, one of BPLIB_PL_LATENCY_*
+ *  \param[in] StartNs Value returned by BPLib_PL_LatencyStart
+ */
+void BPLib_PL_LatencyStop(uint32_t LatencyID, uint64_t StartNs);
+
+/**
+ * \brief Copy out a latency histogram
+ *
+ *  \par Description
+ *       Copies the histogram for LatencyID. Samples recorded while copying may be partly
+ *       included.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] LatencyID Histogram to copy, one of BPLIB_PL_LATENCY_*
+ *  \param[out] Hist Copy of the histogram
+ *
+ *  \return Execution status
+ *  \retval BPLIB_SUCCESS The histogram was copied
+ *  \retval BPLIB_NULL_PTR_ERROR Hist is NULL
+ *  \retval BPLIB_PL_INVALID_LATENCY_ID LatencyID is out of range
+ */
+BPLib_Status_t BPLib_PL_GetLatency(uint32_t LatencyID, BPLib_PL_LatencyHist_t *Hist);
+
+/**
+ * \brief Clear every latency histogram
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Waits for samples being recorded to finish, so every histogram is cleared whole
+ */
+void BPLib_PL_ResetLatency(void);
+
+/**
+ * \brief Smallest latency that falls in a histogram bucket
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] Bucket Bucket index, less than BPLIB_PL_LATENCY_NUM_BUCKETS
+ *
+ *  \return Lower bound of the bucket in nanoseconds
+ */
+uint64_t BPLib_PL_LatencyBucketLowerBound(uint32_t Bucket);
+
+/**
+ * \brief Estimate a latency percentile from a histogram
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The estimate is the upper bound of the bucket holding the percentile, capped at
+ *       the histogram's maximum
+ *
+ *  \param[in] Hist Histogram from BPLib_PL_GetLatency
+ *  \param[in] PerMille Percentile in tenths of a percent, e.g. 990 for the 99th percentile
+ *
+ *  \return Latency in nanoseconds, or 0 if Hist is NULL or empty
+ */
+uint64_t BPLib_PL_LatencyPercentile(const BPLib_PL_LatencyHist_t *Hist, uint32_t PerMille);
+
+/**
+ * \brief Enable or disable bundle tracing
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The initial state is set by BPLIB_PL_TRACE_DEFAULT_ENABLED
+ *
+ *  \param[in] Enabled true to record trace points
+ */
+void BPLib_PL_SetTraceEnabled(bool Enabled);
+
+/**
+ * \brief Record a bundle trace point
+ *
+ *  \par Description
+ *       Appends a record to the calling thread's trace ring, overwriting the oldest record
+ *       once the ring is full. No locks are taken and nothing is formatted.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A thread claims a ring the first time it records a trace point. Once all
+ *       BPLIB_PL_TRACE_MAX_THREADS rings are claimed, trace points from other threads
+ *       are dropped.
+ *
+ *  \param[in] Point Trace point, one of BPLIB_PL_TRACE_*
+ *  \param[in] SrcNode Node number of the bundle's source EID
+ *  \param[in] SrcService Service number of the bundle's source EID
+ *  \param[in] CreateTime Creation time of the bundle
+ *  \param[in] SequenceNumber Creation sequence number of the bundle
+ *  \param[in] QueueDepth Depth of the queue involved, 0 if none
+ *  \param[in] Arg Trace point specific argument
+ */
+void BPLib_PL_Trace(uint32_t Point, uint64_t SrcNode, uint64_t SrcService, uint64_t CreateTime,
+                    uint64_t SequenceNumber, uint32_t QueueDepth, int32_t Arg);
+
+/**
+ * \brief Number of trace rings claimed so far
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \return Number of rings that may hold records, at most BPLIB_PL_TRACE_MAX_THREADS
+ */
+uint32_t BPLib_PL_TraceNumRings(void);
+
+/**
+ * \brief Copy the records out of a trace ring
+ *
+ *  \par Description
+ *       Copies up to MaxRecords of the most recent records in Ring, oldest first. Safe to
+ *       call while the owning thread is still tracing; records overwritten during the copy
+ *       are skipped.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] Ring Ring index, less than BPLib_PL_TraceNumRings()
+ *  \param[out] Records Buffer for the copied records
+ *  \param[in] MaxRecords Number of records Records can hold
+ *  \param[out] NumRecords Number of records copied
+ *
+ *  \return Execution status
+ *  \retval BPLIB_SUCCESS The records were copied
+ *  \retval BPLIB_NULL_PTR_ERROR Records or NumRecords is NULL
+ *  \retval BPLIB_PL_INVALID_TRACE_RING Ring is out of range
+ */
+BPLib_Status_t BPLib_PL_TraceSnapshot(uint32_t Ring, BPLib_PL_TraceRecord_t *Records, uint32_t MaxRecords,
+                                      uint32_t *NumRecords);
+
+/**
+ * \brief Discard every recorded trace point
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Ring ownership is kept. Must not race with threads that are tracing.
+ */
+void BPLib_PL_ResetTrace(void);
+
+/**
+ * \brief Name of a trace point
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] Point Trace point, one of BPLIB_PL_TRACE_*
+ *
+ *  \return Name of the trace point, or "UNKNOWN"
+ */
+const char *BPLib_PL_TracePointName(uint32_t Point);
+
+/**
+ * \brief Format a trace record as one line of text
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The output is truncated to fit BufLen and has no trailing newline
+ *
+ *  \param[in] Record Record to format
+ *  \param[out] Buf Output buffer
+ *  \param[in] BufLen Size of Buf in bytes
+ *
+ *  \return Length of the formatted text (as snprintf), or -1 if Record or Buf is NULL
+ */
+int BPLib_PL_TraceDecode(const BPLib_PL_TraceRecord_t *Record, char *Buf, size_t BufLen);
+
 #endif /* BPLIB_PL_H */
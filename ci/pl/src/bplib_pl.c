@@ -25,6 +25,78 @@
 #include "bplib_pl.h"
 #include "bplib_fwp.h"
 
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/*
+** Type Definitions
+*/
+
+/* Trace ring, written only by the thread that claimed it */
+typedef struct
+{
+    uint64_t               Head;                              /* Number of records ever written */
+    BPLib_PL_TraceRecord_t Records[BPLIB_PL_TRACE_RING_SIZE]; /* Most recent records */
+} __attribute__((aligned(64))) BPLib_PL_TraceRing_t;
+
+/*
+** Global Data
+*/
+
+static bool                   BPLib_PL_LatencyEnabled;                          /* Whether latencies are recorded */
+static BPLib_PL_LatencyHist_t BPLib_PL_Latency[BPLIB_PL_NUM_LATENCY_IDS];       /* One histogram per latency ID */
+static pthread_rwlock_t       BPLib_PL_LatencyLock = PTHREAD_RWLOCK_INITIALIZER; /* Shared to record or copy, exclusive to reset */
+
+static bool                 BPLib_PL_TraceEnabled = BPLIB_PL_TRACE_DEFAULT_ENABLED; /* Whether trace points are recorded */
+static uint32_t             BPLib_PL_TraceRingsClaimed;                         /* Rings handed out, may exceed the max */
+static BPLib_PL_TraceRing_t BPLib_PL_TraceRings[BPLIB_PL_TRACE_MAX_THREADS];     /* One ring per tracing thread */
+
+static __thread BPLib_PL_TraceRing_t *BPLib_PL_LocalTraceRing;                   /* Ring owned by this thread */
+static __thread bool                  BPLib_PL_LocalTraceClaimed;                /* Whether this thread tried to claim a ring */
+
+static const char *const BPLib_PL_TracePointNames[BPLIB_PL_NUM_TRACE_POINTS] = {
+    "BI_RECV", "QM_QUEUED", "QM_RUN", "QM_EGRESS", "STOR_STORE", "STOR_LOAD", "CLA_EGRESS", "PI_DELIVER"
+};
+
+/*
+** Internal Function Definitions
+*/
+
+/* Current monotonic time in nanoseconds, never 0 */
+static inline uint64_t BPLib_PL_GetTimeNs(void)
+{
+    struct timespec Now;
+    uint64_t NowNs;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    NowNs = ((uint64_t) Now.tv_sec * 1000000000ull) + (uint64_t) Now.tv_nsec;
+
+    /* 0 is reserved for "not timed" */
+    return (NowNs != 0) ? NowNs : 1;
+}
+
+/* Bucket holding a latency, see BPLib_PL_LatencyHist_t */
+static inline uint32_t BPLib_PL_LatencyBucket(uint64_t Ns)
+{
+    uint32_t Exp;
+
+    if (Ns < BPLIB_PL_LATENCY_SUB_BUCKETS)
+    {
+        return (uint32_t) Ns;
+    }
+
+    Exp = 63 - __builtin_clzll(Ns);
+    if (Exp >= BPLIB_PL_LATENCY_MAX_BITS)
+    {
+        return BPLIB_PL_LATENCY_NUM_BUCKETS - 1;
+    }
+
+    return ((Exp - BPLIB_PL_LATENCY_SUB_BUCKET_BITS + 1) << BPLIB_PL_LATENCY_SUB_BUCKET_BITS) |
+           ((uint32_t) (Ns >> (Exp - BPLIB_PL_LATENCY_SUB_BUCKET_BITS)) & (BPLIB_PL_LATENCY_SUB_BUCKETS - 1));
+}
+
 
 /*
 ** Function Definitions
@@ -59,3 +131,288 @@ BPLib_Status_t BPLib_PL_PerfLogExit(uint32_t PerfLogID)
     }
     return BPLIB_SUCCESS;        
 }
+
+void BPLib_PL_SetLatencyEnabled(bool Enabled)
+{
+    __atomic_store_n(&BPLib_PL_LatencyEnabled, Enabled, __ATOMIC_RELAXED);
+}
+
+uint64_t BPLib_PL_LatencyStart(void)
+{
+    if (!__atomic_load_n(&BPLib_PL_LatencyEnabled, __ATOMIC_RELAXED))
+    {
+        return 0;
+    }
+
+    return BPLib_PL_GetTimeNs();
+}
+
+void BPLib_PL_LatencyStop(uint32_t LatencyID, uint64_t StartNs)
+{
+    BPLib_PL_LatencyHist_t *Hist;
+    uint64_t StopNs;
+    uint64_t Ns;
+    uint64_t MaxNs;
+
+    if (StartNs == 0 || LatencyID >= BPLIB_PL_NUM_LATENCY_IDS)
+    {
+        return;
+    }
+
+    StopNs = BPLib_PL_LatencyStart();
+    if (StopNs < StartNs)
+    {
+        /* Recording was disabled mid-sample */
+        return;
+    }
+
+    Ns   = StopNs - StartNs;
+    Hist = &BPLib_PL_Latency[LatencyID];
+
+    pthread_rwlock_rdlock(&BPLib_PL_LatencyLock);
+
+    __atomic_fetch_add(&Hist->Buckets[BPLib_PL_LatencyBucket(Ns)], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&Hist->Count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&Hist->SumNs, Ns, __ATOMIC_RELAXED);
+
+    MaxNs = __atomic_load_n(&Hist->MaxNs, __ATOMIC_RELAXED);
+    while (Ns > MaxNs &&
+           !__atomic_compare_exchange_n(&Hist->MaxNs, &MaxNs, Ns, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+        /* MaxNs was reloaded by the failed exchange */
+    }
+
+    pthread_rwlock_unlock(&BPLib_PL_LatencyLock);
+}
+
+BPLib_Status_t BPLib_PL_GetLatency(uint32_t LatencyID, BPLib_PL_LatencyHist_t *Hist)
+{
+    BPLib_PL_LatencyHist_t *Src;
+    uint32_t Bucket;
+
+    if (Hist == NULL)
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    if (LatencyID >= BPLIB_PL_NUM_LATENCY_IDS)
+    {
+        return BPLIB_PL_INVALID_LATENCY_ID;
+    }
+
+    Src = &BPLib_PL_Latency[LatencyID];
+
+    pthread_rwlock_rdlock(&BPLib_PL_LatencyLock);
+
+    Hist->Count = __atomic_load_n(&Src->Count, __ATOMIC_RELAXED);
+    Hist->SumNs = __atomic_load_n(&Src->SumNs, __ATOMIC_RELAXED);
+    Hist->MaxNs = __atomic_load_n(&Src->MaxNs, __ATOMIC_RELAXED);
+    for (Bucket = 0; Bucket < BPLIB_PL_LATENCY_NUM_BUCKETS; Bucket++)
+    {
+        Hist->Buckets[Bucket] = __atomic_load_n(&Src->Buckets[Bucket], __ATOMIC_RELAXED);
+    }
+
+    pthread_rwlock_unlock(&BPLib_PL_LatencyLock);
+
+    return BPLIB_SUCCESS;
+}
+
+void BPLib_PL_ResetLatency(void)
+{
+    pthread_rwlock_wrlock(&BPLib_PL_LatencyLock);
+    memset(BPLib_PL_Latency, 0, sizeof(BPLib_PL_Latency));
+    pthread_rwlock_unlock(&BPLib_PL_LatencyLock);
+}
+
+uint64_t BPLib_PL_LatencyBucketLowerBound(uint32_t Bucket)
+{
+    if (Bucket < BPLIB_PL_LATENCY_SUB_BUCKETS)
+    {
+        return Bucket;
+    }
+
+    return (uint64_t) (BPLIB_PL_LATENCY_SUB_BUCKETS | (Bucket & (BPLIB_PL_LATENCY_SUB_BUCKETS - 1)))
+           << ((Bucket >> BPLIB_PL_LATENCY_SUB_BUCKET_BITS) - 1);
+}
+
+uint64_t BPLib_PL_LatencyPercentile(const BPLib_PL_LatencyHist_t *Hist, uint32_t PerMille)
+{
+    uint64_t Target;
+    uint64_t Seen;
+    uint64_t UpperNs;
+    uint32_t Bucket;
+
+    if (Hist == NULL || Hist->Count == 0)
+    {
+        return 0;
+    }
+
+    Target = (Hist->Count * PerMille + 999) / 1000;
+    if (Target == 0)
+    {
+        Target = 1;
+    }
+
+    Seen = 0;
+    for (Bucket = 0; Bucket < BPLIB_PL_LATENCY_NUM_BUCKETS - 1; Bucket++)
+    {
+        Seen += Hist->Buckets[Bucket];
+        if (Seen >= Target)
+        {
+            UpperNs = BPLib_PL_LatencyBucketLowerBound(Bucket + 1) - 1;
+            return (UpperNs < Hist->MaxNs) ? UpperNs : Hist->MaxNs;
+        }
+    }
+
+    return Hist->MaxNs;
+}
+
+void BPLib_PL_SetTraceEnabled(bool Enabled)
+{
+    __atomic_store_n(&BPLib_PL_TraceEnabled, Enabled, __ATOMIC_RELAXED);
+}
+
+void BPLib_PL_Trace(uint32_t Point, uint64_t SrcNode, uint64_t SrcService, uint64_t CreateTime,
+                    uint64_t SequenceNumber, uint32_t QueueDepth, int32_t Arg)
+{
+    BPLib_PL_TraceRing_t   *Ring;
+    BPLib_PL_TraceRecord_t *Record;
+    uint32_t RingIdx;
+    uint64_t Head;
+
+    if (!__atomic_load_n(&BPLib_PL_TraceEnabled, __ATOMIC_RELAXED))
+    {
+        return;
+    }
+
+    if (!BPLib_PL_LocalTraceClaimed)
+    {
+        BPLib_PL_LocalTraceClaimed = true;
+        RingIdx = __atomic_fetch_add(&BPLib_PL_TraceRingsClaimed, 1, __ATOMIC_RELAXED);
+        if (RingIdx < BPLIB_PL_TRACE_MAX_THREADS)
+        {
+            BPLib_PL_LocalTraceRing = &BPLib_PL_TraceRings[RingIdx];
+        }
+    }
+
+    Ring = BPLib_PL_LocalTraceRing;
+    if (Ring == NULL)
+    {
+        return;
+    }
+
+    Head   = Ring->Head;
+    Record = &Ring->Records[Head & (BPLIB_PL_TRACE_RING_SIZE - 1)];
+
+    /* Mark the slot as being rewritten before touching the payload so readers skip it */
+    __atomic_store_n(&Record->Seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    Record->TimeNs         = BPLib_PL_GetTimeNs();
+    Record->SrcNode        = SrcNode;
+    Record->SrcService     = SrcService;
+    Record->CreateTime     = CreateTime;
+    Record->SequenceNumber = SequenceNumber;
+    Record->Point          = (uint16_t) Point;
+    Record->Ring           = (uint16_t) (Ring - BPLib_PL_TraceRings);
+    Record->QueueDepth     = QueueDepth;
+    Record->Arg            = Arg;
+
+    __atomic_store_n(&Record->Seq, (uint32_t) (Head + 1), __ATOMIC_RELEASE);
+    __atomic_store_n(&Ring->Head, Head + 1, __ATOMIC_RELEASE);
+}
+
+uint32_t BPLib_PL_TraceNumRings(void)
+{
+    uint32_t NumRings;
+
+    NumRings = __atomic_load_n(&BPLib_PL_TraceRingsClaimed, __ATOMIC_RELAXED);
+
+    return (NumRings < BPLIB_PL_TRACE_MAX_THREADS) ? NumRings : BPLIB_PL_TRACE_MAX_THREADS;
+}
+
+BPLib_Status_t BPLib_PL_TraceSnapshot(uint32_t Ring, BPLib_PL_TraceRecord_t *Records, uint32_t MaxRecords,
+                                      uint32_t *NumRecords)
+{
+    BPLib_PL_TraceRing_t   *Src;
+    BPLib_PL_TraceRecord_t *Slot;
+    uint64_t Head;
+    uint64_t Pos;
+    uint32_t SeqBefore;
+    uint32_t SeqAfter;
+    uint32_t Copied;
+
+    if (Records == NULL || NumRecords == NULL)
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    if (Ring >= BPLib_PL_TraceNumRings())
+    {
+        return BPLIB_PL_INVALID_TRACE_RING;
+    }
+
+    Src  = &BPLib_PL_TraceRings[Ring];
+    Head = __atomic_load_n(&Src->Head, __ATOMIC_ACQUIRE);
+
+    /* Oldest record still in the ring, further limited by the caller's buffer */
+    Pos = (Head > BPLIB_PL_TRACE_RING_SIZE) ? Head - BPLIB_PL_TRACE_RING_SIZE : 0;
+    if (Head - Pos > MaxRecords)
+    {
+        Pos = Head - MaxRecords;
+    }
+
+    Copied = 0;
+    for (; Pos < Head; Pos++)
+    {
+        Slot = &Src->Records[Pos & (BPLIB_PL_TRACE_RING_SIZE - 1)];
+
+        SeqBefore = __atomic_load_n(&Slot->Seq, __ATOMIC_ACQUIRE);
+        Records[Copied] = *Slot;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        SeqAfter = __atomic_load_n(&Slot->Seq, __ATOMIC_RELAXED);
+
+        /* Skip records the owner overwrote while they were being copied */
+        if (SeqBefore == (uint32_t) (Pos + 1) && SeqAfter == SeqBefore)
+        {
+            Records[Copied].Seq = SeqBefore;
+            Copied++;
+        }
+    }
+
+    *NumRecords = Copied;
+
+    return BPLIB_SUCCESS;
+}
+
+void BPLib_PL_ResetTrace(void)
+{
+    memset(BPLib_PL_TraceRings, 0, sizeof(BPLib_PL_TraceRings));
+}
+
+const char *BPLib_PL_TracePointName(uint32_t Point)
+{
+    if (Point >= BPLIB_PL_NUM_TRACE_POINTS)
+    {
+        return "UNKNOWN";
+    }
+
+    return BPLib_PL_TracePointNames[Point];
+}
+
+int BPLib_PL_TraceDecode(const BPLib_PL_TraceRecord_t *Record, char *Buf, size_t BufLen)
+{
+    if (Record == NULL || Buf == NULL)
+    {
+        return -1;
+    }
+
+    return snprintf(Buf, BufLen, "%llu.%09llu ring=%u seq=%lu %-10s bundle=ipn:%llu.%llu/%llu.%llu depth=%lu arg=%ld",
+                    (unsigned long long) (Record->TimeNs / 1000000000ull),
+                    (unsigned long long) (Record->TimeNs % 1000000000ull),
+                    (unsigned int) Record->Ring, (unsigned long) Record->Seq,
+                    BPLib_PL_TracePointName(Record->Point),
+                    (unsigned long long) Record->SrcNode, (unsigned long long) Record->SrcService,
+                    (unsigned long long) Record->CreateTime, (unsigned long long) Record->SequenceNumber,
+                    (unsigned long) Record->QueueDepth, (long) Record->Arg);
+}
@@ -65,6 +65,181 @@ void Test_BPLib_PL_PerfLogExitNULL(void)
     UtAssert_INT32_EQ(BPLib_PL_PerfLogExit(PerfLogID), BPLIB_PL_NULL_CALLBACK_ERROR);    
 }
 
+void Test_BPLib_PL_LatencyDisabled(void)
+{
+    BPLib_PL_LatencyHist_t Hist;
+
+    BPLib_PL_SetLatencyEnabled(false);
+    UtAssert_EQ(uint64_t, BPLib_PL_LatencyStart(), 0);
+
+    /* An untimed start must not produce a sample */
+    BPLib_PL_LatencyStop(BPLIB_PL_LATENCY_DECODE, 0);
+    UtAssert_INT32_EQ(BPLib_PL_GetLatency(BPLIB_PL_LATENCY_DECODE, &Hist), BPLIB_SUCCESS);
+    UtAssert_EQ(uint64_t, Hist.Count, 0);
+}
+
+void Test_BPLib_PL_LatencyNominal(void)
+{
+    BPLib_PL_LatencyHist_t Hist;
+    uint64_t StartNs;
+
+    BPLib_PL_SetLatencyEnabled(true);
+    StartNs = BPLib_PL_LatencyStart();
+    UtAssert_True(StartNs != 0, "StartNs != 0");
+
+    BPLib_PL_LatencyStop(BPLIB_PL_LATENCY_ROUTE, StartNs);
+    BPLib_PL_LatencyStop(BPLIB_PL_NUM_LATENCY_IDS, StartNs);
+
+    UtAssert_INT32_EQ(BPLib_PL_GetLatency(BPLIB_PL_LATENCY_ROUTE, &Hist), BPLIB_SUCCESS);
+    UtAssert_EQ(uint64_t, Hist.Count, 1);
+    UtAssert_EQ(uint64_t, Hist.SumNs, Hist.MaxNs);
+
+    BPLib_PL_ResetLatency();
+    UtAssert_INT32_EQ(BPLib_PL_GetLatency(BPLIB_PL_LATENCY_ROUTE, &Hist), BPLIB_SUCCESS);
+    UtAssert_EQ(uint64_t, Hist.Count, 0);
+    UtAssert_EQ(uint64_t, Hist.MaxNs, 0);
+}
+
+void Test_BPLib_PL_GetLatencyInvalid(void)
+{
+    BPLib_PL_LatencyHist_t Hist;
+
+    UtAssert_INT32_EQ(BPLib_PL_GetLatency(BPLIB_PL_LATENCY_DECODE, NULL), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_PL_GetLatency(BPLIB_PL_NUM_LATENCY_IDS, &Hist), BPLIB_PL_INVALID_LATENCY_ID);
+}
+
+void Test_BPLib_PL_LatencyBucketLowerBound(void)
+{
+    UtAssert_EQ(uint64_t, BPLib_PL_LatencyBucketLowerBound(0), 0);
+    UtAssert_EQ(uint64_t, BPLib_PL_LatencyBucketLowerBound(3), 3);
+    UtAssert_EQ(uint64_t, BPLib_PL_LatencyBucketLowerBound(4), 4);
+    UtAssert_EQ(uint64_t, BPLib_PL_LatencyBucketLowerBound(8), 8);
+    UtAssert_EQ(uint64_t, BPLib_PL_LatencyBucketLowerBound(9), 10);
+    UtAssert_EQ(uint64_t, BPLib_PL_LatencyBucketLowerBound(12), 16);
+}
+
+void Test_BPLib_PL_LatencyPercentile(void)
+{
+    BPLib_PL_LatencyHist_t Hist;
+
+    memset(&Hist, 0, sizeof(Hist));
+    UtAssert_EQ(uint64_t, BPLib_PL_LatencyPercentile(NULL, 500), 0);
+    UtAssert_EQ(uint64_t, BPLib_PL_LatencyPercentile(&Hist, 500), 0);
+
+    /* 90 samples in [8, 10) and 10 samples in [16, 20), largest was 17 */
+    Hist.Count       = 100;
+    Hist.MaxNs       = 17;
+    Hist.Buckets[8]  = 90;
+    Hist.Buckets[12] = 10;
+
+    UtAssert_EQ(uint64_t, BPLib_PL_LatencyPercentile(&Hist, 0), 9);
+    UtAssert_EQ(uint64_t, BPLib_PL_LatencyPercentile(&Hist, 500), 9);
+    UtAssert_EQ(uint64_t, BPLib_PL_LatencyPercentile(&Hist, 900), 9);
+    UtAssert_EQ(uint64_t, BPLib_PL_LatencyPercentile(&Hist, 990), 17);
+}
+
+void Test_BPLib_PL_TraceNominal(void)
+{
+    BPLib_PL_TraceRecord_t Records[4];
+    uint32_t NumRecords;
+
+    BPLib_PL_SetTraceEnabled(true);
+    BPLib_PL_Trace(BPLIB_PL_TRACE_BI_RECV, 10, 1, 100, 1, 0, BPLIB_SUCCESS);
+    BPLib_PL_Trace(BPLIB_PL_TRACE_QM_QUEUED, 10, 1, 100, 1, 3, 7);
+
+    UtAssert_UINT32_EQ(BPLib_PL_TraceNumRings(), 1);
+    UtAssert_INT32_EQ(BPLib_PL_TraceSnapshot(0, Records, 4, &NumRecords), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(NumRecords, 2);
+
+    UtAssert_UINT32_EQ(Records[0].Point, BPLIB_PL_TRACE_BI_RECV);
+    UtAssert_UINT32_EQ(Records[0].Seq, 1);
+    UtAssert_UINT32_EQ(Records[1].Point, BPLIB_PL_TRACE_QM_QUEUED);
+    UtAssert_UINT32_EQ(Records[1].Seq, 2);
+    UtAssert_EQ(uint64_t, Records[1].SrcNode, 10);
+    UtAssert_EQ(uint64_t, Records[1].SrcService, 1);
+    UtAssert_EQ(uint64_t, Records[1].CreateTime, 100);
+    UtAssert_EQ(uint64_t, Records[1].SequenceNumber, 1);
+    UtAssert_UINT32_EQ(Records[1].QueueDepth, 3);
+    UtAssert_INT32_EQ(Records[1].Arg, 7);
+    UtAssert_True(Records[1].TimeNs >= Records[0].TimeNs, "Records are in time order");
+}
+
+void Test_BPLib_PL_TraceDisabled(void)
+{
+    BPLib_PL_TraceRecord_t Records[4];
+    uint32_t NumRecords;
+
+    /* Claim the ring for this thread, then drop the record */
+    BPLib_PL_SetTraceEnabled(true);
+    BPLib_PL_Trace(BPLIB_PL_TRACE_BI_RECV, 0, 0, 0, 0, 0, 0);
+    BPLib_PL_ResetTrace();
+
+    BPLib_PL_SetTraceEnabled(false);
+    BPLib_PL_Trace(BPLIB_PL_TRACE_BI_RECV, 0, 0, 0, 0, 0, 0);
+
+    UtAssert_INT32_EQ(BPLib_PL_TraceSnapshot(0, Records, 4, &NumRecords), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(NumRecords, 0);
+}
+
+void Test_BPLib_PL_TraceWrap(void)
+{
+    static BPLib_PL_TraceRecord_t Records[BPLIB_PL_TRACE_RING_SIZE];
+    uint32_t NumRecords;
+    uint32_t i;
+
+    BPLib_PL_SetTraceEnabled(true);
+    for (i = 0; i < BPLIB_PL_TRACE_RING_SIZE + 5; i++)
+    {
+        BPLib_PL_Trace(BPLIB_PL_TRACE_STOR_STORE, 0, 0, 0, i, 0, 0);
+    }
+
+    /* Only the most recent records survive, oldest first */
+    UtAssert_INT32_EQ(BPLib_PL_TraceSnapshot(0, Records, BPLIB_PL_TRACE_RING_SIZE, &NumRecords), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(NumRecords, BPLIB_PL_TRACE_RING_SIZE);
+    UtAssert_EQ(uint64_t, Records[0].SequenceNumber, 5);
+    UtAssert_EQ(uint64_t, Records[BPLIB_PL_TRACE_RING_SIZE - 1].SequenceNumber, BPLIB_PL_TRACE_RING_SIZE + 4);
+
+    /* A smaller buffer gets the newest records */
+    UtAssert_INT32_EQ(BPLib_PL_TraceSnapshot(0, Records, 2, &NumRecords), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(NumRecords, 2);
+    UtAssert_EQ(uint64_t, Records[0].SequenceNumber, BPLIB_PL_TRACE_RING_SIZE + 3);
+}
+
+void Test_BPLib_PL_TraceSnapshotInvalid(void)
+{
+    BPLib_PL_TraceRecord_t Records[1];
+    uint32_t NumRecords;
+
+    UtAssert_INT32_EQ(BPLib_PL_TraceSnapshot(0, NULL, 1, &NumRecords), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_PL_TraceSnapshot(0, Records, 1, NULL), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_PL_TraceSnapshot(BPLIB_PL_TRACE_MAX_THREADS, Records, 1, &NumRecords),
+                      BPLIB_PL_INVALID_TRACE_RING);
+}
+
+void Test_BPLib_PL_TraceDecode(void)
+{
+    BPLib_PL_TraceRecord_t Record;
+    char Buf[128];
+
+    memset(&Record, 0, sizeof(Record));
+    Record.TimeNs         = 1000000002ull;
+    Record.SrcNode        = 10;
+    Record.SrcService     = 1;
+    Record.CreateTime     = 42;
+    Record.SequenceNumber = 9;
+    Record.Seq            = 3;
+    Record.Point          = BPLIB_PL_TRACE_CLA_EGRESS;
+    Record.Arg            = -1;
+
+    UtAssert_INT32_EQ(BPLib_PL_TraceDecode(NULL, Buf, sizeof(Buf)), -1);
+    UtAssert_INT32_EQ(BPLib_PL_TraceDecode(&Record, NULL, sizeof(Buf)), -1);
+    UtAssert_True(BPLib_PL_TraceDecode(&Record, Buf, sizeof(Buf)) > 0, "Record decoded");
+    UtAssert_StrCmp(Buf, "1.000000002 ring=0 seq=3 CLA_EGRESS bundle=ipn:10.1/42.9 depth=0 arg=-1", "Decoded text");
+
+    UtAssert_StrCmp(BPLib_PL_TracePointName(BPLIB_PL_TRACE_PI_DELIVER), "PI_DELIVER", "Point name");
+    UtAssert_StrCmp(BPLib_PL_TracePointName(BPLIB_PL_NUM_TRACE_POINTS), "UNKNOWN", "Unknown point name");
+}
+
 void TestBplibPl_Register(void)
 {
     UtTest_Add(Test_BPLib_PL_Init, BPLib_PL_Test_Setup, BPLib_PL_Test_Teardown, "Test_BPLib_PL_Init");
@@ -72,4 +247,14 @@ void TestBplibPl_Register(void)
     UtTest_Add(Test_BPLib_PL_PerfLogExitNULL, BPLib_PL_Test_Setup, BPLib_PL_Test_Teardown, "Test_BPLib_PL_PerfLogExitNULL");
     UtTest_Add(Test_BPLib_PL_PerfLogEntryNominal, BPLib_PL_Test_Setup, BPLib_PL_Test_Teardown, "Test_BPLib_PL_PerfLogEntryNominal");
     UtTest_Add(Test_BPLib_PL_PerfLogExitNominal, BPLib_PL_Test_Setup, BPLib_PL_Test_Teardown, "Test_BPLib_PL_PerfLogExitNominal");
+    UtTest_Add(Test_BPLib_PL_LatencyDisabled, BPLib_PL_Test_Setup, BPLib_PL_Test_Teardown, "Test_BPLib_PL_LatencyDisabled");
+    UtTest_Add(Test_BPLib_PL_LatencyNominal, BPLib_PL_Test_Setup, BPLib_PL_Test_Teardown, "Test_BPLib_PL_LatencyNominal");
+    UtTest_Add(Test_BPLib_PL_GetLatencyInvalid, BPLib_PL_Test_Setup, BPLib_PL_Test_Teardown, "Test_BPLib_PL_GetLatencyInvalid");
+    UtTest_Add(Test_BPLib_PL_LatencyBucketLowerBound, BPLib_PL_Test_Setup, BPLib_PL_Test_Teardown, "Test_BPLib_PL_LatencyBucketLowerBound");
+    UtTest_Add(Test_BPLib_PL_LatencyPercentile, BPLib_PL_Test_Setup, BPLib_PL_Test_Teardown, "Test_BPLib_PL_LatencyPercentile");
+    UtTest_Add(Test_BPLib_PL_TraceNominal, BPLib_PL_Test_Setup, BPLib_PL_Test_Teardown, "Test_BPLib_PL_TraceNominal");
+    UtTest_Add(Test_BPLib_PL_TraceDisabled, BPLib_PL_Test_Setup, BPLib_PL_Test_Teardown, "Test_BPLib_PL_TraceDisabled");
+    UtTest_Add(Test_BPLib_PL_TraceWrap, BPLib_PL_Test_Setup, BPLib_PL_Test_Teardown, "Test_BPLib_PL_TraceWrap");
+    UtTest_Add(Test_BPLib_PL_TraceSnapshotInvalid, BPLib_PL_Test_Setup, BPLib_PL_Test_Teardown, "Test_BPLib_PL_TraceSnapshotInvalid");
+    UtTest_Add(Test_BPLib_PL_TraceDecode, BPLib_PL_Test_Setup, BPLib_PL_Test_Teardown, "Test_BPLib_PL_TraceDecode");
 }
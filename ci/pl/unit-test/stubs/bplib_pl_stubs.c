@@ -27,6 +27,23 @@
 #include "bplib_pl.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_PL_GetLatency()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_PL_GetLatency(uint32_t LatencyID, BPLib_PL_LatencyHist_t *Hist)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_PL_GetLatency, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_PL_GetLatency, uint32_t, LatencyID);
+    UT_GenStub_AddParam(BPLib_PL_GetLatency, BPLib_PL_LatencyHist_t *, Hist);
+
+    UT_GenStub_Execute(BPLib_PL_GetLatency, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_PL_GetLatency, BPLib_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_PL_Init()
@@ -72,3 +89,193 @@ BPLib_Status_t BPLib_PL_PerfLogExit(uint32_t PerfLogID)
 
   return UT_GenStub_GetReturnValue(BPLib_PL_PerfLogExit, BPLib_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_PL_LatencyBucketLowerBound()
+ * ----------------------------------------------------
+ */
+uint64_t BPLib_PL_LatencyBucketLowerBound(uint32_t Bucket)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_PL_LatencyBucketLowerBound, uint64_t);
+
+    UT_GenStub_AddParam(BPLib_PL_LatencyBucketLowerBound, uint32_t, Bucket);
+
+    UT_GenStub_Execute(BPLib_PL_LatencyBucketLowerBound, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_PL_LatencyBucketLowerBound, uint64_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_PL_LatencyPercentile()
+ * ----------------------------------------------------
+ */
+uint64_t BPLib_PL_LatencyPercentile(const BPLib_PL_LatencyHist_t *Hist, uint32_t PerMille)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_PL_LatencyPercentile, uint64_t);
+
+    UT_GenStub_AddParam(BPLib_PL_LatencyPercentile, const BPLib_PL_LatencyHist_t *, Hist);
+    UT_GenStub_AddParam(BPLib_PL_LatencyPercentile, uint32_t, PerMille);
+
+    UT_GenStub_Execute(BPLib_PL_LatencyPercentile, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_PL_LatencyPercentile, uint64_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_PL_LatencyStart()
+ * ----------------------------------------------------
+ */
+uint64_t BPLib_PL_LatencyStart(void)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_PL_LatencyStart, uint64_t);
+
+    UT_GenStub_Execute(BPLib_PL_LatencyStart, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_PL_LatencyStart, uint64_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_PL_LatencyStop()
+ * ----------------------------------------------------
+ */
+void BPLib_PL_LatencyStop(uint32_t LatencyID, uint64_t StartNs)
+{
+    UT_GenStub_AddParam(BPLib_PL_LatencyStop, uint32_t, LatencyID);
+    UT_GenStub_AddParam(BPLib_PL_LatencyStop, uint64_t, StartNs);
+
+    UT_GenStub_Execute(BPLib_PL_LatencyStop, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_PL_ResetLatency()
+ * ----------------------------------------------------
+ */
+void BPLib_PL_ResetLatency(void)
+{
+    UT_GenStub_Execute(BPLib_PL_ResetLatency, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_PL_ResetTrace()
+ * ----------------------------------------------------
+ */
+void BPLib_PL_ResetTrace(void)
+{
+    UT_GenStub_Execute(BPLib_PL_ResetTrace, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_PL_SetLatencyEnabled()
+ * ----------------------------------------------------
+ */
+void BPLib_PL_SetLatencyEnabled(bool Enabled)
+{
+    UT_GenStub_AddParam(BPLib_PL_SetLatencyEnabled, bool, Enabled);
+
+    UT_GenStub_Execute(BPLib_PL_SetLatencyEnabled, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_PL_SetTraceEnabled()
+ * ----------------------------------------------------
+ */
+void BPLib_PL_SetTraceEnabled(bool Enabled)
+{
+    UT_GenStub_AddParam(BPLib_PL_SetTraceEnabled, bool, Enabled);
+
+    UT_GenStub_Execute(BPLib_PL_SetTraceEnabled, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_PL_Trace()
+ * ----------------------------------------------------
+ */
+void BPLib_PL_Trace(uint32_t Point, uint64_t SrcNode, uint64_t SrcService, uint64_t CreateTime,
+                    uint64_t SequenceNumber, uint32_t QueueDepth, int32_t Arg)
+{
+    UT_GenStub_AddParam(BPLib_PL_Trace, uint32_t, Point);
+    UT_GenStub_AddParam(BPLib_PL_Trace, uint64_t, SrcNode);
+    UT_GenStub_AddParam(BPLib_PL_Trace, uint64_t, SrcService);
+    UT_GenStub_AddParam(BPLib_PL_Trace, uint64_t, CreateTime);
+    UT_GenStub_AddParam(BPLib_PL_Trace, uint64_t, SequenceNumber);
+    UT_GenStub_AddParam(BPLib_PL_Trace, uint32_t, QueueDepth);
+    UT_GenStub_AddParam(BPLib_PL_Trace, int32_t, Arg);
+
+    UT_GenStub_Execute(BPLib_PL_Trace, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_PL_TraceDecode()
+ * ----------------------------------------------------
+ */
+int BPLib_PL_TraceDecode(const BPLib_PL_TraceRecord_t *Record, char *Buf, size_t BufLen)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_PL_TraceDecode, int);
+
+    UT_GenStub_AddParam(BPLib_PL_TraceDecode, const BPLib_PL_TraceRecord_t *, Record);
+    UT_GenStub_AddParam(BPLib_PL_TraceDecode, char *, Buf);
+    UT_GenStub_AddParam(BPLib_PL_TraceDecode, size_t, BufLen);
+
+    UT_GenStub_Execute(BPLib_PL_TraceDecode, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_PL_TraceDecode, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_PL_TraceNumRings()
+ * ----------------------------------------------------
+ */
+uint32_t BPLib_PL_TraceNumRings(void)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_PL_TraceNumRings, uint32_t);
+
+    UT_GenStub_Execute(BPLib_PL_TraceNumRings, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_PL_TraceNumRings, uint32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_PL_TracePointName()
+ * ----------------------------------------------------
+ */
+const char *BPLib_PL_TracePointName(uint32_t Point)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_PL_TracePointName, const char *);
+
+    UT_GenStub_AddParam(BPLib_PL_TracePointName, uint32_t, Point);
+
+    UT_GenStub_Execute(BPLib_PL_TracePointName, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_PL_TracePointName, const char *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_PL_TraceSnapshot()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_PL_TraceSnapshot(uint32_t Ring, BPLib_PL_TraceRecord_t *Records, uint32_t MaxRecords, uint32_t *NumRecords)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_PL_TraceSnapshot, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_PL_TraceSnapshot, uint32_t, Ring);
+    UT_GenStub_AddParam(BPLib_PL_TraceSnapshot, BPLib_PL_TraceRecord_t *, Records);
+    UT_GenStub_AddParam(BPLib_PL_TraceSnapshot, uint32_t, MaxRecords);
+    UT_GenStub_AddParam(BPLib_PL_TraceSnapshot, uint32_t *, NumRecords);
+
+    UT_GenStub_Execute(BPLib_PL_TraceSnapshot, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_PL_TraceSnapshot, BPLib_Status_t);
+}
@@ -32,6 +32,10 @@ void BPLib_PL_Test_Setup(void)
 {
     /* Initialize test environment to default state for every test */
     UT_ResetState(0);
+
+    BPLib_PL_SetLatencyEnabled(false);
+    BPLib_PL_ResetLatency();
+    BPLib_PL_ResetTrace();
 }
 
 void BPLib_PL_Test_Teardown(void)
@@ -31,6 +31,7 @@
 #define QM_NO_WAIT          0L  /**< Constant representing no wait */
 #define QM_WAIT_FOREVER    -1L /**< Constant representing an indefinite wait */
 #define QM_MAX_GEN_WORKERS  8L /**< Constant representing maximum allowed generic workers */
+#define QM_MAX_JOB_BATCH   32L /**< Constant representing jobs queued per lock by BPLib_QM_CreateJobs */
 
 #ifndef BPLIB_QM_TX_QUEUE_DEPTH
 #define BPLIB_QM_TX_QUEUE_DEPTH 2048
@@ -125,6 +126,28 @@ bool BPLib_QM_IsDuctEmpty(BPLib_Instance_t* Inst, uint32_t EgressID, bool LocalD
 BPLib_Status_t BPLib_QM_DuctPull(BPLib_Instance_t* Inst, uint32_t EgressID, bool LocalDelivery,
     int TimeoutMs, BPLib_Bundle_t** RetBundle);
 
+/**
+ * @brief Pulls several bundles from a channel or contact duct.
+ * 
+ * This function works like BPLib_QM_DuctPull, but takes up to MaxBundles bundles that
+ * are queued on the duct under a single queue lock acquisition. The storage load check
+ * is done once for the whole batch, and each bundle is run to NO_NEXT_STATE in order.
+ * Nothing is pulled from a contact that is set up but not started; the call waits as it
+ * would on an empty duct so bundles preloaded ahead of a contact window stay queued.
+ * 
+ * @param[in] Inst The instance to pull from.
+ * @param[in] EgressID The channel or contact ID.
+ * @param[in] LocalDelivery Whether EgressID is a channel (true) or a contact (false).
+ * @param[in] TimeoutMs Timeout in milliseconds to wait for the first bundle.
+ * @param[out] RetBundles Array with room for MaxBundles bundle pointers.
+ * @param[in] MaxBundles The maximum number of bundles to pull.
+ * @param[out] NumPulled The number of bundles pulled.
+ * 
+ * @return BPLIB_SUCCESS if at least one bundle was pulled, BPLIB_TIMEOUT if none was.
+ */
+BPLib_Status_t BPLib_QM_DuctPullBatch(BPLib_Instance_t* Inst, uint32_t EgressID, bool LocalDelivery,
+    int TimeoutMs, BPLib_Bundle_t* RetBundles[], size_t MaxBundles, size_t* NumPulled);
+
 /**
  * @brief Adds a job to the queue.
  * 
@@ -143,4 +166,25 @@ BPLib_Status_t BPLib_QM_CreateJob(BPLib_Instance_t* inst, BPLib_Bundle_t* bundle
     BPLib_QM_JobState_t state, BPLib_QM_Priority_t priority, int TimeoutMs);
 
 
+/**
+ * @brief Adds several jobs to the queue.
+ * 
+ * This function adds a job for each bundle to the job queue, in order, with the
+ * specified state and priority. Jobs are queued up to QM_MAX_JOB_BATCH at a time
+ * under a single queue lock acquisition.
+ * 
+ * @param[in] inst The instance to which the jobs are to be added.
+ * @param[in] bundles The bundles associated with the jobs.
+ * @param[in] NumBundles The number of bundles.
+ * @param[in] state The initial state of the jobs.
+ * @param[in] priority The priority of the jobs.
+ * @param[in] TimeoutMs Timeout in milliseconds for adding each group of jobs.
+ * @param[out] NumCreated The number of leading bundles that had jobs created.
+ * 
+ * @return Status of the job addition, BPLIB_QM_PUSH_ERROR if not every job was added.
+ */
+BPLib_Status_t BPLib_QM_CreateJobs(BPLib_Instance_t* inst, BPLib_Bundle_t* const bundles[],
+    size_t NumBundles, BPLib_QM_JobState_t state, BPLib_QM_Priority_t priority, int TimeoutMs,
+    size_t* NumCreated);
+
 #endif /* BPLIB_QM_H */
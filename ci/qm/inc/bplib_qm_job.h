@@ -66,6 +66,7 @@ typedef struct
     BPLib_Bundle_t*     Bundle;    /**< Pointer to the bundle associated with this job */
     BPLib_QM_JobState_t NextState; /**< The next state for the job */
     BPLib_QM_Priority_t Priority;  /**< Priority of the job */
+    uint64_t            QueuedNs;  /**< Time the job was queued, from BPLib_PL_LatencyStart() */
 } BPLib_QM_Job_t;
 
 /**
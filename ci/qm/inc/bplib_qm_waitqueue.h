@@ -90,6 +90,22 @@ void BPLib_QM_WaitQueueDestroy(BPLib_QM_WaitQueue_t* q);
  */
 bool BPLib_QM_WaitQueueTryPush(BPLib_QM_WaitQueue_t* q, const void* item, int timeout_ms);
 
+/**
+ * @brief Attempts to push several items into the wait queue.
+ * 
+ * This function adds items to the queue in order under a single lock acquisition,
+ * waiting for space as needed until the timeout is reached. Waiting pullers are woken
+ * once for the whole batch.
+ * 
+ * @param[in] q The queue to push the items into.
+ * @param[in] items Array of count contiguous items, each the queue's element size.
+ * @param[in] count The number of items to push.
+ * @param[in] timeout_ms The timeout in milliseconds. If the queue is full, it waits until this timeout expires.
+ * 
+ * @return The number of leading items pushed, less than count if the operation timed out.
+ */
+size_t BPLib_QM_WaitQueueTryPushMany(BPLib_QM_WaitQueue_t* q, const void* items, size_t count, int timeout_ms);
+
 /**
  * @brief Attempts to pull an item from the wait queue.
  * 
@@ -104,6 +120,22 @@ bool BPLib_QM_WaitQueueTryPush(BPLib_QM_WaitQueue_t* q, const void* item, int ti
  */
 bool BPLib_QM_WaitQueueTryPull(BPLib_QM_WaitQueue_t* q, void* ret_item, int timeout_ms);
 
+/**
+ * @brief Attempts to pull several items from the wait queue.
+ * 
+ * This function waits until at least one item is available or the timeout is reached,
+ * then takes up to max_items items in order under the same lock acquisition. Waiting
+ * pushers are woken once for the whole batch.
+ * 
+ * @param[in] q The queue to pull the items from.
+ * @param[out] ret_items Array with room for max_items contiguous items, each the queue's element size.
+ * @param[in] max_items The maximum number of items to pull.
+ * @param[in] timeout_ms The timeout in milliseconds. If the queue is empty, it waits until this timeout expires.
+ * 
+ * @return The number of items pulled, 0 if the operation timed out.
+ */
+size_t BPLib_QM_WaitQueueTryPullMany(BPLib_QM_WaitQueue_t* q, void* ret_items, size_t max_items, int timeout_ms);
+
 /**
  * @brief Determine if the queue is currently empty
  * 
@@ -115,4 +147,23 @@ bool BPLib_QM_WaitQueueTryPull(BPLib_QM_WaitQueue_t* q, void* ret_item, int time
  */
 bool BPLib_QM_WaitQueueIsEmpty(BPLib_QM_WaitQueue_t* q);
 
+/**
+ * @brief Waits on the queue without pulling from it.
+ * 
+ * This function blocks until an item is pushed, the queue is woken with
+ * BPLib_QM_WaitQueueWake, or the timeout is reached. It lets a puller that must not take
+ * items yet wait the way it would on an empty queue.
+ * 
+ * @param[in] q The queue to wait on.
+ * @param[in] timeout_ms The timeout in milliseconds.
+ */
+void BPLib_QM_WaitQueueWait(BPLib_QM_WaitQueue_t* q, int timeout_ms);
+
+/**
+ * @brief Wakes every thread waiting to pull from the queue.
+ * 
+ * @param[in] q The queue to wake.
+ */
+void BPLib_QM_WaitQueueWake(BPLib_QM_WaitQueue_t* q);
+
 #endif /* BPLIB_QM_WAITQUEUE_H */
@@ -163,6 +163,10 @@ BPLib_Status_t BPLib_QM_CreateJob(BPLib_Instance_t* inst, BPLib_Bundle_t* bundle
     NewJob.Bundle = bundle;
     NewJob.NextState = state;
     NewJob.Priority = priority;
+    NewJob.QueuedNs = BPLib_PL_LatencyStart();
+
+    BPLIB_PL_TRACE_BUNDLE(BPLIB_PL_TRACE_QM_QUEUED, bundle,
+        (uint32_t) __atomic_load_n(&inst->GenericWorkerJobs.size, __ATOMIC_RELAXED), state);
     
     if (!BPLib_QM_WaitQueueTryPush(&(inst->GenericWorkerJobs), &NewJob, TimeoutMs))
     {
@@ -172,6 +176,53 @@ BPLib_Status_t BPLib_QM_CreateJob(BPLib_Instance_t* inst, BPLib_Bundle_t* bundle
     return Status;
 }
 
+BPLib_Status_t BPLib_QM_CreateJobs(BPLib_Instance_t* inst, BPLib_Bundle_t* const bundles[],
+    size_t NumBundles, BPLib_QM_JobState_t state, BPLib_QM_Priority_t priority, int TimeoutMs,
+    size_t* NumCreated)
+{
+    BPLib_QM_Job_t NewJobs[QM_MAX_JOB_BATCH];
+    size_t Created;
+    size_t BatchLen;
+    size_t Pushed;
+    size_t i;
+
+    if ((inst == NULL) || (bundles == NULL) || (NumCreated == NULL))
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    Created = 0;
+    while (Created < NumBundles)
+    {
+        BatchLen = NumBundles - Created;
+        if (BatchLen > QM_MAX_JOB_BATCH)
+        {
+            BatchLen = QM_MAX_JOB_BATCH;
+        }
+
+        for (i = 0; i < BatchLen; i++)
+        {
+            NewJobs[i].Bundle = bundles[Created + i];
+            NewJobs[i].NextState = state;
+            NewJobs[i].Priority = priority;
+            NewJobs[i].QueuedNs = BPLib_PL_LatencyStart();
+
+            BPLIB_PL_TRACE_BUNDLE(BPLIB_PL_TRACE_QM_QUEUED, NewJobs[i].Bundle,
+                (uint32_t) __atomic_load_n(&inst->GenericWorkerJobs.size, __ATOMIC_RELAXED), state);
+        }
+
+        Pushed = BPLib_QM_WaitQueueTryPushMany(&(inst->GenericWorkerJobs), NewJobs, BatchLen, TimeoutMs);
+        Created += Pushed;
+        if (Pushed < BatchLen)
+        {
+            break;
+        }
+    }
+
+    *NumCreated = Created;
+    return (Created == NumBundles) ? BPLIB_SUCCESS : BPLIB_QM_PUSH_ERROR;
+}
+
 BPLib_Status_t BPLib_QM_WorkerRunJob(BPLib_Instance_t* inst, int32_t WorkerID, int TimeoutMs)
 {
     BPLib_QM_WorkerState_t* WorkerState;
@@ -199,6 +250,10 @@ BPLib_Status_t BPLib_QM_WorkerRunJob(BPLib_Instance_t* inst, int32_t WorkerID, i
     {
         if (BPLib_QM_WaitQueueTryPull(&(inst->GenericWorkerJobs), &WorkerState->CurrJob, TimeoutMs))
         {
+            BPLib_PL_LatencyStop(BPLIB_PL_LATENCY_QUEUE, WorkerState->CurrJob.QueuedNs);
+            BPLIB_PL_TRACE_BUNDLE(BPLIB_PL_TRACE_QM_RUN, WorkerState->CurrJob.Bundle,
+                (uint32_t) __atomic_load_n(&inst->GenericWorkerJobs.size, __ATOMIC_RELAXED),
+                WorkerState->CurrJob.NextState);
             JobFunc = BPLib_QM_JobLookup(WorkerState->CurrJob.NextState);
             WorkerState->CurrJob.NextState = JobFunc(inst, WorkerState->CurrJob.Bundle);
             Status = BPLIB_SUCCESS;
@@ -210,6 +265,8 @@ BPLib_Status_t BPLib_QM_WorkerRunJob(BPLib_Instance_t* inst, int32_t WorkerID, i
     }
     else
     {
+        BPLIB_PL_TRACE_BUNDLE(BPLIB_PL_TRACE_QM_RUN, WorkerState->CurrJob.Bundle, 0,
+            WorkerState->CurrJob.NextState);
         JobFunc = BPLib_QM_JobLookup(WorkerState->CurrJob.NextState);
         WorkerState->CurrJob.NextState = JobFunc(inst, WorkerState->CurrJob.Bundle);
         Status = BPLIB_SUCCESS;
@@ -262,7 +319,21 @@ bool BPLib_QM_IsDuctEmpty(BPLib_Instance_t* Inst, uint32_t EgressID, bool LocalD
 BPLib_Status_t BPLib_QM_DuctPull(BPLib_Instance_t* Inst, uint32_t EgressID, bool LocalDelivery,
     int TimeoutMs, BPLib_Bundle_t** RetBundle)
 {
-    BPLib_Bundle_t* Bundle;
+    size_t NumPulled;
+
+    if (RetBundle == NULL)
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+    *RetBundle = NULL;
+
+    return BPLib_QM_DuctPullBatch(Inst, EgressID, LocalDelivery, TimeoutMs, RetBundle, 1, &NumPulled);
+}
+
+BPLib_Status_t BPLib_QM_DuctPullBatch(BPLib_Instance_t* Inst, uint32_t EgressID, bool LocalDelivery,
+    int TimeoutMs, BPLib_Bundle_t* RetBundles[], size_t MaxBundles, size_t* NumPulled)
+{
+    BPLib_QM_JobState_t FirstState;
     BPLib_QM_JobState_t CurrState;
     BPLib_QM_JobFunc_t JobFunc;
     BPLib_QM_WaitQueue_t* DuctQueue;
@@ -270,12 +341,13 @@ BPLib_Status_t BPLib_QM_DuctPull(BPLib_Instance_t* Inst, uint32_t EgressID, bool
     bool DuctActive = false;
     BPLib_Status_t Status = BPLIB_SUCCESS;
     size_t NumStoredEgressed = 0;
+    size_t i;
 
-    if ((Inst == NULL) || (RetBundle == NULL))
+    if ((Inst == NULL) || (RetBundles == NULL) || (NumPulled == NULL))
     {
         return BPLIB_NULL_PTR_ERROR;
     }
-    *RetBundle = NULL;
+    *NumPulled = 0;
     if (LocalDelivery && EgressID >= BPLIB_MAX_NUM_CHANNELS)
     {
         return BPLIB_STOR_PARAM_ERR;
@@ -288,16 +360,25 @@ BPLib_Status_t BPLib_QM_DuctPull(BPLib_Instance_t* Inst, uint32_t EgressID, bool
     /* Determine which queue to pull from */
     if (LocalDelivery == true)
     {
-        CurrState = CHANNEL_OUT_STOR_TO_CT;
+        FirstState = CHANNEL_OUT_STOR_TO_CT;
         DuctQueue = &(Inst->ChannelEgressJobs[EgressID]);
         DuctActive = (BPLib_NC_GetAppState(EgressID) == BPLIB_NC_APP_STATE_STARTED);
     }
     else
     {
-        CurrState = CONTACT_OUT_STOR_TO_CT;
+        FirstState = CONTACT_OUT_STOR_TO_CT;
         DuctQueue = &(Inst->ContactEgressJobs[EgressID]);
         (void) BPLib_CLA_GetContactRunState(EgressID, &ContactState);
         DuctActive = (ContactState == BPLIB_CLA_STARTED);
+
+        /* A contact that is set up but not started yet keeps whatever was preloaded into
+        ** its duct until its contact window opens
+        */
+        if (ContactState == BPLIB_CLA_SETUP)
+        {
+            BPLib_QM_WaitQueueWait(DuctQueue, TimeoutMs);
+            return BPLIB_TIMEOUT;
+        }
     }
 
     /* If the duct is empty, try to load more from storage */
@@ -317,23 +398,26 @@ BPLib_Status_t BPLib_QM_DuctPull(BPLib_Instance_t* Inst, uint32_t EgressID, bool
         return Status;
     }
 
-    /* Pull the bundle from the queue and push it to the 'edge' of BPA 
+    /* Pull the bundles from the queue and push them to the 'edge' of BPA 
     ** Note: There's no check for DuctActive here to support the case where bundles
     ** remain in the queue after a Channel or Contact is stopped.
     */
-    if (BPLib_QM_WaitQueueTryPull(DuctQueue, &Bundle, TimeoutMs))
+    *NumPulled = BPLib_QM_WaitQueueTryPullMany(DuctQueue, RetBundles, MaxBundles, TimeoutMs);
+    if (*NumPulled == 0)
+    {
+        return BPLIB_TIMEOUT;
+    }
+
+    /* Take each bundle all the way to NO_NEXT_STATE */
+    for (i = 0; i < *NumPulled; i++)
     {
-        /* Take this bundle all the way to NO_NEXT_STATE */
+        CurrState = FirstState;
         while (CurrState != NO_NEXT_STATE)
         {
             JobFunc = BPLib_QM_JobLookup(CurrState);
-            CurrState = JobFunc(Inst, Bundle);
+            CurrState = JobFunc(Inst, RetBundles[i]);
         }
-        *RetBundle = Bundle;
-        return BPLIB_SUCCESS;
-    }
-    else
-    {
-        return BPLIB_TIMEOUT;
     }
+
+    return BPLIB_SUCCESS;
 }
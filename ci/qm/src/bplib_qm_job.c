@@ -25,6 +25,7 @@
 #include "bplib_eid.h"
 #include "bplib_nc.h"
 #include "bplib_ebp.h"
+#include "bplib_pl.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -95,9 +96,13 @@ static BPLib_QM_JobState_t ChannelOut_PI(BPLib_Instance_t* Inst, BPLib_Bundle_t*
 
 static BPLib_QM_JobState_t STOR_Router(BPLib_Instance_t* Inst, BPLib_Bundle_t* Bundle)
 {
-    int i, j;
+    int i;
     BPLib_EID_t* DestEID;
     BPLib_CLA_ContactRunState_t ContactState;
+    uint64_t RouteStart;
+    uint64_t Routes;
+
+    RouteStart = BPLib_PL_LatencyStart();
 
     /* For build 7.0 our ingress route strategy is as follows:
     ** - If the bundle is local, forward to the channel immediatley
@@ -118,6 +123,9 @@ static BPLib_QM_JobState_t STOR_Router(BPLib_Instance_t* Inst, BPLib_Bundle_t* B
                     /* We have a channel we can deliver to: forward without storing */
                     Bundle->Meta.EgressID = i;
                     BPLib_NC_ReaderUnlock();
+                    BPLib_PL_LatencyStop(BPLIB_PL_LATENCY_ROUTE, RouteStart);
+                    BPLIB_PL_TRACE_BUNDLE(BPLIB_PL_TRACE_QM_EGRESS, Bundle,
+                        (uint32_t) __atomic_load_n(&Inst->ChannelEgressJobs[i].size, __ATOMIC_RELAXED), i);
                     BPLib_QM_WaitQueueTryPush(&(Inst->ChannelEgressJobs[Bundle->Meta.EgressID]), &Bundle, QM_WAIT_FOREVER);
                     return NO_NEXT_STATE;
                 }
@@ -126,28 +134,37 @@ static BPLib_QM_JobState_t STOR_Router(BPLib_Instance_t* Inst, BPLib_Bundle_t* B
     }
     else
     {
-        /* Iterate through the contacts: this is very slow. */
+        /* Match a whole route set of contacts' destination patterns at once, then check the matching contacts */
+        Routes = 0;
         for (i = 0; i < BPLIB_MAX_NUM_CONTACTS; i++)
         {
+            if ((i % BPLIB_CLA_ROUTE_SET_CONTACTS) == 0)
+            {
+                Routes = BPLib_CLA_FindContactRoutes(DestEID, i);
+            }
+
+            if ((Routes & BPLIB_CLA_CONTACT_ROUTE_MASK(i)) == 0)
+            {
+                continue;
+            }
+
             /* Contact ID is valid here, so we can ignore the error status of the function */
             (void) BPLib_CLA_GetContactRunState(i, &ContactState);
             if (ContactState == BPLIB_CLA_STARTED)
             {
-                for (j = 0; j < BPLIB_MAX_CONTACT_DEST_EIDS; j++)
-                {
-                    if (BPLib_EID_PatternIsMatch(DestEID, &BPLib_NC_ConfigPtrs.ContactsConfigPtr->ContactSet[i].DestEIDs[j]))
-                    {
-                        /* We have a contact we can deliver to: forward without storing */
-                        Bundle->Meta.EgressID = i;
-                        BPLib_NC_ReaderUnlock();
-                        BPLib_QM_WaitQueueTryPush(&(Inst->ContactEgressJobs[Bundle->Meta.EgressID]), &Bundle, QM_WAIT_FOREVER);
-                        return NO_NEXT_STATE;
-                    }
-                }
+                /* We have a contact we can deliver to: forward without storing */
+                Bundle->Meta.EgressID = i;
+                BPLib_NC_ReaderUnlock();
+                BPLib_PL_LatencyStop(BPLIB_PL_LATENCY_ROUTE, RouteStart);
+                BPLIB_PL_TRACE_BUNDLE(BPLIB_PL_TRACE_QM_EGRESS, Bundle,
+                    (uint32_t) __atomic_load_n(&Inst->ContactEgressJobs[i].size, __ATOMIC_RELAXED), i);
+                BPLib_QM_WaitQueueTryPush(&(Inst->ContactEgressJobs[Bundle->Meta.EgressID]), &Bundle, QM_WAIT_FOREVER);
+                return NO_NEXT_STATE;
             }
         }
     }
     BPLib_NC_ReaderUnlock();
+    BPLib_PL_LatencyStop(BPLIB_PL_LATENCY_ROUTE, RouteStart);
 
     /* We never found an active channel or contact: store this bundle */
     BPLib_STOR_StoreBundle(Inst, Bundle);
@@ -135,6 +135,64 @@ bool BPLib_QM_WaitQueueTryPush(BPLib_QM_WaitQueue_t* q, const void* item, int ti
     return true;
 }
 
+size_t BPLib_QM_WaitQueueTryPushMany(BPLib_QM_WaitQueue_t* q, const void* items, size_t count, int timeout_ms)
+{
+    struct timespec deadline;
+    size_t pushed;
+    int rc;
+
+    if ((q == NULL) || (items == NULL) || (count == 0))
+    {
+        return 0;
+    }
+
+    ms_to_abstimeout((uint32_t)(timeout_ms), &deadline);
+    pthread_mutex_lock(&q->lock);
+    /**** Critical Section Begin ****/
+
+    pushed = 0;
+    while (pushed < count)
+    {
+        /* Wait for queue to be non-full, letting pullers drain what was pushed so far */
+        if (q->size == q->capacity)
+        {
+            if (pushed > 0)
+            {
+                pthread_cond_broadcast(&q->cv_pull);
+            }
+
+            rc = pthread_cond_timedwait(&q->cv_push, &q->lock, &deadline);
+            if (rc != 0)
+            {
+                if (rc != ETIMEDOUT)
+                {
+                    printf(" BPLib_QM_WaitQueueTryPushMany NON-TIMEOUT ERROR: %s\n", strerror(rc));
+                }
+                break;
+            }
+            continue;
+        }
+
+        /* Push an item */
+        q->rear = (q->rear  + 1) % q->capacity;
+        memcpy((void*)(((char *)q->storage) + (q->rear*q->el_size)),
+            (const void*)(((const char *)items) + (pushed*q->el_size)), q->el_size);
+        q->size++;
+        pushed++;
+    }
+
+    /* Notify other pulling threads that items can be pulled. */
+    if (pushed > 0)
+    {
+        pthread_cond_broadcast(&q->cv_pull);
+    }
+
+    /**** Critical Section End ****/
+    pthread_mutex_unlock(&q->lock);
+
+    return pushed;
+}
+
 bool BPLib_QM_WaitQueueTryPull(BPLib_QM_WaitQueue_t* q, void* ret_item, int timeout_ms)
 {
     struct timespec deadline;
@@ -178,6 +236,56 @@ bool BPLib_QM_WaitQueueTryPull(BPLib_QM_WaitQueue_t* q, void* ret_item, int time
     return true;
 }
 
+size_t BPLib_QM_WaitQueueTryPullMany(BPLib_QM_WaitQueue_t* q, void* ret_items, size_t max_items, int timeout_ms)
+{
+    struct timespec deadline;
+    size_t pulled;
+    int rc;
+
+    if ((q == NULL) || (ret_items == NULL) || (max_items == 0))
+    {
+        return 0;
+    }
+
+    ms_to_abstimeout((uint32_t)(timeout_ms), &deadline);
+    pthread_mutex_lock(&q->lock);
+    /**** Critical Section Begin ****/
+
+    /* Wait for queue to be non-empty */
+    while (q->size == 0)
+    {
+        rc = pthread_cond_timedwait(&q->cv_pull, &q->lock, &deadline);
+        if (rc != 0)
+        {
+            if (rc != ETIMEDOUT)
+            {
+                printf(" BPLib_QM_WaitQueueTryPullMany NON-TIMEOUT ERROR: %s\n", strerror(rc));
+            }
+            pthread_mutex_unlock(&q->lock);
+            return 0;
+        }
+    }
+
+    /* Pull whatever is already queued, up to max_items */
+    pulled = 0;
+    while ((pulled < max_items) && (q->size > 0))
+    {
+        memcpy((void*)(((char *)ret_items) + (pulled*q->el_size)),
+            (void*)(((char *)q->storage) + (q->front*q->el_size)), q->el_size);
+        q->size--;
+        q->front = (q->front + 1) % (q->capacity);
+        pulled++;
+    }
+
+    /* Notify other pushing threads that items can be pushed */
+    pthread_cond_broadcast(&q->cv_push);
+
+    /**** Critical Section End ****/
+    pthread_mutex_unlock(&q->lock);
+
+    return pulled;
+}
+
 bool BPLib_QM_WaitQueueIsEmpty(BPLib_QM_WaitQueue_t* q)
 {
     bool IsEmpty;
@@ -193,3 +301,35 @@ bool BPLib_QM_WaitQueueIsEmpty(BPLib_QM_WaitQueue_t* q)
 
     return IsEmpty;
 }
+
+void BPLib_QM_WaitQueueWait(BPLib_QM_WaitQueue_t* q, int timeout_ms)
+{
+    struct timespec deadline;
+    int rc;
+
+    if (q == NULL)
+    {
+        return;
+    }
+
+    ms_to_abstimeout((uint32_t)(timeout_ms), &deadline);
+    pthread_mutex_lock(&q->lock);
+    rc = pthread_cond_timedwait(&q->cv_pull, &q->lock, &deadline);
+    if ((rc != 0) && (rc != ETIMEDOUT))
+    {
+        printf(" BPLib_QM_WaitQueueWait NON-TIMEOUT ERROR: %s\n", strerror(rc));
+    }
+    pthread_mutex_unlock(&q->lock);
+}
+
+void BPLib_QM_WaitQueueWake(BPLib_QM_WaitQueue_t* q)
+{
+    if (q == NULL)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&q->lock);
+    pthread_cond_broadcast(&q->cv_pull);
+    pthread_mutex_unlock(&q->lock);
+}
@@ -55,6 +55,24 @@ void UT_Handler_BPLib_QM_DuctPull(void *UserObj, UT_EntryKey_t FuncKey, const UT
     }
 }
 
+void UT_Handler_BPLib_QM_DuctPullBatch(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    BPLib_Bundle_t **RetBundles = UT_Hook_GetArgValueByName(Context, "RetBundles", BPLib_Bundle_t **);
+    size_t           MaxBundles = UT_Hook_GetArgValueByName(Context, "MaxBundles", size_t);
+    size_t          *NumPulled  = UT_Hook_GetArgValueByName(Context, "NumPulled", size_t *);
+    int32            Status;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+
+    /* Hand out as many of the bundle pointers the test queued as fit */
+    *NumPulled = 0;
+    if (Status >= 0)
+    {
+        *NumPulled = UT_Stub_CopyToLocal(UT_KEY(BPLib_QM_DuctPullBatch), RetBundles,
+                                         MaxBundles * sizeof(BPLib_Bundle_t *)) / sizeof(BPLib_Bundle_t *);
+    }
+}
+
 void UT_Handler_BPLib_QM_WaitQueueTryPush(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
     uint16 CallNum;
@@ -93,3 +111,22 @@ void UT_Handler_BPLib_QM_CreateJob(void *UserObj, UT_EntryKey_t FuncKey, const U
         Context_BPLib_QM_CreateJob[CallNum].Bundle = UT_Hook_GetArgValueByName(Context, "bundle", BPLib_Bundle_t*);
     }
 }
+
+void UT_Handler_BPLib_QM_CreateJobs(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    size_t  NumBundles = UT_Hook_GetArgValueByName(Context, "NumBundles", size_t);
+    size_t *NumCreated = UT_Hook_GetArgValueByName(Context, "NumCreated", size_t *);
+    int32   Status;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+
+    /* Every job is created on success, otherwise use a count the test may have queued */
+    if (Status == BPLIB_SUCCESS)
+    {
+        *NumCreated = NumBundles;
+    }
+    else if (UT_Stub_CopyToLocal(UT_KEY(BPLib_QM_CreateJobs), NumCreated, sizeof(size_t)) != sizeof(size_t))
+    {
+        *NumCreated = 0;
+    }
+}
@@ -60,6 +60,10 @@ void UT_Handler_BPLib_QM_WaitQueueTryPush(void* UserObj, UT_EntryKey_t FuncKey,
 
 void UT_Handler_BPLib_QM_DuctPull(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context);
 
+void UT_Handler_BPLib_QM_DuctPullBatch(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context);
+
 void UT_Handler_BPLib_QM_CreateJob(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context);
 
+void UT_Handler_BPLib_QM_CreateJobs(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context);
+
 #endif /* BPLIB_QM_HANDLERS_H */
@@ -48,6 +48,30 @@ BPLib_Status_t BPLib_QM_CreateJob(BPLib_Instance_t *inst, BPLib_Bundle_t *bundle
     return UT_GenStub_GetReturnValue(BPLib_QM_CreateJob, BPLib_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_QM_CreateJobs()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_QM_CreateJobs(BPLib_Instance_t *inst, BPLib_Bundle_t *const *bundles, size_t NumBundles,
+                                   BPLib_QM_JobState_t state, BPLib_QM_Priority_t priority, int TimeoutMs,
+                                   size_t *NumCreated)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_QM_CreateJobs, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_QM_CreateJobs, BPLib_Instance_t *, inst);
+    UT_GenStub_AddParam(BPLib_QM_CreateJobs, BPLib_Bundle_t *const *, bundles);
+    UT_GenStub_AddParam(BPLib_QM_CreateJobs, size_t, NumBundles);
+    UT_GenStub_AddParam(BPLib_QM_CreateJobs, BPLib_QM_JobState_t, state);
+    UT_GenStub_AddParam(BPLib_QM_CreateJobs, BPLib_QM_Priority_t, priority);
+    UT_GenStub_AddParam(BPLib_QM_CreateJobs, int, TimeoutMs);
+    UT_GenStub_AddParam(BPLib_QM_CreateJobs, size_t *, NumCreated);
+
+    UT_GenStub_Execute(BPLib_QM_CreateJobs, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_QM_CreateJobs, BPLib_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_QM_DuctPull()
@@ -69,6 +93,29 @@ BPLib_Status_t BPLib_QM_DuctPull(BPLib_Instance_t *Inst, uint32_t EgressID, bool
     return UT_GenStub_GetReturnValue(BPLib_QM_DuctPull, BPLib_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_QM_DuctPullBatch()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_QM_DuctPullBatch(BPLib_Instance_t *Inst, uint32_t EgressID, bool LocalDelivery, int TimeoutMs,
+                                      BPLib_Bundle_t **RetBundles, size_t MaxBundles, size_t *NumPulled)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_QM_DuctPullBatch, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_QM_DuctPullBatch, BPLib_Instance_t *, Inst);
+    UT_GenStub_AddParam(BPLib_QM_DuctPullBatch, uint32_t, EgressID);
+    UT_GenStub_AddParam(BPLib_QM_DuctPullBatch, bool, LocalDelivery);
+    UT_GenStub_AddParam(BPLib_QM_DuctPullBatch, int, TimeoutMs);
+    UT_GenStub_AddParam(BPLib_QM_DuctPullBatch, BPLib_Bundle_t **, RetBundles);
+    UT_GenStub_AddParam(BPLib_QM_DuctPullBatch, size_t, MaxBundles);
+    UT_GenStub_AddParam(BPLib_QM_DuctPullBatch, size_t *, NumPulled);
+
+    UT_GenStub_Execute(BPLib_QM_DuctPullBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_QM_DuctPullBatch, BPLib_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_QM_IsDuctEmpty()
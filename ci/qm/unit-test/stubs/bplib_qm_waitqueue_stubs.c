@@ -75,6 +75,25 @@ bool BPLib_QM_WaitQueueTryPull(BPLib_QM_WaitQueue_t *q, void *ret_item, int time
     return UT_GenStub_GetReturnValue(BPLib_QM_WaitQueueTryPull, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_QM_WaitQueueTryPullMany()
+ * ----------------------------------------------------
+ */
+size_t BPLib_QM_WaitQueueTryPullMany(BPLib_QM_WaitQueue_t *q, void *ret_items, size_t max_items, int timeout_ms)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_QM_WaitQueueTryPullMany, size_t);
+
+    UT_GenStub_AddParam(BPLib_QM_WaitQueueTryPullMany, BPLib_QM_WaitQueue_t *, q);
+    UT_GenStub_AddParam(BPLib_QM_WaitQueueTryPullMany, void *, ret_items);
+    UT_GenStub_AddParam(BPLib_QM_WaitQueueTryPullMany, size_t, max_items);
+    UT_GenStub_AddParam(BPLib_QM_WaitQueueTryPullMany, int, timeout_ms);
+
+    UT_GenStub_Execute(BPLib_QM_WaitQueueTryPullMany, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_QM_WaitQueueTryPullMany, size_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_QM_WaitQueueTryPush()
@@ -92,3 +111,47 @@ bool BPLib_QM_WaitQueueTryPush(BPLib_QM_WaitQueue_t *q, const void *item, int ti
 
     return UT_GenStub_GetReturnValue(BPLib_QM_WaitQueueTryPush, bool);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_QM_WaitQueueTryPushMany()
+ * ----------------------------------------------------
+ */
+size_t BPLib_QM_WaitQueueTryPushMany(BPLib_QM_WaitQueue_t *q, const void *items, size_t count, int timeout_ms)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_QM_WaitQueueTryPushMany, size_t);
+
+    UT_GenStub_AddParam(BPLib_QM_WaitQueueTryPushMany, BPLib_QM_WaitQueue_t *, q);
+    UT_GenStub_AddParam(BPLib_QM_WaitQueueTryPushMany, const void *, items);
+    UT_GenStub_AddParam(BPLib_QM_WaitQueueTryPushMany, size_t, count);
+    UT_GenStub_AddParam(BPLib_QM_WaitQueueTryPushMany, int, timeout_ms);
+
+    UT_GenStub_Execute(BPLib_QM_WaitQueueTryPushMany, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_QM_WaitQueueTryPushMany, size_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_QM_WaitQueueWait()
+ * ----------------------------------------------------
+ */
+void BPLib_QM_WaitQueueWait(BPLib_QM_WaitQueue_t *q, int timeout_ms)
+{
+    UT_GenStub_AddParam(BPLib_QM_WaitQueueWait, BPLib_QM_WaitQueue_t *, q);
+    UT_GenStub_AddParam(BPLib_QM_WaitQueueWait, int, timeout_ms);
+
+    UT_GenStub_Execute(BPLib_QM_WaitQueueWait, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_QM_WaitQueueWake()
+ * ----------------------------------------------------
+ */
+void BPLib_QM_WaitQueueWake(BPLib_QM_WaitQueue_t *q)
+{
+    UT_GenStub_AddParam(BPLib_QM_WaitQueueWake, BPLib_QM_WaitQueue_t *, q);
+
+    UT_GenStub_Execute(BPLib_QM_WaitQueueWake, Basic, NULL);
+}
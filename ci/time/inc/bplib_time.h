@@ -33,6 +33,8 @@
 
 #include "bplib_api_types.h"
 
+#include <pthread.h>
+
 
 /*
 ** Macro Definitions
@@ -94,6 +96,24 @@ typedef struct
     uint32_t BootEra;                   /**< \brief Boot era that counter started from */
 } BPLib_TIME_MonotonicTime_t;
 
+/**
+**  \brief Token bucket rate shaper
+**
+**  \par Description
+**       Meters bytes against the monotonic clock at a rate given in bits per
+**       BPLIB_RATE_CYCLE_MS. Tokens may go negative; a shaped sender waits until the
+**       deficit has been paid back before sending again, so bundles larger than the
+**       bucket depth are never stalled forever.
+*/
+typedef struct
+{
+    uint64_t BitsPerCycle;              /**< \brief Configured rate, 0 when unshaped */
+    int64_t  Tokens;                    /**< \brief Available bits, negative when in deficit */
+    int64_t  BurstBits;                 /**< \brief Bucket depth in bits */
+    uint64_t Remainder;                 /**< \brief Fraction of a bit, in bit*msecs per cycle, not yet credited */
+    int64_t  LastTime;                  /**< \brief Monotonic time of the last refill (in msecs) */
+} BPLib_TIME_Shaper_t;
+
 
 /*
 ** Exported Functions
@@ -121,10 +141,14 @@ BPLib_Status_t BPLib_TIME_Init(void);
  * \brief Get Monotonic Time
  *
  *  \par Description
- *       Gets current monotonic time and boot era
+ *       Gets current monotonic time and boot era. Once calibrated, this reads a host clock
+ *       offset to match the BPA_TIMEP_GetMonotonicTime proxy instead of calling the proxy
+ *       (see BPLIB_TIME_FAST_CLOCK).
  *
  *  \par Assumptions, External Events, and Notes:
  *       - Time Management must already be initialized (see BPLib_TIME_Init)
+ *       - The fast clock is recalibrated during maintenance activities and may step by
+ *         more than BPLIB_TIME_FAST_CLOCK_RESOLUTION_MS if the proxy and host clock drift
  * 
  */
 int64_t  BPLib_TIME_GetMonotonicTime(void);
@@ -225,4 +249,82 @@ BPLib_Status_t BPLib_TIME_GetTimeDelta(BPLib_TIME_MonotonicTime_t Time1,
  */
 BPLib_Status_t BPLib_TIME_MaintenanceActivities(void);
 
+/**
+ * \brief Initialize Shaper
+ *
+ *  \par Description
+ *       Sets a shaper's rate and fills its bucket. The bucket is BPLIB_RATE_BURST_MS
+ *       worth of the rate deep.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] Shaper Shaper to initialize
+ *
+ *  \param[in] BitsPerCycle Rate in bits per BPLIB_RATE_CYCLE_MS, 0 disables shaping
+ *
+ *  \param[in] Now Current monotonic time (in msecs)
+ */
+void BPLib_TIME_ShaperInit(BPLib_TIME_Shaper_t *Shaper, uint64_t BitsPerCycle, int64_t Now);
+
+/**
+ * \brief Get Shaper Delay
+ *
+ *  \par Description
+ *       Credits the shaper with the tokens earned since it was last refilled and returns
+ *       how long a sender must wait before the shaper lets it send
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] Shaper Shaper to check
+ *
+ *  \param[in] Now Current monotonic time (in msecs)
+ *
+ *  \return Time to wait (in msecs), 0 if sending is allowed now
+ */
+int64_t BPLib_TIME_ShaperDelay(BPLib_TIME_Shaper_t *Shaper, int64_t Now);
+
+/**
+ * \brief Charge Shaper
+ *
+ *  \par Description
+ *       Takes the tokens for Bytes sent out of the shaper's bucket, possibly leaving it
+ *       in deficit
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] Shaper Shaper to charge
+ *
+ *  \param[in] Bytes Number of bytes sent
+ */
+void BPLib_TIME_ShaperConsume(BPLib_TIME_Shaper_t *Shaper, size_t Bytes);
+
+/**
+ * \brief Wait For Shaper
+ *
+ *  \par Description
+ *       Waits, for at most Timeout msecs, until the shaper lets a sender send
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       - Time Management must already be initialized (see BPLib_TIME_Init)
+ *       - Returns immediately for an unshaped or conforming shaper
+ *       - Timeout is reduced by the time spent waiting, so a caller that goes on to
+ *         pend on a queue with it stays within its original timeout
+ *       - Lock, when given, is the lock the caller holds while it initializes, checks or
+ *         charges the shaper. It is taken around each check here and not held while waiting.
+ *
+ *  \param[in] Shaper Shaper to wait for
+ *
+ *  \param[in] Lock Lock guarding the shaper, NULL if the shaper is only used from one thread
+ *
+ *  \param[in,out] Timeout Maximum time to wait (in msecs), set to the time left of it
+ *
+ *  \return Execution status
+ *  \retval BPLIB_SUCCESS The shaper allows sending
+ *  \retval BPLIB_TIMEOUT The shaper still did not allow sending after Timeout
+ */
+BPLib_Status_t BPLib_TIME_ShaperWait(BPLib_TIME_Shaper_t *Shaper, pthread_mutex_t *Lock, uint32_t *Timeout);
+
 #endif /* BPLIB_TIME_H */
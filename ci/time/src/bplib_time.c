@@ -67,6 +67,9 @@ BPLib_Status_t BPLib_TIME_Init(void) {
     /* Get the offset between the host epoch and the DTN epoch */
     BPLib_TIME_GlobalData.EpochOffset = BPLib_TIME_GetEpochOffset();
 
+    /* Correlate the host clock fast path against the monotonic time proxy */
+    BPLib_TIME_CalibrateFastClock();
+
     /* Read in initial time data from file */
     Status = BPLib_TIME_ReadTimeDataFromFile();
     if (Status == BPLIB_SUCCESS)
@@ -87,6 +90,14 @@ BPLib_Status_t BPLib_TIME_Init(void) {
 /* Get current monotonic time */
 int64_t BPLib_TIME_GetMonotonicTime(void)
 {
+    int64_t MonotonicTime;
+
+    /* Read the calibrated host clock directly when available */
+    if (BPLib_TIME_ReadFastClock(&MonotonicTime))
+    {
+        return MonotonicTime;
+    }
+
     return BPLib_FWP_ProxyCallbacks.BPA_TIMEP_GetMonotonicTime();
 }
 
@@ -173,7 +184,7 @@ uint64_t BPLib_TIME_GetCurrentDtnTime(void)
     }
     else
     {
-        return BPLib_FWP_ProxyCallbacks.BPA_TIMEP_GetMonotonicTime() + BPLib_TIME_GlobalData.CurrentCf;
+        return BPLib_TIME_GetMonotonicTime() + BPLib_TIME_GlobalData.CurrentCf;
     }
 }
 
@@ -226,6 +237,9 @@ BPLib_Status_t BPLib_TIME_MaintenanceActivities(void)
     int64_t        NewCf;
     int64_t        CurrMonotonicTime;
 
+    /* Correct any drift between the host clock and the monotonic time proxy */
+    BPLib_TIME_CalibrateFastClock();
+
     NewCf = BPLib_TIME_CalculateCorrelationFactor();
 
     /* If a valid CF was calculated */
@@ -246,3 +260,144 @@ BPLib_Status_t BPLib_TIME_MaintenanceActivities(void)
 
     return Status;
 }
+
+/* Credit a shaper with the tokens earned since its last refill */
+static void BPLib_TIME_ShaperRefill(BPLib_TIME_Shaper_t *Shaper, int64_t Now)
+{
+    uint64_t Elapsed;
+    uint64_t MaxElapsed;
+    uint64_t Earned;
+
+    /* Restart metering from Now if the clock was stepped back */
+    if (Now <= Shaper->LastTime)
+    {
+        Shaper->LastTime = Now;
+        return;
+    }
+
+    Elapsed = (uint64_t) (Now - Shaper->LastTime);
+    Shaper->LastTime = Now;
+
+    if (Shaper->Tokens >= Shaper->BurstBits)
+    {
+        return;
+    }
+
+    /* Never credit more time than it takes to fill the bucket, this also keeps long idle
+    ** periods from overflowing the product below
+    */
+    MaxElapsed = ((uint64_t) (Shaper->BurstBits - Shaper->Tokens) * BPLIB_RATE_CYCLE_MS) /
+                 Shaper->BitsPerCycle + 1;
+    if (Elapsed > MaxElapsed)
+    {
+        Elapsed = MaxElapsed;
+    }
+
+    /* Carry the fraction of a bit over so the long term rate is exact */
+    Earned = (Elapsed * Shaper->BitsPerCycle) + Shaper->Remainder;
+    Shaper->Tokens += (int64_t) (Earned / BPLIB_RATE_CYCLE_MS);
+    Shaper->Remainder = Earned % BPLIB_RATE_CYCLE_MS;
+
+    if (Shaper->Tokens >= Shaper->BurstBits)
+    {
+        Shaper->Tokens    = Shaper->BurstBits;
+        Shaper->Remainder = 0;
+    }
+}
+
+/* Initialize a rate shaper with a full bucket */
+void BPLib_TIME_ShaperInit(BPLib_TIME_Shaper_t *Shaper, uint64_t BitsPerCycle, int64_t Now)
+{
+    Shaper->BitsPerCycle = BitsPerCycle;
+    Shaper->BurstBits    = (int64_t) ((BitsPerCycle * BPLIB_RATE_BURST_MS) / BPLIB_RATE_CYCLE_MS);
+    Shaper->Tokens       = Shaper->BurstBits;
+    Shaper->Remainder    = 0;
+    Shaper->LastTime     = Now;
+}
+
+/* Get the time until a rate shaper allows sending */
+int64_t BPLib_TIME_ShaperDelay(BPLib_TIME_Shaper_t *Shaper, int64_t Now)
+{
+    uint64_t Needed;
+
+    if (Shaper->BitsPerCycle == 0)
+    {
+        return 0;
+    }
+
+    BPLib_TIME_ShaperRefill(Shaper, Now);
+    if (Shaper->Tokens >= 0)
+    {
+        return 0;
+    }
+
+    /* Bit*msecs still owed, rounded up to whole msecs at the configured rate */
+    Needed = ((uint64_t) (-Shaper->Tokens) * BPLIB_RATE_CYCLE_MS) - Shaper->Remainder;
+
+    return (int64_t) ((Needed + Shaper->BitsPerCycle - 1) / Shaper->BitsPerCycle);
+}
+
+/* Charge a rate shaper for bytes sent */
+void BPLib_TIME_ShaperConsume(BPLib_TIME_Shaper_t *Shaper, size_t Bytes)
+{
+    if (Shaper->BitsPerCycle != 0)
+    {
+        Shaper->Tokens -= (int64_t) Bytes * 8;
+    }
+}
+
+/* Check a rate shaper under the lock that guards it, if any */
+static int64_t BPLib_TIME_ShaperDelayLocked(BPLib_TIME_Shaper_t *Shaper, pthread_mutex_t *Lock, int64_t Now)
+{
+    int64_t Delay;
+
+    if (Lock != NULL)
+    {
+        pthread_mutex_lock(Lock);
+    }
+
+    Delay = BPLib_TIME_ShaperDelay(Shaper, Now);
+
+    if (Lock != NULL)
+    {
+        pthread_mutex_unlock(Lock);
+    }
+
+    return Delay;
+}
+
+/* Wait until a rate shaper allows sending */
+BPLib_Status_t BPLib_TIME_ShaperWait(BPLib_TIME_Shaper_t *Shaper, pthread_mutex_t *Lock, uint32_t *Timeout)
+{
+    int64_t Start;
+    int64_t Now;
+    int64_t Delay;
+
+    Start = BPLib_TIME_GetMonotonicTime();
+    Delay = BPLib_TIME_ShaperDelayLocked(Shaper, Lock, Start);
+    if (Delay == 0)
+    {
+        return BPLIB_SUCCESS;
+    }
+
+    /* Sleep no longer than the caller can wait, then see whether that was enough */
+    if (*Timeout > 0)
+    {
+        (void) OS_TaskDelay((Delay < (int64_t) *Timeout) ? (uint32_t) Delay : *Timeout);
+    }
+
+    Now   = BPLib_TIME_GetMonotonicTime();
+    Delay = BPLib_TIME_ShaperDelayLocked(Shaper, Lock, Now);
+
+    /* Leave the caller only what is left of its timeout */
+    if (Now - Start >= (int64_t) *Timeout)
+    {
+        *Timeout = 0;
+    }
+    else if (Now > Start)
+    {
+        *Timeout -= (uint32_t) (Now - Start);
+    }
+
+    return (Delay == 0) ? BPLIB_SUCCESS : BPLIB_TIMEOUT;
+}
@@ -338,3 +338,124 @@ int64_t BPLib_TIME_GetEpochOffset(void)
 
     return EpochOffset;
 }
+
+#ifdef BPLIB_TIME_FAST_CLOCK_ENABLED
+/* Read a host clock in milliseconds, returns -1 if the clock cannot be read */
+static int64_t BPLib_TIME_ReadHostClock(int ClockId)
+{
+    struct timespec Ts;
+
+    if (clock_gettime((clockid_t) ClockId, &Ts) != 0)
+    {
+        return -1;
+    }
+
+    return ((int64_t) Ts.tv_sec * BPLIB_TIME_SECOND_IN_MSEC) + ((int64_t) Ts.tv_nsec / 1000000);
+}
+#endif
+
+/* Measure the offset between the monotonic time proxy and the host clock */
+void BPLib_TIME_CalibrateFastClock(void)
+{
+#ifdef BPLIB_TIME_FAST_CLOCK_ENABLED
+    clockid_t ClockId;
+    int64_t   Before;
+    int64_t   After;
+    int64_t   ProxyTime;
+    int64_t   Offset;
+    int64_t   Delta;
+
+    /* Pick the host clock once, the coarse clock is cheaper if its resolution is enough */
+    if (!__atomic_load_n(&BPLib_TIME_GlobalData.FastClockValid, __ATOMIC_ACQUIRE))
+    {
+        ClockId = CLOCK_MONOTONIC;
+
+#ifdef CLOCK_MONOTONIC_COARSE
+        {
+            struct timespec Res;
+
+            if (clock_getres(CLOCK_MONOTONIC_COARSE, &Res) == 0 && Res.tv_sec == 0 &&
+                Res.tv_nsec <= (long) BPLIB_TIME_FAST_CLOCK_RESOLUTION_MS * 1000000L)
+            {
+                ClockId = CLOCK_MONOTONIC_COARSE;
+            }
+        }
+#endif
+
+        BPLib_TIME_GlobalData.FastClockId = (int) ClockId;
+
+        if (BPLib_TIME_GlobalData.FastClockRead == NULL)
+        {
+            BPLib_TIME_GlobalData.FastClockRead = BPLib_TIME_ReadHostClock;
+        }
+    }
+
+    ClockId = (clockid_t) BPLib_TIME_GlobalData.FastClockId;
+
+    /* Bracket the proxy call with host clock reads and correlate against the midpoint */
+    Before    = BPLib_TIME_GlobalData.FastClockRead((int) ClockId);
+    ProxyTime = BPLib_FWP_ProxyCallbacks.BPA_TIMEP_GetMonotonicTime();
+    After     = BPLib_TIME_GlobalData.FastClockRead((int) ClockId);
+
+    if (Before < 0 || After < 0)
+    {
+        __atomic_store_n(&BPLib_TIME_GlobalData.FastClockValid, false, __ATOMIC_RELEASE);
+        return;
+    }
+
+    Offset = ProxyTime - (Before + ((After - Before) / 2));
+
+    /* Ignore drift within the clock resolution so the fast clock doesn't jitter */
+    if (__atomic_load_n(&BPLib_TIME_GlobalData.FastClockValid, __ATOMIC_ACQUIRE))
+    {
+        Delta = Offset - __atomic_load_n(&BPLib_TIME_GlobalData.FastClockOffset, __ATOMIC_RELAXED);
+
+        if (Delta >= -BPLIB_TIME_FAST_CLOCK_RESOLUTION_MS && Delta <= BPLIB_TIME_FAST_CLOCK_RESOLUTION_MS)
+        {
+            return;
+        }
+    }
+
+    __atomic_store_n(&BPLib_TIME_GlobalData.FastClockOffset, Offset, __ATOMIC_RELAXED);
+    __atomic_store_n(&BPLib_TIME_GlobalData.FastClockValid, true, __ATOMIC_RELEASE);
+#endif
+}
+
+/* Read the calibrated host clock */
+bool BPLib_TIME_ReadFastClock(int64_t *MonotonicTime)
+{
+#ifdef BPLIB_TIME_FAST_CLOCK_ENABLED
+    int64_t HostTime;
+    int64_t Time;
+    int64_t Last;
+
+    if (__atomic_load_n(&BPLib_TIME_GlobalData.FastClockValid, __ATOMIC_ACQUIRE))
+    {
+        HostTime = BPLib_TIME_GlobalData.FastClockRead(BPLib_TIME_GlobalData.FastClockId);
+
+        if (HostTime >= 0)
+        {
+            Time = HostTime + __atomic_load_n(&BPLib_TIME_GlobalData.FastClockOffset, __ATOMIC_RELAXED);
+
+            /* Hold at the latest time handed out rather than step back after a recalibration */
+            Last = __atomic_load_n(&BPLib_TIME_GlobalData.FastClockLast, __ATOMIC_RELAXED);
+            do
+            {
+                if (Time <= Last)
+                {
+                    Time = Last;
+                    break;
+                }
+            } while (!__atomic_compare_exchange_n(&BPLib_TIME_GlobalData.FastClockLast, &Last, Time, true,
+                                                  __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+            *MonotonicTime = Time;
+            return true;
+        }
+    }
+#else
+    (void) MonotonicTime;
+#endif
+
+    return false;
+}
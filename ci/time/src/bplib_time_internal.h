@@ -35,6 +35,14 @@
 #include "bplib_fwp.h"
 #include "osapi.h"
 
+#include <time.h>
+
+/*
+** The host clock fast path needs clock_gettime and a monotonic clock
+*/
+#if (BPLIB_TIME_FAST_CLOCK == 1) && defined(CLOCK_MONOTONIC)
+#define BPLIB_TIME_FAST_CLOCK_ENABLED
+#endif
 
 /*
 ** Macro Definitions
@@ -92,6 +100,11 @@ typedef struct
     osal_id_t FileHandle;               /**< \brief OSAL handle for time data file */
     BPLib_TIME_InitState_t InitState;   /**< \brief Initialization state of TIME */
     BPLib_TIME_FileData_t TimeData;     /**< \brief Local copy of time file data */
+    int64_t   FastClockOffset;          /**< \brief Proxy monotonic time minus host clock time */
+    int64_t   FastClockLast;            /**< \brief Latest time read from the fast path */
+    int64_t (*FastClockRead)(int ClockId); /**< \brief Host clock reader, defaults to clock_gettime */
+    int       FastClockId;              /**< \brief Host clock used for the fast path */
+    bool      FastClockValid;           /**< \brief Fast path has been calibrated */
 } BPLib_TIME_GlobalData_t;
 
 
@@ -256,4 +269,37 @@ int64_t BPLib_TIME_SafeOffset(int64_t HostEpoch, int64_t DtnEpoch, int64_t Multi
  */
 int64_t BPLib_TIME_GetEpochOffset(void);
 
+/**
+ * \brief Calibrate Fast Clock
+ *
+ *  \par Description
+ *       Measures the offset between the BPA_TIMEP_GetMonotonicTime proxy and a host clock
+ *       so BPLib_TIME_GetMonotonicTime can read the host clock directly. The host clock
+ *       is sampled on both sides of the proxy call and the midpoint is used. On the first
+ *       calibration the coarse host clock is selected if its resolution is within
+ *       BPLIB_TIME_FAST_CLOCK_RESOLUTION_MS.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Offset changes within BPLIB_TIME_FAST_CLOCK_RESOLUTION_MS are ignored so repeated
+ *       calibration does not jitter the clock. This is a no-op when the fast clock is
+ *       disabled or unavailable.
+ */
+void BPLib_TIME_CalibrateFastClock(void);
+
+/**
+ * \brief Read Fast Clock
+ *
+ *  \par Description
+ *       Reads the calibrated host clock in milliseconds
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A recalibration can move the offset back. The time returned never goes below the
+ *       latest time already returned, it holds there until the host clock catches up.
+ *
+ *  \param[out] MonotonicTime Monotonic time, valid only when true is returned
+ *
+ *  \return Whether the fast clock is calibrated and could be read
+ */
+bool BPLib_TIME_ReadFastClock(int64_t *MonotonicTime);
+
 #endif /* BPLIB_TIME_INTERNAL_H */
@@ -508,6 +508,105 @@ void Test_BPLib_TIME_GetEpochOffset_EqualEpochs(void)
     UtAssert_EQ(int64_t, ExpEpochOffset, BPLib_TIME_GetEpochOffset());
 }
 
+/* Test that the fast clock is not used before it has been calibrated */
+void Test_BPLib_TIME_ReadFastClock_Uncalibrated(void)
+{
+    int64_t MonotonicTime = 0;
+
+    UtAssert_BOOL_FALSE(BPLib_TIME_ReadFastClock(&MonotonicTime));
+    UtAssert_EQ(int64_t, MonotonicTime, 0);
+}
+
+#ifdef BPLIB_TIME_FAST_CLOCK_ENABLED
+
+/* Test that the calibrated fast clock tracks the monotonic time proxy */
+void Test_BPLib_TIME_CalibrateFastClock_Nominal(void)
+{
+    int64_t TestMonotonicTime = 1000000;
+    int64_t MonotonicTime = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPA_TIMEP_GetMonotonicTime), TestMonotonicTime);
+
+    BPLib_TIME_CalibrateFastClock();
+
+    UtAssert_BOOL_TRUE(BPLib_TIME_GlobalData.FastClockValid);
+    UtAssert_EQ(int64_t, BPLib_TIME_GlobalData.FastClockOffset, TestMonotonicTime - TestHostClockTime);
+    UtAssert_BOOL_TRUE(BPLib_TIME_ReadFastClock(&MonotonicTime));
+    UtAssert_STUB_COUNT(BPA_TIMEP_GetMonotonicTime, 1);
+    UtAssert_EQ(int64_t, MonotonicTime, TestMonotonicTime);
+
+    TestHostClockTime += 250;
+    UtAssert_BOOL_TRUE(BPLib_TIME_ReadFastClock(&MonotonicTime));
+    UtAssert_EQ(int64_t, MonotonicTime, TestMonotonicTime + 250);
+}
+
+/* Test that the fast clock is not used when the host clock cannot be read */
+void Test_BPLib_TIME_CalibrateFastClock_HostClockErr(void)
+{
+    int64_t MonotonicTime = 0;
+
+    TestHostClockTime = -1;
+    BPLib_TIME_CalibrateFastClock();
+
+    UtAssert_BOOL_FALSE(BPLib_TIME_GlobalData.FastClockValid);
+    UtAssert_BOOL_FALSE(BPLib_TIME_ReadFastClock(&MonotonicTime));
+}
+
+/* Test that recalibration ignores small offset changes and applies large ones */
+void Test_BPLib_TIME_CalibrateFastClock_Recalibrate(void)
+{
+    int64_t TestMonotonicTime = 1000000;
+    int64_t TestStep = 1000;
+    int64_t Offset;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPA_TIMEP_GetMonotonicTime), TestMonotonicTime);
+    BPLib_TIME_CalibrateFastClock();
+    Offset = BPLib_TIME_GlobalData.FastClockOffset;
+
+    /* Offset changes within the clock resolution are ignored */
+    UT_SetDefaultReturnValue(UT_KEY(BPA_TIMEP_GetMonotonicTime),
+                             TestMonotonicTime + BPLIB_TIME_FAST_CLOCK_RESOLUTION_MS);
+    BPLib_TIME_CalibrateFastClock();
+    UtAssert_EQ(int64_t, BPLib_TIME_GlobalData.FastClockOffset, Offset);
+
+    /* Larger changes are applied */
+    UT_SetDefaultReturnValue(UT_KEY(BPA_TIMEP_GetMonotonicTime), TestMonotonicTime + TestStep);
+    BPLib_TIME_CalibrateFastClock();
+    UtAssert_EQ(int64_t, BPLib_TIME_GlobalData.FastClockOffset, Offset + TestStep);
+}
+
+/* Test that a recalibration stepping the offset back does not make the fast clock go backwards */
+void Test_BPLib_TIME_ReadFastClock_StepBack(void)
+{
+    int64_t TestMonotonicTime = 1000000;
+    int64_t TestStep = 1000;
+    int64_t MonotonicTime = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPA_TIMEP_GetMonotonicTime), TestMonotonicTime);
+    BPLib_TIME_CalibrateFastClock();
+    UtAssert_BOOL_TRUE(BPLib_TIME_ReadFastClock(&MonotonicTime));
+    UtAssert_EQ(int64_t, MonotonicTime, TestMonotonicTime);
+
+    /* The proxy is now behind the fast clock */
+    UT_SetDefaultReturnValue(UT_KEY(BPA_TIMEP_GetMonotonicTime), TestMonotonicTime - TestStep);
+    BPLib_TIME_CalibrateFastClock();
+    UtAssert_EQ(int64_t, BPLib_TIME_GlobalData.FastClockOffset, TestMonotonicTime - TestStep - TestHostClockTime);
+
+    /* The fast clock holds until the host clock catches up */
+    UtAssert_BOOL_TRUE(BPLib_TIME_ReadFastClock(&MonotonicTime));
+    UtAssert_EQ(int64_t, MonotonicTime, TestMonotonicTime);
+
+    TestHostClockTime += TestStep;
+    UtAssert_BOOL_TRUE(BPLib_TIME_ReadFastClock(&MonotonicTime));
+    UtAssert_EQ(int64_t, MonotonicTime, TestMonotonicTime);
+
+    TestHostClockTime += 10;
+    UtAssert_BOOL_TRUE(BPLib_TIME_ReadFastClock(&MonotonicTime));
+    UtAssert_EQ(int64_t, MonotonicTime, TestMonotonicTime + 10);
+}
+
+#endif /* BPLIB_TIME_FAST_CLOCK_ENABLED */
+
 void TestBplibTimeInternal_Register(void)
 {
     ADD_TEST(Test_BPLib_TIME_GetCfFromBuffer_Nominal);
@@ -551,4 +650,12 @@ void TestBplibTimeInternal_Register(void)
     ADD_TEST(Test_BPLib_TIME_GetEpochOffset_HostGthDtn);
     ADD_TEST(Test_BPLib_TIME_GetEpochOffset_HostLthDtn);
     ADD_TEST(Test_BPLib_TIME_GetEpochOffset_EqualEpochs);
+
+    ADD_TEST(Test_BPLib_TIME_ReadFastClock_Uncalibrated);
+#ifdef BPLIB_TIME_FAST_CLOCK_ENABLED
+    ADD_TEST(Test_BPLib_TIME_CalibrateFastClock_Nominal);
+    ADD_TEST(Test_BPLib_TIME_CalibrateFastClock_HostClockErr);
+    ADD_TEST(Test_BPLib_TIME_CalibrateFastClock_Recalibrate);
+    ADD_TEST(Test_BPLib_TIME_ReadFastClock_StepBack);
+#endif
 }
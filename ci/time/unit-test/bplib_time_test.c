@@ -133,6 +133,27 @@ void Test_BPLib_TIME_GetMonotonicTime_Nominal(void)
     UtAssert_EQ(int64_t, BPLib_TIME_GetMonotonicTime(), TestMonotonicTime);
 }
 
+#ifdef BPLIB_TIME_FAST_CLOCK_ENABLED
+/* Test that monotonic time is read from the host clock once it has been calibrated */
+void Test_BPLib_TIME_GetMonotonicTime_FastClock(void)
+{
+    int64_t TestMonotonicTime = 1234;
+    int64_t MonotonicTime;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPA_TIMEP_GetMonotonicTime), TestMonotonicTime);
+    BPLib_TIME_CalibrateFastClock();
+
+    MonotonicTime = BPLib_TIME_GetMonotonicTime();
+    UtAssert_EQ(int64_t, MonotonicTime, TestMonotonicTime);
+
+    TestHostClockTime += 10;
+    MonotonicTime = BPLib_TIME_GetMonotonicTime();
+    UtAssert_EQ(int64_t, MonotonicTime, TestMonotonicTime + 10);
+
+    UtAssert_STUB_COUNT(BPA_TIMEP_GetMonotonicTime, 1);
+}
+#endif
+
 /* Test that a positive CF is returned */
 void Test_BPLib_TIME_CalculateCorrelationFactor_NominalPos(void)
 {
@@ -449,6 +470,191 @@ void Test_BPLib_TIME_MaintenanceActivities_NewCf(void)
     UtAssert_STUB_COUNT(OS_write, 1);
 }
 
+/* Test that an unshaped rate shaper never delays */
+void Test_BPLib_TIME_ShaperDelay_Unshaped(void)
+{
+    BPLib_TIME_Shaper_t Shaper;
+
+    BPLib_TIME_ShaperInit(&Shaper, 0, 0);
+    BPLib_TIME_ShaperConsume(&Shaper, 100000);
+
+    UtAssert_EQ(int64_t, BPLib_TIME_ShaperDelay(&Shaper, 0), 0);
+}
+
+/* Test that a rate shaper in deficit delays until the deficit is paid back */
+void Test_BPLib_TIME_ShaperDelay_Deficit(void)
+{
+    BPLib_TIME_Shaper_t Shaper;
+
+    /* 1000 bytes per cycle, with a full bucket of 800 bits */
+    BPLib_TIME_ShaperInit(&Shaper, 8000, 0);
+    UtAssert_EQ(int64_t, BPLib_TIME_ShaperDelay(&Shaper, 0), 0);
+
+    BPLib_TIME_ShaperConsume(&Shaper, 1000);
+    UtAssert_EQ(int64_t, Shaper.Tokens, 800 - 8000);
+    UtAssert_EQ(int64_t, BPLib_TIME_ShaperDelay(&Shaper, 0), 900);
+    UtAssert_EQ(int64_t, BPLib_TIME_ShaperDelay(&Shaper, 450), 450);
+    UtAssert_EQ(int64_t, BPLib_TIME_ShaperDelay(&Shaper, 900), 0);
+    UtAssert_EQ(int64_t, Shaper.Tokens, 0);
+}
+
+/* Test that fractions of a bit are carried over so slow rates are exact */
+void Test_BPLib_TIME_ShaperDelay_Remainder(void)
+{
+    BPLib_TIME_Shaper_t Shaper;
+    int64_t Now;
+
+    /* 3 bits per cycle leaves an empty bucket, 8 bits take 2666.67 msecs */
+    BPLib_TIME_ShaperInit(&Shaper, 3, 0);
+    BPLib_TIME_ShaperConsume(&Shaper, 1);
+    UtAssert_EQ(int64_t, BPLib_TIME_ShaperDelay(&Shaper, 0), 2667);
+
+    for (Now = 1; Now < 2667; Now++)
+    {
+        if (BPLib_TIME_ShaperDelay(&Shaper, Now) != 2667 - Now)
+        {
+            break;
+        }
+    }
+
+    UtAssert_EQ(int64_t, Now, 2667);
+    UtAssert_EQ(int64_t, BPLib_TIME_ShaperDelay(&Shaper, 2667), 0);
+}
+
+/* Test that an idle rate shaper only saves up a burst's worth of tokens */
+void Test_BPLib_TIME_ShaperDelay_Burst(void)
+{
+    BPLib_TIME_Shaper_t Shaper;
+
+    BPLib_TIME_ShaperInit(&Shaper, 8000, 0);
+    BPLib_TIME_ShaperConsume(&Shaper, 10);
+    UtAssert_EQ(int64_t, BPLib_TIME_ShaperDelay(&Shaper, 1000000000), 0);
+    UtAssert_EQ(int64_t, Shaper.Tokens, 800);
+
+    BPLib_TIME_ShaperConsume(&Shaper, 200);
+    UtAssert_EQ(int64_t, BPLib_TIME_ShaperDelay(&Shaper, 1000000000), 100);
+}
+
+/* Test that a rate shaper earns nothing when the clock steps back */
+void Test_BPLib_TIME_ShaperDelay_ClockStep(void)
+{
+    BPLib_TIME_Shaper_t Shaper;
+
+    BPLib_TIME_ShaperInit(&Shaper, 8000, 1000);
+    BPLib_TIME_ShaperConsume(&Shaper, 100);
+    UtAssert_EQ(int64_t, BPLib_TIME_ShaperDelay(&Shaper, 500), 0);
+    UtAssert_EQ(int64_t, Shaper.Tokens, 0);
+    UtAssert_EQ(int64_t, Shaper.LastTime, 500);
+}
+
+/* Test that waiting on a conforming rate shaper returns immediately */
+void Test_BPLib_TIME_ShaperWait_Conforming(void)
+{
+    BPLib_TIME_Shaper_t Shaper;
+    uint32_t Timeout = 1000;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPA_TIMEP_GetMonotonicTime), 0);
+
+    BPLib_TIME_ShaperInit(&Shaper, 8000, 0);
+
+    UtAssert_INT32_EQ(BPLib_TIME_ShaperWait(&Shaper, NULL, &Timeout), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+    UtAssert_UINT32_EQ(Timeout, 1000);
+}
+
+/* Test that waiting on a rate shaper in deficit sleeps off the deficit */
+void Test_BPLib_TIME_ShaperWait_Deficit(void)
+{
+    BPLib_TIME_Shaper_t Shaper;
+    uint32_t Timeout = 2000;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPA_TIMEP_GetMonotonicTime), 0);
+
+    BPLib_TIME_ShaperInit(&Shaper, 8000, 0);
+    BPLib_TIME_ShaperConsume(&Shaper, 1000);
+
+    /* The deficit is gone once the shaper is checked again after the sleep */
+    UT_SetDeferredRetcode(UT_KEY(BPA_TIMEP_GetMonotonicTime), 2, 1000);
+
+    UtAssert_INT32_EQ(BPLib_TIME_ShaperWait(&Shaper, NULL, &Timeout), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_UINT32_EQ(Timeout, 1000);
+}
+
+/* Test that waiting on a rate shaper times out when the deficit outlasts the wait */
+void Test_BPLib_TIME_ShaperWait_Timeout(void)
+{
+    BPLib_TIME_Shaper_t Shaper;
+    uint32_t Timeout = 100;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPA_TIMEP_GetMonotonicTime), 0);
+
+    BPLib_TIME_ShaperInit(&Shaper, 8000, 0);
+    BPLib_TIME_ShaperConsume(&Shaper, 1000);
+
+    /* Sleeps no longer than the timeout, and leaves none of it */
+    UT_SetDeferredRetcode(UT_KEY(BPA_TIMEP_GetMonotonicTime), 2, 100);
+
+    UtAssert_INT32_EQ(BPLib_TIME_ShaperWait(&Shaper, NULL, &Timeout), BPLIB_TIMEOUT);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_UINT32_EQ(Timeout, 0);
+
+    /* Polling never sleeps */
+    UtAssert_INT32_EQ(BPLib_TIME_ShaperWait(&Shaper, NULL, &Timeout), BPLIB_TIMEOUT);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+}
+
+/* Test that a wait cut short by the timeout still succeeds if the rate allows sending by then */
+void Test_BPLib_TIME_ShaperWait_Recheck(void)
+{
+    BPLib_TIME_Shaper_t Shaper;
+    uint32_t Timeout = 500;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPA_TIMEP_GetMonotonicTime), 0);
+
+    BPLib_TIME_ShaperInit(&Shaper, 8000, 0);
+    BPLib_TIME_ShaperConsume(&Shaper, 1000);
+
+    /* The sleep overran enough for the deficit to be paid off */
+    UT_SetDeferredRetcode(UT_KEY(BPA_TIMEP_GetMonotonicTime), 2, 1000);
+
+    UtAssert_INT32_EQ(BPLib_TIME_ShaperWait(&Shaper, NULL, &Timeout), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_UINT32_EQ(Timeout, 0);
+}
+
+static pthread_mutex_t Test_ShaperLock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Handler that checks the shaper's lock is free while sleeping */
+static void UT_Handler_OS_TaskDelay_LockFree(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UtAssert_INT32_EQ(pthread_mutex_trylock(&Test_ShaperLock), 0);
+    pthread_mutex_unlock(&Test_ShaperLock);
+}
+
+/* Test that waiting on a rate shaper with a lock does not hold the lock while sleeping */
+void Test_BPLib_TIME_ShaperWait_Locked(void)
+{
+    BPLib_TIME_Shaper_t Shaper;
+    uint32_t Timeout = 2000;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPA_TIMEP_GetMonotonicTime), 0);
+    UT_SetHandlerFunction(UT_KEY(OS_TaskDelay), UT_Handler_OS_TaskDelay_LockFree, NULL);
+
+    BPLib_TIME_ShaperInit(&Shaper, 8000, 0);
+    BPLib_TIME_ShaperConsume(&Shaper, 1000);
+
+    UT_SetDeferredRetcode(UT_KEY(BPA_TIMEP_GetMonotonicTime), 2, 1000);
+
+    UtAssert_INT32_EQ(BPLib_TIME_ShaperWait(&Shaper, &Test_ShaperLock, &Timeout), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_UINT32_EQ(Timeout, 1000);
+
+    /* The lock is released on return */
+    UtAssert_INT32_EQ(pthread_mutex_trylock(&Test_ShaperLock), 0);
+    pthread_mutex_unlock(&Test_ShaperLock);
+}
+
 void TestBplibTime_Register(void)
 {
     ADD_TEST(Test_BPLib_TIME_Init_Nominal);
@@ -459,6 +665,9 @@ void TestBplibTime_Register(void)
     ADD_TEST(Test_BPLib_TIME_Init_FailedRead);
 
     ADD_TEST(Test_BPLib_TIME_GetMonotonicTime_Nominal);
+#ifdef BPLIB_TIME_FAST_CLOCK_ENABLED
+    ADD_TEST(Test_BPLib_TIME_GetMonotonicTime_FastClock);
+#endif
 
     ADD_TEST(Test_BPLib_TIME_CalculateCorrelationFactor_NominalPos);
     ADD_TEST(Test_BPLib_TIME_CalculateCorrelationFactor_NominalNeg);
@@ -481,4 +690,15 @@ void TestBplibTime_Register(void)
 
     ADD_TEST(Test_BPLib_TIME_MaintenanceActivities_ZeroCf);
     ADD_TEST(Test_BPLib_TIME_MaintenanceActivities_NewCf);
+
+    ADD_TEST(Test_BPLib_TIME_ShaperDelay_Unshaped);
+    ADD_TEST(Test_BPLib_TIME_ShaperDelay_Deficit);
+    ADD_TEST(Test_BPLib_TIME_ShaperDelay_Remainder);
+    ADD_TEST(Test_BPLib_TIME_ShaperDelay_Burst);
+    ADD_TEST(Test_BPLib_TIME_ShaperDelay_ClockStep);
+    ADD_TEST(Test_BPLib_TIME_ShaperWait_Conforming);
+    ADD_TEST(Test_BPLib_TIME_ShaperWait_Deficit);
+    ADD_TEST(Test_BPLib_TIME_ShaperWait_Timeout);
+    ADD_TEST(Test_BPLib_TIME_ShaperWait_Recheck);
+    ADD_TEST(Test_BPLib_TIME_ShaperWait_Locked);
 }
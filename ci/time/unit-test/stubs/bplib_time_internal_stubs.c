@@ -27,6 +27,16 @@
 #include "bplib_time_internal.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_TIME_CalibrateFastClock()
+ * ----------------------------------------------------
+ */
+void BPLib_TIME_CalibrateFastClock(void)
+{
+    UT_GenStub_Execute(BPLib_TIME_CalibrateFastClock, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_TIME_GetCfFromBuffer()
@@ -89,6 +99,22 @@ uint64_t BPLib_TIME_GetEstimatedDtnTime(BPLib_TIME_MonotonicTime_t MonotonicTime
     return UT_GenStub_GetReturnValue(BPLib_TIME_GetEstimatedDtnTime, uint64_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_TIME_ReadFastClock()
+ * ----------------------------------------------------
+ */
+bool BPLib_TIME_ReadFastClock(int64_t *MonotonicTime)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_TIME_ReadFastClock, bool);
+
+    UT_GenStub_AddParam(BPLib_TIME_ReadFastClock, int64_t *, MonotonicTime);
+
+    UT_GenStub_Execute(BPLib_TIME_ReadFastClock, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_TIME_ReadFastClock, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_TIME_ReadTimeDataFromFile()
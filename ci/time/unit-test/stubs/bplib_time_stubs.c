@@ -159,3 +159,65 @@ BPLib_Status_t BPLib_TIME_MaintenanceActivities(void)
 
     return UT_GenStub_GetReturnValue(BPLib_TIME_MaintenanceActivities, BPLib_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_TIME_ShaperConsume()
+ * ----------------------------------------------------
+ */
+void BPLib_TIME_ShaperConsume(BPLib_TIME_Shaper_t *Shaper, size_t Bytes)
+{
+    UT_GenStub_AddParam(BPLib_TIME_ShaperConsume, BPLib_TIME_Shaper_t *, Shaper);
+    UT_GenStub_AddParam(BPLib_TIME_ShaperConsume, size_t, Bytes);
+
+    UT_GenStub_Execute(BPLib_TIME_ShaperConsume, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_TIME_ShaperDelay()
+ * ----------------------------------------------------
+ */
+int64_t BPLib_TIME_ShaperDelay(BPLib_TIME_Shaper_t *Shaper, int64_t Now)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_TIME_ShaperDelay, int64_t);
+
+    UT_GenStub_AddParam(BPLib_TIME_ShaperDelay, BPLib_TIME_Shaper_t *, Shaper);
+    UT_GenStub_AddParam(BPLib_TIME_ShaperDelay, int64_t, Now);
+
+    UT_GenStub_Execute(BPLib_TIME_ShaperDelay, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_TIME_ShaperDelay, int64_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_TIME_ShaperInit()
+ * ----------------------------------------------------
+ */
+void BPLib_TIME_ShaperInit(BPLib_TIME_Shaper_t *Shaper, uint64_t BitsPerCycle, int64_t Now)
+{
+    UT_GenStub_AddParam(BPLib_TIME_ShaperInit, BPLib_TIME_Shaper_t *, Shaper);
+    UT_GenStub_AddParam(BPLib_TIME_ShaperInit, uint64_t, BitsPerCycle);
+    UT_GenStub_AddParam(BPLib_TIME_ShaperInit, int64_t, Now);
+
+    UT_GenStub_Execute(BPLib_TIME_ShaperInit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_TIME_ShaperWait()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_TIME_ShaperWait(BPLib_TIME_Shaper_t *Shaper, pthread_mutex_t *Lock, uint32_t *Timeout)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_TIME_ShaperWait, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_TIME_ShaperWait, BPLib_TIME_Shaper_t *, Shaper);
+    UT_GenStub_AddParam(BPLib_TIME_ShaperWait, pthread_mutex_t *, Lock);
+    UT_GenStub_AddParam(BPLib_TIME_ShaperWait, uint32_t *, Timeout);
+
+    UT_GenStub_Execute(BPLib_TIME_ShaperWait, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_TIME_ShaperWait, BPLib_Status_t);
+}
@@ -29,6 +29,7 @@
 */
 
 uint16_t TestEpochYear;
+int64_t  TestHostClockTime;
 
 
 /*
@@ -49,6 +50,12 @@ void UT_BPA_TIMEP_GetHostEpoch_Handler(void *UserObj, UT_EntryKey_t FuncKey,
     Epoch->Day = 1;
 }
 
+/* Host clock the fast clock reads in place of clock_gettime */
+int64_t UT_BPLib_TIME_ReadHostClock(int ClockId)
+{
+    return TestHostClockTime;
+}
+
 void BPLib_TIME_Test_Setup(void)
 {
     /* Initialize test environment to default state for every test */
@@ -69,6 +76,10 @@ void BPLib_TIME_Test_Setup(void)
     /* Default host epoch is 1970 */
     TestEpochYear = 1970;
 
+    /* Read the host clock from the test */
+    TestHostClockTime = 5000;
+    BPLib_TIME_GlobalData.FastClockRead = UT_BPLib_TIME_ReadHostClock;
+
     UT_SetHandlerFunction(UT_KEY(BPA_TIMEP_GetHostEpoch), 
                                 UT_BPA_TIMEP_GetHostEpoch_Handler, NULL);
 
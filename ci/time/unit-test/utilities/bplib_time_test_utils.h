@@ -40,6 +40,7 @@
 */
 
 extern uint16_t TestEpochYear;
+extern int64_t  TestHostClockTime;
 
 /*
 ** Macro Definitions
@@ -52,6 +53,8 @@ extern uint16_t TestEpochYear;
 ** Function Definitions
 */
 
+int64_t UT_BPLib_TIME_ReadHostClock(int ClockId);
+
 void BPLib_TIME_Test_Setup(void);
 void BPLib_TIME_Test_Teardown(void);
 
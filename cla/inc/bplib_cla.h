@@ -34,6 +34,38 @@
 #include "bplib_qm.h"
 #include "bplib_em.h"
 
+/* ======= */
+/* Defines */
+/* ======= */
+
+#if BPLIB_MAX_CONTACT_DEST_EIDS <= BPLIB_EID_PATTERN_SET_MAX
+
+/**
+ * \brief Contacts whose destination EID patterns are compiled into one pattern set
+ */
+#define BPLIB_CLA_ROUTE_SET_CONTACTS (BPLIB_EID_PATTERN_SET_MAX / BPLIB_MAX_CONTACT_DEST_EIDS)
+
+/**
+ * \brief Bits of a BPLib_CLA_FindContactRoutes mask that belong to a contact
+ */
+#define BPLIB_CLA_CONTACT_ROUTE_MASK(ContactId)                                            \
+    ((UINT64_MAX >> (BPLIB_EID_PATTERN_SET_MAX - BPLIB_MAX_CONTACT_DEST_EIDS))            \
+     << (((ContactId) % BPLIB_CLA_ROUTE_SET_CONTACTS) * BPLIB_MAX_CONTACT_DEST_EIDS))
+
+#else
+
+/* A contact's patterns do not fit in a pattern set, so each contact is matched on its own */
+#define BPLIB_CLA_ROUTE_SET_CONTACTS            1
+#define BPLIB_CLA_CONTACT_ROUTE_MASK(ContactId) ((uint64_t) 1)
+
+#endif
+
+/**
+ * \brief Compiled pattern sets needed to cover every contact
+ */
+#define BPLIB_CLA_NUM_ROUTE_SETS \
+    ((BPLIB_MAX_NUM_CONTACTS + BPLIB_CLA_ROUTE_SET_CONTACTS - 1) / BPLIB_CLA_ROUTE_SET_CONTACTS)
+
 /* ======== */
 /* Typedefs */
 /* ======== */
@@ -92,6 +124,7 @@ typedef struct
 
     size_t              IngressBitsPerCycle;
     size_t              EgressBitsPerCycle;
+    size_t              EgressMtu;          /* Largest encoded bundle sent whole, 0 if only the CL's buffer limits it */
   } BPLib_CLA_ContactsSet_t;
 
 typedef struct
@@ -99,6 +132,35 @@ typedef struct
     BPLib_CLA_ContactsSet_t ContactSet[BPLIB_MAX_NUM_CONTACTS];
 } BPLib_CLA_ContactsTable_t;
 
+/**
+ * \brief Contact plan window, a planned span of DTN time during which a contact is up
+ */
+typedef struct
+{
+    uint32_t            ContactId;          /* Contact from the Contacts Configuration */
+    uint64_t            StartTime;          /* DTN time the window opens (ms) */
+    uint64_t            EndTime;            /* DTN time the window closes (ms), 0 if the window is unused */
+    size_t              EgressBitsPerCycle; /* Egress rate during the window, 0 keeps the contact's rate */
+} BPLib_CLA_ContactWindow_t;
+
+/**
+ * \brief Contact Plan Configuration
+ */
+typedef struct
+{
+    BPLib_CLA_ContactWindow_t Windows[BPLIB_MAX_NUM_CONTACT_WINDOWS];
+} BPLib_CLA_ContactPlanTable_t;
+
+/**
+ * \brief Span of DTN time and rate a contact is known to be sending at
+ */
+typedef struct
+{
+    uint64_t            StartTime;          /* DTN time sending starts (ms), 0 if not planned */
+    uint64_t            EndTime;            /* DTN time sending stops (ms), 0 if not planned */
+    uint64_t            BitsPerCycle;       /* Egress rate in bits per BPLIB_RATE_CYCLE_MS, 0 if unshaped */
+} BPLib_CLA_EgressWindow_t;
+
 /* =================== */
 /* Function Prototypes */
 /* =================== */
@@ -122,10 +184,40 @@ typedef struct
  *
  *  \return Execution status
  *  \retval BPLIB_SUCCESS when BPLib_CLA_Ingress was successful
+ *  \retval BPLIB_MEM_POOL_CONGESTED when the bundle was shed because the memory pool
+ *          is above its high watermark; the CL should slow down
  */
 BPLib_Status_t BPLib_CLA_Ingress(BPLib_Instance_t* Inst, uint32_t ContId,
                                     const void *Bundle, size_t Size, uint32_t Timeout);
 
+/**
+ * \brief CLA Batch Ingress function
+ *
+ *  \par Description
+ *       Receive several bundles from CL and pass them to Bundle Interface together, so a
+ *       CL that reads many datagrams per wakeup queues them under one lock acquisition
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Control messages in the batch are processed in place. Each bundle is accepted or
+ *       rejected on its own, as if it had been passed to BPLib_CLA_Ingress, except that
+ *       memory pool congestion is only checked once for the whole batch.
+ *
+ *  \param[in] Inst Pointer to a valid BPLib_Instance_t
+ *  \param[in] ContId Contact ID
+ *  \param[in] Bundles Array of pointers to the bundles to ingress
+ *  \param[in] Sizes Array of sizes of the bundles to ingress
+ *  \param[in] NumBundles Number of bundles in the batch
+ *  \param[out] NumAccepted Number of bundles and control messages accepted
+ *
+ *  \return Execution status
+ *  \retval BPLIB_SUCCESS when every bundle in the batch was accepted
+ *  \retval BPLIB_MEM_POOL_CONGESTED when the batch was shed because the memory pool
+ *          is above its high watermark; the CL should slow down
+ *  \retval Other The status of the last bundle that was rejected
+ */
+BPLib_Status_t BPLib_CLA_IngressBatch(BPLib_Instance_t* Inst, uint32_t ContId, const void *const Bundles[],
+                                      const size_t Sizes[], uint32_t NumBundles, uint32_t *NumAccepted);
+
 /**
  * \brief CLA Egress function
  *
@@ -133,7 +225,13 @@ BPLib_Status_t BPLib_CLA_Ingress(BPLib_Instance_t* Inst, uint32_t ContId,
  *       Receive bundle from Bundle Interface and send it to CL
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       A contact with a nonzero EgressBitsPerCycle is shaped to that rate: once it has
+ *       sent more than its rate allows, this waits for up to Timeout for the rate to catch
+ *       up before pulling a bundle.
+ *
+ *       A bundle larger than BufLen, or than the contact's EgressMtu, is sent as fragments
+ *       unless it must not be fragmented. Each call returns the next fragment, and the
+ *       fragments of one bundle go out before any other bundle on the contact.
  *
  *  \param[in] Inst Pointer to a valid BPLib_Instance_t
  *  \param[in] ContId Contact ID
@@ -148,6 +246,44 @@ BPLib_Status_t BPLib_CLA_Ingress(BPLib_Instance_t* Inst, uint32_t ContId,
 BPLib_Status_t BPLib_CLA_Egress(BPLib_Instance_t* Inst, uint32_t ContId, void *BundleOut,
                                 size_t *Size, size_t BufLen, uint32_t Timeout);
 
+/**
+ * \brief CLA Batch Egress function
+ *
+ *  \par Description
+ *       Receive several bundles from Bundle Interface at once and pack them back to back
+ *       into one CL buffer, so a CL that sends many bundles per wakeup (sendmmsg, link
+ *       frames carrying several bundles) pulls them under one queue lock acquisition
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Bundle i starts at the sum of Sizes[0] through Sizes[i - 1]. BufLen is the byte
+ *       budget for the batch: a pulled bundle that does not fit in the rest of the buffer
+ *       is held back, along with any bundles after it, and egressed first by the next
+ *       BPLib_CLA_Egress or BPLib_CLA_EgressBatch call on the contact. A bundle that does
+ *       not fit in an empty buffer, or is larger than the contact's EgressMtu, is packed
+ *       as fragments, each taking its own Sizes entry; fragments that do not fit go out
+ *       first in the next call. A bundle that must not be fragmented and does not fit
+ *       is dropped, as BPLib_CLA_Egress would drop it. At most QM_MAX_JOB_BATCH bundles
+ *       are egressed per call. A shaped contact waits for its egress rate like
+ *       BPLib_CLA_Egress does and holds back the rest of the batch once the bundles packed
+ *       so far use up the rate.
+ *
+ *  \param[in] Inst Pointer to a valid BPLib_Instance_t
+ *  \param[in] ContId Contact ID
+ *  \param[in] BundlesOut Buffer to pack the egressing bundles into
+ *  \param[in] BufLen Length of BundlesOut, in bytes
+ *  \param[out] Sizes Array with room for MaxBundles sizes of the egressed bundles
+ *  \param[in] MaxBundles Maximum number of bundles to egress
+ *  \param[out] NumBundles Number of bundles egressed
+ *  \param[in] Timeout Time to pend on contact egress queue for the first bundle (in milliseconds)
+ *
+ *  \return Execution status
+ *  \retval BPLIB_SUCCESS when at least one bundle was egressed
+ *  \retval BPLIB_CLA_TIMEOUT when no bundle was available before the timeout
+ *  \retval Other The status of the last bundle dropped when none was egressed
+ */
+BPLib_Status_t BPLib_CLA_EgressBatch(BPLib_Instance_t* Inst, uint32_t ContId, void *BundlesOut, size_t BufLen,
+                                     size_t Sizes[], uint32_t MaxBundles, uint32_t *NumBundles, uint32_t Timeout);
+
 /**
  * \brief Validate Contacts Configuration
  *
@@ -168,7 +304,7 @@ BPLib_Status_t BPLib_CLA_ContactsTblValidateFunc(void *TblData);
 
 /**
  * \brief     Find the requested contact ID in the Contacts Configuration and pass that information to the
- *            CLA proxy to configure the CLA with
+ *            CLA proxy to configure the CLA with. The contact's egress is shaped to its EgressBitsPerCycle.
  * \param[in] ContactId (uint32_t) Contact ID from the Contacts Configuration to setup
  * \return    Execution status
  * \retval    BPLIB_SUCCESS: Successful execution
@@ -231,4 +367,102 @@ BPLib_Status_t BPLib_CLA_ContactTeardown(BPLib_Instance_t *Inst, uint32_t Contac
   */
 BPLib_Status_t BPLib_CLA_GetContactRunState(uint32_t ContactId, BPLib_CLA_ContactRunState_t* ReturnState);
 
+/**
+  * \brief      Rebuild the compiled contact routes
+  * \details    Compiles the destination EID patterns of every BPLIB_CLA_ROUTE_SET_CONTACTS
+  *             contacts into one pattern set so routing can match a destination against
+  *             all of them at once
+  * \note       The caller must hold the NC lock. NC calls this at initialization and every
+  *             time a new contacts table is loaded. When a single contact's patterns do
+  *             not fit in a pattern set, nothing is compiled and routing matches the
+  *             patterns one at a time.
+  */
+void BPLib_CLA_RefreshRoutes(void);
+
+/**
+  * \brief      Find the contact destination EID patterns that match an EID
+  * \param[in]  DestEID   (const BPLib_EID_t*) Destination EID to route
+  * \param[in]  ContactId (uint32_t) Any contact in the route set to match against
+  * \return     Matches for every contact in the same route set as ContactId, test a
+  *             contact's bits with BPLIB_CLA_CONTACT_ROUTE_MASK. 0 for an invalid contact.
+  * \note       The caller must hold the NC reader lock
+  */
+uint64_t BPLib_CLA_FindContactRoutes(const BPLib_EID_t* DestEID, uint32_t ContactId);
+
+/**
+ * \brief Validate Contact Plan Configuration
+ *
+ *  \par Description
+ *       Validate contact plan windows. Every window in use must name a valid contact and
+ *       end after it starts, and windows of the same contact must not overlap.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       - This function is called by whatever external task handles table management.
+ *         Every time a new Contact Plan Configuration is loaded, this function should be
+ *         called to validate its parameters.
+ *
+ *  \param[in] TblData Pointer to the config table
+ *
+ *  \return Execution status
+ *  \retval BPLIB_SUCCESS Validation was successful
+ *  \retval BPLIB_INVALID_CONFIG_ERR A window is invalid
+ */
+BPLib_Status_t BPLib_CLA_ContactPlanTblValidateFunc(void *TblData);
+
+/**
+  * \brief      Restart contact plan scheduling
+  * \details    Makes BPLib_CLA_ProcessContactPlan schedule every window of the contact plan
+  *             afresh. Windows that are already over are skipped, windows in progress are opened.
+  * \note       The caller must hold the NC lock. NC calls this every time a new contact plan
+  *             table is loaded.
+  */
+void BPLib_CLA_RefreshContactPlan(void);
+
+/**
+ * \brief Process Contact Plan
+ *
+ *  \par Description
+ *       Runs the contact plan against the current DTN time:
+ *       - BPLIB_CLA_PLAN_PRELOAD_MS before a window opens, its contact is set up and its
+ *         egress queue is preloaded from storage. The preloaded bundles stay queued until
+ *         the window opens.
+ *       - When the window opens, the contact is started at the window's egress rate
+ *       - When the window closes, the contact is stopped and torn down, returning any
+ *         bundles that did not go out to storage
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       - This should be called periodically, at least as often as the preload lead time.
+ *         A window only acts on its contact when it moves from one of these steps to the
+ *         next, so directives sent in between are not undone.
+ *       - Nothing is scheduled while DTN time is unavailable or no contact plan is loaded
+ *
+ *  \param[in] Inst Pointer to a valid BPLib_Instance_t
+ *
+ *  \return Execution status
+ *  \retval BPLIB_SUCCESS The contact plan was processed
+ *  \retval BPLIB_NULL_PTR_ERROR Inst is NULL
+ */
+BPLib_Status_t BPLib_CLA_ProcessContactPlan(BPLib_Instance_t *Inst);
+
+/**
+ * \brief Get Egress Window
+ *
+ *  \par Description
+ *       Gets the span of DTN time and the rate the contact will be sending at, so storage
+ *       can leave out bundles the contact has no time to send
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The span is only known while a contact plan window for the contact is preloading
+ *       or open. The rate is known once the contact has been set up.
+ *
+ *  \param[in] ContactId ID of the contact
+ *  \param[out] Window Span and rate of the contact
+ *
+ *  \return Execution status
+ *  \retval BPLIB_SUCCESS The window was returned
+ *  \retval BPLIB_NULL_PTR_ERROR Window is NULL
+ *  \retval BPLIB_INVALID_CONT_ID_ERR ContactId is out of range
+ */
+BPLib_Status_t BPLib_CLA_GetEgressWindow(uint32_t ContactId, BPLib_CLA_EgressWindow_t *Window);
+
 #endif /* BPLIB_CLA_H */
@@ -28,6 +28,10 @@
 #include "bplib_fwp.h"
 #include "bplib_nc.h"
 #include "bplib_stor.h"
+#include "bplib_pl.h"
+#include "bplib_time.h"
+
+#include <pthread.h>
 
 /* =========== */
 /* Global Data */
@@ -35,6 +39,394 @@
 
 volatile BPLib_CLA_ContactRunState_t BPLib_CLA_ContactRunStates[BPLIB_MAX_NUM_CONTACTS];
 
+/* Destination EID patterns of every contact, compiled for routing */
+#if BPLIB_MAX_CONTACT_DEST_EIDS <= BPLIB_EID_PATTERN_SET_MAX
+static BPLib_EID_PatternSet_t BPLib_CLA_ContactRoutes[BPLIB_CLA_NUM_ROUTE_SETS];
+#endif
+
+/* Bundles BPLib_CLA_EgressBatch pulled but had no room for. They are egressed, in order,
+** before anything else is pulled from the contact's duct.
+*/
+static BPLib_Bundle_t *BPLib_CLA_HeldBundles[BPLIB_MAX_NUM_CONTACTS][QM_MAX_JOB_BATCH];
+static uint32_t        BPLib_CLA_NumHeld[BPLIB_MAX_NUM_CONTACTS];
+
+/* Guards each contact's held and fragmenting bundles against teardown from another thread. Egress only lets
+** go of it while pulling from the duct. Teardown bumps the generation so an egress call that
+** pulled while it ran returns what it would otherwise hold back to storage.
+*/
+static pthread_mutex_t BPLib_CLA_EgressLocks[BPLIB_MAX_NUM_CONTACTS];
+static pthread_once_t  BPLib_CLA_EgressLocksOnce = PTHREAD_ONCE_INIT;
+static uint32_t        BPLib_CLA_EgressGenerations[BPLIB_MAX_NUM_CONTACTS];
+
+/* Bundle each contact is part way through sending as fragments, and how much of its payload
+** has gone out. Its remaining fragments are egressed before anything else.
+*/
+static BPLib_Bundle_t *BPLib_CLA_FragBundles[BPLIB_MAX_NUM_CONTACTS];
+static size_t          BPLib_CLA_FragOffsets[BPLIB_MAX_NUM_CONTACTS];
+
+/* Largest encoded bundle each contact sends whole, set up from EgressMtu */
+static size_t          BPLib_CLA_EgressMtus[BPLIB_MAX_NUM_CONTACTS];
+
+/* Egress rate of each contact, set up from EgressBitsPerCycle */
+static BPLib_TIME_Shaper_t BPLib_CLA_EgressShapers[BPLIB_MAX_NUM_CONTACTS];
+
+/* Progress of each contact plan window. The generation is bumped whenever a new plan is
+** loaded so the scheduler starts the new plan's windows afresh.
+*/
+static BPLib_CLA_WindowState_t BPLib_CLA_WindowStates[BPLIB_MAX_NUM_CONTACT_WINDOWS];
+static BPLib_CLA_ContactWindow_t BPLib_CLA_ScheduledWindows[BPLIB_MAX_NUM_CONTACT_WINDOWS];
+static uint32_t                BPLib_CLA_PlanGeneration;
+static uint32_t                BPLib_CLA_ScheduledGeneration;
+
+/* Span and rate each contact is known to be sending at, read by storage to pick what it loads */
+static BPLib_CLA_EgressWindow_t BPLib_CLA_EgressWindows[BPLIB_MAX_NUM_CONTACTS];
+static pthread_mutex_t          BPLib_CLA_EgressWindowsLock = PTHREAD_MUTEX_INITIALIZER;
+
+/* ================ */
+/* Static Functions */
+/* ================ */
+
+/* Room a bundle may take in the CL's buffer: the space left, capped at the contact's MTU */
+static size_t BPLib_CLA_EgressRoom(uint32_t ContId, size_t Space)
+{
+    if ((BPLib_CLA_EgressMtus[ContId] != 0) && (BPLib_CLA_EgressMtus[ContId] < Space))
+    {
+        return BPLib_CLA_EgressMtus[ContId];
+    }
+
+    return Space;
+}
+
+/* Whether a bundle too large to send whole may be sent as fragments */
+static bool BPLib_CLA_CanFragment(const BPLib_Bundle_t *Bundle)
+{
+    return !(Bundle->blocks.PrimaryBlock.BundleProcFlags & BPLIB_BUNDLE_PROC_NO_FRAG_FLAG) &&
+           (Bundle->blocks.PayloadHeader.DataSize > 1);
+}
+
+/* Encode a pulled bundle into the CL's buffer, counting it as forwarded and charging the
+** contact's egress rate if it fits
+*/
+static BPLib_Status_t BPLib_CLA_EncodeOut(uint32_t ContId, BPLib_Bundle_t *Bundle, void *BundleOut,
+                                         size_t BufLen, size_t *Size)
+{
+    BPLib_Status_t Status;
+
+    Status = BPLib_BI_BlobCopyOut(Bundle, BundleOut, BPLib_CLA_EgressRoom(ContId, BufLen), Size);
+    if (Status == BPLIB_SUCCESS)
+    {
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_FORWARDED, 1);
+        BPLib_AS_IncrementSlot(BPLib_AS_ResolveSourceSlot(&Bundle->blocks.PrimaryBlock.SrcEID),
+                               BUNDLE_COUNT_FORWARDED, 1);
+        BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_EGRESS, ContId, *Size);
+        BPLib_TIME_ShaperConsume(&BPLib_CLA_EgressShapers[ContId], *Size);
+    }
+
+    return Status;
+}
+
+/* Trace a bundle leaving the BPA and free its blocks */
+static void BPLib_CLA_ReleaseOut(BPLib_Instance_t *Inst, uint32_t ContId, BPLib_Bundle_t *Bundle)
+{
+    BPLIB_PL_TRACE_BUNDLE(BPLIB_PL_TRACE_CLA_EGRESS, Bundle, 0, (int32_t) ContId);
+
+    BPLib_MEM_BundleFree(&Inst->pool, Bundle);
+}
+
+/* Start sending a bundle that does not fit whole as fragments */
+static void BPLib_CLA_StartFragmenting(uint32_t ContId, BPLib_Bundle_t *Bundle)
+{
+    BPLib_CLA_FragBundles[ContId] = Bundle;
+    BPLib_CLA_FragOffsets[ContId] = 0;
+
+    BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_FRAGMENTED, 1);
+}
+
+/* Pack fragments of the bundle the contact is fragmenting at Offset in the CL's buffer, one per
+** Sizes entry, until the bundle is done, the batch or buffer is full or the contact has used
+** up its egress rate. The bundle is counted as forwarded and freed once its last fragment is
+** out. If not even a fragment fits in an empty buffer the bundle is dropped.
+*/
+static BPLib_Status_t BPLib_CLA_FragmentOut(BPLib_Instance_t *Inst, uint32_t ContId, uint8_t *BundlesOut,
+                                           size_t BufLen, size_t *Offset, size_t Sizes[], uint32_t MaxBundles,
+                                           uint32_t *NumBundles, int64_t Now)
+{
+    BPLib_Bundle_t *Bundle = BPLib_CLA_FragBundles[ContId];
+    BPLib_Status_t  Status;
+    size_t          PayloadBytes;
+
+    while ((Bundle != NULL) && (*NumBundles < MaxBundles))
+    {
+        Status = BPLib_BI_FragmentCopyOut(Bundle, BPLib_CLA_FragOffsets[ContId], BundlesOut + *Offset,
+                                          BPLib_CLA_EgressRoom(ContId, BufLen - *Offset),
+                                          &Sizes[*NumBundles], &PayloadBytes);
+        if (Status != BPLIB_SUCCESS)
+        {
+            if (*NumBundles > 0)
+            {
+                /* No room left, the rest of the fragments start the next batch */
+                break;
+            }
+
+            BPLib_CLA_FragBundles[ContId] = NULL;
+            BPLib_CLA_ReleaseOut(Inst, ContId, Bundle);
+            return Status;
+        }
+
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_GENERATED_FRAGMENT, 1);
+        BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_EGRESS, ContId, Sizes[*NumBundles]);
+        BPLib_TIME_ShaperConsume(&BPLib_CLA_EgressShapers[ContId], Sizes[*NumBundles]);
+
+        *Offset += Sizes[*NumBundles];
+        (*NumBundles)++;
+
+        BPLib_CLA_FragOffsets[ContId] += PayloadBytes;
+        if (BPLib_CLA_FragOffsets[ContId] >= Bundle->blocks.PayloadHeader.DataSize)
+        {
+            BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_FORWARDED, 1);
+            BPLib_AS_IncrementSlot(BPLib_AS_ResolveSourceSlot(&Bundle->blocks.PrimaryBlock.SrcEID),
+                                   BUNDLE_COUNT_FORWARDED, 1);
+
+            BPLib_CLA_FragBundles[ContId] = NULL;
+            BPLib_CLA_ReleaseOut(Inst, ContId, Bundle);
+            Bundle = NULL;
+        }
+
+        if (BPLib_TIME_ShaperDelay(&BPLib_CLA_EgressShapers[ContId], Now) > 0)
+        {
+            break;
+        }
+    }
+
+    return BPLIB_SUCCESS;
+}
+
+/* Push a bundle that will not be egressed on this contact back into storage */
+static void BPLib_CLA_ReturnToStorage(BPLib_Instance_t *Inst, uint32_t ContactId, BPLib_Bundle_t *Bundle)
+{
+    BPLib_Status_t Status;
+
+    Status = BPLib_STOR_StoreBundle(Inst, Bundle);
+
+    if (Status != BPLIB_SUCCESS)
+    {
+        BPLib_EM_SendEvent(BPLIB_CLA_REMOVE_QUEUE_FLUSH_DGB_EID, BPLib_EM_EventType_DEBUG,
+                            "Contact with ID #%d failed to push a bundle back to storage, Status = %d",
+                            ContactId, Status);
+
+        /* Bundle is effectively getting dropped */
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DELETED, 1);
+        BPLib_AS_IncrementSlot(BPLIB_AS_NODE_CNTR_INDICATOR, BUNDLE_COUNT_DISCARDED, 1);
+
+        /* This is still considered a successful contact-teardown, just with some bundle loss */
+    }
+}
+
+static void BPLib_CLA_InitEgressLocks(void)
+{
+    uint32_t ContId;
+
+    for (ContId = 0; ContId < BPLIB_MAX_NUM_CONTACTS; ContId++)
+    {
+        pthread_mutex_init(&BPLib_CLA_EgressLocks[ContId], NULL);
+    }
+}
+
+/* Get a contact's egress lock, which also guards the contact's egress shaper */
+static pthread_mutex_t *BPLib_CLA_EgressLock(uint32_t ContId)
+{
+    (void) pthread_once(&BPLib_CLA_EgressLocksOnce, BPLib_CLA_InitEgressLocks);
+
+    return &BPLib_CLA_EgressLocks[ContId];
+}
+
+/* Take a contact's egress lock, returning the contact's teardown generation */
+static uint32_t BPLib_CLA_LockEgress(uint32_t ContId)
+{
+    pthread_mutex_lock(BPLib_CLA_EgressLock(ContId));
+
+    return BPLib_CLA_EgressGenerations[ContId];
+}
+
+/* Take the oldest bundle held back by BPLib_CLA_EgressBatch, if there is one */
+static BPLib_Bundle_t *BPLib_CLA_TakeHeld(uint32_t ContId)
+{
+    BPLib_Bundle_t *Bundle;
+
+    if (BPLib_CLA_NumHeld[ContId] == 0)
+    {
+        return NULL;
+    }
+
+    Bundle = BPLib_CLA_HeldBundles[ContId][0];
+    BPLib_CLA_NumHeld[ContId]--;
+    memmove(&BPLib_CLA_HeldBundles[ContId][0], &BPLib_CLA_HeldBundles[ContId][1],
+            BPLib_CLA_NumHeld[ContId] * sizeof(BPLib_Bundle_t *));
+
+    return Bundle;
+}
+
+/* Return a contact's bundle being fragmented and its held bundles to storage, under its egress lock.
+** Fragments already sent are not sent again, the bundle goes back as the fragment holding the rest.
+*/
+static void BPLib_CLA_ReturnEgressState(BPLib_Instance_t *Inst, uint32_t ContId)
+{
+    BPLib_Bundle_t *Bundle;
+
+    if (BPLib_CLA_FragBundles[ContId] != NULL)
+    {
+        if (BPLib_CLA_FragOffsets[ContId] > 0)
+        {
+            /* The offset is always short of the payload's end while the bundle is held */
+            (void) BPLib_BI_FragmentTrim(BPLib_CLA_FragBundles[ContId], BPLib_CLA_FragOffsets[ContId]);
+        }
+
+        BPLib_CLA_ReturnToStorage(Inst, ContId, BPLib_CLA_FragBundles[ContId]);
+        BPLib_CLA_FragBundles[ContId] = NULL;
+    }
+    while ((Bundle = BPLib_CLA_TakeHeld(ContId)) != NULL)
+    {
+        BPLib_CLA_ReturnToStorage(Inst, ContId, Bundle);
+    }
+}
+
+/* Let go of a contact's egress lock. If the contact was torn down since Generation, what
+** the egress call left held or part way fragmented is returned to storage instead.
+*/
+static void BPLib_CLA_UnlockEgress(BPLib_Instance_t *Inst, uint32_t ContId, uint32_t Generation)
+{
+    if (Generation != BPLib_CLA_EgressGenerations[ContId])
+    {
+        BPLib_CLA_ReturnEgressState(Inst, ContId);
+    }
+
+    pthread_mutex_unlock(&BPLib_CLA_EgressLocks[ContId]);
+}
+
+
+/* Record the span and rate a contact will be sending at */
+static void BPLib_CLA_SetEgressWindow(uint32_t ContId, uint64_t StartTime, uint64_t EndTime, uint64_t BitsPerCycle)
+{
+    pthread_mutex_lock(&BPLib_CLA_EgressWindowsLock);
+    BPLib_CLA_EgressWindows[ContId].StartTime    = StartTime;
+    BPLib_CLA_EgressWindows[ContId].EndTime      = EndTime;
+    BPLib_CLA_EgressWindows[ContId].BitsPerCycle = BitsPerCycle;
+    pthread_mutex_unlock(&BPLib_CLA_EgressWindowsLock);
+}
+
+/* Set a planned contact up ahead of its window and warm its duct from storage */
+static void BPLib_CLA_PreloadWindow(BPLib_Instance_t *Inst, const BPLib_CLA_ContactWindow_t *Window)
+{
+    uint32_t ContId = Window->ContactId;
+    size_t   NumLoaded;
+    uint32_t Step;
+
+    if (BPLib_CLA_ContactRunStates[ContId] == BPLIB_CLA_TORNDOWN)
+    {
+        (void) BPLib_CLA_ContactSetup(ContId);
+    }
+
+    /* Storage only preloads what the window has time to send */
+    BPLib_CLA_SetEgressWindow(ContId, Window->StartTime, Window->EndTime,
+                              (Window->EgressBitsPerCycle != 0) ? Window->EgressBitsPerCycle :
+                                                                  BPLib_CLA_EgressShapers[ContId].BitsPerCycle);
+
+    /* Only a contact that is set up but not started holds on to what is preloaded */
+    if (BPLib_CLA_ContactRunStates[ContId] != BPLIB_CLA_SETUP)
+    {
+        return;
+    }
+
+    /* Storage finds the contact's bundles on one call and loads them on the next */
+    for (Step = 0; Step < 2; Step++)
+    {
+        NumLoaded = 0;
+        if ((BPLib_STOR_EgressForID(Inst, ContId, false, &NumLoaded) != BPLIB_SUCCESS) || (NumLoaded > 0))
+        {
+            break;
+        }
+    }
+}
+
+/* Start a planned contact at the window's rate */
+static void BPLib_CLA_OpenWindow(BPLib_Instance_t *Inst, const BPLib_CLA_ContactWindow_t *Window)
+{
+    uint32_t       ContId = Window->ContactId;
+    BPLib_Status_t Status = BPLIB_SUCCESS;
+    uint64_t       BitsPerCycle;
+
+    if (BPLib_CLA_ContactRunStates[ContId] == BPLIB_CLA_TORNDOWN)
+    {
+        Status = BPLib_CLA_ContactSetup(ContId);
+    }
+
+    if (Status == BPLIB_SUCCESS)
+    {
+        (void) BPLib_CLA_LockEgress(ContId);
+
+        if (Window->EgressBitsPerCycle != 0)
+        {
+            BPLib_TIME_ShaperInit(&BPLib_CLA_EgressShapers[ContId], Window->EgressBitsPerCycle,
+                                  BPLib_TIME_GetMonotonicTime());
+        }
+
+        BitsPerCycle = BPLib_CLA_EgressShapers[ContId].BitsPerCycle;
+        pthread_mutex_unlock(&BPLib_CLA_EgressLocks[ContId]);
+
+        BPLib_CLA_SetEgressWindow(ContId, Window->StartTime, Window->EndTime, BitsPerCycle);
+
+        Status = BPLib_CLA_ContactStart(ContId);
+    }
+
+    if (Status == BPLIB_SUCCESS)
+    {
+        /* Let the CL pick up the preloaded bundles without waiting out its timeout */
+        BPLib_QM_WaitQueueWake(&Inst->ContactEgressJobs[ContId]);
+
+        BPLib_EM_SendEvent(BPLIB_CLA_PLAN_WINDOW_INF_EID, BPLib_EM_EventType_INFORMATION,
+                            "Contact plan started contact #%d", ContId);
+    }
+    else
+    {
+        BPLib_EM_SendEvent(BPLIB_CLA_PLAN_WINDOW_ERR_EID, BPLib_EM_EventType_ERROR,
+                            "Contact plan failed to start contact #%d, Status = %d", ContId, Status);
+    }
+}
+
+/* Stop and tear down a planned contact, returning what it did not send to storage */
+static void BPLib_CLA_CloseWindow(BPLib_Instance_t *Inst, const BPLib_CLA_ContactWindow_t *Window)
+{
+    uint32_t       ContId = Window->ContactId;
+    BPLib_Status_t Status = BPLIB_SUCCESS;
+
+    /* Once the window is over the contact's span is no longer known */
+    BPLib_CLA_SetEgressWindow(ContId, 0, 0, BPLib_CLA_EgressShapers[ContId].BitsPerCycle);
+
+    if (BPLib_CLA_ContactRunStates[ContId] == BPLIB_CLA_STARTED)
+    {
+        Status = BPLib_CLA_ContactStop(ContId);
+    }
+
+    /* This runs alongside the CL egress task. Teardown takes the contact's egress lock to
+    ** return what egress holds back or is fragmenting to storage, and does not wait on a pull.
+    */
+    if (Status == BPLIB_SUCCESS)
+    {
+        Status = BPLib_CLA_ContactTeardown(Inst, ContId);
+    }
+
+    if (Status == BPLIB_SUCCESS)
+    {
+        BPLib_EM_SendEvent(BPLIB_CLA_PLAN_WINDOW_INF_EID, BPLib_EM_EventType_INFORMATION,
+                            "Contact plan stopped contact #%d", ContId);
+    }
+    else
+    {
+        BPLib_EM_SendEvent(BPLIB_CLA_PLAN_WINDOW_ERR_EID, BPLib_EM_EventType_ERROR,
+                            "Contact plan failed to stop contact #%d, Status = %d", ContId, Status);
+    }
+}
+
 /* ==================== */
 /* Function Definitions */
 /* ==================== */
@@ -42,6 +434,7 @@ volatile BPLib_CLA_ContactRunState_t BPLib_CLA_ContactRunStates[BPLIB_MAX_NUM_CO
 /* BPLib_CLA_Ingress - Received candidate bundles from CL */
 BPLib_Status_t BPLib_CLA_Ingress(BPLib_Instance_t* Inst, uint32_t ContId, const void *Bundle, size_t Size, uint32_t Timeout)
 {
+    BPLib_Status_t Status;
 
     if ((Inst == NULL) || (Bundle == NULL))
     {
@@ -61,13 +454,120 @@ BPLib_Status_t BPLib_CLA_Ingress(BPLib_Instance_t* Inst, uint32_t ContId, const
         return BPLIB_SUCCESS;
     }
     else
-    {        
-        /* Receive a RFC 9171 bundle and pass it to BI */
-        /* Note: An argument can be made to simply implement RecvFullBundleIn here
-        * and do away with BI_RecvFullBundleIn()
+    {
+        BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_INGRESS, ContId, Size);
+
+        /* Shed new bundles early while the pool is above its high watermark */
+        if (BPLib_MEM_PoolIsCongested(&Inst->pool))
+        {
+            Status = BPLIB_MEM_POOL_CONGESTED;
+        }
+        else
+        {
+            /* Receive a RFC 9171 bundle and pass it to BI */
+            /* Note: An argument can be made to simply implement RecvFullBundleIn here
+            * and do away with BI_RecvFullBundleIn()
+            */
+            Status = BPLib_BI_RecvFullBundleIn(Inst, Bundle, Size, ContId);
+        }
+
+        if (Status != BPLIB_SUCCESS)
+        {
+            BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_INGRESS_REJECTED, ContId, Size);
+        }
+
+        return Status;
+    }
+}
+
+/* BPLib_CLA_IngressBatch - Received several candidate bundles from CL at once */
+BPLib_Status_t BPLib_CLA_IngressBatch(BPLib_Instance_t* Inst, uint32_t ContId, const void *const Bundles[],
+                                      const size_t Sizes[], uint32_t NumBundles, uint32_t *NumAccepted)
+{
+    BPLib_Status_t Status;
+    BPLib_Status_t BundleStatus[QM_MAX_JOB_BATCH];
+    const void    *Pending[QM_MAX_JOB_BATCH];
+    size_t         PendingSizes[QM_MAX_JOB_BATCH];
+    uint32_t       NumPending;
+    uint32_t       Next;
+    uint32_t       i;
+    bool           Congested;
+
+    if ((Inst == NULL) || (Bundles == NULL) || (Sizes == NULL) || (NumAccepted == NULL))
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    *NumAccepted = 0;
+    if (ContId >= BPLIB_MAX_NUM_CONTACTS)
+    {
+        return BPLIB_INVALID_CONT_ID_ERR;
+    }
+
+    /* The whole batch is shed if the pool is above its high watermark when it arrives */
+    Congested = BPLib_MEM_PoolIsCongested(&Inst->pool);
+
+    Status = BPLIB_SUCCESS;
+    Next = 0;
+    while (Next < NumBundles)
+    {
+        /* Pick out the RFC 9171 bundles, handling control messages in place */
+        NumPending = 0;
+        while ((Next < NumBundles) && (NumPending < QM_MAX_JOB_BATCH))
+        {
+            if (Bundles[Next] == NULL)
+            {
+                Status = BPLIB_NULL_PTR_ERROR;
+            }
+            else if (BPLib_CLA_IsAControlMsg((const uint8_t*)Bundles[Next], Sizes[Next]))
+            {
+                BPLib_CLA_ProcessControlMessage((BPLib_CLA_CtrlMsg_t*)Bundles[Next]);
+                (*NumAccepted)++;
+            }
+            else
+            {
+                BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_INGRESS, ContId, Sizes[Next]);
+
+                if (Congested)
+                {
+                    BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_INGRESS_REJECTED, ContId, Sizes[Next]);
+                    Status = BPLIB_MEM_POOL_CONGESTED;
+                }
+                else
+                {
+                    Pending[NumPending] = Bundles[Next];
+                    PendingSizes[NumPending] = Sizes[Next];
+                    NumPending++;
+                }
+            }
+            Next++;
+        }
+
+        if (NumPending == 0)
+        {
+            continue;
+        }
+
+        /* Pass the bundles to BI together so their jobs are queued together. Inputs are
+        ** already checked, so every entry of BundleStatus gets set.
         */
-        return BPLib_BI_RecvFullBundleIn(Inst, Bundle, Size, ContId);
+        (void) BPLib_BI_RecvBundlesIn(Inst, Pending, PendingSizes, NumPending, ContId, BundleStatus);
+
+        for (i = 0; i < NumPending; i++)
+        {
+            if (BundleStatus[i] == BPLIB_SUCCESS)
+            {
+                (*NumAccepted)++;
+            }
+            else
+            {
+                BPLib_AS_RecordTraffic(BPLIB_AS_TRAFFIC_INGRESS_REJECTED, ContId, PendingSizes[i]);
+                Status = BundleStatus[i];
+            }
+        }
     }
+
+    return Status;
 }
 
 /* BPLib_CLA_Egress - Receive bundles from BI and send bundles out to CL */
@@ -76,6 +576,9 @@ BPLib_Status_t BPLib_CLA_Egress(BPLib_Instance_t* Inst, uint32_t ContId, void *B
 {
     BPLib_Status_t     Status = BPLIB_SUCCESS;
     BPLib_Bundle_t    *Bundle = NULL;
+    size_t             Offset = 0;
+    uint32_t           NumOut = 0;
+    uint32_t           Generation;
 
     /* Null checks */
     if ((Inst == NULL) || (BundleOut == NULL) || (Size == NULL))
@@ -89,19 +592,55 @@ BPLib_Status_t BPLib_CLA_Egress(BPLib_Instance_t* Inst, uint32_t ContId, void *B
     }
     *Size = 0;
 
-    /* Try to pull bundle from the duct using user-specified timeout. */
-    Status = BPLib_QM_DuctPull(Inst, ContId, false, Timeout, &Bundle);
+    /* Hold off until the contact's egress rate allows another bundle. The next fragment of
+    ** a bundle being fragmented goes first, then anything held back by a batch egress,
+    ** otherwise pull bundle from the duct using user-specified timeout.
+    */
+    Status = BPLib_TIME_ShaperWait(&BPLib_CLA_EgressShapers[ContId], BPLib_CLA_EgressLock(ContId), &Timeout);
     if (Status == BPLIB_SUCCESS)
     {
-        /* Copy the bundle to the CLA buffer */
-        Status = BPLib_BI_BlobCopyOut(Bundle, BundleOut, BufLen, Size);
+        Generation = BPLib_CLA_LockEgress(ContId);
+
+        if (BPLib_CLA_FragBundles[ContId] != NULL)
+        {
+            Status = BPLib_CLA_FragmentOut(Inst, ContId, BundleOut, BufLen, &Offset, Size, 1, &NumOut,
+                                           BPLib_TIME_GetMonotonicTime());
+            BPLib_CLA_UnlockEgress(Inst, ContId, Generation);
+
+            return Status;
+        }
+
+        Bundle = BPLib_CLA_TakeHeld(ContId);
+        if (Bundle == NULL)
+        {
+            /* Teardown does not wait on the pull */
+            pthread_mutex_unlock(&BPLib_CLA_EgressLocks[ContId]);
+            Status = BPLib_QM_DuctPull(Inst, ContId, false, Timeout, &Bundle);
+            (void) BPLib_CLA_LockEgress(ContId);
+        }
+
         if (Status == BPLIB_SUCCESS)
         {
-            BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_FORWARDED, 1);
+            /* Copy the bundle to the CLA buffer */
+            Status = BPLib_CLA_EncodeOut(ContId, Bundle, BundleOut, BufLen, Size);
+
+            if ((Status != BPLIB_SUCCESS) && BPLib_CLA_CanFragment(Bundle))
+            {
+                /* Too big to go whole, send its first fragment. FragmentOut frees the bundle
+                ** once its last fragment is out.
+                */
+                BPLib_CLA_StartFragmenting(ContId, Bundle);
+                Status = BPLib_CLA_FragmentOut(Inst, ContId, BundleOut, BufLen, &Offset, Size, 1, &NumOut,
+                                               BPLib_TIME_GetMonotonicTime());
+            }
+            else
+            {
+                /* Free the bundle blocks */
+                BPLib_CLA_ReleaseOut(Inst, ContId, Bundle);
+            }
         }
 
-        /* Free the bundle blocks */
-        BPLib_MEM_BundleFree(&Inst->pool, Bundle);
+        BPLib_CLA_UnlockEgress(Inst, ContId, Generation);
     }
 
     if (Status == BPLIB_TIMEOUT)
@@ -112,6 +651,149 @@ BPLib_Status_t BPLib_CLA_Egress(BPLib_Instance_t* Inst, uint32_t ContId, void *B
     return Status;
 }
 
+/* BPLib_CLA_EgressBatch - Receive several bundles from BI and pack them for the CL */
+BPLib_Status_t BPLib_CLA_EgressBatch(BPLib_Instance_t* Inst, uint32_t ContId, void *BundlesOut, size_t BufLen,
+                                     size_t Sizes[], uint32_t MaxBundles, uint32_t *NumBundles, uint32_t Timeout)
+{
+    BPLib_Status_t  Status;
+    BPLib_Status_t  EncodeStatus;
+    BPLib_Bundle_t *Pulled[QM_MAX_JOB_BATCH];
+    size_t          NumPulled;
+    size_t          NumNew = 0;
+    size_t          Offset;
+    size_t          i;
+    int64_t         Now;
+    uint32_t        Generation;
+
+    if ((Inst == NULL) || (BundlesOut == NULL) || (Sizes == NULL) || (NumBundles == NULL))
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    *NumBundles = 0;
+    if (ContId >= BPLIB_MAX_NUM_CONTACTS)
+    {
+        return BPLIB_INVALID_CONT_ID_ERR;
+    }
+
+    if (MaxBundles > QM_MAX_JOB_BATCH)
+    {
+        MaxBundles = QM_MAX_JOB_BATCH;
+    }
+
+    /* Hold off until the contact's egress rate allows another bundle */
+    Status = BPLib_TIME_ShaperWait(&BPLib_CLA_EgressShapers[ContId], BPLib_CLA_EgressLock(ContId), &Timeout);
+    if (Status != BPLIB_SUCCESS)
+    {
+        return BPLIB_CLA_TIMEOUT;
+    }
+
+    /* The rest of a bundle being fragmented goes first */
+    Generation = BPLib_CLA_LockEgress(ContId);
+    Offset     = 0;
+    Now        = BPLib_TIME_GetMonotonicTime();
+    Status     = BPLib_CLA_FragmentOut(Inst, ContId, BundlesOut, BufLen, &Offset, Sizes, MaxBundles, NumBundles, Now);
+    if ((BPLib_CLA_FragBundles[ContId] != NULL) || (*NumBundles >= MaxBundles) ||
+        ((*NumBundles > 0) && (BPLib_TIME_ShaperDelay(&BPLib_CLA_EgressShapers[ContId], Now) > 0)))
+    {
+        BPLib_CLA_UnlockEgress(Inst, ContId, Generation);
+
+        return (*NumBundles > 0) ? BPLIB_SUCCESS : Status;
+    }
+
+    /* Bundles held back by the last call go next, the rest of the batch comes from the
+    ** duct without waiting if anything is already going out. Teardown does not wait on the
+    ** pull, what this call takes from the duct is its own until it holds any back.
+    */
+    NumPulled = BPLib_CLA_NumHeld[ContId];
+    memcpy(Pulled, BPLib_CLA_HeldBundles[ContId], NumPulled * sizeof(BPLib_Bundle_t *));
+    BPLib_CLA_NumHeld[ContId] = 0;
+
+    Status = BPLIB_SUCCESS;
+    if (NumPulled < (MaxBundles - *NumBundles))
+    {
+        pthread_mutex_unlock(&BPLib_CLA_EgressLocks[ContId]);
+        Status = BPLib_QM_DuctPullBatch(Inst, ContId, false,
+                                        ((NumPulled > 0) || (*NumBundles > 0)) ? QM_NO_WAIT : (int) Timeout,
+                                        &Pulled[NumPulled], MaxBundles - *NumBundles - NumPulled, &NumNew);
+        NumPulled += NumNew;
+        (void) BPLib_CLA_LockEgress(ContId);
+    }
+
+    if (NumPulled == 0)
+    {
+        BPLib_CLA_UnlockEgress(Inst, ContId, Generation);
+
+        if (*NumBundles > 0)
+        {
+            return BPLIB_SUCCESS;
+        }
+
+        return (Status == BPLIB_TIMEOUT) ? BPLIB_CLA_TIMEOUT : Status;
+    }
+
+    /* Pack the bundles back to back until the buffer or the batch is full, or the contact
+    ** has used up its egress rate
+    */
+    Status = BPLIB_SUCCESS;
+    for (i = 0; (i < NumPulled) && (*NumBundles < MaxBundles); i++)
+    {
+        EncodeStatus = BPLib_CLA_EncodeOut(ContId, Pulled[i], (uint8_t *) BundlesOut + Offset, BufLen - Offset,
+                                           &Sizes[*NumBundles]);
+        if (EncodeStatus == BPLIB_SUCCESS)
+        {
+            Offset += Sizes[*NumBundles];
+            (*NumBundles)++;
+
+            BPLib_CLA_ReleaseOut(Inst, ContId, Pulled[i]);
+        }
+        else if (BPLib_CLA_CanFragment(Pulled[i]) &&
+                 ((*NumBundles == 0) || (BPLib_CLA_EgressRoom(ContId, BufLen - Offset) < (BufLen - Offset))))
+        {
+            /* Too big to go whole on this contact at all, it goes out as fragments from here */
+            BPLib_CLA_StartFragmenting(ContId, Pulled[i]);
+            EncodeStatus = BPLib_CLA_FragmentOut(Inst, ContId, BundlesOut, BufLen, &Offset, Sizes, MaxBundles,
+                                                 NumBundles, Now);
+            if (EncodeStatus != BPLIB_SUCCESS)
+            {
+                Status = EncodeStatus;
+            }
+
+            if (BPLib_CLA_FragBundles[ContId] != NULL)
+            {
+                /* The rest of its fragments start the next batch */
+                i++;
+                break;
+            }
+        }
+        else if (*NumBundles > 0)
+        {
+            /* No room left, this bundle starts the next batch */
+            break;
+        }
+        else
+        {
+            /* Does not fit even an empty buffer, dropped the way BPLib_CLA_Egress drops it */
+            Status = EncodeStatus;
+
+            BPLib_CLA_ReleaseOut(Inst, ContId, Pulled[i]);
+        }
+
+        if (BPLib_TIME_ShaperDelay(&BPLib_CLA_EgressShapers[ContId], Now) > 0)
+        {
+            /* The rest waits until the rate allows more */
+            i++;
+            break;
+        }
+    }
+
+    BPLib_CLA_NumHeld[ContId] = (uint32_t) (NumPulled - i);
+    memcpy(BPLib_CLA_HeldBundles[ContId], &Pulled[i], (NumPulled - i) * sizeof(BPLib_Bundle_t *));
+    BPLib_CLA_UnlockEgress(Inst, ContId, Generation);
+
+    return (*NumBundles > 0) ? BPLIB_SUCCESS : Status;
+}
+
 /* Validate Contacts table data */
 BPLib_Status_t BPLib_CLA_ContactsTblValidateFunc(void *TblData)
 {
@@ -180,6 +862,17 @@ BPLib_Status_t BPLib_CLA_ContactSetup(uint32_t ContactId)
 
             if (Status == BPLIB_SUCCESS)
             {
+                (void) BPLib_CLA_LockEgress(ContactId);
+                BPLib_TIME_ShaperInit(&BPLib_CLA_EgressShapers[ContactId], ContactInfo.EgressBitsPerCycle,
+                                      BPLib_TIME_GetMonotonicTime());
+                pthread_mutex_unlock(&BPLib_CLA_EgressLocks[ContactId]);
+
+                pthread_mutex_lock(&BPLib_CLA_EgressWindowsLock);
+                BPLib_CLA_EgressWindows[ContactId].BitsPerCycle = ContactInfo.EgressBitsPerCycle;
+                pthread_mutex_unlock(&BPLib_CLA_EgressWindowsLock);
+
+                BPLib_CLA_EgressMtus[ContactId] = ContactInfo.EgressMtu;
+
                 (void) BPLib_CLA_SetContactRunState(ContactId, BPLIB_CLA_SETUP); /* Ignore return since pre-call run state is valid */
             }
         }
@@ -305,7 +998,6 @@ BPLib_Status_t BPLib_CLA_ContactStop(uint32_t ContactId)
 
 BPLib_Status_t BPLib_CLA_ContactTeardown(BPLib_Instance_t *Inst, uint32_t ContactId)
 {
-    BPLib_Status_t              Status;
     BPLib_CLA_ContactRunState_t RunState;
     BPLib_Bundle_t             *Bundle;
 
@@ -342,23 +1034,17 @@ BPLib_Status_t BPLib_CLA_ContactTeardown(BPLib_Instance_t *Inst, uint32_t Contac
         return BPLIB_CLA_INCORRECT_STATE;
     }
 
-    /* Push any bundles waiting for egress back into storage */
+    /* Push any bundles waiting for egress back into storage, oldest first. A bundle part way
+    ** through going out as fragments goes back without the fragments already sent.
+    */
+    (void) BPLib_CLA_LockEgress(ContactId);
+    BPLib_CLA_EgressGenerations[ContactId]++;
+    BPLib_CLA_ReturnEgressState(Inst, ContactId);
+    pthread_mutex_unlock(&BPLib_CLA_EgressLocks[ContactId]);
+
     while (BPLib_QM_WaitQueueTryPull(&Inst->ContactEgressJobs[ContactId], &Bundle, QM_NO_WAIT))
     {
-        Status = BPLib_STOR_StoreBundle(Inst, Bundle);
-
-        if (Status != BPLIB_SUCCESS)
-        {
-            BPLib_EM_SendEvent(BPLIB_CLA_REMOVE_QUEUE_FLUSH_DGB_EID, BPLib_EM_EventType_DEBUG,
-                                "Contact with ID #%d failed to push a bundle back to storage, Status = %d",
-                                ContactId, Status);
-
-            /* Bundle is effectively getting dropped */
-            BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DELETED, 1);
-            BPLib_AS_Increment(BPLIB_EID_INSTANCE, BUNDLE_COUNT_DISCARDED, 1);
-
-            /* This is still considered a successful contact-teardown, just with some bundle loss */
-        }
+        BPLib_CLA_ReturnToStorage(Inst, ContactId, Bundle);
     }
 
     /* Do any framework-specific operations */
@@ -387,3 +1073,273 @@ BPLib_Status_t BPLib_CLA_GetContactRunState(uint32_t ContactId, BPLib_CLA_Contac
         return BPLIB_INVALID_CONT_ID_ERR;
     }
 }
+
+#if BPLIB_MAX_CONTACT_DEST_EIDS <= BPLIB_EID_PATTERN_SET_MAX
+
+/* Compile the destination EID patterns of every contact */
+void BPLib_CLA_RefreshRoutes(void)
+{
+    BPLib_EID_Pattern_t Patterns[BPLIB_EID_PATTERN_SET_MAX];
+    uint32_t SetIdx;
+    uint32_t ContactId;
+    uint32_t NumPatterns;
+
+    for (SetIdx = 0; SetIdx < BPLIB_CLA_NUM_ROUTE_SETS; SetIdx++)
+    {
+        NumPatterns = 0;
+        ContactId   = SetIdx * BPLIB_CLA_ROUTE_SET_CONTACTS;
+
+        while ((BPLib_NC_ConfigPtrs.ContactsConfigPtr != NULL) && (ContactId < BPLIB_MAX_NUM_CONTACTS) &&
+               (NumPatterns < BPLIB_CLA_ROUTE_SET_CONTACTS * BPLIB_MAX_CONTACT_DEST_EIDS))
+        {
+            memcpy(&Patterns[NumPatterns], BPLib_NC_ConfigPtrs.ContactsConfigPtr->ContactSet[ContactId].DestEIDs,
+                   sizeof(BPLib_EID_Pattern_t) * BPLIB_MAX_CONTACT_DEST_EIDS);
+            NumPatterns += BPLIB_MAX_CONTACT_DEST_EIDS;
+            ContactId++;
+        }
+
+        /* A set never holds more patterns than fit in its match mask */
+        (void) BPLib_EID_PatternSetCompile(&BPLib_CLA_ContactRoutes[SetIdx], Patterns, NumPatterns);
+    }
+}
+
+/* Match a destination EID against the destination EID patterns of a set of contacts */
+uint64_t BPLib_CLA_FindContactRoutes(const BPLib_EID_t* DestEID, uint32_t ContactId)
+{
+    if (ContactId >= BPLIB_MAX_NUM_CONTACTS)
+    {
+        return 0;
+    }
+
+    return BPLib_EID_PatternSetMatch(DestEID, &BPLib_CLA_ContactRoutes[ContactId / BPLIB_CLA_ROUTE_SET_CONTACTS]);
+}
+
+#else
+
+/* Contact patterns are matched one at a time, there is nothing to compile */
+void BPLib_CLA_RefreshRoutes(void)
+{
+}
+
+/* Match a destination EID against one contact's destination EID patterns */
+uint64_t BPLib_CLA_FindContactRoutes(const BPLib_EID_t* DestEID, uint32_t ContactId)
+{
+    uint32_t PatternIdx;
+
+    if ((ContactId >= BPLIB_MAX_NUM_CONTACTS) || (BPLib_NC_ConfigPtrs.ContactsConfigPtr == NULL))
+    {
+        return 0;
+    }
+
+    for (PatternIdx = 0; PatternIdx < BPLIB_MAX_CONTACT_DEST_EIDS; PatternIdx++)
+    {
+        if (BPLib_EID_PatternIsMatch((BPLib_EID_t*) DestEID,
+                &BPLib_NC_ConfigPtrs.ContactsConfigPtr->ContactSet[ContactId].DestEIDs[PatternIdx]))
+        {
+            return BPLIB_CLA_CONTACT_ROUTE_MASK(ContactId);
+        }
+    }
+
+    return 0;
+}
+
+#endif
+
+/* Validate Contact Plan table data */
+BPLib_Status_t BPLib_CLA_ContactPlanTblValidateFunc(void *TblData)
+{
+    BPLib_CLA_ContactPlanTable_t *TblDataPtr = (BPLib_CLA_ContactPlanTable_t *)TblData;
+    BPLib_CLA_ContactWindow_t    *Window;
+    BPLib_CLA_ContactWindow_t    *Other;
+    uint32_t WinIdx;
+    uint32_t OtherIdx;
+
+    for (WinIdx = 0; WinIdx < BPLIB_MAX_NUM_CONTACT_WINDOWS; WinIdx++)
+    {
+        Window = &TblDataPtr->Windows[WinIdx];
+        if (Window->EndTime == 0)
+        {
+            continue;
+        }
+
+        if ((Window->ContactId >= BPLIB_MAX_NUM_CONTACTS) || (Window->StartTime >= Window->EndTime))
+        {
+            return BPLIB_INVALID_CONFIG_ERR;
+        }
+
+        /* A contact can only be in one window at a time */
+        for (OtherIdx = WinIdx + 1; OtherIdx < BPLIB_MAX_NUM_CONTACT_WINDOWS; OtherIdx++)
+        {
+            Other = &TblDataPtr->Windows[OtherIdx];
+            if ((Other->EndTime != 0) && (Other->ContactId == Window->ContactId) &&
+                (Other->StartTime < Window->EndTime) && (Window->StartTime < Other->EndTime))
+            {
+                return BPLIB_INVALID_CONFIG_ERR;
+            }
+        }
+    }
+
+    return BPLIB_SUCCESS;
+}
+
+/* Carry the windows being worked over to a newly loaded contact plan. Open and preloading
+** windows the new plan keeps unchanged stay as they are, the ones it drops are closed.
+*/
+static void BPLib_CLA_RescheduleWindows(BPLib_Instance_t *Inst, const BPLib_CLA_ContactWindow_t Windows[])
+{
+    BPLib_CLA_WindowState_t          NewStates[BPLIB_MAX_NUM_CONTACT_WINDOWS];
+    const BPLib_CLA_ContactWindow_t *Old;
+    const BPLib_CLA_ContactWindow_t *New;
+    BPLib_CLA_WindowState_t          OldState;
+    uint32_t OldIdx;
+    uint32_t NewIdx;
+    bool     Kept;
+
+    memset(NewStates, 0, sizeof(NewStates));
+
+    for (OldIdx = 0; OldIdx < BPLIB_MAX_NUM_CONTACT_WINDOWS; OldIdx++)
+    {
+        Old      = &BPLib_CLA_ScheduledWindows[OldIdx];
+        OldState = BPLib_CLA_WindowStates[OldIdx];
+        if ((OldState != BPLIB_CLA_WINDOW_PRELOADING) && (OldState != BPLIB_CLA_WINDOW_OPEN))
+        {
+            continue;
+        }
+
+        Kept = false;
+        for (NewIdx = 0; NewIdx < BPLIB_MAX_NUM_CONTACT_WINDOWS && !Kept; NewIdx++)
+        {
+            New = &Windows[NewIdx];
+            if ((NewStates[NewIdx] == BPLIB_CLA_WINDOW_PENDING) && (New->ContactId == Old->ContactId) &&
+                (New->StartTime == Old->StartTime) && (New->EndTime == Old->EndTime) &&
+                (New->EgressBitsPerCycle == Old->EgressBitsPerCycle))
+            {
+                NewStates[NewIdx] = OldState;
+                Kept = true;
+            }
+        }
+
+        if (!Kept)
+        {
+            BPLib_CLA_CloseWindow(Inst, Old);
+        }
+    }
+
+    memcpy(BPLib_CLA_WindowStates, NewStates, sizeof(BPLib_CLA_WindowStates));
+}
+
+/* Schedule the windows of a newly loaded contact plan afresh */
+void BPLib_CLA_RefreshContactPlan(void)
+{
+    BPLib_CLA_PlanGeneration++;
+}
+
+/* Start, stop and preload contacts according to the contact plan */
+BPLib_Status_t BPLib_CLA_ProcessContactPlan(BPLib_Instance_t *Inst)
+{
+    BPLib_CLA_ContactWindow_t Windows[BPLIB_MAX_NUM_CONTACT_WINDOWS];
+    BPLib_CLA_ContactWindow_t *Window;
+    BPLib_CLA_WindowState_t   *State;
+    uint32_t Generation;
+    uint64_t Now;
+    uint32_t WinIdx;
+
+    if (Inst == NULL)
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    /* Windows are planned in DTN time, so nothing can be scheduled until it is known */
+    Now = BPLib_TIME_GetCurrentDtnTime();
+    if (Now == 0)
+    {
+        return BPLIB_SUCCESS;
+    }
+
+    /* Work from a copy, the contact directives below take the NC lock themselves */
+    BPLib_NC_ReaderLock();
+    if (BPLib_NC_ConfigPtrs.ContactPlanConfigPtr == NULL)
+    {
+        BPLib_NC_ReaderUnlock();
+        return BPLIB_SUCCESS;
+    }
+
+    memcpy(Windows, BPLib_NC_ConfigPtrs.ContactPlanConfigPtr->Windows, sizeof(Windows));
+    Generation = BPLib_CLA_PlanGeneration;
+    BPLib_NC_ReaderUnlock();
+
+    if (Generation != BPLib_CLA_ScheduledGeneration)
+    {
+        BPLib_CLA_RescheduleWindows(Inst, Windows);
+        BPLib_CLA_ScheduledGeneration = Generation;
+    }
+
+    /* Keep the windows the states refer to, a later plan load may drop them */
+    memcpy(BPLib_CLA_ScheduledWindows, Windows, sizeof(BPLib_CLA_ScheduledWindows));
+
+    /* Close windows that are over first, so a window that starts right as another window
+    ** of the same contact ends does not have its contact torn down under it
+    */
+    for (WinIdx = 0; WinIdx < BPLIB_MAX_NUM_CONTACT_WINDOWS; WinIdx++)
+    {
+        Window = &Windows[WinIdx];
+        State  = &BPLib_CLA_WindowStates[WinIdx];
+        if ((Window->EndTime == 0) || (Window->ContactId >= BPLIB_MAX_NUM_CONTACTS) || (Now < Window->EndTime))
+        {
+            continue;
+        }
+
+        /* Windows that were over before they were ever scheduled are left alone */
+        if ((*State == BPLIB_CLA_WINDOW_PRELOADING) || (*State == BPLIB_CLA_WINDOW_OPEN))
+        {
+            BPLib_CLA_CloseWindow(Inst, Window);
+        }
+
+        *State = BPLIB_CLA_WINDOW_CLOSED;
+    }
+
+    for (WinIdx = 0; WinIdx < BPLIB_MAX_NUM_CONTACT_WINDOWS; WinIdx++)
+    {
+        Window = &Windows[WinIdx];
+        State  = &BPLib_CLA_WindowStates[WinIdx];
+        if ((Window->EndTime == 0) || (Window->ContactId >= BPLIB_MAX_NUM_CONTACTS) ||
+            ((*State != BPLIB_CLA_WINDOW_PENDING) && (*State != BPLIB_CLA_WINDOW_PRELOADING)))
+        {
+            continue;
+        }
+
+        if (Now >= Window->StartTime)
+        {
+            BPLib_CLA_OpenWindow(Inst, Window);
+            *State = BPLIB_CLA_WINDOW_OPEN;
+        }
+        else if ((Now + BPLIB_CLA_PLAN_PRELOAD_MS) >= Window->StartTime)
+        {
+            /* Keep topping the duct up until the window opens */
+            BPLib_CLA_PreloadWindow(Inst, Window);
+            *State = BPLIB_CLA_WINDOW_PRELOADING;
+        }
+    }
+
+    return BPLIB_SUCCESS;
+}
+
+/* Get the span and rate a contact is sending at */
+BPLib_Status_t BPLib_CLA_GetEgressWindow(uint32_t ContactId, BPLib_CLA_EgressWindow_t *Window)
+{
+    if (Window == NULL)
+    {
+        return BPLIB_NULL_PTR_ERROR;
+    }
+
+    if (ContactId >= BPLIB_MAX_NUM_CONTACTS)
+    {
+        return BPLIB_INVALID_CONT_ID_ERR;
+    }
+
+    pthread_mutex_lock(&BPLib_CLA_EgressWindowsLock);
+    *Window = BPLib_CLA_EgressWindows[ContactId];
+    pthread_mutex_unlock(&BPLib_CLA_EgressWindowsLock);
+
+    return BPLIB_SUCCESS;
+}
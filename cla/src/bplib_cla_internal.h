@@ -47,6 +47,15 @@ typedef struct
     uint32_t  SessionID;
 } BPLib_CLA_IDSet_t;
 
+/* Where a contact plan window is in its life */
+typedef enum
+{
+    BPLIB_CLA_WINDOW_PENDING    = 0, /* Window is further off than the preload lead time */
+    BPLIB_CLA_WINDOW_PRELOADING = 1, /* Contact is set up and its duct is being preloaded */
+    BPLIB_CLA_WINDOW_OPEN       = 2, /* Contact was started for the window */
+    BPLIB_CLA_WINDOW_CLOSED     = 3  /* Window is over */
+} BPLib_CLA_WindowState_t;
+
 /* =================== */
 /* Function Prototypes */
 /* =================== */
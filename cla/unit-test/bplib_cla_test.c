@@ -138,6 +138,119 @@ void Test_BPLib_CLA_Ingress_NonControlMessageNominal(void)
     UtAssert_STUB_COUNT(BPLib_BI_RecvFullBundleIn, 1);
 }
 
+void Test_BPLib_CLA_Ingress_PoolCongested(void)
+{
+    BPLib_Status_t ReturnStatus;
+    BPLib_Instance_t InputInstance;
+    uint32_t ContId = 0;
+    char InputBundleBuffer[30];
+    uint32_t Timeout = 0;
+
+    memset(InputBundleBuffer, 0, sizeof(InputBundleBuffer));
+    strncpy(InputBundleBuffer, "NOT-MSG", sizeof(InputBundleBuffer));
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_MEM_PoolIsCongested), true);
+
+    ReturnStatus = BPLib_CLA_Ingress(&InputInstance,
+                                     ContId,
+                                     InputBundleBuffer,
+                                     sizeof(InputBundleBuffer),
+                                     Timeout);
+
+    UtAssert_INT32_EQ(ReturnStatus, BPLIB_MEM_POOL_CONGESTED);
+    UtAssert_STUB_COUNT(BPLib_BI_RecvFullBundleIn, 0);
+}
+
+/* Fill in per-bundle statuses for BPLib_BI_RecvBundlesIn, rejecting the second bundle */
+static void UT_Handler_BPLib_BI_RecvBundlesIn_RejectSecond(void *UserObj, UT_EntryKey_t FuncKey,
+                                                           const UT_StubContext_t *Context)
+{
+    uint32_t        NumBundles = UT_Hook_GetArgValueByName(Context, "NumBundles", uint32_t);
+    BPLib_Status_t *Statuses   = UT_Hook_GetArgValueByName(Context, "Statuses", BPLib_Status_t *);
+    uint32_t        i;
+
+    for (i = 0; i < NumBundles; i++)
+    {
+        Statuses[i] = (i == 1) ? BPLIB_QM_PUSH_ERROR : BPLIB_SUCCESS;
+    }
+}
+
+void Test_BPLib_CLA_IngressBatch_InputErrors(void)
+{
+    BPLib_Instance_t InputInstance;
+    char             InputBundleBuffer[30];
+    const void      *Bundles[1] = { InputBundleBuffer };
+    size_t           Sizes[1]   = { sizeof(InputBundleBuffer) };
+    uint32_t         NumAccepted;
+
+    UtAssert_INT32_EQ(BPLib_CLA_IngressBatch(NULL, 0, Bundles, Sizes, 1, &NumAccepted), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_CLA_IngressBatch(&InputInstance, 0, NULL, Sizes, 1, &NumAccepted), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_CLA_IngressBatch(&InputInstance, 0, Bundles, NULL, 1, &NumAccepted), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_CLA_IngressBatch(&InputInstance, 0, Bundles, Sizes, 1, NULL), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_CLA_IngressBatch(&InputInstance, BPLIB_MAX_NUM_CONTACTS, Bundles, Sizes, 1, &NumAccepted),
+                      BPLIB_INVALID_CONT_ID_ERR);
+    UtAssert_UINT32_EQ(NumAccepted, 0);
+    UtAssert_STUB_COUNT(BPLib_BI_RecvBundlesIn, 0);
+}
+
+void Test_BPLib_CLA_IngressBatch_Nominal(void)
+{
+    BPLib_Instance_t    InputInstance;
+    BPLib_CLA_CtrlMsg_t InputControlMessage;
+    char                InputBundleBuffer[3][30];
+    const void         *Bundles[4];
+    size_t              Sizes[4];
+    uint32_t            NumAccepted;
+    uint32_t            i;
+
+    memset(&InputControlMessage, 0, sizeof(InputControlMessage));
+    strncpy(InputControlMessage.CtrlMsgTag, "BPNMSG", sizeof(InputControlMessage.CtrlMsgTag));
+    InputControlMessage.MsgTypes = SentIt;
+
+    for (i = 0; i < 3; i++)
+    {
+        memset(InputBundleBuffer[i], 0, sizeof(InputBundleBuffer[i]));
+        strncpy(InputBundleBuffer[i], "NOT-MSG", sizeof(InputBundleBuffer[i]));
+        Bundles[i] = InputBundleBuffer[i];
+        Sizes[i]   = sizeof(InputBundleBuffer[i]);
+    }
+    Bundles[3] = &InputControlMessage;
+    Sizes[3]   = sizeof(InputControlMessage);
+
+    UT_SetHandlerFunction(UT_KEY(BPLib_BI_RecvBundlesIn), UT_Handler_BPLib_BI_RecvBundlesIn_RejectSecond, NULL);
+
+    UtAssert_INT32_EQ(BPLib_CLA_IngressBatch(&InputInstance, 0, Bundles, Sizes, 4, &NumAccepted),
+                      BPLIB_QM_PUSH_ERROR);
+
+    /* The control message and two of the three bundles are accepted */
+    UtAssert_UINT32_EQ(NumAccepted, 3);
+    UtAssert_STUB_COUNT(BPLib_BI_RecvBundlesIn, 1);
+    UtAssert_STUB_COUNT(BPLib_BI_RecvFullBundleIn, 0);
+    UtAssert_STUB_COUNT(BPLib_MEM_PoolIsCongested, 1);
+    UtAssert_STUB_COUNT(BPLib_AS_RecordTraffic, 4);
+}
+
+void Test_BPLib_CLA_IngressBatch_PoolCongested(void)
+{
+    BPLib_Instance_t InputInstance;
+    char             InputBundleBuffer[2][30];
+    const void      *Bundles[2] = { InputBundleBuffer[0], InputBundleBuffer[1] };
+    size_t           Sizes[2]   = { sizeof(InputBundleBuffer[0]), sizeof(InputBundleBuffer[1]) };
+    uint32_t         NumAccepted;
+
+    memset(InputBundleBuffer, 0, sizeof(InputBundleBuffer));
+    strncpy(InputBundleBuffer[0], "NOT-MSG", sizeof(InputBundleBuffer[0]));
+    strncpy(InputBundleBuffer[1], "NOT-MSG", sizeof(InputBundleBuffer[1]));
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_MEM_PoolIsCongested), true);
+
+    UtAssert_INT32_EQ(BPLib_CLA_IngressBatch(&InputInstance, 0, Bundles, Sizes, 2, &NumAccepted),
+                      BPLIB_MEM_POOL_CONGESTED);
+    UtAssert_UINT32_EQ(NumAccepted, 0);
+    UtAssert_STUB_COUNT(BPLib_BI_RecvBundlesIn, 0);
+    UtAssert_STUB_COUNT(BPLib_AS_RecordTraffic, 4);
+}
+
 void Test_BPLib_CLA_Egress_NullInstanceInputError(void)
 {
     BPLib_Status_t ReturnStatus;
@@ -250,6 +363,22 @@ void Test_BPLib_CLA_Egress_QueuePullTimeout(void)
     UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
 }
 
+void Test_BPLib_CLA_Egress_RateLimited(void)
+{
+    BPLib_Instance_t Instance;
+    uint8_t OutputBundleBuffer[30];
+    size_t NumBytesCopiedToOutputBuf;
+
+    /* Nothing is pulled while the contact is over its egress rate */
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_ShaperWait), BPLIB_TIMEOUT);
+
+    UtAssert_INT32_EQ(BPLib_CLA_Egress(&Instance, 0, OutputBundleBuffer, &NumBytesCopiedToOutputBuf,
+                                       sizeof(OutputBundleBuffer), 10),
+                      BPLIB_CLA_TIMEOUT);
+    UtAssert_STUB_COUNT(BPLib_TIME_ShaperWait, 1);
+    UtAssert_STUB_COUNT(BPLib_QM_DuctPull, 0);
+}
+
 void Test_BPLib_CLA_Egress_BlobCopyFail(void)
 {
     BPLib_Status_t ReturnStatus;
@@ -303,6 +432,464 @@ void Test_BPLib_CLA_Egress_Nominal(void)
     UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
 }
 
+/* Every bundle encodes to 10 bytes unless the test queued a failure */
+static void UT_Handler_BPLib_BI_BlobCopyOut_TenBytes(void *UserObj, UT_EntryKey_t FuncKey,
+                                                     const UT_StubContext_t *Context)
+{
+    size_t *NumBytesCopied = UT_Hook_GetArgValueByName(Context, "NumBytesCopied", size_t *);
+    int32   Status;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+    *NumBytesCopied = (Status == BPLIB_SUCCESS) ? 10 : 0;
+}
+
+void Test_BPLib_CLA_EgressBatch_InputErrors(void)
+{
+    BPLib_Instance_t Instance;
+    uint8_t          OutputBuffer[30];
+    size_t           Sizes[2];
+    uint32_t         NumBundles = 1;
+
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(NULL, 0, OutputBuffer, sizeof(OutputBuffer), Sizes, 2, &NumBundles, 0),
+                      BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Instance, 0, NULL, sizeof(OutputBuffer), Sizes, 2, &NumBundles, 0),
+                      BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Instance, 0, OutputBuffer, sizeof(OutputBuffer), NULL, 2, &NumBundles, 0),
+                      BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Instance, 0, OutputBuffer, sizeof(OutputBuffer), Sizes, 2, NULL, 0),
+                      BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Instance, BPLIB_MAX_NUM_CONTACTS, OutputBuffer, sizeof(OutputBuffer),
+                                            Sizes, 2, &NumBundles, 0),
+                      BPLIB_INVALID_CONT_ID_ERR);
+    UtAssert_UINT32_EQ(NumBundles, 0);
+    UtAssert_STUB_COUNT(BPLib_QM_DuctPullBatch, 0);
+}
+
+void Test_BPLib_CLA_EgressBatch_QueuePullTimeout(void)
+{
+    BPLib_Instance_t Instance;
+    uint8_t          OutputBuffer[30];
+    size_t           Sizes[2];
+    uint32_t         NumBundles;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_DuctPullBatch), BPLIB_TIMEOUT);
+
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Instance, 0, OutputBuffer, sizeof(OutputBuffer), Sizes, 2, &NumBundles, 0),
+                      BPLIB_CLA_TIMEOUT);
+    UtAssert_UINT32_EQ(NumBundles, 0);
+    UtAssert_STUB_COUNT(BPLib_BI_BlobCopyOut, 0);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
+}
+
+void Test_BPLib_CLA_EgressBatch_Nominal(void)
+{
+    BPLib_Instance_t Instance;
+    BPLib_Bundle_t   Bundles[3];
+    BPLib_Bundle_t  *BundlePtrs[3] = { &Bundles[0], &Bundles[1], &Bundles[2] };
+    uint8_t          OutputBuffer[40];
+    size_t           Sizes[4];
+    uint32_t         NumBundles;
+
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPullBatch), BundlePtrs, sizeof(BundlePtrs), false);
+    UT_SetHandlerFunction(UT_KEY(BPLib_BI_BlobCopyOut), UT_Handler_BPLib_BI_BlobCopyOut_TenBytes, NULL);
+
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Instance, 0, OutputBuffer, sizeof(OutputBuffer), Sizes, 4, &NumBundles, 0),
+                      BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(NumBundles, 3);
+    UtAssert_UINT32_EQ(Sizes[0], 10);
+    UtAssert_UINT32_EQ(Sizes[2], 10);
+    UtAssert_STUB_COUNT(BPLib_QM_DuctPullBatch, 1);
+    UtAssert_STUB_COUNT(BPLib_BI_BlobCopyOut, 3);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 3);
+    UtAssert_STUB_COUNT(BPLib_AS_RecordTraffic, 3);
+}
+
+void Test_BPLib_CLA_EgressBatch_HoldsWhatDoesNotFit(void)
+{
+    BPLib_Instance_t Instance;
+    BPLib_Bundle_t   Bundles[3];
+    BPLib_Bundle_t  *BundlePtrs[3] = { &Bundles[0], &Bundles[1], &Bundles[2] };
+    uint8_t          OutputBuffer[40];
+    size_t           Sizes[4];
+    uint32_t         NumBundles;
+
+    /* The second bundle does not fit, so it and the third are held for the next call */
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPullBatch), BundlePtrs, sizeof(BundlePtrs), false);
+    UT_SetHandlerFunction(UT_KEY(BPLib_BI_BlobCopyOut), UT_Handler_BPLib_BI_BlobCopyOut_TenBytes, NULL);
+    UT_SetDeferredRetcode(UT_KEY(BPLib_BI_BlobCopyOut), 2, BPLIB_BUF_LEN_ERROR);
+
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Instance, 0, OutputBuffer, sizeof(OutputBuffer), Sizes, 4, &NumBundles, 0),
+                      BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(NumBundles, 1);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
+
+    /* The held bundles go out next, even though the duct is empty */
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_DuctPullBatch), BPLIB_TIMEOUT);
+
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Instance, 0, OutputBuffer, sizeof(OutputBuffer), Sizes, 4, &NumBundles, 0),
+                      BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(NumBundles, 2);
+    UtAssert_STUB_COUNT(BPLib_QM_DuctPullBatch, 2);
+    UtAssert_STUB_COUNT(BPLib_BI_BlobCopyOut, 4);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 3);
+}
+
+void Test_BPLib_CLA_EgressBatch_RateLimited(void)
+{
+    BPLib_Instance_t Instance;
+    BPLib_Bundle_t   Bundles[3];
+    BPLib_Bundle_t  *BundlePtrs[3] = { &Bundles[0], &Bundles[1], &Bundles[2] };
+    uint8_t          OutputBuffer[40];
+    size_t           Sizes[4];
+    uint32_t         NumBundles;
+
+    /* The contact is over its rate before the batch starts */
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_ShaperWait), BPLIB_TIMEOUT);
+
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Instance, 0, OutputBuffer, sizeof(OutputBuffer), Sizes, 4, &NumBundles, 0),
+                      BPLIB_CLA_TIMEOUT);
+    UtAssert_UINT32_EQ(NumBundles, 0);
+    UtAssert_STUB_COUNT(BPLib_QM_DuctPullBatch, 0);
+
+    /* The first bundle uses up the rate, so the other two are held for the next call */
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_ShaperWait), BPLIB_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(BPLib_TIME_ShaperDelay), 1, 1);
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPullBatch), BundlePtrs, sizeof(BundlePtrs), false);
+    UT_SetHandlerFunction(UT_KEY(BPLib_BI_BlobCopyOut), UT_Handler_BPLib_BI_BlobCopyOut_TenBytes, NULL);
+
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Instance, 0, OutputBuffer, sizeof(OutputBuffer), Sizes, 4, &NumBundles, 0),
+                      BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(NumBundles, 1);
+    UtAssert_STUB_COUNT(BPLib_TIME_ShaperConsume, 1);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_DuctPullBatch), BPLIB_TIMEOUT);
+
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Instance, 0, OutputBuffer, sizeof(OutputBuffer), Sizes, 4, &NumBundles, 0),
+                      BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(NumBundles, 2);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 3);
+}
+
+/* The contact is torn down by another thread while the egress task is pulling */
+static void UT_Handler_BPLib_QM_DuctPullBatch_Teardown(void *UserObj, UT_EntryKey_t FuncKey,
+                                                       const UT_StubContext_t *Context)
+{
+    BPLib_Instance_t *Inst   = UT_Hook_GetArgValueByName(Context, "Inst", BPLib_Instance_t *);
+    uint32_t          ContId = UT_Hook_GetArgValueByName(Context, "EgressID", uint32_t);
+
+    UT_Handler_BPLib_QM_DuctPullBatch(UserObj, FuncKey, Context);
+
+    BPLib_CLA_ContactRunStates[ContId] = BPLIB_CLA_STOPPED;
+    UtAssert_INT32_EQ(BPLib_CLA_ContactTeardown(Inst, ContId), BPLIB_SUCCESS);
+}
+
+void Test_BPLib_CLA_EgressBatch_TeardownDuringPull(void)
+{
+    BPLib_Instance_t Instance;
+    BPLib_Bundle_t   Bundles[3];
+    BPLib_Bundle_t  *BundlePtrs[3] = { &Bundles[0], &Bundles[1], &Bundles[2] };
+    uint8_t          OutputBuffer[40];
+    size_t           Sizes[4];
+    uint32_t         NumBundles;
+
+    /* The second bundle does not fit, the two left over go back to storage rather than being
+    ** held for a contact that has been torn down
+    */
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPullBatch), BundlePtrs, sizeof(BundlePtrs), false);
+    UT_SetHandlerFunction(UT_KEY(BPLib_QM_DuctPullBatch), UT_Handler_BPLib_QM_DuctPullBatch_Teardown, NULL);
+    UT_SetHandlerFunction(UT_KEY(BPLib_BI_BlobCopyOut), UT_Handler_BPLib_BI_BlobCopyOut_TenBytes, NULL);
+    UT_SetDeferredRetcode(UT_KEY(BPLib_BI_BlobCopyOut), 2, BPLIB_BUF_LEN_ERROR);
+
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Instance, 0, OutputBuffer, sizeof(OutputBuffer), Sizes, 4, &NumBundles, 0),
+                      BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(NumBundles, 1);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
+    UtAssert_STUB_COUNT(BPLib_STOR_StoreBundle, 2);
+
+    /* Nothing is left held */
+    UT_SetHandlerFunction(UT_KEY(BPLib_QM_DuctPullBatch), UT_Handler_BPLib_QM_DuctPullBatch, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_DuctPullBatch), BPLIB_TIMEOUT);
+
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Instance, 0, OutputBuffer, sizeof(OutputBuffer), Sizes, 4, &NumBundles, 0),
+                      BPLIB_CLA_TIMEOUT);
+    UtAssert_UINT32_EQ(NumBundles, 0);
+    UtAssert_STUB_COUNT(BPLib_BI_BlobCopyOut, 2);
+}
+
+/* Every fragment encodes to 10 bytes and carries 400 bytes of payload unless the test queued a failure */
+static void UT_Handler_BPLib_BI_FragmentCopyOut_TenBytes(void *UserObj, UT_EntryKey_t FuncKey,
+                                                         const UT_StubContext_t *Context)
+{
+    size_t *NumBytesCopied = UT_Hook_GetArgValueByName(Context, "NumBytesCopied", size_t *);
+    size_t *PayloadBytes   = UT_Hook_GetArgValueByName(Context, "PayloadBytes", size_t *);
+    int32   Status;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+    *NumBytesCopied = (Status == BPLIB_SUCCESS) ? 10 : 0;
+    *PayloadBytes   = (Status == BPLIB_SUCCESS) ? 400 : 0;
+}
+
+/* Largest buffer the last bundle was encoded into */
+static size_t BPLib_CLA_Test_EncodeRoom;
+
+static void UT_Handler_BPLib_BI_BlobCopyOut_Room(void *UserObj, UT_EntryKey_t FuncKey,
+                                                 const UT_StubContext_t *Context)
+{
+    BPLib_CLA_Test_EncodeRoom = UT_Hook_GetArgValueByName(Context, "OutputBufferSize", size_t);
+
+    UT_Handler_BPLib_BI_BlobCopyOut_TenBytes(UserObj, FuncKey, Context);
+}
+
+/* Payload offset the bundle going back to storage was last trimmed at */
+static size_t BPLib_CLA_Test_TrimOffset;
+
+static void UT_Handler_BPLib_BI_FragmentTrim_Offset(void *UserObj, UT_EntryKey_t FuncKey,
+                                                    const UT_StubContext_t *Context)
+{
+    BPLib_CLA_Test_TrimOffset = UT_Hook_GetArgValueByName(Context, "PayloadOffset", size_t);
+}
+
+/* Set up a bundle with 1000 bytes of payload that goes out as three fragments */
+static void BPLib_CLA_Test_InitBigBundle(BPLib_Bundle_t *Bundle)
+{
+    memset(Bundle, 0, sizeof(*Bundle));
+    Bundle->blocks.PayloadHeader.DataSize = 1000;
+
+    UT_SetHandlerFunction(UT_KEY(BPLib_BI_FragmentCopyOut), UT_Handler_BPLib_BI_FragmentCopyOut_TenBytes, NULL);
+    UT_SetHandlerFunction(UT_KEY(BPLib_BI_FragmentTrim), UT_Handler_BPLib_BI_FragmentTrim_Offset, NULL);
+    BPLib_CLA_Test_TrimOffset = 0;
+}
+
+void Test_BPLib_CLA_Egress_Fragments(void)
+{
+    BPLib_Instance_t Instance;
+    BPLib_Bundle_t   Bundle;
+    BPLib_Bundle_t  *BundlePtr = &Bundle;
+    uint8_t          OutputBuffer[30];
+    size_t           Size;
+
+    BPLib_CLA_Test_InitBigBundle(&Bundle);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_BI_BlobCopyOut), BPLIB_BUF_LEN_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_DuctPull), BPLIB_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPull), &BundlePtr, sizeof(BundlePtr), false);
+
+    /* One fragment per call until the whole payload is out */
+    UtAssert_INT32_EQ(BPLib_CLA_Egress(&Instance, 0, OutputBuffer, &Size, sizeof(OutputBuffer), 0), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Size, 10);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
+
+    UtAssert_INT32_EQ(BPLib_CLA_Egress(&Instance, 0, OutputBuffer, &Size, sizeof(OutputBuffer), 0), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
+
+    UtAssert_INT32_EQ(BPLib_CLA_Egress(&Instance, 0, OutputBuffer, &Size, sizeof(OutputBuffer), 0), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Size, 10);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
+
+    UtAssert_STUB_COUNT(BPLib_QM_DuctPull, 1);
+    UtAssert_STUB_COUNT(BPLib_BI_BlobCopyOut, 1);
+    UtAssert_STUB_COUNT(BPLib_BI_FragmentCopyOut, 3);
+    UtAssert_STUB_COUNT(BPLib_TIME_ShaperConsume, 3);
+}
+
+void Test_BPLib_CLA_Egress_NoFragment(void)
+{
+    BPLib_Instance_t Instance;
+    BPLib_Bundle_t   Bundle;
+    BPLib_Bundle_t  *BundlePtr = &Bundle;
+    uint8_t          OutputBuffer[30];
+    size_t           Size;
+
+    /* Must not be fragmented, so it is dropped */
+    BPLib_CLA_Test_InitBigBundle(&Bundle);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_BI_BlobCopyOut), BPLIB_BUF_LEN_ERROR);
+    Bundle.blocks.PrimaryBlock.BundleProcFlags = BPLIB_BUNDLE_PROC_NO_FRAG_FLAG;
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_DuctPull), BPLIB_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPull), &BundlePtr, sizeof(BundlePtr), false);
+
+    UtAssert_INT32_EQ(BPLib_CLA_Egress(&Instance, 0, OutputBuffer, &Size, sizeof(OutputBuffer), 0),
+                      BPLIB_BUF_LEN_ERROR);
+    UtAssert_STUB_COUNT(BPLib_BI_FragmentCopyOut, 0);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
+
+    /* Not even a fragment fits, so it is dropped */
+    BPLib_CLA_Test_InitBigBundle(&Bundle);
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPull), &BundlePtr, sizeof(BundlePtr), false);
+    UT_SetDeferredRetcode(UT_KEY(BPLib_BI_FragmentCopyOut), 1, BPLIB_BI_FRAG_NO_ROOM_ERR);
+
+    UtAssert_INT32_EQ(BPLib_CLA_Egress(&Instance, 0, OutputBuffer, &Size, sizeof(OutputBuffer), 0),
+                      BPLIB_BI_FRAG_NO_ROOM_ERR);
+    UtAssert_UINT32_EQ(Size, 0);
+    UtAssert_STUB_COUNT(BPLib_BI_FragmentCopyOut, 1);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 2);
+}
+
+void Test_BPLib_CLA_EgressBatch_Fragments(void)
+{
+    BPLib_Instance_t Instance;
+    BPLib_Bundle_t   Bundles[2];
+    BPLib_Bundle_t  *BundlePtrs[2] = { &Bundles[0], &Bundles[1] };
+    uint8_t          OutputBuffer[40];
+    size_t           Sizes[4];
+    uint32_t         NumBundles;
+
+    /* The first bundle does not fit whole and goes as three fragments, the second goes whole */
+    BPLib_CLA_Test_InitBigBundle(&Bundles[0]);
+    memset(&Bundles[1], 0, sizeof(Bundles[1]));
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPullBatch), BundlePtrs, sizeof(BundlePtrs), false);
+    UT_SetHandlerFunction(UT_KEY(BPLib_BI_BlobCopyOut), UT_Handler_BPLib_BI_BlobCopyOut_TenBytes, NULL);
+    UT_SetDeferredRetcode(UT_KEY(BPLib_BI_BlobCopyOut), 1, BPLIB_BUF_LEN_ERROR);
+
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Instance, 0, OutputBuffer, sizeof(OutputBuffer), Sizes, 4, &NumBundles, 0),
+                      BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(NumBundles, 4);
+    UtAssert_UINT32_EQ(Sizes[0], 10);
+    UtAssert_UINT32_EQ(Sizes[3], 10);
+    UtAssert_STUB_COUNT(BPLib_BI_FragmentCopyOut, 3);
+    UtAssert_STUB_COUNT(BPLib_BI_BlobCopyOut, 2);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 2);
+}
+
+void Test_BPLib_CLA_EgressBatch_FragmentsContinue(void)
+{
+    BPLib_Instance_t Instance;
+    BPLib_Bundle_t   Bundle;
+    BPLib_Bundle_t  *BundlePtr = &Bundle;
+    uint8_t          OutputBuffer[40];
+    size_t           Sizes[2];
+    uint32_t         NumBundles;
+
+    /* Only two of the three fragments fit in the first batch */
+    BPLib_CLA_Test_InitBigBundle(&Bundle);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_BI_BlobCopyOut), BPLIB_BUF_LEN_ERROR);
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPullBatch), &BundlePtr, sizeof(BundlePtr), false);
+
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Instance, 0, OutputBuffer, sizeof(OutputBuffer), Sizes, 2, &NumBundles, 0),
+                      BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(NumBundles, 2);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
+
+    /* The last fragment starts the next batch, ahead of the duct */
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_DuctPullBatch), BPLIB_TIMEOUT);
+
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Instance, 0, OutputBuffer, sizeof(OutputBuffer), Sizes, 2, &NumBundles, 0),
+                      BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(NumBundles, 1);
+    UtAssert_STUB_COUNT(BPLib_BI_FragmentCopyOut, 3);
+    UtAssert_STUB_COUNT(BPLib_QM_DuctPullBatch, 2);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
+}
+
+void Test_BPLib_CLA_EgressBatch_EgressMtu(void)
+{
+    BPLib_CLA_ContactsTable_t ContactsTbl;
+    BPLib_Instance_t Instance;
+    BPLib_Bundle_t   Bundles[2];
+    BPLib_Bundle_t  *BundlePtrs[2] = { &Bundles[0], &Bundles[1] };
+    uint8_t          OutputBuffer[40];
+    size_t           Sizes[4];
+    uint32_t         NumBundles;
+
+    memset(&ContactsTbl, 0, sizeof(ContactsTbl));
+    ContactsTbl.ContactSet[0].EgressMtu = 20;
+    BPLib_NC_ConfigPtrs.ContactsConfigPtr = &ContactsTbl;
+    BPLib_CLA_ContactRunStates[0] = BPLIB_CLA_TORNDOWN;
+    UtAssert_INT32_EQ(BPLib_CLA_ContactSetup(0), BPLIB_SUCCESS);
+
+    /* Bundles are encoded no larger than the MTU, so the second bundle is fragmented even
+    ** though the buffer still has room for it
+    */
+    BPLib_CLA_Test_InitBigBundle(&Bundles[1]);
+    memset(&Bundles[0], 0, sizeof(Bundles[0]));
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPullBatch), BundlePtrs, sizeof(BundlePtrs), false);
+    UT_SetHandlerFunction(UT_KEY(BPLib_BI_BlobCopyOut), UT_Handler_BPLib_BI_BlobCopyOut_Room, NULL);
+    UT_SetDeferredRetcode(UT_KEY(BPLib_BI_BlobCopyOut), 2, BPLIB_BUF_LEN_ERROR);
+
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Instance, 0, OutputBuffer, sizeof(OutputBuffer), Sizes, 4, &NumBundles, 0),
+                      BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(BPLib_CLA_Test_EncodeRoom, 20);
+    UtAssert_UINT32_EQ(NumBundles, 4);
+    UtAssert_STUB_COUNT(BPLib_BI_FragmentCopyOut, 3);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 2);
+
+    /* Restore the contact to no MTU for the other tests */
+    ContactsTbl.ContactSet[0].EgressMtu = 0;
+    BPLib_CLA_ContactRunStates[0] = BPLIB_CLA_TORNDOWN;
+    UtAssert_INT32_EQ(BPLib_CLA_ContactSetup(0), BPLIB_SUCCESS);
+}
+
+void Test_BPLib_CLA_ContactTeardown_Fragmenting(void)
+{
+    BPLib_Instance_t Instance;
+    BPLib_Bundle_t   Bundle;
+    BPLib_Bundle_t  *BundlePtr = &Bundle;
+    uint8_t          OutputBuffer[30];
+    size_t           Size;
+
+    BPLib_CLA_Test_InitBigBundle(&Bundle);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_BI_BlobCopyOut), BPLIB_BUF_LEN_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_DuctPull), BPLIB_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPull), &BundlePtr, sizeof(BundlePtr), false);
+    UtAssert_INT32_EQ(BPLib_CLA_Egress(&Instance, 0, OutputBuffer, &Size, sizeof(OutputBuffer), 0), BPLIB_SUCCESS);
+
+    /* The rest of the bundle goes back to storage without the fragment already sent, and
+    ** egress starts afresh
+    */
+    BPLib_CLA_ContactRunStates[0] = BPLIB_CLA_STOPPED;
+    UtAssert_INT32_EQ(BPLib_CLA_ContactTeardown(&Instance, 0), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPLib_BI_FragmentTrim, 1);
+    UtAssert_UINT32_EQ(BPLib_CLA_Test_TrimOffset, 400);
+    UtAssert_STUB_COUNT(BPLib_STOR_StoreBundle, 1);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_DuctPull), BPLIB_TIMEOUT);
+    UtAssert_INT32_EQ(BPLib_CLA_Egress(&Instance, 0, OutputBuffer, &Size, sizeof(OutputBuffer), 0), BPLIB_CLA_TIMEOUT);
+    UtAssert_STUB_COUNT(BPLib_BI_FragmentCopyOut, 1);
+}
+
+/* The contact is torn down by another thread while the egress task is pulling */
+static void UT_Handler_BPLib_QM_DuctPull_Teardown(void *UserObj, UT_EntryKey_t FuncKey,
+                                                  const UT_StubContext_t *Context)
+{
+    BPLib_Instance_t *Inst   = UT_Hook_GetArgValueByName(Context, "Inst", BPLib_Instance_t *);
+    uint32_t          ContId = UT_Hook_GetArgValueByName(Context, "EgressID", uint32_t);
+
+    UT_Handler_BPLib_QM_DuctPull(UserObj, FuncKey, Context);
+
+    BPLib_CLA_ContactRunStates[ContId] = BPLIB_CLA_STOPPED;
+    UtAssert_INT32_EQ(BPLib_CLA_ContactTeardown(Inst, ContId), BPLIB_SUCCESS);
+}
+
+void Test_BPLib_CLA_Egress_FragmentingTeardownDuringPull(void)
+{
+    BPLib_Instance_t Instance;
+    BPLib_Bundle_t   Bundle;
+    BPLib_Bundle_t  *BundlePtr = &Bundle;
+    uint8_t          OutputBuffer[30];
+    size_t           Size;
+
+    /* The first fragment goes out, the rest of the bundle goes back to storage as a fragment
+    ** rather than being left to fragment on a contact that has been torn down
+    */
+    BPLib_CLA_Test_InitBigBundle(&Bundle);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_BI_BlobCopyOut), BPLIB_BUF_LEN_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_DuctPull), BPLIB_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPull), &BundlePtr, sizeof(BundlePtr), false);
+    UT_SetHandlerFunction(UT_KEY(BPLib_QM_DuctPull), UT_Handler_BPLib_QM_DuctPull_Teardown, NULL);
+
+    UtAssert_INT32_EQ(BPLib_CLA_Egress(&Instance, 0, OutputBuffer, &Size, sizeof(OutputBuffer), 0), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Size, 10);
+    UtAssert_STUB_COUNT(BPLib_BI_FragmentTrim, 1);
+    UtAssert_UINT32_EQ(BPLib_CLA_Test_TrimOffset, 400);
+    UtAssert_STUB_COUNT(BPLib_STOR_StoreBundle, 1);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 0);
+
+    UT_SetHandlerFunction(UT_KEY(BPLib_QM_DuctPull), UT_Handler_BPLib_QM_DuctPull, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_QM_DuctPull), BPLIB_TIMEOUT);
+    UtAssert_INT32_EQ(BPLib_CLA_Egress(&Instance, 0, OutputBuffer, &Size, sizeof(OutputBuffer), 0), BPLIB_CLA_TIMEOUT);
+    UtAssert_STUB_COUNT(BPLib_BI_FragmentCopyOut, 1);
+}
+
 void Test_BPLib_CLA_ContactsTblValidateFunc_Nominal(void)
 {
     BPLib_Status_t ReturnStatus;
@@ -422,6 +1009,9 @@ void Test_BPLib_CLA_ContactSetup_Nominal(void)
 
     /* Verify that run state is setup */
     UtAssert_EQ(BPLib_CLA_ContactRunState_t, BPLib_CLA_ContactRunStates[ContactId], BPLIB_CLA_SETUP);
+
+    /* Verify that the contact's egress rate was set up */
+    UtAssert_STUB_COUNT(BPLib_TIME_ShaperInit, 1);
 }
 
 void Test_BPLib_CLA_ContactSetup_InvalidContactId(void)
@@ -756,9 +1346,407 @@ void Test_BPLib_CLA_ContactTeardown_InvalidRunState(void)
                                 "Contact with ID #%d needs to be stopped or set up first");
 }
 
+#if BPLIB_MAX_CONTACT_DEST_EIDS <= BPLIB_EID_PATTERN_SET_MAX
+
+void Test_BPLib_CLA_RefreshRoutes_Nominal(void)
+{
+    static BPLib_CLA_ContactsTable_t TestContactsTbl;
+
+    BPLib_NC_ConfigPtrs.ContactsConfigPtr = &TestContactsTbl;
+
+    BPLib_CLA_RefreshRoutes();
+
+    UtAssert_STUB_COUNT(BPLib_EID_PatternSetCompile, BPLIB_CLA_NUM_ROUTE_SETS);
+}
+
+void Test_BPLib_CLA_RefreshRoutes_NullTable(void)
+{
+    BPLib_NC_ConfigPtrs.ContactsConfigPtr = NULL;
+
+    BPLib_CLA_RefreshRoutes();
+
+    UtAssert_STUB_COUNT(BPLib_EID_PatternSetCompile, BPLIB_CLA_NUM_ROUTE_SETS);
+}
+
+void Test_BPLib_CLA_FindContactRoutes_Nominal(void)
+{
+    BPLib_EID_t DestEID;
+    uint64_t    ExpRoutes = BPLIB_CLA_CONTACT_ROUTE_MASK(0);
+
+    memset(&DestEID, 0, sizeof(DestEID));
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_PatternSetMatch), ExpRoutes);
+
+    UtAssert_EQ(uint64_t, BPLib_CLA_FindContactRoutes(&DestEID, 0), ExpRoutes);
+    UtAssert_STUB_COUNT(BPLib_EID_PatternSetMatch, 1);
+}
+
+#else
+
+void Test_BPLib_CLA_FindContactRoutes_Nominal(void)
+{
+    static BPLib_CLA_ContactsTable_t TestContactsTbl;
+    BPLib_EID_t DestEID;
+
+    memset(&DestEID, 0, sizeof(DestEID));
+    BPLib_NC_ConfigPtrs.ContactsConfigPtr = &TestContactsTbl;
+
+    /* Each contact's patterns are matched one at a time, stopping at the first match */
+    UT_SetDeferredRetcode(UT_KEY(BPLib_EID_PatternIsMatch), 2, true);
+    UtAssert_EQ(uint64_t, BPLib_CLA_FindContactRoutes(&DestEID, 0), BPLIB_CLA_CONTACT_ROUTE_MASK(0));
+    UtAssert_STUB_COUNT(BPLib_EID_PatternIsMatch, 2);
+
+    UtAssert_EQ(uint64_t, BPLib_CLA_FindContactRoutes(&DestEID, 0), 0);
+    UtAssert_STUB_COUNT(BPLib_EID_PatternIsMatch, 2 + BPLIB_MAX_CONTACT_DEST_EIDS);
+}
+
+#endif
+
+void Test_BPLib_CLA_FindContactRoutes_InvalidContact(void)
+{
+    BPLib_EID_t DestEID;
+
+    memset(&DestEID, 0, sizeof(DestEID));
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_EID_PatternSetMatch), BPLIB_CLA_CONTACT_ROUTE_MASK(0));
+
+    UtAssert_EQ(uint64_t, BPLib_CLA_FindContactRoutes(&DestEID, BPLIB_MAX_NUM_CONTACTS), 0);
+    UtAssert_STUB_COUNT(BPLib_EID_PatternSetMatch, 0);
+}
+
+void Test_BPLib_CLA_ContactPlanTblValidateFunc_Nominal(void)
+{
+    BPLib_CLA_ContactPlanTable_t TestPlanTbl;
+
+    memset(&TestPlanTbl, 0, sizeof(TestPlanTbl));
+    TestPlanTbl.Windows[0].StartTime = 1000;
+    TestPlanTbl.Windows[0].EndTime   = 2000;
+    TestPlanTbl.Windows[1].StartTime = 2000;
+    TestPlanTbl.Windows[1].EndTime   = 3000;
+
+    UtAssert_INT32_EQ(BPLib_CLA_ContactPlanTblValidateFunc(&TestPlanTbl), BPLIB_SUCCESS);
+}
+
+void Test_BPLib_CLA_ContactPlanTblValidateFunc_InvContactId(void)
+{
+    BPLib_CLA_ContactPlanTable_t TestPlanTbl;
+
+    memset(&TestPlanTbl, 0, sizeof(TestPlanTbl));
+    TestPlanTbl.Windows[0].ContactId = BPLIB_MAX_NUM_CONTACTS;
+    TestPlanTbl.Windows[0].StartTime = 1000;
+    TestPlanTbl.Windows[0].EndTime   = 2000;
+
+    UtAssert_INT32_EQ(BPLib_CLA_ContactPlanTblValidateFunc(&TestPlanTbl), BPLIB_INVALID_CONFIG_ERR);
+}
+
+void Test_BPLib_CLA_ContactPlanTblValidateFunc_InvWindow(void)
+{
+    BPLib_CLA_ContactPlanTable_t TestPlanTbl;
+
+    memset(&TestPlanTbl, 0, sizeof(TestPlanTbl));
+    TestPlanTbl.Windows[0].StartTime = 2000;
+    TestPlanTbl.Windows[0].EndTime   = 2000;
+
+    UtAssert_INT32_EQ(BPLib_CLA_ContactPlanTblValidateFunc(&TestPlanTbl), BPLIB_INVALID_CONFIG_ERR);
+}
+
+void Test_BPLib_CLA_ContactPlanTblValidateFunc_Overlap(void)
+{
+    BPLib_CLA_ContactPlanTable_t TestPlanTbl;
+
+    memset(&TestPlanTbl, 0, sizeof(TestPlanTbl));
+    TestPlanTbl.Windows[0].StartTime = 1000;
+    TestPlanTbl.Windows[0].EndTime   = 2000;
+    TestPlanTbl.Windows[3].StartTime = 1999;
+    TestPlanTbl.Windows[3].EndTime   = 3000;
+
+    UtAssert_INT32_EQ(BPLib_CLA_ContactPlanTblValidateFunc(&TestPlanTbl), BPLIB_INVALID_CONFIG_ERR);
+}
+
+void Test_BPLib_CLA_ProcessContactPlan_NullInst(void)
+{
+    UtAssert_INT32_EQ(BPLib_CLA_ProcessContactPlan(NULL), BPLIB_NULL_PTR_ERROR);
+    UtAssert_STUB_COUNT(BPLib_TIME_GetCurrentDtnTime, 0);
+}
+
+void Test_BPLib_CLA_ProcessContactPlan_NoDtnTime(void)
+{
+    BPLib_Instance_t Inst;
+    BPLib_CLA_ContactPlanTable_t TestPlanTbl;
+
+    memset(&TestPlanTbl, 0, sizeof(TestPlanTbl));
+    TestPlanTbl.Windows[0].StartTime = 1000;
+    TestPlanTbl.Windows[0].EndTime   = 2000;
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = &TestPlanTbl;
+    BPLib_CLA_RefreshContactPlan();
+
+    /* Windows cannot be scheduled without a valid DTN time */
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 0);
+
+    UtAssert_INT32_EQ(BPLib_CLA_ProcessContactPlan(&Inst), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactSetup, 0);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactStart, 0);
+
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = NULL;
+}
+
+void Test_BPLib_CLA_ProcessContactPlan_NoPlan(void)
+{
+    BPLib_Instance_t Inst;
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 1500);
+
+    UtAssert_INT32_EQ(BPLib_CLA_ProcessContactPlan(&Inst), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactSetup, 0);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactStart, 0);
+}
+
+void Test_BPLib_CLA_ProcessContactPlan_Preload(void)
+{
+    BPLib_Instance_t Inst;
+    BPLib_CLA_ContactPlanTable_t TestPlanTbl;
+
+    memset(&TestPlanTbl, 0, sizeof(TestPlanTbl));
+    TestPlanTbl.Windows[0].StartTime = BPLIB_CLA_PLAN_PRELOAD_MS + 1000;
+    TestPlanTbl.Windows[0].EndTime   = BPLIB_CLA_PLAN_PRELOAD_MS + 2000;
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = &TestPlanTbl;
+    BPLib_CLA_RefreshContactPlan();
+
+    BPLib_CLA_ContactRunStates[0] = BPLIB_CLA_TORNDOWN;
+
+    /* Too early to preload */
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 500);
+    UtAssert_INT32_EQ(BPLib_CLA_ProcessContactPlan(&Inst), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactSetup, 0);
+
+    /* Within the preload lead time the contact is set up and its duct loaded, but not started */
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 1000);
+    UtAssert_INT32_EQ(BPLib_CLA_ProcessContactPlan(&Inst), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactSetup, 1);
+    UtAssert_STUB_COUNT(BPLib_STOR_EgressForID, 2);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactStart, 0);
+    UtAssert_EQ(BPLib_CLA_ContactRunState_t, BPLib_CLA_ContactRunStates[0], BPLIB_CLA_SETUP);
+
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = NULL;
+}
+
+void Test_BPLib_CLA_ProcessContactPlan_OpenAndClose(void)
+{
+    BPLib_Instance_t Inst;
+    BPLib_CLA_EgressWindow_t Window;
+    BPLib_CLA_ContactPlanTable_t TestPlanTbl;
+
+    memset(&TestPlanTbl, 0, sizeof(TestPlanTbl));
+    TestPlanTbl.Windows[0].StartTime          = 1000;
+    TestPlanTbl.Windows[0].EndTime            = 2000;
+    TestPlanTbl.Windows[0].EgressBitsPerCycle = 8000;
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = &TestPlanTbl;
+    BPLib_CLA_RefreshContactPlan();
+
+    BPLib_CLA_ContactRunStates[0] = BPLIB_CLA_SETUP;
+
+    /* The window opens at the window's rate and wakes the CL */
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 1000);
+    UtAssert_INT32_EQ(BPLib_CLA_ProcessContactPlan(&Inst), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPLib_TIME_ShaperInit, 1);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactStart, 1);
+    UtAssert_STUB_COUNT(BPLib_QM_WaitQueueWake, 1);
+    UtAssert_EQ(BPLib_CLA_ContactRunState_t, BPLib_CLA_ContactRunStates[0], BPLIB_CLA_STARTED);
+    BPLib_CLA_Test_Verify_Event(0, BPLIB_CLA_PLAN_WINDOW_INF_EID, "Contact plan started contact #%d");
+
+    /* Storage sees the window's span */
+    UtAssert_INT32_EQ(BPLib_CLA_GetEgressWindow(0, &Window), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Window.StartTime, 1000);
+    UtAssert_UINT32_EQ(Window.EndTime, 2000);
+
+    /* An open window is not started again */
+    UtAssert_INT32_EQ(BPLib_CLA_ProcessContactPlan(&Inst), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactStart, 1);
+
+    /* The contact is stopped and torn down once the window ends */
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 2000);
+    UtAssert_INT32_EQ(BPLib_CLA_ProcessContactPlan(&Inst), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactStop, 1);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactTeardown, 1);
+    UtAssert_EQ(BPLib_CLA_ContactRunState_t, BPLib_CLA_ContactRunStates[0], BPLIB_CLA_TORNDOWN);
+    BPLib_CLA_Test_Verify_Event(1, BPLIB_CLA_PLAN_WINDOW_INF_EID, "Contact plan stopped contact #%d");
+    UtAssert_INT32_EQ(BPLib_CLA_GetEgressWindow(0, &Window), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Window.EndTime, 0);
+
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = NULL;
+}
+
+void Test_BPLib_CLA_ProcessContactPlan_ReloadDuringWindow(void)
+{
+    BPLib_Instance_t Inst;
+    BPLib_CLA_EgressWindow_t Window;
+    BPLib_CLA_ContactPlanTable_t TestPlanTbl;
+    BPLib_CLA_ContactPlanTable_t ReloadPlanTbl;
+
+    memset(&TestPlanTbl, 0, sizeof(TestPlanTbl));
+    TestPlanTbl.Windows[0].StartTime = 1000;
+    TestPlanTbl.Windows[0].EndTime   = 2000;
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = &TestPlanTbl;
+    BPLib_CLA_RefreshContactPlan();
+
+    BPLib_CLA_ContactRunStates[0] = BPLIB_CLA_SETUP;
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 1500);
+    UtAssert_INT32_EQ(BPLib_CLA_ProcessContactPlan(&Inst), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactStart, 1);
+
+    /* A reload that keeps the open window leaves its contact running */
+    memcpy(&ReloadPlanTbl, &TestPlanTbl, sizeof(ReloadPlanTbl));
+    ReloadPlanTbl.Windows[1].StartTime = BPLIB_CLA_PLAN_PRELOAD_MS + 3000;
+    ReloadPlanTbl.Windows[1].EndTime   = BPLIB_CLA_PLAN_PRELOAD_MS + 4000;
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = &ReloadPlanTbl;
+    BPLib_CLA_RefreshContactPlan();
+    UtAssert_INT32_EQ(BPLib_CLA_ProcessContactPlan(&Inst), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactStart, 1);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactStop, 0);
+    UtAssert_EQ(BPLib_CLA_ContactRunState_t, BPLib_CLA_ContactRunStates[0], BPLIB_CLA_STARTED);
+
+    /* A reload that drops the open window stops and tears down its contact */
+    memset(&TestPlanTbl, 0, sizeof(TestPlanTbl));
+    TestPlanTbl.Windows[0].StartTime = BPLIB_CLA_PLAN_PRELOAD_MS + 3000;
+    TestPlanTbl.Windows[0].EndTime   = BPLIB_CLA_PLAN_PRELOAD_MS + 4000;
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = &TestPlanTbl;
+    BPLib_CLA_RefreshContactPlan();
+    UtAssert_INT32_EQ(BPLib_CLA_ProcessContactPlan(&Inst), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactStop, 1);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactTeardown, 1);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactStart, 1);
+    UtAssert_EQ(BPLib_CLA_ContactRunState_t, BPLib_CLA_ContactRunStates[0], BPLIB_CLA_TORNDOWN);
+    UtAssert_INT32_EQ(BPLib_CLA_GetEgressWindow(0, &Window), BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Window.EndTime, 0);
+
+    /* Nothing is closed twice once the dropped window is gone */
+    UtAssert_INT32_EQ(BPLib_CLA_ProcessContactPlan(&Inst), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactStop, 1);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactTeardown, 1);
+
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = NULL;
+}
+
+void Test_BPLib_CLA_ProcessContactPlan_CloseReturnsHeld(void)
+{
+    BPLib_Instance_t Inst;
+    BPLib_Bundle_t   Bundles[3];
+    BPLib_Bundle_t  *BundlePtrs[3] = { &Bundles[0], &Bundles[1], &Bundles[2] };
+    uint8_t          OutputBuffer[40];
+    size_t           Sizes[4];
+    uint32_t         NumBundles;
+    BPLib_CLA_ContactPlanTable_t TestPlanTbl;
+
+    memset(&TestPlanTbl, 0, sizeof(TestPlanTbl));
+    TestPlanTbl.Windows[0].StartTime = 1000;
+    TestPlanTbl.Windows[0].EndTime   = 2000;
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = &TestPlanTbl;
+    BPLib_CLA_RefreshContactPlan();
+
+    BPLib_CLA_ContactRunStates[0] = BPLIB_CLA_SETUP;
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 1000);
+    UtAssert_INT32_EQ(BPLib_CLA_ProcessContactPlan(&Inst), BPLIB_SUCCESS);
+
+    /* The egress task holds back the two bundles that did not fit */
+    UT_SetDataBuffer(UT_KEY(BPLib_QM_DuctPullBatch), BundlePtrs, sizeof(BundlePtrs), false);
+    UT_SetHandlerFunction(UT_KEY(BPLib_BI_BlobCopyOut), UT_Handler_BPLib_BI_BlobCopyOut_TenBytes, NULL);
+    UT_SetDeferredRetcode(UT_KEY(BPLib_BI_BlobCopyOut), 2, BPLIB_BUF_LEN_ERROR);
+    UtAssert_INT32_EQ(BPLib_CLA_EgressBatch(&Inst, 0, OutputBuffer, sizeof(OutputBuffer), Sizes, 4, &NumBundles, 0),
+                      BPLIB_SUCCESS);
+    UtAssert_UINT32_EQ(NumBundles, 1);
+
+    /* Closing the window returns them to storage */
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 2000);
+    UtAssert_INT32_EQ(BPLib_CLA_ProcessContactPlan(&Inst), BPLIB_SUCCESS);
+    UtAssert_EQ(BPLib_CLA_ContactRunState_t, BPLib_CLA_ContactRunStates[0], BPLIB_CLA_TORNDOWN);
+    UtAssert_STUB_COUNT(BPLib_STOR_StoreBundle, 2);
+    UtAssert_STUB_COUNT(BPLib_MEM_BundleFree, 1);
+
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = NULL;
+}
+
+void Test_BPLib_CLA_ProcessContactPlan_StartFail(void)
+{
+    BPLib_Instance_t Inst;
+    BPLib_CLA_ContactPlanTable_t TestPlanTbl;
+
+    memset(&TestPlanTbl, 0, sizeof(TestPlanTbl));
+    TestPlanTbl.Windows[0].StartTime = 1000;
+    TestPlanTbl.Windows[0].EndTime   = 2000;
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = &TestPlanTbl;
+    BPLib_CLA_RefreshContactPlan();
+
+    BPLib_CLA_ContactRunStates[0] = BPLIB_CLA_TORNDOWN;
+    UT_SetDefaultReturnValue(UT_KEY(BPA_CLAP_ContactSetup), BPLIB_CLA_IO_ERROR);
+
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 1500);
+    UtAssert_INT32_EQ(BPLib_CLA_ProcessContactPlan(&Inst), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactStart, 0);
+    UtAssert_STUB_COUNT(BPLib_QM_WaitQueueWake, 0);
+    BPLib_CLA_Test_Verify_Event(UT_GetStubCount(UT_KEY(BPLib_EM_SendEvent)) - 1, BPLIB_CLA_PLAN_WINDOW_ERR_EID,
+                                "Contact plan failed to start contact #%d, Status = %d");
+
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = NULL;
+}
+
+void Test_BPLib_CLA_ProcessContactPlan_AlreadyOver(void)
+{
+    BPLib_Instance_t Inst;
+    BPLib_CLA_ContactPlanTable_t TestPlanTbl;
+
+    memset(&TestPlanTbl, 0, sizeof(TestPlanTbl));
+    TestPlanTbl.Windows[0].StartTime = 1000;
+    TestPlanTbl.Windows[0].EndTime   = 2000;
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = &TestPlanTbl;
+    BPLib_CLA_RefreshContactPlan();
+
+    BPLib_CLA_ContactRunStates[0] = BPLIB_CLA_STARTED;
+
+    /* A window that ended before it was scheduled leaves the contact alone */
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 3000);
+    UtAssert_INT32_EQ(BPLib_CLA_ProcessContactPlan(&Inst), BPLIB_SUCCESS);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactStop, 0);
+    UtAssert_STUB_COUNT(BPA_CLAP_ContactStart, 0);
+    UtAssert_EQ(BPLib_CLA_ContactRunState_t, BPLib_CLA_ContactRunStates[0], BPLIB_CLA_STARTED);
+
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = NULL;
+}
+
+void Test_BPLib_CLA_GetEgressWindow_InputErrors(void)
+{
+    BPLib_CLA_EgressWindow_t Window;
+
+    UtAssert_INT32_EQ(BPLib_CLA_GetEgressWindow(0, NULL), BPLIB_NULL_PTR_ERROR);
+    UtAssert_INT32_EQ(BPLib_CLA_GetEgressWindow(BPLIB_MAX_NUM_CONTACTS, &Window), BPLIB_INVALID_CONT_ID_ERR);
+}
+
 void TestBplibCla_Register(void)
 {
+    ADD_TEST(Test_BPLib_CLA_Ingress_NullInstPtrError);
+    ADD_TEST(Test_BPLib_CLA_Ingress_NullInputBundleError);
+    ADD_TEST(Test_BPLib_CLA_Ingress_BadContId);
+    ADD_TEST(Test_BPLib_CLA_Ingress_ControlMessageNominal);
+    ADD_TEST(Test_BPLib_CLA_Ingress_NonControlMessageNominal);
+    ADD_TEST(Test_BPLib_CLA_Ingress_PoolCongested);
+
+    ADD_TEST(Test_BPLib_CLA_IngressBatch_InputErrors);
+    ADD_TEST(Test_BPLib_CLA_IngressBatch_Nominal);
+    ADD_TEST(Test_BPLib_CLA_IngressBatch_PoolCongested);
+
     ADD_TEST(Test_BPLib_CLA_Egress_Nominal);
+    ADD_TEST(Test_BPLib_CLA_Egress_RateLimited);
+
+    ADD_TEST(Test_BPLib_CLA_EgressBatch_InputErrors);
+    ADD_TEST(Test_BPLib_CLA_EgressBatch_QueuePullTimeout);
+    ADD_TEST(Test_BPLib_CLA_EgressBatch_Nominal);
+    ADD_TEST(Test_BPLib_CLA_EgressBatch_HoldsWhatDoesNotFit);
+    ADD_TEST(Test_BPLib_CLA_EgressBatch_RateLimited);
+    ADD_TEST(Test_BPLib_CLA_EgressBatch_TeardownDuringPull);
+    ADD_TEST(Test_BPLib_CLA_Egress_Fragments);
+    ADD_TEST(Test_BPLib_CLA_Egress_NoFragment);
+    ADD_TEST(Test_BPLib_CLA_EgressBatch_Fragments);
+    ADD_TEST(Test_BPLib_CLA_EgressBatch_FragmentsContinue);
+    ADD_TEST(Test_BPLib_CLA_EgressBatch_EgressMtu);
+    ADD_TEST(Test_BPLib_CLA_ContactTeardown_Fragmenting);
+    ADD_TEST(Test_BPLib_CLA_Egress_FragmentingTeardownDuringPull);
 
     ADD_TEST(Test_BPLib_CLA_ContactsTblValidateFunc_Nominal);
     ADD_TEST(Test_BPLib_CLA_ContactsTblValidateFunc_DtnDestEid);
@@ -785,4 +1773,26 @@ void TestBplibCla_Register(void)
     ADD_TEST(Test_BPLib_CLA_ContactTeardown_InvalidContactId);
     ADD_TEST(Test_BPLib_CLA_ContactTeardown_InvalidRunState);
     ADD_TEST(Test_BPLib_CLA_ContactTeardown_StorErr);
+
+#if BPLIB_MAX_CONTACT_DEST_EIDS <= BPLIB_EID_PATTERN_SET_MAX
+    ADD_TEST(Test_BPLib_CLA_RefreshRoutes_Nominal);
+    ADD_TEST(Test_BPLib_CLA_RefreshRoutes_NullTable);
+#endif
+    ADD_TEST(Test_BPLib_CLA_FindContactRoutes_Nominal);
+    ADD_TEST(Test_BPLib_CLA_FindContactRoutes_InvalidContact);
+
+    ADD_TEST(Test_BPLib_CLA_ContactPlanTblValidateFunc_Nominal);
+    ADD_TEST(Test_BPLib_CLA_ContactPlanTblValidateFunc_InvContactId);
+    ADD_TEST(Test_BPLib_CLA_ContactPlanTblValidateFunc_InvWindow);
+    ADD_TEST(Test_BPLib_CLA_ContactPlanTblValidateFunc_Overlap);
+    ADD_TEST(Test_BPLib_CLA_ProcessContactPlan_NullInst);
+    ADD_TEST(Test_BPLib_CLA_ProcessContactPlan_NoDtnTime);
+    ADD_TEST(Test_BPLib_CLA_ProcessContactPlan_NoPlan);
+    ADD_TEST(Test_BPLib_CLA_ProcessContactPlan_Preload);
+    ADD_TEST(Test_BPLib_CLA_ProcessContactPlan_OpenAndClose);
+    ADD_TEST(Test_BPLib_CLA_ProcessContactPlan_ReloadDuringWindow);
+    ADD_TEST(Test_BPLib_CLA_ProcessContactPlan_CloseReturnsHeld);
+    ADD_TEST(Test_BPLib_CLA_ProcessContactPlan_StartFail);
+    ADD_TEST(Test_BPLib_CLA_ProcessContactPlan_AlreadyOver);
+    ADD_TEST(Test_BPLib_CLA_GetEgressWindow_InputErrors);
 }
\ No newline at end of file
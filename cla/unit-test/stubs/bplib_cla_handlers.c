@@ -44,4 +44,16 @@ void UT_Handler_BPLib_CLA_Egress(void* UserObj, UT_EntryKey_t FuncKey, const UT_
     {
         UT_Stub_CopyToLocal(UT_KEY(BPLib_CLA_Egress), MsgSize, sizeof(size_t*));
     }
-}
\ No newline at end of file
+}
+
+void UT_Handler_BPLib_CLA_GetEgressWindow(void* UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t* Context)
+{
+    BPLib_CLA_EgressWindow_t* Window = UT_Hook_GetArgValueByName(Context, "Window", BPLib_CLA_EgressWindow_t*);
+    int32 Status;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+    if (Status >= 0)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(BPLib_CLA_GetEgressWindow), Window, sizeof(BPLib_CLA_EgressWindow_t));
+    }
+}
@@ -27,6 +27,22 @@
 #include "bplib_cla.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_CLA_ContactPlanTblValidateFunc()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_CLA_ContactPlanTblValidateFunc(void *TblData)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_CLA_ContactPlanTblValidateFunc, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_CLA_ContactPlanTblValidateFunc, void *, TblData);
+
+    UT_GenStub_Execute(BPLib_CLA_ContactPlanTblValidateFunc, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_CLA_ContactPlanTblValidateFunc, BPLib_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_CLA_ContactSetup()
@@ -130,6 +146,47 @@ BPLib_Status_t BPLib_CLA_Egress(BPLib_Instance_t *Inst, uint32_t ContId, void *B
     return UT_GenStub_GetReturnValue(BPLib_CLA_Egress, BPLib_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_CLA_EgressBatch()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_CLA_EgressBatch(BPLib_Instance_t *Inst, uint32_t ContId, void *BundlesOut, size_t BufLen,
+                                     size_t *Sizes, uint32_t MaxBundles, uint32_t *NumBundles, uint32_t Timeout)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_CLA_EgressBatch, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_CLA_EgressBatch, BPLib_Instance_t *, Inst);
+    UT_GenStub_AddParam(BPLib_CLA_EgressBatch, uint32_t, ContId);
+    UT_GenStub_AddParam(BPLib_CLA_EgressBatch, void *, BundlesOut);
+    UT_GenStub_AddParam(BPLib_CLA_EgressBatch, size_t, BufLen);
+    UT_GenStub_AddParam(BPLib_CLA_EgressBatch, size_t *, Sizes);
+    UT_GenStub_AddParam(BPLib_CLA_EgressBatch, uint32_t, MaxBundles);
+    UT_GenStub_AddParam(BPLib_CLA_EgressBatch, uint32_t *, NumBundles);
+    UT_GenStub_AddParam(BPLib_CLA_EgressBatch, uint32_t, Timeout);
+
+    UT_GenStub_Execute(BPLib_CLA_EgressBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_CLA_EgressBatch, BPLib_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_CLA_FindContactRoutes()
+ * ----------------------------------------------------
+ */
+uint64_t BPLib_CLA_FindContactRoutes(const BPLib_EID_t *DestEID, uint32_t ContactId)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_CLA_FindContactRoutes, uint64_t);
+
+    UT_GenStub_AddParam(BPLib_CLA_FindContactRoutes, const BPLib_EID_t *, DestEID);
+    UT_GenStub_AddParam(BPLib_CLA_FindContactRoutes, uint32_t, ContactId);
+
+    UT_GenStub_Execute(BPLib_CLA_FindContactRoutes, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_CLA_FindContactRoutes, uint64_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_CLA_GetContactRunState()
@@ -147,6 +204,23 @@ BPLib_Status_t BPLib_CLA_GetContactRunState(uint32_t ContactId, BPLib_CLA_Contac
     return UT_GenStub_GetReturnValue(BPLib_CLA_GetContactRunState, BPLib_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_CLA_GetEgressWindow()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_CLA_GetEgressWindow(uint32_t ContactId, BPLib_CLA_EgressWindow_t *Window)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_CLA_GetEgressWindow, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_CLA_GetEgressWindow, uint32_t, ContactId);
+    UT_GenStub_AddParam(BPLib_CLA_GetEgressWindow, BPLib_CLA_EgressWindow_t *, Window);
+
+    UT_GenStub_Execute(BPLib_CLA_GetEgressWindow, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_CLA_GetEgressWindow, BPLib_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for BPLib_CLA_Ingress()
@@ -166,4 +240,62 @@ BPLib_Status_t BPLib_CLA_Ingress(BPLib_Instance_t *Inst, uint32_t ContId, const
     UT_GenStub_Execute(BPLib_CLA_Ingress, Basic, NULL);
 
     return UT_GenStub_GetReturnValue(BPLib_CLA_Ingress, BPLib_Status_t);
-}
\ No newline at end of file
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_CLA_IngressBatch()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_CLA_IngressBatch(BPLib_Instance_t *Inst, uint32_t ContId, const void *const *Bundles,
+                                      const size_t *Sizes, uint32_t NumBundles, uint32_t *NumAccepted)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_CLA_IngressBatch, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_CLA_IngressBatch, BPLib_Instance_t *, Inst);
+    UT_GenStub_AddParam(BPLib_CLA_IngressBatch, uint32_t, ContId);
+    UT_GenStub_AddParam(BPLib_CLA_IngressBatch, const void *const *, Bundles);
+    UT_GenStub_AddParam(BPLib_CLA_IngressBatch, const size_t *, Sizes);
+    UT_GenStub_AddParam(BPLib_CLA_IngressBatch, uint32_t, NumBundles);
+    UT_GenStub_AddParam(BPLib_CLA_IngressBatch, uint32_t *, NumAccepted);
+
+    UT_GenStub_Execute(BPLib_CLA_IngressBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_CLA_IngressBatch, BPLib_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_CLA_ProcessContactPlan()
+ * ----------------------------------------------------
+ */
+BPLib_Status_t BPLib_CLA_ProcessContactPlan(BPLib_Instance_t *Inst)
+{
+    UT_GenStub_SetupReturnBuffer(BPLib_CLA_ProcessContactPlan, BPLib_Status_t);
+
+    UT_GenStub_AddParam(BPLib_CLA_ProcessContactPlan, BPLib_Instance_t *, Inst);
+
+    UT_GenStub_Execute(BPLib_CLA_ProcessContactPlan, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(BPLib_CLA_ProcessContactPlan, BPLib_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_CLA_RefreshContactPlan()
+ * ----------------------------------------------------
+ */
+void BPLib_CLA_RefreshContactPlan(void)
+{
+    UT_GenStub_Execute(BPLib_CLA_RefreshContactPlan, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for BPLib_CLA_RefreshRoutes()
+ * ----------------------------------------------------
+ */
+void BPLib_CLA_RefreshRoutes(void)
+{
+    UT_GenStub_Execute(BPLib_CLA_RefreshRoutes, Basic, NULL);
+}
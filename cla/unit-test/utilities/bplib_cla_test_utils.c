@@ -56,14 +56,27 @@ void BPLib_CLA_Test_Setup(void)
     /* Prime the Contacts Configuration to return valid values */
     memset((void*) &TestContactsTbl,  0, sizeof(BPLib_CLA_ContactsTable_t));
     BPLib_NC_ConfigPtrs.ContactsConfigPtr = &TestContactsTbl;
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = NULL;
 
     UT_SetHandlerFunction(UT_KEY(BPLib_QM_DuctPull), UT_Handler_BPLib_QM_DuctPull, NULL);
+    UT_SetHandlerFunction(UT_KEY(BPLib_QM_DuctPullBatch), UT_Handler_BPLib_QM_DuctPullBatch, NULL);
     UT_SetHandlerFunction(UT_KEY(BPLib_EM_SendEvent), UT_Handler_BPLib_EM_SendEvent, NULL);
 }
 
 void BPLib_CLA_Test_Teardown(void)
 {
+    BPLib_Instance_t Inst;
+    BPLib_CLA_ContactPlanTable_t EmptyPlanTbl;
+
     /* Clean up test environment */
+
+    /* Load an empty contact plan so windows a test left open are not closed in the next test */
+    memset(&EmptyPlanTbl, 0, sizeof(EmptyPlanTbl));
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = &EmptyPlanTbl;
+    BPLib_CLA_RefreshContactPlan();
+    UT_SetDefaultReturnValue(UT_KEY(BPLib_TIME_GetCurrentDtnTime), 1);
+    (void) BPLib_CLA_ProcessContactPlan(&Inst);
+    BPLib_NC_ConfigPtrs.ContactPlanConfigPtr = NULL;
 }
 
 void UtTest_Setup(void)
@@ -146,9 +146,9 @@ typedef enum
 #define BPLIB_INVALID_CONT_ID_ERR                      ((BPLib_Status_t) -14) /* Invalid Contact ID */
 #define BPLIB_INVALID_CONFIG_ERR                       ((BPLib_Status_t) -15) /* Invalid configuration */
 #define BPLIB_APP_STATE_ERR                            ((BPLib_Status_t) -16) /* Invalid application state */
+#define BPLIB_EID_PATTERN_SET_TOO_BIG                  ((BPLib_Status_t) -17) /* More patterns than a compiled pattern set holds */
 /*
 
-#define BPLIB_GENERIC_ERROR_17              ((BPLib_Status_t) -17) // Error description
 #define BPLIB_GENERIC_ERROR_18              ((BPLib_Status_t) -18) // Error description
 #define BPLIB_GENERIC_ERROR_19              ((BPLib_Status_t) -19) // Error description
 #define BPLIB_GENERIC_ERROR_20              ((BPLib_Status_t) -20) // Error description
@@ -209,6 +209,12 @@ typedef enum
 /* MEM Errors */
 #define BPLIB_MEM_INITMEM_UNALIGN                      ((BPLib_Status_t) -56)
 #define BPLIB_MEM_CPY_FRM_OFFSET_NE_ERR                ((BPLib_Status_t) -57) /* BPLib_MEM_CopyOutFromOffset: bytes copied != requested */
+#define BPLIB_MEM_MAP_ERR                              ((BPLib_Status_t) -58) /* BPLib_MEM_PoolMapInit: anonymous mapping failed */
+#define BPLIB_MEM_POOL_CONGESTED                       ((BPLib_Status_t) -59) /* Ingress shed: pool is above its high watermark */
+
+/* PerfLog Proxy Errors, continued */
+#define BPLIB_PL_INVALID_LATENCY_ID                    ((BPLib_Status_t) -60) /* Latency histogram ID is out of range */
+#define BPLIB_PL_INVALID_TRACE_RING                    ((BPLib_Status_t) -61) /* Trace ring index is out of range */
 
 /* Node Config Errors */
 #define BPLIB_NC_TBL_UPDATE_ERR                        ((BPLib_Status_t) -80)
@@ -282,6 +288,8 @@ typedef enum
 #define BPLIB_CBOR_DEC_TYPES_CRC_32_LEN_ERR            ((BPLib_Status_t) -175) /* CBOR decode types error: CRC Val length not 32 */
 #define BPLIB_CBOR_DEC_TYPES_CRC_UNSUPPORTED_TYPE_ERR  ((BPLib_Status_t) -176) /* CBOR decode types error: CRC Val type */
 #define BPLIB_CBOR_DEC_TYPES_EID_DTN_ERR               ((BPLib_Status_t) -177) /* CBOR decode types error: DTN EID decode failed */
+#define BPLIB_CBOR_DEC_PRIM_FRAG_OFFSET_DEC_ERR        ((BPLib_Status_t) -178) /* CBOR primary block decode error: decode fragment offset field */
+#define BPLIB_CBOR_DEC_PRIM_ADU_LEN_DEC_ERR            ((BPLib_Status_t) -179) /* CBOR primary block decode error: decode total ADU length field */
 
 /* CBOR Encode Errors */
 #define BPLIB_CBOR_ENC_EXT_SIZES_CRRPTD_ERR            ((BPLib_Status_t) -188) /* BPLib_CBOR_EncodeExtensionBlock: Block Sizes Corrupted Error */
@@ -329,6 +337,9 @@ typedef enum
 /* Bundle Interface Errors */
 #define BPLIB_BI_INVALID_BUNDLE_ERR                    ((BPLib_Status_t) -250)
 #define BPLIB_BI_EXPIRED_BUNDLE_ERR                    ((BPLib_Status_t) -251)
+#define BPLIB_BI_DUPLICATE_BUNDLE_ERR                  ((BPLib_Status_t) -252)
+#define BPLIB_BI_FRAG_NO_ROOM_ERR                      ((BPLib_Status_t) -253)
+#define BPLIB_BI_FRAGMENT_ERR                          ((BPLib_Status_t) -254)
 
 /** @} */
 
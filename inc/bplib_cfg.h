@@ -64,6 +64,17 @@ extern "C" {
  */
 #define BPLIB_MAX_CONTACT_DEST_EIDS             3
 
+/**
+ * \brief Maximum number of contact windows in the contact plan
+ */
+#define BPLIB_MAX_NUM_CONTACT_WINDOWS           16
+
+/**
+ * \brief How long, in milliseconds, before a planned contact window opens that the contact
+ *        is set up and its egress queue is preloaded from storage
+ */
+#define BPLIB_CLA_PLAN_PRELOAD_MS               5000
+
 /** 
  * \brief Maximum number of channels that can be running at once
  *          This drives the number of entries in the channel and ADU proxy configuration
@@ -182,6 +193,178 @@ extern "C" {
  */
 #define BPLIB_SUPPORTED_CLAS                    "UDP"
 
+/**
+ *  \brief Time constant, in milliseconds, of the moving average used for the throughput
+ *         rates in the node MIB reports and channel/contact status telemetry
+ */
+#define BPLIB_AS_RATE_WINDOW_MS                 10000
+
+/**
+ *  \brief Minimum time, in milliseconds, between throughput rate samples. Rate updates
+ *         requested sooner than this keep accumulating into the next sample.
+ */
+#define BPLIB_AS_RATE_MIN_SAMPLE_MS             100
+
+/**
+ *  \brief Number of entries in the hash table that maps source EIDs to source MIB sets.
+ *         Must be a power of two.
+ */
+#define BPLIB_AS_SRC_CACHE_SIZE                 256
+
+/**
+ *  \brief Number of consecutive source hash table entries probed for an EID before the
+ *         least recently used one is evicted
+ */
+#define BPLIB_AS_SRC_CACHE_PROBES               8
+
+/**
+ *  \brief Latency histograms split every power of two into 2^N linear buckets. Higher values
+ *         give finer resolution at the cost of memory.
+ */
+#define BPLIB_PL_LATENCY_SUB_BUCKET_BITS        2
+
+/**
+ *  \brief Latencies of 2^N nanoseconds or more all land in the last latency histogram bucket
+ */
+#define BPLIB_PL_LATENCY_MAX_BITS               36
+
+/**
+ *  \brief Maximum number of threads that get their own bundle trace ring. Trace points hit
+ *         by any further threads are dropped.
+ */
+#define BPLIB_PL_TRACE_MAX_THREADS              8
+
+/**
+ *  \brief Number of records held by each bundle trace ring, must be a power of two
+ */
+#define BPLIB_PL_TRACE_RING_SIZE                512
+
+/**
+ *  \brief Whether bundle tracing is enabled at startup (1) or must be enabled at runtime (0)
+ */
+#define BPLIB_PL_TRACE_DEFAULT_ENABLED          1
+
+/**
+ *  \brief Number of per-event ID rate limit/filter entries, must be a power of two. Event
+ *         IDs that are equal modulo this size share an entry.
+ */
+#define BPLIB_EM_FILTER_TABLE_SIZE              256
+
+/**
+ *  \brief Rate limiting window for events, in milliseconds
+ */
+#define BPLIB_EM_RATE_WINDOW_MS                 1000
+
+/**
+ *  \brief Maximum number of events sent per event ID per rate limiting window, 0 disables
+ *         rate limiting. Further events in the window are counted and dropped before they
+ *         are formatted.
+ */
+#define BPLIB_EM_RATE_LIMIT                     10
+
+/**
+ *  \brief Number of events the deferred event ring can hold, must be a power of two
+ */
+#define BPLIB_EM_DEFERRED_RING_SIZE             64
+
+/**
+ *  \brief Maximum number of format arguments captured for a deferred event. Events with
+ *         more arguments are formatted immediately.
+ */
+#define BPLIB_EM_DEFERRED_MAX_ARGS              6
+
+/**
+ *  \brief Bytes available per deferred event for copies of string arguments
+ */
+#define BPLIB_EM_DEFERRED_STR_SIZE              64
+
+/**
+ *  \brief Whether monotonic time is read from a host clock calibrated against the
+ *         BPA_TIMEP_GetMonotonicTime proxy (1) or from the proxy on every call (0). The
+ *         host clock is only used when the platform provides clock_gettime.
+ */
+#define BPLIB_TIME_FAST_CLOCK                   1
+
+/**
+ *  \brief Coarsest host clock resolution, in milliseconds, accepted for monotonic time.
+ *         The cheaper coarse clock is used when its resolution is within this value,
+ *         otherwise the precise host clock is used. Recalibrations that move the clock by
+ *         this amount or less are ignored.
+ */
+#define BPLIB_TIME_FAST_CLOCK_RESOLUTION_MS     4
+
+/**
+ *  \brief Length of the cycle, in milliseconds, that the IngressBitsPerCycle and
+ *         EgressBitsPerCycle rates of contacts and channels are given per
+ */
+#define BPLIB_RATE_CYCLE_MS                     1000
+
+/**
+ *  \brief Depth of the egress rate shaping token buckets, in milliseconds worth of the
+ *         configured rate. This is how large a burst an idle contact or channel may send
+ *         at once.
+ */
+#define BPLIB_RATE_BURST_MS                     100
+
+/**
+ *  \brief Whether received bundles are checked for duplicates (1) or not (0). Bundles that
+ *         may have been seen before are confirmed against storage before being dropped.
+ */
+#define BPLIB_BI_DUP_FILTER                     1
+
+/**
+ *  \brief Number of partitions in the duplicate filter. Bundles go in the partition for
+ *         the period they expire in, and a partition is reused once its period is over.
+ */
+#define BPLIB_BI_DUP_PARTITIONS                 8
+
+/**
+ *  \brief Period of DTN time, in milliseconds, that each duplicate filter partition covers.
+ *         Bundles expiring after BPLIB_BI_DUP_PARTITIONS periods go in the last partition
+ *         and are forgotten when its period ends, so BPLIB_BI_DUP_PARTITIONS times this
+ *         should cover the longest bundle lifetime duplicates need to be caught for.
+ */
+#define BPLIB_BI_DUP_PARTITION_MS               900000
+
+/**
+ *  \brief Number of counters in each duplicate filter partition, must be a power of two.
+ *         Each counter is one byte.
+ */
+#define BPLIB_BI_DUP_COUNTERS                   32768
+
+/**
+ *  \brief Number of counters each bundle sets in its duplicate filter partition
+ */
+#define BPLIB_BI_DUP_HASHES                     4
+
+/**
+ *  \brief Smallest payload, in bytes, a fragment is made with. A fragment that would carry
+ *         less, unless it is the last, waits for an egress buffer with more room.
+ */
+#define BPLIB_BI_FRAG_MIN_PAYLOAD               64
+
+/**
+ *  \brief Number of bundles that can be reassembled from fragments at once
+ */
+#define BPLIB_PI_REASM_SLOTS                    8
+
+/**
+ *  \brief Most fragments held for any one bundle being reassembled
+ */
+#define BPLIB_PI_REASM_MAX_FRAGS                64
+
+/**
+ *  \brief Most ADU bytes reserved across all bundles being reassembled. Each bundle
+ *         reserves its total ADU length when its first fragment arrives.
+ */
+#define BPLIB_PI_REASM_MAX_BYTES                (1024 * 1024)
+
+/**
+ *  \brief Time, in milliseconds, a bundle being reassembled waits for its missing fragments
+ *         before the fragments it has are dropped
+ */
+#define BPLIB_PI_REASM_TIMEOUT_MS               60000
+
 /**
  *  \brief Maximum number of bundle bytes allowed in storage at any given time
  */
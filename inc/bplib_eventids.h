@@ -160,6 +160,8 @@
 #define BPLIB_CLA_CONTACT_NO_STATE_CHG_DBG_EID          (661u)
 #define BPLIB_CLA_INVALID_CONTACT_ID_DBG_EID            (662u)
 #define BPLIB_CLA_REMOVE_QUEUE_FLUSH_DGB_EID            (663u)
+#define BPLIB_CLA_PLAN_WINDOW_INF_EID                   (664u)
+#define BPLIB_CLA_PLAN_WINDOW_ERR_EID                   (665u)
 
 /* ============ */
 /* PI event IDs */